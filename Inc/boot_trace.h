@@ -0,0 +1,68 @@
+/*
+ * boot_trace.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Boot timeline. Each phase of the initialization is timestamped
+ *         with the DWT cycle counter when it ends, the timeline is printed
+ *         afterwards so the UART is not part of it.
+ */
+
+
+#ifndef BOOT_TRACE_H_
+#define BOOT_TRACE_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+/* Phases kept, the later ones are dropped */
+#define BOOT_TRACE_MAX_PHASES		16U
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* Starts the DWT cycle counter from 0, first thing in main: the startup
+ * code before main is not counted. The only place the counter is reset,
+ * everything else that times with it (GetCurrentTimeTicks, the profilers,
+ * ts_fifo) only takes differences */
+void boot_trace_init (void);
+
+/* Ends the phase named phase (a string literal, it is not copied) */
+void boot_trace_mark (const char * phase);
+
+/* Prints each phase, its length and its end since boot_trace_init, then the
+ * total */
+void boot_trace_print (void);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_TRACE_H_ */
@@ -0,0 +1,74 @@
+/*
+ * brush.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Stroke rendering with DMA2D. The pencil is rasterized once into
+ *         an anti-aliased A8 sprite and blended into the ARGB8888 or RGB565
+ *         layer 0 framebuffer (DMA2D_M2M_BLEND), one transfer per stamp,
+ *         chained from the DMA2D interrupt. In L8 the CPU blends it.
+ */
+
+
+#ifndef BRUSH_H_
+#define BRUSH_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+#define BRUSH_MAX_RADIUS			8U
+/* Stamps waiting for the DMA2D, power of 2 */
+#define BRUSH_QUEUE_SIZE			64U
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* Rasterizes the brush, radius up to BRUSH_MAX_RADIUS. The framebuffer has
+ * width pixels per line and height lines, in pixel_format:
+ * LTDC_PIXEL_FORMAT_ARGB8888, _RGB565 or _L8 */
+void brush_init (uint32_t radius, uint32_t framebuffer, uint32_t width, uint32_t height, uint32_t pixel_format);
+
+/* Queues a stamp centered at x, y in color (ARGB8888). A stamp the brush
+ * would not fit inside the framebuffer is dropped. Only waits if the queue
+ * is full */
+void brush_stamp (uint32_t x, uint32_t y, uint32_t color);
+
+/* Starts the DMA2D on the queued stamps, if it is not already running */
+void brush_flush (void);
+
+/* Flushes and waits until every stamp is in the framebuffer. Call before
+ * the CPU or another DMA2D user (BSP_LCD_*) touches the framebuffer */
+void brush_wait (void);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BRUSH_H_ */
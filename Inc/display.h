@@ -0,0 +1,93 @@
+/*
+ * display.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: LCD layer format. The LTDC reads the visible layer from SDRAM on
+ *         every refresh, 4, 2 or 1 byte per pixel in ARGB8888, RGB565 or
+ *         L8, on the bus the inference, the framebuffer readback and the
+ *         drawing share. The readback reads the layer format directly.
+ */
+
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+#define DISPLAY_ARGB8888			0U
+#define DISPLAY_RGB565				1U
+/* Luminance, the colors through the CLUT: the pen colors keep theirs, any
+ * other level is shown gray */
+#define DISPLAY_L8					2U
+#define DISPLAY_FORMATS				3U
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* Initializes the LCD with both layers in format: layer 1 keyed out and
+ * hidden, layer 0 selected and shown. In L8 the count colors of pens are
+ * shown in their own color. Both layers are then cleared white by the DMA2D
+ * in the background: call display_wait before drawing */
+void display_init (uint32_t format, const uint32_t * pens, uint32_t count);
+
+/* Starts the next clear when the DMA2D is done with the last one. Call it
+ * between the boot steps to keep the DMA2D busy */
+void display_poll (void);
+
+/* Returns when the layers are cleared */
+void display_wait (void);
+
+/* The format of layer 0 and its LTDC_PIXEL_FORMAT_xxx */
+uint32_t display_format (void);
+uint32_t display_pixel_format (void);
+const char * display_format_name (uint32_t format);
+
+/* Switches layer 0 to format without converting its pixels, or stops the
+ * LTDC from reading it. For the bus benchmark, the screen is garbled until
+ * the format is set back */
+void display_set_format (uint32_t format);
+void display_enable (uint8_t enable);
+
+/* Copies width x height pixels at x, y of layer 0 to rgb888, stored B, G, R
+ * as the DMA2D writes it. ARGB8888 and RGB565 only, converted by the DMA2D
+ * in one transfer: call brush_wait first */
+void display_read_rgb888 (uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t * rgb888);
+
+/* Copies width x height pixels at x, y of layer 0 to gray as 255 - L, the
+ * inverted gray level rgb2gray gives. L8 only */
+void display_read_gray (uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t * gray);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_H_ */
@@ -71,12 +71,25 @@
 #define WORKING_FRAME_BUFFER                   	 (LCD_FRAME_BUFFER+0x260000) //Here will be the working area saved
 #define GRAY_WORKING_FRAME_BUFFER				(LCD_FRAME_BUFFER+0x390000) // grayscale image
 #define TRANSFORMED_FRAME_BUFFER				(LCD_FRAME_BUFFER+0x4C0000) //Here will be the working area transformed in 28x28 image in grayscale
+#define TENSOR_ARENA_SDRAM						(LCD_FRAME_BUFFER+0x500000) // activations spilled from the on-chip arena
+#define TENSOR_ARENA_SDRAM_SIZE					0x300000
+#define TENSOR_ARENA_CCM						0x10000000U // 64K core coupled memory, CPU only, unused by the linker script
+#define TENSOR_ARENA_CCM_SIZE					0x10000U
+#define KERNEL_TABLE_FLASH_ADDR					0x081E0000U // last 128K sector, left out of ROM in the linker script
+#define KERNEL_TABLE_FLASH_SECTOR				FLASH_SECTOR_23
+#define TS_CALIBRATION_FLASH_ADDR				0x081C0000U // the sector before it, also left out of ROM
+#define TS_CALIBRATION_FLASH_SECTOR				FLASH_SECTOR_22
+
+/* Touchscreen_Calibration: where the calibration comes from */
+#define TS_CALIBRATION_LOADED					0U // from flash
+#define TS_CALIBRATION_STORED					1U // pressed, stored in flash
+#define TS_CALIBRATION_NOT_STORED				2U // pressed, storing it failed
 
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 
-void Touchscreen_Calibration (void);
+uint8_t Touchscreen_Calibration (void);
 uint16_t Calibration_GetX(uint16_t x);
 uint16_t Calibration_GetY(uint16_t y);
 uint8_t IsCalibrationDone(void);
@@ -0,0 +1,957 @@
+const unsigned char model_patched_tflite[] = {
+  0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xfc, 0x2b, 0x00, 0x00, 0xb8, 0x1c, 0x00, 0x00,
+  0xa0, 0x1c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
+  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x1c, 0x00, 0x00,
+  0x50, 0x1c, 0x00, 0x00, 0xb8, 0x1b, 0x00, 0x00, 0x64, 0x1b, 0x00, 0x00,
+  0x20, 0x1b, 0x00, 0x00, 0xfc, 0x1a, 0x00, 0x00, 0x28, 0x0f, 0x00, 0x00,
+  0xf4, 0x0d, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x86, 0xe4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x31, 0x2e, 0x35, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0xd9, 0xff, 0xff, 0x34, 0xd9, 0xff, 0xff,
+  0x38, 0xd9, 0xff, 0xff, 0x3c, 0xd9, 0xff, 0xff, 0x40, 0xd9, 0xff, 0xff,
+  0x44, 0xd9, 0xff, 0xff, 0xc6, 0xe4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x0d, 0x00, 0x00, 0xf3, 0xd2, 0xe9, 0x20, 0xec, 0xfd, 0x1d, 0xe2,
+  0xdd, 0xd4, 0x1b, 0x0c, 0x19, 0xe1, 0x48, 0x05, 0x1a, 0x07, 0x12, 0xd4,
+  0xff, 0xdc, 0xe1, 0xfc, 0x1d, 0x1c, 0x06, 0x1f, 0xf2, 0xe1, 0x1f, 0x61,
+  0x0d, 0x08, 0xe8, 0xf7, 0xf0, 0xe6, 0xe7, 0xb3, 0xf2, 0xd5, 0xff, 0xee,
+  0xec, 0xf6, 0xe9, 0xfb, 0xde, 0x17, 0x1f, 0x1f, 0x16, 0xce, 0x21, 0x07,
+  0x1f, 0xf4, 0xbb, 0xc9, 0x0f, 0x12, 0x3d, 0x14, 0x0b, 0x31, 0x06, 0x02,
+  0x3f, 0x20, 0xff, 0xdc, 0x29, 0xe6, 0x23, 0x06, 0x35, 0xed, 0xcd, 0x31,
+  0x1d, 0x3d, 0x22, 0x4b, 0x23, 0xf0, 0x46, 0x1a, 0xf8, 0x03, 0xe7, 0x98,
+  0x2d, 0x2c, 0x0c, 0x8e, 0xb5, 0x0b, 0xd0, 0xee, 0xdd, 0xe4, 0x02, 0xee,
+  0xd4, 0xe0, 0x2f, 0x1b, 0xf5, 0x29, 0xc5, 0xd9, 0xe6, 0x20, 0xfe, 0x1f,
+  0x15, 0xae, 0xbf, 0xf7, 0xfc, 0xdf, 0xfe, 0xea, 0xba, 0xf7, 0xd6, 0x05,
+  0x38, 0x47, 0x18, 0xfd, 0x7f, 0xd9, 0x28, 0xd8, 0x32, 0x85, 0x0d, 0x25,
+  0xfa, 0x14, 0xb0, 0x0c, 0x2f, 0xe7, 0x2a, 0x29, 0xd6, 0xb4, 0xf0, 0x3d,
+  0xfa, 0xf7, 0xd5, 0xb0, 0x3f, 0x1a, 0x13, 0x9e, 0xf2, 0x16, 0x03, 0xf0,
+  0x60, 0xdd, 0x5a, 0xe4, 0x19, 0xeb, 0x3d, 0x12, 0x18, 0x30, 0xb0, 0x19,
+  0x50, 0x01, 0x1d, 0x73, 0xc5, 0x22, 0x1f, 0x3c, 0xea, 0x11, 0xb5, 0x9e,
+  0x69, 0x17, 0x10, 0xc1, 0xec, 0x35, 0xfa, 0xf9, 0x34, 0x19, 0x47, 0xfb,
+  0x12, 0xd9, 0x15, 0x36, 0x3e, 0x14, 0xbd, 0xfd, 0x35, 0x25, 0xeb, 0x31,
+  0x0b, 0xcd, 0xf0, 0x1c, 0x12, 0x17, 0xfe, 0xab, 0x37, 0x1f, 0xdd, 0xe1,
+  0x04, 0x1e, 0x21, 0x18, 0x51, 0xc7, 0x11, 0xf3, 0x17, 0xc0, 0xf8, 0xf8,
+  0x36, 0xeb, 0xb6, 0x04, 0x3b, 0x02, 0x30, 0x4c, 0x16, 0xe1, 0xf7, 0x28,
+  0x21, 0xea, 0xd7, 0xd0, 0x3c, 0x0a, 0xdc, 0xdf, 0x0e, 0x25, 0x06, 0xba,
+  0x38, 0x27, 0x13, 0xc3, 0xc8, 0x21, 0xe2, 0x1c, 0xe9, 0xee, 0xc1, 0xf9,
+  0x22, 0xf1, 0x05, 0x19, 0xed, 0x15, 0xf3, 0x14, 0xd5, 0x28, 0xca, 0xe0,
+  0x15, 0x13, 0xca, 0xdb, 0xf2, 0x39, 0x03, 0xe9, 0xe3, 0x21, 0x3f, 0xd8,
+  0x30, 0xfd, 0x40, 0x0a, 0x34, 0x20, 0x9b, 0xfb, 0x1a, 0x1a, 0x15, 0xc8,
+  0xeb, 0x33, 0xef, 0x48, 0x1e, 0xe4, 0x3e, 0xed, 0x38, 0x22, 0x07, 0xdf,
+  0xcf, 0x1e, 0xea, 0xca, 0xd5, 0xf0, 0x21, 0x11, 0xda, 0x24, 0xfa, 0x2e,
+  0xff, 0xf7, 0xd9, 0xf0, 0x17, 0x2a, 0xc7, 0xb3, 0x14, 0xf5, 0xd9, 0x05,
+  0xf2, 0x07, 0x4d, 0xe4, 0x05, 0x0a, 0xc9, 0x24, 0xb7, 0x22, 0xd3, 0xd3,
+  0xfc, 0xcf, 0xdd, 0xd5, 0x15, 0x3e, 0x0d, 0xe5, 0x13, 0xda, 0xfd, 0xea,
+  0xef, 0xe1, 0xd5, 0xde, 0x13, 0x1f, 0xcb, 0xef, 0xef, 0x1f, 0xf4, 0xe4,
+  0x22, 0xe3, 0xeb, 0x14, 0x24, 0xf5, 0x1e, 0xfe, 0x85, 0x0c, 0x14, 0xc2,
+  0xeb, 0x0f, 0x01, 0x1f, 0xe2, 0x24, 0x37, 0x3e, 0xe4, 0x16, 0x11, 0x95,
+  0x10, 0x2a, 0x38, 0x31, 0x08, 0xcb, 0xeb, 0xec, 0x98, 0xe1, 0x1e, 0x21,
+  0xed, 0xf6, 0x03, 0x03, 0xd2, 0x34, 0x08, 0xb9, 0x17, 0xfe, 0x2d, 0xe5,
+  0xf8, 0x0f, 0x22, 0x2d, 0x15, 0x16, 0xd7, 0x87, 0x05, 0x15, 0x32, 0x1f,
+  0xf1, 0xc5, 0x05, 0x23, 0xd1, 0xd8, 0x1f, 0xf5, 0x54, 0xf7, 0x08, 0xf4,
+  0xc3, 0x09, 0xe2, 0xae, 0x04, 0xf1, 0xfd, 0x22, 0x25, 0x16, 0x2b, 0x0b,
+  0x28, 0x04, 0xfb, 0xf6, 0xee, 0xe6, 0x08, 0xff, 0x17, 0xfb, 0x0e, 0xf1,
+  0xd6, 0xee, 0xea, 0x05, 0x17, 0x1f, 0x2c, 0xf4, 0xee, 0x3f, 0x32, 0xd5,
+  0x25, 0xfd, 0x27, 0x1f, 0x2e, 0xef, 0x77, 0x11, 0x29, 0x0c, 0x24, 0xbc,
+  0x4d, 0xf5, 0x44, 0x1d, 0x1a, 0x20, 0x46, 0x30, 0xb2, 0x24, 0x26, 0x48,
+  0x09, 0x17, 0x05, 0x33, 0xce, 0x28, 0x03, 0xcb, 0xf4, 0x16, 0x09, 0x0b,
+  0xf7, 0x0e, 0x71, 0x3d, 0x27, 0x42, 0xe1, 0x81, 0x51, 0x28, 0x0c, 0x28,
+  0x0a, 0xe6, 0x3d, 0x50, 0xd3, 0xf8, 0x07, 0x47, 0xf4, 0x1e, 0x1b, 0x1a,
+  0x17, 0x03, 0x2e, 0xf8, 0x16, 0x37, 0x0e, 0xde, 0xf3, 0xe5, 0x6f, 0x30,
+  0xef, 0xf9, 0xe9, 0x94, 0x20, 0x20, 0x0b, 0xec, 0x00, 0x08, 0x08, 0x08,
+  0xfb, 0x25, 0x38, 0x2d, 0x36, 0x11, 0xfd, 0x33, 0x0d, 0x28, 0x47, 0xbd,
+  0x02, 0x1b, 0x1d, 0x03, 0x36, 0x19, 0x59, 0x09, 0x49, 0x20, 0x23, 0xde,
+  0x17, 0x21, 0x0a, 0x13, 0x0e, 0x7d, 0x24, 0x41, 0x2a, 0x3f, 0x35, 0x4f,
+  0x28, 0xe1, 0xdf, 0x30, 0x07, 0x01, 0x10, 0xc6, 0xf2, 0xf6, 0xec, 0xec,
+  0xfb, 0x00, 0x38, 0x0f, 0x11, 0xf7, 0x01, 0xf4, 0xf7, 0x06, 0x31, 0xe1,
+  0xf7, 0x51, 0x00, 0x0f, 0xf3, 0xe7, 0x0a, 0x45, 0xd5, 0xfe, 0xf7, 0xd1,
+  0x22, 0x1d, 0xf9, 0xc2, 0xfa, 0xf1, 0xdd, 0xde, 0xf9, 0xc1, 0xd8, 0x02,
+  0xaf, 0xe9, 0xff, 0xba, 0x21, 0x1d, 0xf0, 0xff, 0xf4, 0xc5, 0xc0, 0xad,
+  0x13, 0xe5, 0x06, 0xc1, 0xd1, 0xf3, 0xcc, 0xe9, 0xc2, 0xfd, 0xe8, 0x05,
+  0xd1, 0x04, 0xd0, 0x1a, 0xff, 0xfb, 0x53, 0xce, 0x0f, 0x0f, 0xd2, 0xe8,
+  0xd0, 0xdc, 0xe4, 0x02, 0xf6, 0x53, 0x0e, 0x25, 0xc9, 0xe6, 0x0a, 0x63,
+  0xbc, 0xfa, 0xfd, 0xed, 0x0f, 0xe7, 0x25, 0x1c, 0x1a, 0xbb, 0x0e, 0x2a,
+  0xe1, 0x2c, 0xff, 0xf3, 0x14, 0x01, 0xf3, 0x37, 0xe1, 0x9e, 0xce, 0x36,
+  0xe7, 0x1f, 0x32, 0xe9, 0x03, 0xfc, 0xdb, 0xfa, 0xe7, 0x17, 0x01, 0xda,
+  0x04, 0xfa, 0x04, 0x16, 0x05, 0xcf, 0x23, 0x13, 0x22, 0x1a, 0xe3, 0xee,
+  0x25, 0xcb, 0xfc, 0x4d, 0xe9, 0xae, 0xba, 0xfb, 0xe1, 0x25, 0xf6, 0xb6,
+  0xe6, 0x05, 0xd9, 0xc9, 0xf0, 0x18, 0xf8, 0xf1, 0xdb, 0x22, 0x3b, 0xd7,
+  0x3f, 0x25, 0x36, 0x7f, 0x17, 0x32, 0xe0, 0x03, 0x16, 0x49, 0x21, 0x37,
+  0x2d, 0xdf, 0x27, 0x6e, 0x3c, 0x0f, 0x79, 0xe5, 0xe4, 0x0e, 0xe5, 0xd1,
+  0xf5, 0x45, 0x03, 0xfc, 0xf5, 0x1f, 0x3c, 0x37, 0x00, 0xac, 0x25, 0x2d,
+  0x38, 0x40, 0x1c, 0xfa, 0x33, 0x11, 0x11, 0x0b, 0xb3, 0xcc, 0xdf, 0x58,
+  0x01, 0x30, 0x5c, 0xd4, 0xf5, 0x0f, 0xec, 0x09, 0x1a, 0x20, 0xf8, 0xed,
+  0xe5, 0xf5, 0x00, 0x1e, 0x0f, 0xcd, 0xf2, 0x03, 0x1b, 0x3a, 0x12, 0xeb,
+  0x28, 0x02, 0xf9, 0x16, 0xd9, 0xb7, 0xed, 0x22, 0x10, 0x35, 0x0c, 0xd9,
+  0x0f, 0xe2, 0xe2, 0x0b, 0x3c, 0xf0, 0x0a, 0x29, 0x29, 0x15, 0x07, 0xcf,
+  0x00, 0x1c, 0x09, 0x12, 0x29, 0xef, 0xf0, 0x1d, 0x0a, 0x08, 0x03, 0xdf,
+  0x42, 0x22, 0x02, 0x03, 0x13, 0xdc, 0x32, 0xd2, 0x09, 0x0c, 0x3b, 0xda,
+  0x3c, 0x09, 0x17, 0x08, 0x26, 0x03, 0xfc, 0x08, 0x1b, 0xf6, 0x03, 0x0d,
+  0x0d, 0xfe, 0xf6, 0x08, 0x29, 0x0e, 0x28, 0x1f, 0x06, 0xf1, 0x14, 0x0a,
+  0x16, 0x04, 0x10, 0xf8, 0x29, 0x35, 0x19, 0xf1, 0x07, 0x3f, 0x16, 0xfb,
+  0x2f, 0x07, 0x2a, 0x2a, 0x1d, 0xdc, 0x1c, 0x06, 0x27, 0x27, 0x15, 0xfe,
+  0x2c, 0xe0, 0x16, 0x1b, 0xfb, 0xf1, 0xee, 0x0e, 0x35, 0x34, 0x08, 0xf5,
+  0x1d, 0x1f, 0xfd, 0x21, 0x4e, 0xfc, 0x1f, 0x1f, 0xf3, 0xf6, 0x06, 0xea,
+  0xfe, 0x28, 0x09, 0xdc, 0xe2, 0xf0, 0x44, 0x16, 0xf1, 0xef, 0x1e, 0xe6,
+  0x1d, 0x20, 0x2d, 0xea, 0x1b, 0x2c, 0xb7, 0x13, 0x05, 0x24, 0x2b, 0x30,
+  0x2f, 0x1d, 0x12, 0x08, 0xfb, 0xc6, 0x03, 0x13, 0x02, 0xdb, 0xfb, 0xe4,
+  0x1e, 0xf2, 0x2f, 0x11, 0x11, 0xd9, 0x23, 0x19, 0xe6, 0xf9, 0xfa, 0x21,
+  0x02, 0x17, 0xcb, 0x27, 0x2e, 0x2d, 0x0f, 0x30, 0xef, 0x19, 0xdc, 0xe7,
+  0x2f, 0x94, 0x18, 0x0b, 0xec, 0xd3, 0xf5, 0xb8, 0x1b, 0xf5, 0xfb, 0xc6,
+  0x0d, 0xb1, 0xdd, 0xe7, 0x9b, 0xb8, 0xf8, 0xf4, 0xd3, 0x39, 0x81, 0xf3,
+  0x1b, 0x22, 0xf4, 0x18, 0xe4, 0xfb, 0xf3, 0x04, 0xdf, 0xdb, 0xf0, 0x18,
+  0xf6, 0xf2, 0x02, 0xd7, 0xe6, 0xcd, 0x27, 0xc9, 0x0a, 0xd4, 0xed, 0xc0,
+  0xd9, 0xeb, 0xce, 0xef, 0xd5, 0x09, 0xdc, 0x28, 0xe7, 0xff, 0xf9, 0x08,
+  0xe0, 0xfa, 0xd9, 0x00, 0xdd, 0xbe, 0x1b, 0x05, 0xe0, 0xd2, 0xf7, 0x0d,
+  0xdd, 0xec, 0x29, 0xd7, 0xf7, 0xb0, 0xe5, 0x0a, 0xa2, 0x9e, 0xf0, 0x02,
+  0xce, 0x26, 0xcc, 0x23, 0xd0, 0xed, 0xe7, 0x1c, 0xef, 0x15, 0xf5, 0xd0,
+  0xec, 0xff, 0xec, 0x30, 0xfc, 0xc6, 0xf0, 0x15, 0xeb, 0x00, 0xd8, 0xda,
+  0x04, 0xff, 0xd1, 0x3d, 0xa7, 0xb9, 0xf8, 0xff, 0xdc, 0xe9, 0xec, 0xc2,
+  0xef, 0xc4, 0xdc, 0xdf, 0x11, 0x36, 0xde, 0x0f, 0x23, 0xed, 0x3c, 0xef,
+  0x09, 0x06, 0x23, 0x3a, 0x05, 0x10, 0xc3, 0xea, 0x48, 0x0f, 0x04, 0x27,
+  0xd3, 0xe9, 0xca, 0x42, 0x10, 0x09, 0x11, 0x90, 0xfe, 0x0c, 0xe1, 0xd3,
+  0x16, 0x39, 0xf6, 0x09, 0x02, 0xca, 0x05, 0x01, 0x08, 0xe1, 0x2b, 0x03,
+  0x35, 0x32, 0x03, 0xd9, 0x24, 0xd1, 0x0f, 0x28, 0xc7, 0xda, 0xe9, 0x14,
+  0xe2, 0x48, 0xe7, 0xee, 0x29, 0xfd, 0x06, 0x08, 0x29, 0x09, 0xf5, 0x09,
+  0x19, 0xe9, 0x1f, 0xd1, 0x06, 0xdb, 0x18, 0x17, 0x08, 0x16, 0x2a, 0xd2,
+  0x37, 0xf7, 0xfb, 0x31, 0xdb, 0xdb, 0x15, 0x1e, 0x09, 0x34, 0xd8, 0xd9,
+  0x0c, 0xf9, 0x1b, 0x2b, 0x05, 0xf5, 0x07, 0xf1, 0xe3, 0x36, 0xfc, 0xd7,
+  0x10, 0x08, 0x07, 0x00, 0xef, 0x17, 0x2c, 0x1e, 0x10, 0x15, 0x02, 0xf2,
+  0xf5, 0x2b, 0x15, 0x21, 0xdd, 0x28, 0xf4, 0xff, 0x28, 0xfa, 0x0f, 0xff,
+  0x01, 0x11, 0xec, 0x03, 0xec, 0x3d, 0xff, 0xc2, 0x0a, 0x56, 0x08, 0x12,
+  0xe0, 0x0a, 0x0d, 0x2c, 0x0a, 0x02, 0xe1, 0xec, 0x21, 0x47, 0x11, 0x02,
+  0x05, 0xc8, 0x21, 0xe6, 0x16, 0x0c, 0x0a, 0xe2, 0x29, 0x16, 0x07, 0x11,
+  0xf7, 0x28, 0x0a, 0xae, 0x06, 0x2f, 0xf7, 0x02, 0xfb, 0x26, 0x38, 0x12,
+  0x28, 0x21, 0xf5, 0xfd, 0x07, 0x2a, 0x13, 0x37, 0x0f, 0x01, 0x20, 0xeb,
+  0xe0, 0xf3, 0xe9, 0xdb, 0x08, 0xe6, 0xfe, 0x1e, 0xcb, 0x36, 0xde, 0xb3,
+  0xd8, 0x26, 0x04, 0xf5, 0x05, 0xec, 0x27, 0x15, 0xd0, 0x23, 0xd8, 0xf5,
+  0x32, 0x31, 0x1a, 0xfb, 0xf5, 0x13, 0x2e, 0x2d, 0xcc, 0xf4, 0x12, 0x35,
+  0xe7, 0xce, 0xdd, 0x29, 0xa6, 0x1c, 0xf2, 0x81, 0xe9, 0x18, 0x09, 0xea,
+  0x06, 0x04, 0x46, 0x0a, 0xe6, 0x0e, 0xf5, 0x9e, 0x24, 0x03, 0x32, 0xe0,
+  0xf4, 0x02, 0x2f, 0x2d, 0xbc, 0xeb, 0x14, 0x26, 0xf1, 0xec, 0xe5, 0x19,
+  0xe5, 0x12, 0x19, 0xdf, 0x09, 0x08, 0xff, 0xef, 0xf2, 0xf7, 0x54, 0x0b,
+  0xf3, 0x1f, 0x04, 0xc1, 0x29, 0x16, 0x15, 0x0d, 0xf0, 0x2d, 0x42, 0x17,
+  0xcc, 0xf1, 0xf0, 0x29, 0xe4, 0x07, 0xe5, 0x0b, 0xfa, 0xde, 0x21, 0x00,
+  0x0b, 0x02, 0x2c, 0x15, 0x1c, 0x18, 0x08, 0x23, 0xf7, 0xf8, 0xdb, 0x24,
+  0xeb, 0xfc, 0x0f, 0xf4, 0xe3, 0xed, 0xf7, 0xb8, 0x24, 0xec, 0xfd, 0xe8,
+  0x01, 0x0a, 0x09, 0x10, 0xf4, 0xec, 0xec, 0x0e, 0xea, 0x03, 0x11, 0x15,
+  0xf6, 0xef, 0xea, 0x17, 0x1a, 0x08, 0x0d, 0xdc, 0xdb, 0x08, 0x16, 0xd4,
+  0xe5, 0xc4, 0xe7, 0xb7, 0x42, 0x1f, 0xf2, 0xd5, 0xce, 0xd2, 0xe2, 0x83,
+  0x09, 0x4b, 0xf2, 0x0c, 0xcf, 0x12, 0xbf, 0x23, 0xdc, 0xb1, 0x93, 0x32,
+  0xd0, 0x2f, 0xa2, 0x06, 0x17, 0x0b, 0xca, 0xda, 0xc9, 0xd0, 0x1b, 0xfb,
+  0x2d, 0xd6, 0x81, 0xd0, 0xf8, 0x0e, 0x04, 0xf4, 0x1d, 0xe7, 0x08, 0xb7,
+  0xea, 0x0b, 0x13, 0xe5, 0xf8, 0xf9, 0xac, 0x22, 0x13, 0x19, 0xd1, 0xb3,
+  0x2d, 0x2b, 0x05, 0x0d, 0x12, 0xc2, 0xe0, 0xe2, 0x2a, 0x26, 0x2d, 0xb4,
+  0x02, 0x31, 0xf6, 0xf4, 0xd9, 0x00, 0x21, 0xff, 0xfb, 0xd8, 0xf6, 0x03,
+  0x01, 0xef, 0xc1, 0x10, 0x02, 0xe1, 0xe5, 0x29, 0xba, 0xe9, 0x0c, 0xfc,
+  0xdc, 0xcd, 0xff, 0xb8, 0xfe, 0xe1, 0x1a, 0xe7, 0x44, 0x38, 0x01, 0x16,
+  0x06, 0x2e, 0x08, 0x37, 0x27, 0xe6, 0x2b, 0x3a, 0x22, 0x53, 0x0f, 0x28,
+  0x0f, 0x32, 0x1a, 0x66, 0xf3, 0x16, 0x2e, 0x56, 0xf4, 0x3a, 0x1c, 0xc9,
+  0xd9, 0xf1, 0xd9, 0xfe, 0x23, 0x07, 0x11, 0x1f, 0x3d, 0x18, 0xdf, 0xfe,
+  0x0f, 0x2e, 0xff, 0xef, 0xf0, 0xf4, 0x28, 0x27, 0xc6, 0x05, 0xda, 0xbb,
+  0x0d, 0x16, 0x1e, 0x17, 0xe8, 0xc8, 0xdc, 0xce, 0x40, 0x09, 0x21, 0x09,
+  0xfc, 0x44, 0x0e, 0xf9, 0x03, 0xfb, 0x3f, 0x09, 0x18, 0x2f, 0x3f, 0x15,
+  0x3a, 0x37, 0xef, 0xe8, 0x25, 0x2d, 0x38, 0x66, 0x16, 0x0f, 0x16, 0x20,
+  0x03, 0xed, 0x13, 0x13, 0x24, 0xef, 0x18, 0xe9, 0x15, 0x29, 0x16, 0x08,
+  0x24, 0xca, 0x39, 0xd5, 0xef, 0xe4, 0x23, 0xd9, 0xf9, 0xf6, 0xfe, 0xf9,
+  0x01, 0xf1, 0x2f, 0xf7, 0xfd, 0xda, 0x1a, 0x0a, 0x0f, 0x59, 0x0f, 0x32,
+  0xfa, 0x07, 0x11, 0x14, 0x24, 0x12, 0xf5, 0x16, 0x27, 0xdd, 0x0f, 0xed,
+  0x1a, 0xf4, 0x1d, 0xfb, 0x11, 0x0d, 0x06, 0xec, 0x08, 0xd8, 0xfc, 0x23,
+  0xc1, 0xd1, 0xfd, 0x04, 0x07, 0xd8, 0xe8, 0xf1, 0x2a, 0x20, 0x23, 0xd1,
+  0x20, 0x0e, 0x18, 0xf8, 0x37, 0x01, 0x1a, 0x0d, 0x04, 0xff, 0xef, 0xee,
+  0x1d, 0x16, 0xd6, 0x1c, 0x0a, 0x01, 0x1f, 0x37, 0xe3, 0x0c, 0xf7, 0x20,
+  0x0e, 0xd1, 0xec, 0x86, 0x4e, 0x32, 0x00, 0xb3, 0xf2, 0x42, 0x07, 0xf7,
+  0x1a, 0x09, 0x18, 0x01, 0x0d, 0x12, 0xfc, 0x26, 0x32, 0x2b, 0xaf, 0xdf,
+  0x46, 0x04, 0x0a, 0x3d, 0xef, 0x05, 0xdb, 0x3e, 0xff, 0x3c, 0xcf, 0x9a,
+  0x24, 0x2c, 0xf7, 0xcd, 0xf3, 0xcc, 0xda, 0x16, 0xfc, 0xce, 0xee, 0xd3,
+  0xe2, 0xe0, 0x00, 0xcf, 0xc4, 0xf3, 0x14, 0xe1, 0xba, 0xb1, 0x0b, 0xe6,
+  0xd1, 0xe1, 0x08, 0xf8, 0xe9, 0xb3, 0xaf, 0xd7, 0x05, 0xfe, 0x1a, 0xde,
+  0x22, 0x02, 0x1a, 0xf4, 0x00, 0x0f, 0xca, 0xc9, 0xf3, 0x0d, 0xec, 0xd6,
+  0x02, 0xde, 0x02, 0x27, 0x00, 0xd5, 0x17, 0xfb, 0x07, 0x38, 0x07, 0xec,
+  0xf9, 0x93, 0xda, 0xb1, 0x19, 0x17, 0xf7, 0x9e, 0x36, 0x18, 0xf6, 0xea,
+  0xe9, 0x28, 0x04, 0xdd, 0xf3, 0x32, 0xfc, 0x41, 0x12, 0x03, 0xe5, 0x44,
+  0x08, 0x38, 0xe4, 0xbd, 0x1a, 0x49, 0x39, 0xe7, 0xf3, 0xca, 0x2c, 0xb7,
+  0x28, 0xe7, 0x0a, 0xa1, 0xfd, 0xc2, 0xe9, 0x24, 0xb3, 0xe1, 0xd8, 0xd3,
+  0xef, 0xd8, 0xea, 0xb3, 0xc7, 0xb5, 0x37, 0xc8, 0xc6, 0xbb, 0xd0, 0xe9,
+  0xe0, 0xa4, 0xd4, 0xd9, 0xd2, 0xd1, 0xbd, 0xfd, 0x9d, 0xbb, 0xef, 0xf1,
+  0x1d, 0xce, 0xf1, 0x2e, 0xa3, 0x21, 0xcf, 0x93, 0x10, 0x1e, 0x02, 0xbc,
+  0xbb, 0xd0, 0x28, 0xf0, 0xbc, 0x03, 0xf2, 0xd8, 0x19, 0x13, 0x3c, 0xc8,
+  0x1a, 0xd6, 0xdd, 0x32, 0xed, 0xd7, 0x36, 0x1d, 0x5b, 0xe2, 0x42, 0x34,
+  0xa5, 0x7f, 0x04, 0x90, 0x14, 0x4e, 0x20, 0x2d, 0xf2, 0x01, 0x3d, 0x4b,
+  0x0a, 0x58, 0x12, 0xc4, 0x64, 0x43, 0x5e, 0x03, 0x21, 0xce, 0x5c, 0x18,
+  0xf5, 0x1e, 0x38, 0x0b, 0x17, 0x0e, 0x47, 0x0e, 0x42, 0xdd, 0x3c, 0xf0,
+  0x41, 0x08, 0x0b, 0xec, 0x1c, 0x38, 0xf8, 0x46, 0x25, 0xdb, 0x1b, 0x39,
+  0x05, 0x1f, 0xff, 0x21, 0x34, 0x36, 0xba, 0xe8, 0x5a, 0x37, 0xfd, 0xf7,
+  0xe7, 0xef, 0x04, 0x01, 0x10, 0xdb, 0x25, 0x10, 0xdc, 0x31, 0xd2, 0xef,
+  0x06, 0xf1, 0x1f, 0xe9, 0x0a, 0xf4, 0x0f, 0x0b, 0xfa, 0x0e, 0x15, 0xe6,
+  0xe2, 0x3e, 0xb0, 0x15, 0x31, 0x25, 0x16, 0x35, 0xe8, 0xf4, 0xd0, 0x09,
+  0xea, 0xcc, 0x03, 0x0d, 0xdb, 0x11, 0x04, 0x17, 0x01, 0x00, 0x13, 0xfd,
+  0xec, 0xe4, 0xd5, 0x01, 0xd3, 0x08, 0xdf, 0xf7, 0xd8, 0xf7, 0xe3, 0x04,
+  0xdf, 0xfb, 0xea, 0x11, 0x2b, 0x16, 0x32, 0x04, 0x37, 0x2e, 0xf8, 0xe4,
+  0xf7, 0x0b, 0xfa, 0x01, 0x3b, 0xeb, 0xdd, 0xfb, 0x1a, 0x27, 0x0a, 0x22,
+  0xfc, 0x43, 0x1c, 0xfe, 0x22, 0x1f, 0xfd, 0xda, 0x47, 0x35, 0x3b, 0xf6,
+  0xb4, 0x08, 0xdb, 0xd8, 0x1f, 0x0e, 0xf3, 0xff, 0xe4, 0x4a, 0xee, 0xf1,
+  0xdb, 0xb9, 0xdc, 0x1a, 0x01, 0x0d, 0xc1, 0x81, 0x27, 0x4d, 0xf5, 0xf8,
+  0xd6, 0xce, 0x13, 0xf4, 0x2f, 0x17, 0xc1, 0xdd, 0x24, 0xb6, 0xcc, 0x34,
+  0x26, 0xf7, 0xd7, 0x2c, 0xbe, 0x28, 0xec, 0x21, 0xc9, 0xe6, 0x34, 0xbd,
+  0xaf, 0x14, 0x04, 0x11, 0xfd, 0xe3, 0x03, 0xc7, 0xf0, 0xd8, 0xec, 0x01,
+  0x00, 0xa6, 0x0d, 0x13, 0x27, 0x31, 0x2c, 0x06, 0x0e, 0xef, 0xff, 0x00,
+  0xf6, 0x1b, 0xd6, 0x14, 0x06, 0xde, 0xbe, 0x26, 0xe0, 0x03, 0x00, 0x1c,
+  0xfb, 0x0c, 0xff, 0x0f, 0xf8, 0xb6, 0xca, 0xc2, 0x3b, 0x34, 0x08, 0x90,
+  0xaf, 0x29, 0xda, 0x9b, 0x19, 0x13, 0xff, 0xc6, 0xe3, 0x35, 0xe5, 0xf7,
+  0x10, 0xed, 0xa9, 0x1d, 0xe8, 0xec, 0xf8, 0xce, 0x22, 0x4c, 0xd8, 0xe5,
+  0xfd, 0xf4, 0xe9, 0xb1, 0x38, 0x0c, 0xe8, 0xba, 0x18, 0x09, 0xdd, 0x0a,
+  0x19, 0x14, 0xf4, 0x0f, 0xe7, 0x21, 0x19, 0xfb, 0xfb, 0x00, 0xf1, 0x0f,
+  0xd5, 0xf6, 0xeb, 0x25, 0x0b, 0xf9, 0xeb, 0x12, 0x09, 0xbb, 0xe4, 0xfc,
+  0x0a, 0xbc, 0xf0, 0xe0, 0xdf, 0xc6, 0x28, 0xe7, 0x32, 0x07, 0xf2, 0x18,
+  0xff, 0x3c, 0xdc, 0x22, 0xd6, 0xfd, 0x31, 0x2a, 0xd9, 0x1a, 0xea, 0xe8,
+  0x3e, 0x17, 0x14, 0xf1, 0x02, 0x08, 0x3b, 0x2b, 0x3d, 0xee, 0xe5, 0x3a,
+  0x00, 0x1b, 0x13, 0x1a, 0xde, 0x08, 0x13, 0xf8, 0x1d, 0xd2, 0x09, 0x02,
+  0xe7, 0x15, 0xf4, 0x04, 0x04, 0x2d, 0x12, 0x2b, 0x0a, 0xe5, 0xff, 0x17,
+  0x25, 0xe7, 0x12, 0xf0, 0xdf, 0x07, 0x10, 0x07, 0x06, 0x1d, 0x17, 0x13,
+  0xcd, 0xf6, 0x0d, 0xe9, 0x17, 0xd4, 0x46, 0x04, 0x00, 0x39, 0xd2, 0x32,
+  0xe8, 0x05, 0x19, 0x28, 0xe3, 0xd7, 0x3a, 0x15, 0x19, 0xdb, 0xdf, 0xc7,
+  0xda, 0xfa, 0x56, 0xc6, 0xe7, 0x01, 0xf0, 0x00, 0x1a, 0xd9, 0x13, 0xfc,
+  0xd3, 0x35, 0x07, 0xef, 0xdf, 0xd7, 0x24, 0xc4, 0xe0, 0xe8, 0xdb, 0xcb,
+  0x18, 0x02, 0xbd, 0xc1, 0xc7, 0x17, 0xcd, 0x33, 0xf1, 0x0d, 0x1c, 0x1b,
+  0x1b, 0xfd, 0xfa, 0x0a, 0x81, 0xcd, 0x06, 0xdc, 0x29, 0xb4, 0x0a, 0xf9,
+  0xe0, 0xf1, 0x01, 0xcf, 0xfa, 0xf2, 0xe6, 0x1a, 0xd9, 0x9c, 0x0b, 0x10,
+  0x11, 0x00, 0xc4, 0xf9, 0xcd, 0xe4, 0x0d, 0xf3, 0x30, 0x20, 0x40, 0x39,
+  0x1a, 0xf9, 0x05, 0xe5, 0x3e, 0xcf, 0x0b, 0x19, 0x19, 0xeb, 0xbd, 0x15,
+  0x0e, 0xee, 0x2b, 0x2f, 0x07, 0xff, 0x4b, 0x22, 0x49, 0x9f, 0xc0, 0xa9,
+  0x03, 0x16, 0x4c, 0xbd, 0xf6, 0xa4, 0xc1, 0xe3, 0x44, 0xc9, 0xc8, 0x28,
+  0xdd, 0x19, 0xc3, 0xfd, 0xbf, 0xe4, 0xfe, 0xf4, 0xa6, 0xd2, 0xe1, 0xf5,
+  0xea, 0x07, 0xd3, 0xe9, 0xde, 0x10, 0xd0, 0x10, 0x05, 0xac, 0xf7, 0x4b,
+  0xeb, 0xe9, 0x17, 0x26, 0x32, 0xaf, 0xd3, 0x14, 0xf1, 0x00, 0x12, 0xee,
+  0xec, 0x0e, 0xde, 0xf6, 0xda, 0xe4, 0x1c, 0x23, 0x0d, 0x02, 0xe8, 0xc6,
+  0xe7, 0xc1, 0xc4, 0xc6, 0x0b, 0xda, 0xff, 0xdd, 0x3d, 0xf9, 0x51, 0x4a,
+  0x58, 0xd0, 0x29, 0x0d, 0x43, 0xdb, 0x11, 0xf9, 0x21, 0x06, 0x9f, 0xf0,
+  0x18, 0xda, 0x43, 0x43, 0xf0, 0x01, 0x40, 0xed, 0x4f, 0xab, 0xa4, 0xa1,
+  0x39, 0x0a, 0x4b, 0x97, 0xaf, 0xb2, 0xde, 0x16, 0xba, 0x9f, 0xd3, 0x29,
+  0xa3, 0xff, 0xc2, 0xc8, 0x96, 0x99, 0x5c, 0xac, 0xd7, 0xab, 0xd8, 0x8d,
+  0xf4, 0xb0, 0xfc, 0x99, 0xb0, 0x1b, 0xdc, 0x30, 0xbe, 0xc4, 0xf8, 0x3d,
+  0x1f, 0xb3, 0xcb, 0x57, 0xb2, 0xa8, 0xe6, 0xf1, 0xe5, 0xe2, 0x08, 0xce,
+  0xc2, 0xec, 0x7f, 0x9c, 0x03, 0xc2, 0xd6, 0xc2, 0xdb, 0xa6, 0x02, 0xce,
+  0xe5, 0x23, 0xd2, 0x2d, 0xa3, 0xd5, 0x17, 0x3e, 0x35, 0x05, 0xf8, 0x58,
+  0xb2, 0x92, 0x2e, 0x27, 0xfe, 0xa1, 0xfb, 0xee, 0x27, 0x06, 0x70, 0xca,
+  0x25, 0xa7, 0x26, 0x02, 0x83, 0x84, 0xdc, 0x30, 0xfa, 0x5d, 0x8b, 0x37,
+  0xe0, 0x1c, 0x22, 0x63, 0xe4, 0xf0, 0xee, 0xa9, 0xcf, 0x3d, 0x01, 0x07,
+  0xf2, 0x24, 0x02, 0x2a, 0xf2, 0x15, 0xbf, 0x0a, 0xfa, 0x1c, 0xd9, 0x0a,
+  0x2a, 0x07, 0xd2, 0x2d, 0xee, 0xb8, 0x64, 0x21, 0x99, 0xc8, 0x94, 0xf8,
+  0xc0, 0xcf, 0xf7, 0x99, 0xb5, 0x34, 0xed, 0x1b, 0x0d, 0x24, 0x0b, 0x23,
+  0xc3, 0xe4, 0xe8, 0xfe, 0xd6, 0x23, 0xfb, 0xb9, 0x44, 0xf8, 0xf9, 0xd4,
+  0x0b, 0x86, 0x40, 0x30, 0xe8, 0xc8, 0xb6, 0x1f, 0xbc, 0xbb, 0xb0, 0xa8,
+  0xf3, 0x06, 0xdf, 0x09, 0xef, 0x2c, 0x1b, 0xc3, 0xda, 0xf8, 0x13, 0xf2,
+  0xcb, 0xef, 0xbd, 0xc8, 0x23, 0x08, 0xde, 0xc6, 0xbc, 0xb2, 0x21, 0x2b,
+  0xe6, 0xb9, 0xd5, 0x3c, 0x45, 0x1c, 0x29, 0x35, 0x07, 0x2a, 0x3e, 0x06,
+  0x12, 0x09, 0xfc, 0x26, 0x36, 0x57, 0x55, 0x2c, 0x41, 0x3d, 0x13, 0xdc,
+  0x3d, 0x2e, 0x11, 0x46, 0x00, 0x2e, 0x1e, 0xe9, 0x08, 0x29, 0x24, 0x3b,
+  0x44, 0x1b, 0x2c, 0x22, 0x0d, 0x2a, 0xec, 0xfe, 0x1f, 0x3b, 0x01, 0x17,
+  0x21, 0x23, 0xe6, 0x2a, 0xe0, 0x1a, 0x2c, 0xd5, 0x0c, 0x08, 0x35, 0x07,
+  0x18, 0x9c, 0x40, 0xcf, 0xc2, 0xdc, 0x18, 0xe6, 0x21, 0xe3, 0x22, 0xec,
+  0x0a, 0x44, 0xe4, 0xf1, 0x35, 0x43, 0x0d, 0x12, 0xf8, 0xef, 0xe7, 0x21,
+  0xd1, 0x4e, 0xff, 0xdb, 0x1f, 0x55, 0x25, 0xe7, 0x2e, 0xb7, 0x35, 0xce,
+  0x17, 0x11, 0xfe, 0x99, 0x06, 0xd3, 0x0b, 0x04, 0xce, 0x03, 0x06, 0xfa,
+  0x0c, 0xe6, 0xf9, 0x00, 0x12, 0x08, 0x2a, 0xdd, 0x01, 0x14, 0xec, 0x09,
+  0x07, 0xd3, 0xf5, 0x03, 0xdb, 0x19, 0x10, 0x2f, 0xd2, 0xfb, 0x02, 0x10,
+  0xe0, 0xd0, 0xef, 0xe3, 0xc2, 0x03, 0x03, 0x0c, 0xf7, 0xe6, 0x19, 0x17,
+  0xf1, 0x1e, 0xe4, 0xfe, 0x06, 0x10, 0xf3, 0x00, 0xef, 0xd4, 0xdc, 0x12,
+  0x05, 0xe6, 0x2b, 0x14, 0x81, 0xea, 0xf2, 0x06, 0x13, 0xe9, 0x07, 0xeb,
+  0xc1, 0x17, 0xf7, 0xdc, 0x0b, 0xea, 0xee, 0x1f, 0x0a, 0x34, 0xd9, 0x18,
+  0x06, 0x27, 0x0d, 0x14, 0x19, 0xd8, 0xf2, 0x09, 0x10, 0xe1, 0x3d, 0xf8,
+  0xdd, 0xfc, 0xec, 0xfc, 0x0a, 0x08, 0xef, 0x08, 0xab, 0x19, 0xf3, 0x0a,
+  0x0a, 0xe8, 0x0e, 0x23, 0x10, 0x0b, 0xcc, 0x1d, 0x0c, 0x12, 0x0e, 0x45,
+  0xe3, 0xd3, 0x0f, 0x25, 0x10, 0xf6, 0xfd, 0xbf, 0xab, 0xed, 0xf2, 0xcb,
+  0xf8, 0x1a, 0x15, 0x06, 0xdd, 0x0d, 0x1f, 0xeb, 0x16, 0xa3, 0x11, 0x01,
+  0x28, 0x25, 0xec, 0x0e, 0x29, 0xfd, 0xfa, 0x11, 0x03, 0xc1, 0xe8, 0x14,
+  0x0a, 0x1f, 0x1f, 0xdc, 0xca, 0x0d, 0x12, 0xe1, 0xf7, 0x22, 0x03, 0xf5,
+  0xca, 0x04, 0x2d, 0x09, 0x25, 0xd6, 0x10, 0x35, 0xf7, 0x2c, 0xf2, 0x04,
+  0x2f, 0x27, 0x03, 0x0a, 0xf4, 0xdd, 0x1b, 0x1a, 0x28, 0x32, 0x08, 0x01,
+  0xdf, 0x05, 0x09, 0x27, 0xeb, 0x20, 0x10, 0x19, 0xf4, 0x09, 0x1c, 0x05,
+  0x29, 0xcd, 0x25, 0xe6, 0x0c, 0x20, 0x00, 0x11, 0x22, 0x10, 0x0e, 0x1c,
+  0xe1, 0xe4, 0x23, 0x1c, 0x0e, 0x08, 0xe0, 0xe9, 0xdd, 0x06, 0x1a, 0xd4,
+  0xe4, 0xee, 0x25, 0xf3, 0xf4, 0x10, 0xfe, 0x0e, 0x13, 0xd7, 0xd3, 0x10,
+  0x11, 0xea, 0xf2, 0x11, 0x01, 0x0c, 0xfe, 0xd8, 0xd7, 0xf2, 0x23, 0x07,
+  0x0e, 0x11, 0xf3, 0xef, 0xdb, 0xf7, 0x0b, 0xed, 0x02, 0x1d, 0x15, 0xec,
+  0xe0, 0x07, 0x34, 0xc8, 0x19, 0xe3, 0x16, 0x1e, 0x2d, 0x35, 0xfc, 0xf2,
+  0x24, 0x10, 0x1c, 0xd4, 0xdf, 0x01, 0xf6, 0x2d, 0x16, 0x08, 0x0d, 0xd7,
+  0xec, 0x0a, 0xf4, 0xfb, 0xd9, 0x04, 0xe2, 0xcd, 0x1b, 0xe3, 0xed, 0x28,
+  0x01, 0x1c, 0xf8, 0xfa, 0xe9, 0xfa, 0x03, 0x0f, 0x0a, 0xfd, 0xd5, 0xdb,
+  0x18, 0x2f, 0xfc, 0x09, 0xd8, 0xf6, 0xf3, 0x03, 0x33, 0xfe, 0xed, 0x0a,
+  0xf2, 0xd5, 0xb7, 0xbb, 0x04, 0xda, 0xb8, 0x03, 0xcc, 0xf9, 0xe6, 0xf7,
+  0xed, 0xc8, 0xa0, 0xf3, 0xbe, 0xff, 0xb3, 0xf1, 0xdf, 0x00, 0xd0, 0xe5,
+  0xdb, 0xe1, 0xd6, 0xf6, 0xed, 0xc8, 0xda, 0xd9, 0x09, 0x00, 0xf5, 0xe9,
+  0x14, 0x06, 0x0f, 0x0c, 0x1c, 0x9b, 0x2b, 0xf4, 0x0b, 0x18, 0x8c, 0xfa,
+  0x19, 0xd6, 0x08, 0x3d, 0xd6, 0xa4, 0xd4, 0x2d, 0x13, 0x92, 0xdf, 0xba,
+  0x00, 0x08, 0xf3, 0x81, 0x14, 0x07, 0xe5, 0x0b, 0xfe, 0xe0, 0xf2, 0xfe,
+  0x01, 0xf3, 0xfc, 0x0b, 0xdf, 0x13, 0x1a, 0xbd, 0xf6, 0xff, 0xe3, 0x2e,
+  0xab, 0xcb, 0xec, 0xe9, 0xdb, 0x44, 0xdb, 0x25, 0x07, 0xf6, 0x04, 0x46,
+  0x1e, 0x11, 0xdf, 0xef, 0x01, 0xf6, 0xdf, 0x1d, 0x07, 0xe7, 0xe5, 0xf4,
+  0x1e, 0x03, 0xb8, 0xf2, 0xf2, 0xe1, 0xed, 0x11, 0xf9, 0xea, 0xed, 0x12,
+  0xe7, 0xd1, 0x04, 0xea, 0x11, 0xff, 0x08, 0x04, 0x13, 0x18, 0x1c, 0x10,
+  0x15, 0xe5, 0x01, 0x1f, 0x20, 0xd7, 0x29, 0xf2, 0x25, 0xfd, 0xc0, 0xf5,
+  0xfe, 0x02, 0x2d, 0x3b, 0xee, 0x06, 0xfd, 0x34, 0x2e, 0xf1, 0xcc, 0xc0,
+  0x30, 0x1b, 0x00, 0xa6, 0xbb, 0x24, 0xdb, 0xe1, 0xd8, 0x12, 0x13, 0x21,
+  0x1a, 0xf5, 0x0d, 0x44, 0xe6, 0x0c, 0xbc, 0x21, 0xf5, 0x31, 0xff, 0x24,
+  0x1c, 0xc7, 0xcb, 0x13, 0xfc, 0xff, 0x26, 0x15, 0xbb, 0xde, 0xe1, 0x0d,
+  0x08, 0x0d, 0xf0, 0xf9, 0x18, 0xfc, 0xe7, 0x29, 0x0f, 0xff, 0x2e, 0x1b,
+  0xf2, 0x22, 0x93, 0x09, 0x0b, 0x0e, 0x2b, 0x05, 0x17, 0xfc, 0xd4, 0x02,
+  0x24, 0xbd, 0x0a, 0xce, 0xf0, 0x17, 0x12, 0x96, 0x28, 0x31, 0x18, 0xfe,
+  0x2b, 0xe3, 0xf3, 0x36, 0x25, 0xf7, 0x18, 0xf3, 0x1b, 0x19, 0xa0, 0xfe,
+  0x0a, 0xf0, 0x17, 0x33, 0x06, 0xfa, 0xf1, 0x1d, 0x1b, 0xd3, 0xeb, 0xc9,
+  0x1b, 0x1d, 0x06, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x56, 0xf2, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x8c, 0xd4, 0xde, 0x1d,
+  0x4a, 0x51, 0x81, 0xbd, 0x33, 0xb9, 0x18, 0x49, 0xcb, 0x7f, 0xec, 0x49,
+  0x34, 0x8b, 0x7f, 0x39, 0xfb, 0x2b, 0x5c, 0x48, 0xf1, 0x7b, 0x32, 0xdc,
+  0xf2, 0x3c, 0x11, 0x45, 0x55, 0x81, 0x87, 0x07, 0x33, 0xf6, 0xef, 0x3d,
+  0xf0, 0xc9, 0x37, 0xcf, 0x81, 0x15, 0xcf, 0x81, 0x29, 0x3c, 0x0b, 0xd0,
+  0x1a, 0x39, 0xb4, 0xe9, 0x7f, 0x25, 0x45, 0xf2, 0x48, 0xc8, 0xa9, 0xd7,
+  0x81, 0x9f, 0x9e, 0xd2, 0x53, 0xbf, 0x1f, 0x35, 0x8b, 0x51, 0x24, 0x94,
+  0x32, 0x33, 0x7f, 0xf4, 0x32, 0x1f, 0xd0, 0xd2, 0x1f, 0xe3, 0x81, 0x69,
+  0x4d, 0x01, 0xb8, 0x10, 0x57, 0xd7, 0xd2, 0x35, 0x3a, 0x7f, 0xa7, 0x42,
+  0x81, 0xa1, 0xa9, 0x98, 0x4f, 0x4e, 0x68, 0x7d, 0x9d, 0x4d, 0x5f, 0x71,
+  0x7f, 0xbb, 0x62, 0xe1, 0x81, 0x81, 0xc5, 0x35, 0xfc, 0x78, 0x75, 0x70,
+  0x02, 0x93, 0x35, 0x38, 0x2d, 0x09, 0x29, 0x50, 0x81, 0x92, 0xc2, 0x6d,
+  0xd7, 0x81, 0x39, 0x1c, 0xaf, 0x10, 0x62, 0x48, 0x82, 0xfb, 0x5a, 0x3f,
+  0x6f, 0x11, 0x09, 0x0e, 0x81, 0x0c, 0xb5, 0x81, 0x2e, 0xf9, 0x0c, 0xf3,
+  0x67, 0x64, 0xee, 0x7f, 0x62, 0xc8, 0xe3, 0x2a, 0x2a, 0x4e, 0x1a, 0x81,
+  0xd5, 0x24, 0xb0, 0x13, 0x4c, 0xe1, 0x49, 0x2a, 0xeb, 0x8c, 0xf1, 0x61,
+  0xf2, 0x81, 0x3c, 0x51, 0x03, 0x53, 0xa6, 0x9e, 0x7f, 0xec, 0x8a, 0x4f,
+  0x52, 0x15, 0x3b, 0x2b, 0x81, 0x13, 0x5e, 0x43, 0x8c, 0xf2, 0x67, 0x8f,
+  0xd5, 0x2c, 0xff, 0x4a, 0x42, 0x1d, 0x36, 0x81, 0xf0, 0x34, 0x5a, 0x28,
+  0x15, 0x44, 0x54, 0x3a, 0x7f, 0x3f, 0x65, 0x63, 0x57, 0x1c, 0xd3, 0xd9,
+  0x81, 0x82, 0xcd, 0x81, 0xa2, 0x09, 0x11, 0x21, 0x5f, 0x67, 0x38, 0x10,
+  0x27, 0x7f, 0x97, 0xdc, 0xcf, 0x93, 0x86, 0x9b, 0x60, 0x28, 0x98, 0x5b,
+  0x02, 0x81, 0x44, 0x18, 0x8a, 0x58, 0x22, 0x35, 0x28, 0x44, 0x99, 0x38,
+  0x4d, 0x81, 0x2f, 0x29, 0x21, 0xf9, 0x2e, 0x43, 0x81, 0xdc, 0x4c, 0x7f,
+  0x5a, 0x75, 0xda, 0x04, 0xf8, 0x83, 0x87, 0x9f, 0x00, 0x00, 0x00, 0x00,
+  0x86, 0xf3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0x00,
+  0xe0, 0xdd, 0xf2, 0xff, 0xcf, 0xe1, 0xdc, 0xe7, 0xed, 0xee, 0xee, 0xe6,
+  0x03, 0xdf, 0xfb, 0xd7, 0xdf, 0xf4, 0xd6, 0xe4, 0xef, 0x01, 0xf3, 0xe7,
+  0xf0, 0xf8, 0xef, 0xe1, 0xf3, 0xef, 0xf6, 0xee, 0xf1, 0x08, 0xf2, 0x02,
+  0xef, 0x08, 0x04, 0xd4, 0xf9, 0xfa, 0xfc, 0xee, 0xfc, 0x0c, 0xfe, 0xff,
+  0xeb, 0xf6, 0xee, 0xd0, 0xf4, 0xf8, 0x0d, 0xed, 0xdc, 0x09, 0xf1, 0xe1,
+  0x01, 0xee, 0x00, 0xec, 0xc3, 0xff, 0xdb, 0xd9, 0xf6, 0xf8, 0xf1, 0xf6,
+  0xf2, 0xff, 0xfc, 0xe7, 0xed, 0xfe, 0xe0, 0xef, 0xed, 0xf5, 0x02, 0x00,
+  0xfd, 0xf3, 0xe8, 0xf4, 0xf0, 0x02, 0xe9, 0xf7, 0xf5, 0xeb, 0xf9, 0xf3,
+  0xe4, 0xfe, 0xe7, 0xee, 0xf8, 0xf6, 0x16, 0xf1, 0xed, 0xfe, 0xf7, 0xd8,
+  0xf4, 0x03, 0xda, 0xc7, 0x08, 0xfa, 0x14, 0xf3, 0x09, 0xf1, 0xf4, 0xb5,
+  0x06, 0xf5, 0x08, 0xde, 0xdc, 0xfa, 0xf4, 0xef, 0x06, 0xf4, 0x00, 0xff,
+  0x0f, 0xf0, 0xfb, 0xde, 0xe4, 0xf8, 0xf8, 0x04, 0xf5, 0xdc, 0x03, 0x07,
+  0x00, 0xe6, 0xde, 0xe7, 0xe8, 0xd8, 0xc8, 0x0d, 0xcd, 0xd0, 0xe7, 0xca,
+  0x05, 0xd9, 0xf4, 0xe0, 0xfb, 0xf3, 0xee, 0xe1, 0x00, 0xcf, 0xd8, 0x04,
+  0xf9, 0xee, 0xff, 0xe2, 0xe9, 0xf9, 0x12, 0xf7, 0x18, 0xcb, 0xf4, 0xf6,
+  0x05, 0xe2, 0xf9, 0xdd, 0xf0, 0xec, 0x01, 0x00, 0xf4, 0xd3, 0x00, 0x09,
+  0xfc, 0xf0, 0xf4, 0xde, 0xf2, 0xfd, 0x05, 0xf7, 0xf8, 0xdc, 0xeb, 0xf8,
+  0xf1, 0xf3, 0xea, 0xc9, 0xf4, 0x13, 0xf8, 0x0f, 0xe2, 0xe1, 0xe9, 0xe7,
+  0xff, 0xf2, 0xf1, 0xf3, 0xfc, 0x05, 0xd4, 0xe2, 0x01, 0xe5, 0xf7, 0x01,
+  0xfa, 0xf0, 0xf0, 0x0c, 0xf1, 0xe1, 0xe2, 0xf2, 0x0a, 0xe5, 0x05, 0x0b,
+  0xfc, 0xf6, 0x05, 0xf0, 0xfd, 0xda, 0x02, 0xd0, 0xfe, 0xe1, 0xe0, 0xff,
+  0xf6, 0xf7, 0xf2, 0xee, 0xf9, 0xee, 0x05, 0x02, 0xf9, 0xd8, 0xe4, 0xc8,
+  0xe8, 0x0a, 0xf7, 0x00, 0xfb, 0x00, 0x07, 0x09, 0xc1, 0xf8, 0xee, 0xda,
+  0xe6, 0xfa, 0xf4, 0x0c, 0xfd, 0xfd, 0xc9, 0xed, 0xcd, 0x05, 0xf7, 0xea,
+  0xf6, 0xde, 0xff, 0xf9, 0xf7, 0xd7, 0xca, 0xee, 0x00, 0xee, 0xff, 0x11,
+  0xca, 0xe1, 0xcb, 0xfa, 0xd1, 0xf3, 0xe0, 0xf8, 0xe1, 0xf7, 0xd1, 0xe1,
+  0xf0, 0xf5, 0xe8, 0xe3, 0xed, 0xf1, 0x14, 0xf5, 0x0f, 0xf7, 0xf6, 0xfd,
+  0x11, 0xe1, 0xf9, 0xd7, 0xec, 0x03, 0x1d, 0x11, 0x0b, 0xfc, 0xf7, 0x00,
+  0x03, 0xea, 0xea, 0xf9, 0xdc, 0xf3, 0x0d, 0x14, 0x1e, 0xf1, 0x0b, 0x08,
+  0x11, 0xf2, 0xf7, 0xfc, 0xdf, 0xf4, 0x05, 0xfd, 0x0e, 0xf4, 0xf6, 0x01,
+  0xd9, 0xf3, 0xe4, 0xfd, 0xee, 0xee, 0xeb, 0xed, 0xf2, 0xe6, 0xe4, 0xe2,
+  0xdc, 0xef, 0xfc, 0xec, 0xec, 0xe4, 0xf0, 0xcc, 0xe9, 0xf0, 0xef, 0xe0,
+  0x01, 0xf9, 0xff, 0xe2, 0xe7, 0xfd, 0xf3, 0xf2, 0x08, 0xe8, 0x02, 0xf7,
+  0xf2, 0xf9, 0xde, 0xeb, 0xde, 0x07, 0xfe, 0x08, 0x19, 0xee, 0x02, 0x37,
+  0xfa, 0xe4, 0xda, 0xe8, 0xf6, 0xda, 0xeb, 0xf2, 0xfc, 0xd6, 0xef, 0xf3,
+  0xc3, 0xee, 0xd9, 0x09, 0xee, 0xeb, 0xbf, 0xd4, 0xd4, 0xf1, 0xe5, 0xe6,
+  0xe3, 0xd9, 0xff, 0x02, 0xef, 0xf4, 0xb5, 0xeb, 0x04, 0xe9, 0xf7, 0xf6,
+  0xfd, 0xd2, 0xf0, 0xf7, 0xd5, 0xed, 0xf5, 0xdf, 0x10, 0xc5, 0xf6, 0x19,
+  0xf9, 0xf5, 0xca, 0xe6, 0xd4, 0xe7, 0x07, 0x0a, 0xe5, 0xd8, 0x15, 0xd0,
+  0xc3, 0xdf, 0xdb, 0xf3, 0xea, 0xf0, 0xd7, 0xf7, 0xfd, 0xdf, 0xa6, 0xf3,
+  0xd3, 0xf1, 0xf0, 0x08, 0xdd, 0xf4, 0xe7, 0xec, 0xf0, 0xfb, 0xe9, 0xef,
+  0xf8, 0xed, 0xfc, 0xe7, 0xe6, 0xee, 0xd9, 0xed, 0xf0, 0xfd, 0xeb, 0xfa,
+  0xfd, 0xe4, 0xf2, 0x0f, 0xda, 0xd8, 0x0e, 0x0f, 0x0d, 0xe2, 0xff, 0x10,
+  0xe3, 0xfa, 0xe0, 0xec, 0xf7, 0xfa, 0x12, 0x06, 0x00, 0xfa, 0xec, 0xf5,
+  0xd8, 0xff, 0xfa, 0xd4, 0xf0, 0xfd, 0xc8, 0xed, 0xef, 0xf7, 0xe8, 0xfe,
+  0xea, 0x04, 0xff, 0xef, 0xfe, 0x11, 0xf3, 0xe6, 0xf2, 0x09, 0x01, 0xfd,
+  0xf4, 0xf2, 0x08, 0xf9, 0xf7, 0xec, 0xf4, 0x0c, 0xfa, 0xf8, 0xff, 0x0c,
+  0xfb, 0xeb, 0xe8, 0x00, 0xf2, 0xdd, 0xfb, 0x07, 0x11, 0xfc, 0x01, 0x01,
+  0xdf, 0x11, 0xe7, 0xec, 0xf7, 0x10, 0x14, 0xe5, 0xf6, 0xfe, 0xf2, 0xfb,
+  0xaf, 0x01, 0xe1, 0x02, 0x06, 0x12, 0xf7, 0xe9, 0xd6, 0xf8, 0xdc, 0xcc,
+  0xed, 0xf8, 0xf3, 0x0d, 0xef, 0xea, 0xd8, 0xdd, 0xe9, 0xea, 0xf3, 0xe4,
+  0xf5, 0xfd, 0xf3, 0x24, 0xf7, 0xf4, 0xef, 0xdc, 0xf3, 0xf4, 0x06, 0x01,
+  0xfa, 0xfb, 0xfc, 0x0f, 0xf9, 0xff, 0x06, 0xfb, 0xec, 0x00, 0xee, 0xf9,
+  0xe6, 0x04, 0x05, 0xe7, 0xfa, 0xf8, 0x08, 0xf2, 0xe5, 0x05, 0xed, 0xe1,
+  0xc2, 0xf7, 0xd5, 0xd0, 0xeb, 0xf2, 0xea, 0xfe, 0xd9, 0xeb, 0xf5, 0xac,
+  0xe9, 0xe7, 0xfa, 0x03, 0xeb, 0xfe, 0xd2, 0x07, 0xe8, 0xf9, 0xe8, 0xfc,
+  0xf0, 0xef, 0xf8, 0xfd, 0xf8, 0xf0, 0xe0, 0xda, 0xe4, 0xfd, 0xeb, 0xee,
+  0xe2, 0xf5, 0xf1, 0xff, 0xe7, 0xf1, 0xe9, 0xf7, 0xeb, 0xfd, 0xe5, 0xe8,
+  0xf4, 0xf3, 0xf9, 0x01, 0xf4, 0xe8, 0x07, 0xf5, 0x0a, 0xeb, 0xd2, 0xda,
+  0xf8, 0xe2, 0xe5, 0xcc, 0xd9, 0xf2, 0xe8, 0xf8, 0xf4, 0xeb, 0xd8, 0xd0,
+  0xe1, 0x03, 0x0a, 0x09, 0xd5, 0x07, 0xd0, 0xf7, 0xe9, 0x0f, 0xf9, 0xef,
+  0xec, 0x07, 0x0a, 0x00, 0xed, 0xef, 0xae, 0xd3, 0xe1, 0x12, 0xfa, 0xff,
+  0xea, 0xf3, 0xf9, 0xfa, 0xf4, 0xf0, 0xc4, 0xe7, 0xe8, 0x17, 0xf4, 0xf9,
+  0x11, 0xe6, 0xf8, 0xee, 0xf2, 0x04, 0xe0, 0xf6, 0xfd, 0x04, 0xf1, 0x00,
+  0xf3, 0xf1, 0xf8, 0xdd, 0xf4, 0xf4, 0xed, 0xf9, 0xf1, 0xf4, 0xeb, 0x0d,
+  0x04, 0x00, 0xf8, 0xe9, 0xf2, 0x08, 0xf2, 0xe4, 0x07, 0xf4, 0x16, 0xfc,
+  0x0a, 0xe9, 0xfa, 0xe5, 0xfe, 0x01, 0xf6, 0xd0, 0x00, 0xe2, 0x10, 0x16,
+  0x08, 0x00, 0xf5, 0xf5, 0xff, 0xec, 0xed, 0xea, 0xef, 0xde, 0x0e, 0xfc,
+  0xf7, 0xff, 0x00, 0xf8, 0x01, 0x01, 0xf2, 0xf8, 0xec, 0xfe, 0x06, 0x09,
+  0xce, 0x02, 0x03, 0xfa, 0x05, 0x10, 0xfe, 0xf5, 0xc9, 0x03, 0x18, 0x1f,
+  0xef, 0xe7, 0xed, 0xf7, 0xfc, 0xf2, 0xec, 0x14, 0xf9, 0xd5, 0xfd, 0xfd,
+  0x04, 0xe1, 0xeb, 0xfa, 0xfd, 0xea, 0x09, 0x0d, 0xf8, 0xd7, 0xf0, 0xf9,
+  0xd9, 0xf7, 0xfa, 0xfd, 0x02, 0xf7, 0xfc, 0xfe, 0xcc, 0xed, 0x00, 0xcb,
+  0xda, 0x0a, 0xfa, 0xf5, 0x0d, 0xfd, 0x05, 0xeb, 0xc3, 0xfe, 0xf6, 0xd0,
+  0xb4, 0x14, 0xf9, 0x04, 0x07, 0x1d, 0x1f, 0xf4, 0xdc, 0x36, 0xfa, 0xee,
+  0xe6, 0xf7, 0xf7, 0xfc, 0x02, 0xf2, 0xef, 0xe0, 0xea, 0xfb, 0xf8, 0x00,
+  0xe7, 0x0b, 0xf4, 0x0e, 0xff, 0x00, 0xee, 0xd1, 0xec, 0xfa, 0xfd, 0xf6,
+  0xe2, 0xff, 0x01, 0xfc, 0x00, 0xfd, 0xff, 0xed, 0xe7, 0x0e, 0xfd, 0xeb,
+  0xd8, 0xf7, 0xf5, 0xe8, 0xf5, 0xf7, 0xf9, 0xfe, 0xd9, 0xf4, 0xf5, 0xe0,
+  0xcf, 0xf5, 0xef, 0xd5, 0xeb, 0xe7, 0xef, 0x0a, 0xd5, 0xfb, 0xd8, 0xc8,
+  0xd6, 0xe5, 0xea, 0x0e, 0xea, 0xf5, 0xda, 0xf6, 0xed, 0xee, 0xe5, 0xe7,
+  0xe1, 0xea, 0x05, 0x03, 0xed, 0xfd, 0xcb, 0xcb, 0xea, 0xf2, 0xf6, 0xc4,
+  0xfa, 0xf0, 0x0d, 0xf2, 0xfa, 0xeb, 0xe1, 0xba, 0xee, 0xfe, 0x0a, 0xbf,
+  0x09, 0xfa, 0x1b, 0xed, 0xf5, 0xe9, 0xf6, 0xed, 0xfc, 0xef, 0xf1, 0xcc,
+  0xf8, 0xf7, 0xf6, 0xe9, 0xe8, 0xf3, 0xc8, 0xf2, 0xef, 0xe3, 0xd4, 0xd0,
+  0xcd, 0xd6, 0xd1, 0x06, 0xde, 0xf4, 0xcc, 0x07, 0xde, 0xf3, 0xe2, 0xd1,
+  0xda, 0xe4, 0xfc, 0x01, 0x00, 0xee, 0xca, 0xf1, 0xf1, 0xfc, 0xfc, 0xc4,
+  0xfb, 0xf5, 0x05, 0xf4, 0xf7, 0xfb, 0x06, 0xd4, 0xe8, 0xf2, 0x27, 0xe2,
+  0xf9, 0x02, 0x0a, 0x00, 0x0e, 0xe7, 0x03, 0xff, 0xdb, 0xfb, 0x0b, 0xb8,
+  0xd0, 0xf5, 0xef, 0x00, 0x10, 0xf7, 0xe9, 0x0b, 0xd9, 0xf9, 0xc4, 0xc2,
+  0xcc, 0x05, 0xcb, 0xe1, 0xdb, 0xe8, 0xf3, 0xf4, 0xdf, 0x0a, 0xf1, 0xe1,
+  0xce, 0xec, 0xe4, 0xea, 0xec, 0xf7, 0xdd, 0xf2, 0xf0, 0x05, 0xe4, 0xd3,
+  0xe2, 0xf7, 0xe7, 0xff, 0x04, 0xf6, 0xf8, 0xe4, 0xe9, 0x03, 0xf3, 0xe1,
+  0xff, 0x0f, 0x0c, 0xf3, 0x0a, 0xed, 0xf7, 0xed, 0xf0, 0xff, 0xf2, 0xe4,
+  0xeb, 0xea, 0xff, 0xd9, 0xea, 0x00, 0xe6, 0x08, 0x08, 0xd9, 0xd3, 0xc8,
+  0xde, 0x08, 0xea, 0xf1, 0x01, 0xf6, 0xf1, 0xd9, 0xea, 0x0a, 0xf0, 0xe0,
+  0xc9, 0x0b, 0xee, 0xfa, 0xec, 0x01, 0xe8, 0xde, 0xdf, 0xf9, 0xf9, 0xde,
+  0xf4, 0x04, 0x0c, 0xf4, 0xe4, 0x06, 0xd6, 0xcf, 0xd8, 0xfe, 0x00, 0xef,
+  0x01, 0xf9, 0x08, 0xf8, 0xfb, 0xeb, 0xcb, 0xe7, 0xf9, 0xf3, 0xfc, 0xf2,
+  0x03, 0xd8, 0xeb, 0xe7, 0xe8, 0xea, 0xb3, 0x06, 0xf2, 0xc1, 0x01, 0x0b,
+  0xf8, 0x08, 0xfd, 0xef, 0xf2, 0xf3, 0x0c, 0xfb, 0x03, 0x01, 0xf7, 0xef,
+  0xfe, 0xf0, 0xe2, 0xd8, 0xce, 0xfd, 0xfa, 0x13, 0xfe, 0x05, 0xf5, 0xfc,
+  0x03, 0xdd, 0xea, 0xd7, 0xae, 0xf4, 0xfe, 0x25, 0x17, 0xf1, 0xe9, 0xf6,
+  0x08, 0xd8, 0xf6, 0xd2, 0xc2, 0x09, 0x00, 0x0d, 0x18, 0xe4, 0xef, 0xff,
+  0x19, 0xe3, 0x05, 0xcf, 0xc7, 0x0a, 0xfc, 0xf8, 0x1a, 0xf0, 0xf5, 0x03,
+  0xf6, 0xf8, 0xf0, 0xf5, 0xed, 0x04, 0x03, 0xe7, 0xf3, 0x02, 0x01, 0xee,
+  0x01, 0xf0, 0x04, 0xbb, 0xe1, 0xf8, 0x04, 0x0c, 0x06, 0xfc, 0xfa, 0x05,
+  0x12, 0xe9, 0xe7, 0xdd, 0xeb, 0xf4, 0xe8, 0x09, 0xff, 0xd3, 0xed, 0xed,
+  0x08, 0xdc, 0xe4, 0xcf, 0xed, 0xfd, 0xf6, 0x0a, 0x17, 0xc3, 0xef, 0x0d,
+  0xfd, 0xe5, 0xf2, 0xf0, 0xec, 0xf8, 0xe7, 0x0a, 0x02, 0xe9, 0x02, 0x0c,
+  0xf8, 0x09, 0x09, 0xf1, 0x04, 0xfa, 0x05, 0xd1, 0x07, 0xf4, 0x05, 0x00,
+  0x0a, 0xfc, 0xf6, 0xe2, 0xf4, 0xfd, 0x0f, 0xf3, 0xf1, 0xe6, 0x0c, 0x02,
+  0xd9, 0xfd, 0xe6, 0xf9, 0x0c, 0xfd, 0xf8, 0xf8, 0xe7, 0xef, 0xee, 0xe3,
+  0x02, 0xee, 0xf5, 0xe1, 0xff, 0x00, 0x01, 0xf2, 0xfb, 0xec, 0xf5, 0xff,
+  0xe0, 0xfa, 0xf6, 0xfe, 0x08, 0xfe, 0x04, 0x06, 0xdd, 0xe5, 0xee, 0xf3,
+  0xf1, 0xf9, 0xfd, 0xfb, 0xf7, 0xe2, 0xfc, 0xe6, 0xe7, 0xf3, 0x03, 0xf5,
+  0xfc, 0xfb, 0xf7, 0xfc, 0xfa, 0xec, 0xf6, 0xec, 0xe1, 0xff, 0xf8, 0xdf,
+  0xf3, 0x03, 0xff, 0xef, 0x02, 0xea, 0xd5, 0xf3, 0x01, 0xfe, 0xe8, 0xe6,
+  0x01, 0x02, 0x02, 0x0b, 0x09, 0xec, 0xf2, 0xed, 0x04, 0xf4, 0x00, 0xd8,
+  0xd7, 0x02, 0x04, 0x03, 0x08, 0xea, 0x00, 0xf2, 0xe4, 0xe8, 0xf7, 0xdb,
+  0xd0, 0xd2, 0xfa, 0xf2, 0xe9, 0xe0, 0xb2, 0x0f, 0xf1, 0xf2, 0xe9, 0xdc,
+  0xfe, 0xd9, 0xf5, 0xec, 0xdb, 0xee, 0xc8, 0x04, 0xe3, 0xd0, 0xe9, 0xed,
+  0x03, 0xc4, 0xf9, 0xe8, 0xe6, 0xca, 0xe9, 0xf8, 0xf4, 0xd6, 0xef, 0xf9,
+  0xf8, 0xec, 0xed, 0xe5, 0xfb, 0xc8, 0x04, 0x02, 0x02, 0xd8, 0xe1, 0xe5,
+  0xef, 0x02, 0xee, 0xea, 0xf6, 0xfe, 0x01, 0x01, 0xfe, 0xef, 0xdb, 0xda,
+  0xdd, 0xea, 0xec, 0xeb, 0xdf, 0xf5, 0xf5, 0xdc, 0x03, 0xfc, 0xee, 0xe3,
+  0xea, 0xfb, 0xf5, 0xc2, 0xf2, 0xea, 0x04, 0xe6, 0x04, 0xf2, 0xfe, 0xf1,
+  0xef, 0xf5, 0xf7, 0xf1, 0xfe, 0x04, 0xdf, 0xcc, 0xf2, 0xf4, 0xef, 0xf9,
+  0xf6, 0xfc, 0xfd, 0x0a, 0x07, 0xfd, 0xdc, 0xde, 0xd3, 0x00, 0xfb, 0x11,
+  0xe6, 0xfc, 0x16, 0x12, 0x0e, 0xfb, 0xc4, 0xe8, 0xf7, 0xf6, 0xfb, 0x2c,
+  0xf0, 0xe0, 0xda, 0xce, 0xf6, 0xef, 0xf4, 0xd4, 0xf9, 0xd9, 0xf5, 0xf1,
+  0xfc, 0xfa, 0xee, 0xca, 0xf4, 0xee, 0xfe, 0xf8, 0x0b, 0xde, 0xf5, 0xf8,
+  0xf5, 0x01, 0xe6, 0xf2, 0xee, 0xec, 0xf6, 0x08, 0xe5, 0xfa, 0x01, 0x00,
+  0xba, 0xf7, 0xfb, 0x08, 0x09, 0xec, 0xe9, 0xec, 0xa3, 0x0b, 0xf4, 0x09,
+  0x83, 0x02, 0x17, 0x1e, 0x18, 0x0b, 0xd7, 0xe5, 0xc8, 0xfb, 0x0a, 0x05,
+  0xe7, 0xed, 0xe3, 0xf5, 0xed, 0xe5, 0x03, 0xca, 0xe6, 0xfe, 0xe3, 0xe9,
+  0xf1, 0xfa, 0xef, 0xfe, 0x00, 0xfd, 0x01, 0xe2, 0xfa, 0xf1, 0xe3, 0xfe,
+  0xe0, 0xfa, 0xe8, 0xf2, 0xef, 0xfb, 0xf8, 0x00, 0xe1, 0x0c, 0xf6, 0xe4,
+  0xc5, 0xf7, 0xe9, 0xf1, 0xff, 0xf4, 0xf2, 0x01, 0xed, 0x0f, 0xe3, 0xc7,
+  0x9e, 0xfa, 0xf1, 0xf2, 0xeb, 0x09, 0xee, 0xec, 0xd3, 0x06, 0xbd, 0xb6,
+  0xdf, 0xfc, 0xdc, 0x02, 0xed, 0xfe, 0xf6, 0xec, 0xea, 0x15, 0xf0, 0xe5,
+  0xe2, 0x05, 0xfd, 0x02, 0xf8, 0xf1, 0xf4, 0xe9, 0xdb, 0x1e, 0xeb, 0xd4,
+  0xf3, 0xf9, 0xfc, 0xec, 0xfc, 0xfd, 0xf7, 0x04, 0xed, 0xf7, 0xe6, 0xfa,
+  0xf6, 0xfa, 0xf5, 0xea, 0xe2, 0xed, 0x00, 0xf0, 0xf4, 0xf4, 0xec, 0xfd,
+  0xff, 0xf5, 0xe3, 0xd4, 0xd9, 0xf4, 0xff, 0xfe, 0xf6, 0xeb, 0xdc, 0xd2,
+  0xe0, 0xf8, 0xe5, 0x02, 0xf7, 0x05, 0xec, 0xfb, 0xf3, 0x07, 0xe9, 0xf0,
+  0xdd, 0xff, 0x05, 0xfc, 0xfa, 0xf9, 0xf4, 0xed, 0xfa, 0x03, 0x09, 0xe1,
+  0xf2, 0x02, 0x09, 0xfa, 0xf8, 0x04, 0xe9, 0xf3, 0xfa, 0x0f, 0x16, 0xfe,
+  0x10, 0xf4, 0xf5, 0xf9, 0xe4, 0x04, 0xb9, 0xf1, 0xed, 0xfc, 0x00, 0x0b,
+  0xf6, 0xe4, 0xf1, 0xec, 0xf2, 0xf3, 0xd7, 0xec, 0x04, 0xec, 0xfe, 0x11,
+  0x0d, 0xe8, 0xf1, 0xe8, 0xe7, 0xf8, 0xf6, 0xfb, 0x04, 0xf4, 0xfa, 0xff,
+  0x05, 0xd9, 0xef, 0xe9, 0xbd, 0xe8, 0xe2, 0x13, 0xfd, 0xd9, 0xe2, 0xfc,
+  0x04, 0xd6, 0xfa, 0xea, 0xdd, 0xe0, 0xde, 0x15, 0x00, 0xe4, 0xf3, 0xfb,
+  0xfb, 0xe5, 0xfa, 0x0c, 0xe9, 0xe5, 0xe6, 0xf0, 0x01, 0xe2, 0x00, 0x0b,
+  0xfd, 0xf6, 0xec, 0x1b, 0x06, 0xed, 0xe0, 0xe7, 0xfa, 0xf4, 0xf5, 0xdd,
+  0x00, 0xd7, 0xf3, 0xe7, 0xde, 0xf1, 0xf3, 0xf9, 0x03, 0xdc, 0xf5, 0xfb,
+  0x0b, 0xdf, 0x02, 0xe9, 0xd4, 0x00, 0xf1, 0x07, 0xfc, 0xdf, 0xfc, 0xfa,
+  0x05, 0xe1, 0xef, 0xf2, 0xdc, 0xfd, 0xd7, 0x0f, 0xf0, 0xdc, 0xf6, 0x13,
+  0xef, 0xea, 0x05, 0x08, 0xf9, 0xf5, 0xd1, 0xfd, 0xd6, 0xfe, 0xf1, 0x0c,
+  0xd8, 0xff, 0x02, 0x0b, 0xf9, 0xed, 0xd6, 0xf1, 0xc8, 0x1c, 0xeb, 0x06,
+  0x00, 0xdf, 0xef, 0xca, 0xe4, 0xf2, 0x03, 0xf5, 0x0c, 0xd2, 0xec, 0xf9,
+  0x01, 0xe1, 0xfd, 0xb9, 0xd7, 0x06, 0xf0, 0x0b, 0xfd, 0xd2, 0xfa, 0x10,
+  0xfa, 0xf8, 0xe7, 0xe6, 0xfb, 0x13, 0xf6, 0xfc, 0xe1, 0xf3, 0x0a, 0x0b,
+  0xe6, 0x17, 0xf5, 0xea, 0x09, 0xfa, 0xdf, 0xf8, 0xea, 0x10, 0x06, 0xf4,
+  0xea, 0x05, 0x09, 0xce, 0xf6, 0x0a, 0xf1, 0xdd, 0xdb, 0x10, 0xf2, 0xc9,
+  0xfd, 0xe2, 0xf1, 0xec, 0xf3, 0xe2, 0x01, 0xda, 0x04, 0xb8, 0xef, 0x06,
+  0x00, 0xf4, 0xf2, 0xc7, 0xfd, 0xf1, 0x04, 0xf4, 0x07, 0xc8, 0xf3, 0xff,
+  0xed, 0xf6, 0xe0, 0xdf, 0x03, 0x09, 0x08, 0xfb, 0xf8, 0xe1, 0x06, 0xe3,
+  0xfc, 0x01, 0xfa, 0xe1, 0x03, 0xee, 0xe7, 0xe9, 0xe2, 0xef, 0xf6, 0xe9,
+  0xf9, 0xf9, 0xf3, 0xf5, 0xfb, 0xed, 0xed, 0xfa, 0xfe, 0xea, 0xfc, 0xeb,
+  0xdf, 0xb5, 0xdf, 0xef, 0xeb, 0xb6, 0xe5, 0xd2, 0xec, 0xd8, 0xdf, 0xf0,
+  0xf8, 0xe8, 0xf4, 0xfb, 0x0a, 0xdc, 0x0e, 0xc9, 0x04, 0xd8, 0xe3, 0xc8,
+  0xdd, 0x09, 0xe1, 0xf5, 0x02, 0xf3, 0x08, 0xe2, 0xe0, 0xf8, 0xf0, 0x85,
+  0xe4, 0x03, 0xf5, 0x03, 0x09, 0xf4, 0xed, 0xef, 0xd2, 0xeb, 0xf3, 0xd5,
+  0xe9, 0xee, 0xfe, 0xfb, 0xfd, 0xf2, 0xd4, 0xf9, 0xf0, 0xcc, 0xe3, 0xea,
+  0xe3, 0x05, 0xf3, 0xf7, 0x02, 0xf1, 0x00, 0x0b, 0xf9, 0x01, 0xea, 0xf4,
+  0xd5, 0x05, 0xfe, 0xdb, 0x07, 0x0b, 0x29, 0x09, 0xfa, 0x0a, 0xf5, 0xfb,
+  0xd7, 0xf3, 0xe8, 0xe0, 0x0c, 0x03, 0xf0, 0xe7, 0xc4, 0x04, 0x03, 0xe8,
+  0xe2, 0xf5, 0xf8, 0xd9, 0x00, 0xef, 0xda, 0xf5, 0xad, 0x04, 0xe2, 0x00,
+  0xe8, 0xf1, 0xf9, 0xe7, 0xdb, 0xf9, 0xbb, 0xfc, 0xb7, 0x01, 0xd7, 0x00,
+  0xeb, 0x08, 0xe4, 0x08, 0x0a, 0xfc, 0x04, 0xe4, 0xe7, 0x12, 0xf1, 0xf2,
+  0xee, 0x0b, 0xef, 0x07, 0xf5, 0xf9, 0xf0, 0xf0, 0xf3, 0x1d, 0xee, 0xf3,
+  0xe4, 0x0d, 0xe5, 0x14, 0xf7, 0xea, 0xd9, 0xef, 0x02, 0x02, 0x03, 0xda,
+  0x05, 0x0c, 0x04, 0xff, 0xf4, 0xfc, 0xf7, 0xeb, 0x03, 0x02, 0x05, 0xe5,
+  0xf9, 0xf4, 0xf7, 0xf3, 0xf0, 0xf8, 0xe7, 0xff, 0xf8, 0xfd, 0x01, 0x09,
+  0xe2, 0xfd, 0xf6, 0xfd, 0xf7, 0xec, 0xd4, 0xe8, 0xf1, 0xf7, 0xef, 0xd7,
+  0xee, 0xed, 0xef, 0x12, 0xdb, 0xfd, 0xeb, 0xea, 0xea, 0x07, 0xf9, 0xe0,
+  0xfd, 0xd1, 0xf1, 0x04, 0xf0, 0xee, 0xcd, 0xfe, 0xfe, 0xf7, 0xe0, 0x16,
+  0x0e, 0xe6, 0xfd, 0xe9, 0xf3, 0xf7, 0x09, 0xf6, 0x18, 0xe1, 0xe8, 0xf5,
+  0xf1, 0x07, 0x05, 0xed, 0xf3, 0xfd, 0xff, 0x01, 0xf4, 0xf6, 0xe7, 0xf3,
+  0xe5, 0xe1, 0xf6, 0xfc, 0xd8, 0xf7, 0xd7, 0x06, 0xf2, 0xea, 0xf0, 0xda,
+  0xf3, 0xed, 0xf8, 0x14, 0xfa, 0xf6, 0xd4, 0x2b, 0xe7, 0xeb, 0x04, 0xe5,
+  0xec, 0xe9, 0xff, 0xf1, 0xf5, 0xee, 0xe0, 0x07, 0x05, 0xf4, 0xfc, 0x07,
+  0xf8, 0xfa, 0xdf, 0x04, 0xf0, 0xfa, 0xf1, 0xf1, 0x03, 0xf7, 0x04, 0x17,
+  0xeb, 0xfb, 0xfd, 0x0d, 0xfd, 0xe1, 0xe2, 0xfb, 0xf0, 0xfd, 0xfb, 0x03,
+  0x00, 0xed, 0x00, 0xdf, 0xd5, 0x08, 0xb3, 0xf0, 0xfe, 0xf8, 0xf5, 0xf4,
+  0x0c, 0xc9, 0x01, 0xe9, 0xcb, 0xeb, 0xcc, 0x03, 0xfc, 0xdc, 0xfb, 0xf3,
+  0x0c, 0xc5, 0xe8, 0xe5, 0xdb, 0xcd, 0xf6, 0x03, 0x0d, 0xc2, 0xed, 0x03,
+  0xf7, 0xe1, 0xe2, 0xe7, 0xdf, 0xe6, 0xfa, 0x00, 0x0b, 0xda, 0xe2, 0xfa,
+  0xdb, 0xcd, 0x01, 0xf4, 0xed, 0xc4, 0xcd, 0xfc, 0xe0, 0xcc, 0xc9, 0xdb,
+  0xeb, 0xe3, 0xfd, 0xeb, 0xe0, 0xf3, 0xe1, 0xdd, 0xff, 0x02, 0xfd, 0xfc,
+  0xf7, 0x02, 0x0a, 0xde, 0xe1, 0x03, 0xd6, 0xb4, 0xf5, 0xfa, 0xf8, 0xf3,
+  0xef, 0xff, 0xfe, 0xde, 0xef, 0xf9, 0xdf, 0xc0, 0xe7, 0xfe, 0xf7, 0x01,
+  0xf0, 0xf9, 0xf8, 0xe4, 0xfb, 0x04, 0xe4, 0xf1, 0xe0, 0xfb, 0xf6, 0xf6,
+  0xda, 0xf8, 0xf2, 0xdf, 0x02, 0x09, 0xea, 0xfc, 0xd9, 0xff, 0xeb, 0xea,
+  0xf4, 0xf5, 0xf4, 0xec, 0xfe, 0xfc, 0x00, 0xc7, 0x0a, 0x03, 0xf6, 0x00,
+  0xeb, 0xea, 0xff, 0xd2, 0x06, 0xef, 0x07, 0xf4, 0xf9, 0xf4, 0x02, 0xf6,
+  0xef, 0x04, 0xf1, 0xdf, 0x11, 0xf1, 0x0b, 0xf9, 0xe3, 0xf4, 0xf2, 0xc9,
+  0xf2, 0xed, 0x05, 0xec, 0x0e, 0xfb, 0xd8, 0xec, 0xdf, 0xd7, 0xea, 0xc7,
+  0xf7, 0xfa, 0x04, 0xef, 0xf7, 0xf3, 0xee, 0xf9, 0xff, 0xf8, 0xe9, 0xea,
+  0xeb, 0xdd, 0xe9, 0xf4, 0xf8, 0xef, 0x01, 0xb6, 0xef, 0xeb, 0xfc, 0xfc,
+  0xfd, 0x03, 0xfb, 0xcc, 0x0b, 0xe8, 0x0f, 0xde, 0xfa, 0x01, 0xe5, 0xeb,
+  0xf3, 0x0c, 0xfb, 0xdc, 0x04, 0x0a, 0x08, 0xe8, 0xf5, 0xf1, 0xe6, 0xdb,
+  0xf5, 0x04, 0xf5, 0xf4, 0x04, 0x08, 0xf8, 0xfb, 0xe0, 0xe2, 0xf9, 0xe0,
+  0xe8, 0xfd, 0x15, 0x05, 0x05, 0xe9, 0xee, 0xfd, 0xd3, 0xde, 0x00, 0xe5,
+  0x01, 0xe8, 0xfb, 0xf4, 0xd8, 0xf6, 0xf2, 0xce, 0xff, 0xe9, 0x03, 0x03,
+  0x06, 0xee, 0x14, 0xe2, 0xf0, 0xfb, 0xfc, 0xe7, 0x07, 0xca, 0x04, 0x02,
+  0x05, 0xe5, 0xef, 0xf4, 0x0a, 0xf3, 0xea, 0xff, 0xe9, 0xe0, 0xff, 0xe3,
+  0xe7, 0x04, 0xef, 0xe8, 0x05, 0xfd, 0xf2, 0x0b, 0xdc, 0xe0, 0xee, 0xbf,
+  0xde, 0xf8, 0x00, 0xe0, 0x04, 0xf9, 0xf3, 0x06, 0xf7, 0xde, 0xd1, 0xb7,
+  0xfb, 0xda, 0xcd, 0xe4, 0xf8, 0xe4, 0xff, 0xc8, 0xf8, 0xcd, 0xfc, 0xe7,
+  0xf2, 0xf7, 0xe9, 0xdb, 0x14, 0xd3, 0x0c, 0xee, 0xf8, 0xcf, 0xe6, 0xf8,
+  0xee, 0xfd, 0xf7, 0xdf, 0x09, 0xf5, 0x05, 0xe8, 0xe8, 0xe1, 0xf9, 0xb6,
+  0xec, 0xfd, 0x06, 0xf4, 0xf9, 0x14, 0xd6, 0xf4, 0xd8, 0xde, 0xe3, 0xd7,
+  0xfc, 0xee, 0xf3, 0xf0, 0xf1, 0xfd, 0xcf, 0xfd, 0xf1, 0xcc, 0xfc, 0xed,
+  0xc1, 0xd4, 0xfc, 0xf8, 0xbb, 0xfa, 0xba, 0xc8, 0xea, 0xea, 0xfb, 0xf0,
+  0xf2, 0xea, 0x02, 0xfa, 0xdc, 0xfb, 0xbc, 0x81, 0xe8, 0xf6, 0xff, 0xf5,
+  0xeb, 0x0c, 0x15, 0xda, 0xf4, 0xfc, 0xbb, 0xb7, 0xe4, 0xfe, 0xfa, 0xfd,
+  0xd3, 0x10, 0x04, 0xc3, 0x04, 0x0a, 0xe1, 0xe7, 0xac, 0x11, 0xf0, 0xff,
+  0xcf, 0xfb, 0xf7, 0xdb, 0xfd, 0x03, 0xf6, 0xfa, 0x92, 0x01, 0xec, 0xed,
+  0x07, 0xf6, 0xf8, 0xd6, 0xdf, 0x04, 0xf1, 0xd2, 0xf0, 0xe2, 0x0c, 0x04,
+  0x05, 0xf1, 0x00, 0xe4, 0x07, 0x04, 0xfc, 0xef, 0xff, 0xe6, 0x0d, 0x01,
+  0xfa, 0xf6, 0x0d, 0xe5, 0x06, 0x00, 0xff, 0xf5, 0xde, 0xee, 0x07, 0xea,
+  0xf1, 0xff, 0x04, 0xe2, 0x06, 0xf3, 0xea, 0xfd, 0xdb, 0xec, 0x02, 0xb6,
+  0xec, 0xf9, 0xf3, 0xda, 0xfd, 0xe8, 0xfc, 0x0b, 0xee, 0xf1, 0xdc, 0xae,
+  0xf7, 0xe9, 0xdd, 0xdc, 0xf7, 0xe1, 0xfb, 0xec, 0xf3, 0xd7, 0xef, 0x07,
+  0xf2, 0xf5, 0xe5, 0xd4, 0x0d, 0xe5, 0x0d, 0xf9, 0xef, 0xf6, 0xe7, 0x0b,
+  0xe9, 0x06, 0xfe, 0xfe, 0xfe, 0xf7, 0xf7, 0xda, 0xf6, 0xe5, 0xfa, 0xd4,
+  0xf4, 0x04, 0x06, 0x00, 0xec, 0xec, 0xe7, 0x05, 0xe4, 0xea, 0x14, 0xf1,
+  0x01, 0xec, 0xda, 0xf6, 0xce, 0xfc, 0xe6, 0xf8, 0x02, 0xe0, 0xe9, 0xdb,
+  0xf4, 0xe6, 0xe8, 0xe7, 0xfd, 0xc7, 0x02, 0xcc, 0xee, 0xe2, 0xc6, 0x00,
+  0xef, 0x14, 0xdb, 0xef, 0xfe, 0xfd, 0x04, 0xe5, 0xd0, 0x02, 0xc0, 0xd7,
+  0xed, 0xeb, 0x01, 0x0d, 0x00, 0xf5, 0xd0, 0xda, 0xed, 0x02, 0xe8, 0xeb,
+  0x08, 0xd6, 0x02, 0x05, 0xe5, 0xd7, 0xf8, 0xfa, 0x00, 0xce, 0xf1, 0xe2,
+  0xec, 0xdf, 0xd7, 0xed, 0xd5, 0xd1, 0xf5, 0x03, 0xf5, 0xa8, 0xe2, 0xed,
+  0xdf, 0xe7, 0xf8, 0xf7, 0xde, 0xfa, 0xc5, 0xe1, 0xfd, 0xf1, 0xec, 0xf1,
+  0xf7, 0xf5, 0xef, 0xfb, 0xe9, 0x13, 0xd9, 0xdb, 0xf3, 0x0c, 0xf0, 0xe8,
+  0xff, 0xd1, 0xfd, 0xfa, 0xee, 0xd4, 0xe8, 0x03, 0x01, 0xfb, 0xf3, 0x00,
+  0xfe, 0xd9, 0xfa, 0xfe, 0xf6, 0xed, 0xfe, 0x04, 0x0c, 0xf9, 0xf6, 0xe9,
+  0xfb, 0xf5, 0xdf, 0xd5, 0xfc, 0xf3, 0x03, 0xf1, 0xf1, 0xe1, 0xc1, 0xe7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x56, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff,
+  0xa6, 0x00, 0x00, 0x00, 0x53, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff,
+  0xfa, 0xfd, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x4f, 0xfe, 0xff, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0xff, 0xff, 0x69, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb6, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xc1, 0xea, 0xff, 0xff, 0xd1, 0xf7, 0xff, 0xff, 0xb5, 0xf4, 0xff, 0xff,
+  0xbb, 0xfc, 0xff, 0xff, 0x2b, 0xe9, 0xff, 0xff, 0x08, 0xfa, 0xff, 0xff,
+  0x96, 0xec, 0xff, 0xff, 0x03, 0xfe, 0xff, 0xff, 0x49, 0x08, 0x00, 0x00,
+  0x44, 0x0d, 0x00, 0x00, 0x12, 0xed, 0xff, 0xff, 0x65, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xef, 0xfe, 0xff, 0xff,
+  0xda, 0xc1, 0xff, 0xff, 0x7d, 0xe3, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+  0x10, 0xff, 0xff, 0xff, 0xba, 0xe0, 0xff, 0xff, 0x8c, 0xd4, 0xff, 0xff,
+  0xcd, 0x43, 0x00, 0x00, 0x09, 0x98, 0xff, 0xff, 0x74, 0xfe, 0xff, 0xff,
+  0x29, 0xb3, 0xff, 0xff, 0x9e, 0xe9, 0xff, 0xff, 0x4e, 0xbf, 0xff, 0xff,
+  0xe5, 0xb5, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x86, 0xc6, 0xff, 0xff,
+  0x0a, 0xda, 0xff, 0xff, 0x5a, 0xec, 0xff, 0xff, 0xa5, 0xfe, 0xff, 0xff,
+  0x86, 0xfd, 0xff, 0xff, 0x87, 0xf5, 0xff, 0xff, 0x73, 0xcc, 0xff, 0xff,
+  0x72, 0xb8, 0xff, 0xff, 0xc4, 0xce, 0xff, 0xff, 0xa9, 0xee, 0xff, 0xff,
+  0xa3, 0xfe, 0xff, 0xff, 0x9b, 0x00, 0x00, 0x00, 0xd5, 0x2a, 0x00, 0x00,
+  0x2c, 0xf8, 0xff, 0xff, 0x71, 0xdd, 0xff, 0xff, 0x67, 0xd2, 0xff, 0xff,
+  0xfd, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0xf5, 0xff, 0xff, 0x20, 0xf5, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
+  0x04, 0x02, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb4, 0xf5, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x07, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x79, 0x65,
+  0x72, 0x73, 0x00, 0x0e, 0x00, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x92, 0xc1, 0xa7, 0x3b,
+  0x74, 0x69, 0x6c, 0x65, 0x73, 0x5f, 0x68, 0x00, 0x74, 0x69, 0x6c, 0x65,
+  0x73, 0x5f, 0x77, 0x00, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x73, 0x00, 0x01, 0x80, 0x05, 0x47, 0x32, 0x21, 0x1a, 0x13,
+  0x05, 0x01, 0x05, 0x47, 0x2c, 0x07, 0x07, 0x0e, 0x2c, 0x36, 0x04, 0x04,
+  0x2c, 0x0a, 0x24, 0x01, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x70, 0x0c, 0x00, 0x00, 0x5c, 0x0a, 0x00, 0x00, 0x44, 0x09, 0x00, 0x00,
+  0xc0, 0x08, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00,
+  0xf4, 0x04, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+  0xc8, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xd8, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x6c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0xbc, 0xf3, 0xff, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xcc, 0xf2, 0x55, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd9, 0x1c, 0x55, 0xc2, 0x08, 0x00, 0x00, 0x00,
+  0x49, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x58, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x2c, 0x01, 0x00, 0x00, 0x3c, 0xf4, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x27, 0xb1, 0xbe, 0x3c, 0x01, 0x00, 0x00, 0x00,
+  0x76, 0xf2, 0xbd, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e,
+  0x5f, 0x32, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00,
+  0xe8, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x8c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xd4, 0xf4, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x27, 0xb1, 0xbe, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x76, 0xf2, 0xbd, 0x40,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32,
+  0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67,
+  0x32, 0x64, 0x5f, 0x35, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x90, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x7c, 0xf5, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x27, 0xb1, 0xbe, 0x3c, 0x01, 0x00, 0x00, 0x00,
+  0x76, 0xf2, 0xbd, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
+  0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65,
+  0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x35, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
+  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f,
+  0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x35, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
+  0x64, 0x5f, 0x35, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
+  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x4f, 0x70, 0x2f, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xa0, 0xf6, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x8c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8c, 0xf6, 0xff, 0xff,
+  0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x92, 0xc1, 0xa7, 0x3b,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x19, 0xa7, 0x3f, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x6d, 0x61, 0x78,
+  0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x5f, 0x34,
+  0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x52, 0xf9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x4c, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1c, 0xf7, 0xff, 0xff,
+  0xe0, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xa9, 0xb5, 0x6b, 0x3b, 0xfe, 0x5d, 0x5b, 0x3b,
+  0xed, 0x55, 0x75, 0x3b, 0x28, 0xdd, 0x9b, 0x3b, 0x03, 0x40, 0x88, 0x3b,
+  0x7d, 0x2e, 0x60, 0x3b, 0x00, 0x7d, 0x8e, 0x3b, 0x08, 0x6d, 0x63, 0x3b,
+  0x17, 0xdd, 0x57, 0x3b, 0xbd, 0xe1, 0x6c, 0x3b, 0x82, 0x44, 0xa5, 0x3b,
+  0x0b, 0xb4, 0x93, 0x3b, 0x0c, 0x00, 0x00, 0x00, 0x3e, 0xde, 0xe9, 0x3e,
+  0x13, 0x1d, 0xcc, 0x3e, 0x41, 0x6b, 0xf3, 0x3e, 0x5f, 0x40, 0xbe, 0x3e,
+  0x4f, 0x9f, 0xb7, 0x3e, 0x34, 0x62, 0xb3, 0x3e, 0x06, 0x60, 0x0d, 0x3f,
+  0x05, 0x0f, 0xa0, 0x3e, 0x2a, 0x6a, 0x94, 0x3e, 0xfa, 0x07, 0xeb, 0x3e,
+  0xea, 0x0b, 0xb2, 0x3e, 0xb3, 0x3e, 0xa2, 0x3e, 0x0c, 0x00, 0x00, 0x00,
+  0x98, 0x64, 0xe2, 0xbe, 0x42, 0xa7, 0xd9, 0xbe, 0xee, 0x8c, 0xbb, 0xbe,
+  0x6e, 0xa5, 0x1a, 0xbf, 0x83, 0x2f, 0x07, 0xbf, 0x20, 0x6e, 0xde, 0xbe,
+  0x92, 0x29, 0x08, 0xbf, 0x2e, 0xa6, 0xe1, 0xbe, 0x5d, 0x2d, 0xd6, 0xbe,
+  0x3b, 0x03, 0xe8, 0xbe, 0xf9, 0xf9, 0x23, 0xbf, 0xa3, 0x8c, 0x12, 0xbf,
+  0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
+  0x35, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xba, 0xfa, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0xdc, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xb0, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x84, 0xf8, 0xff, 0xff,
+  0x20, 0x02, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc2, 0x37, 0xfd, 0x3a,
+  0xef, 0xdf, 0x0d, 0x3b, 0x0e, 0xa3, 0xf3, 0x3a, 0xe9, 0x69, 0x49, 0x3b,
+  0x92, 0x57, 0xab, 0x3b, 0x92, 0xb6, 0x3d, 0x3b, 0x4f, 0x26, 0x0d, 0x3b,
+  0x9e, 0x4b, 0x57, 0x3b, 0x9f, 0x4a, 0x87, 0x3a, 0x90, 0xe3, 0x67, 0x3b,
+  0x80, 0x7d, 0x9f, 0x3a, 0xf0, 0xc6, 0x03, 0x3b, 0xf6, 0xc2, 0xef, 0x3a,
+  0x8d, 0xcd, 0xde, 0x3a, 0x3b, 0x4e, 0x6d, 0x3b, 0x37, 0x95, 0x0f, 0x3b,
+  0xcf, 0x7c, 0x30, 0x3b, 0xc7, 0x56, 0x13, 0x3b, 0x98, 0x97, 0xea, 0x3a,
+  0x71, 0x06, 0x94, 0x3b, 0xbd, 0x9d, 0x4c, 0x3b, 0x55, 0x59, 0x49, 0x3b,
+  0xb8, 0x2e, 0x11, 0x3b, 0x55, 0xcc, 0x0f, 0x3b, 0x51, 0x6b, 0xe7, 0x3a,
+  0xdc, 0x39, 0x6c, 0x3b, 0x39, 0x00, 0x4d, 0x3b, 0x5e, 0x1a, 0x61, 0x3b,
+  0xa2, 0x7c, 0x60, 0x3b, 0xca, 0xe8, 0x11, 0x3b, 0x7c, 0x53, 0x3b, 0x3b,
+  0x3f, 0xfa, 0x2e, 0x3b, 0x20, 0x00, 0x00, 0x00, 0xe9, 0x16, 0x20, 0x3e,
+  0x2f, 0xc4, 0x8c, 0x3e, 0xc8, 0xbb, 0x71, 0x3e, 0xa2, 0x7a, 0x86, 0x3e,
+  0x2f, 0xb7, 0xa2, 0x3e, 0xd1, 0xd1, 0x31, 0x3e, 0x02, 0x0c, 0x8c, 0x3e,
+  0x90, 0xc2, 0x8b, 0x3e, 0x0a, 0x3c, 0x06, 0x3e, 0xf1, 0x9d, 0xbe, 0x3e,
+  0x85, 0x3e, 0x1e, 0x3e, 0x9d, 0x4e, 0x80, 0x3e, 0x70, 0xe3, 0x6d, 0x3e,
+  0x1c, 0x0b, 0x51, 0x3e, 0x39, 0x76, 0x93, 0x3e, 0x25, 0x4b, 0x74, 0x3e,
+  0x92, 0x71, 0x99, 0x3e, 0xdb, 0xc9, 0x6c, 0x3e, 0x69, 0xc2, 0x68, 0x3e,
+  0xbc, 0x00, 0xaf, 0x3e, 0x67, 0x8a, 0x9b, 0x3e, 0xa2, 0xc6, 0xc7, 0x3e,
+  0x0e, 0x8f, 0x69, 0x3e, 0x93, 0xfd, 0x25, 0x3e, 0x7a, 0x9c, 0x65, 0x3e,
+  0x0b, 0xb4, 0xba, 0x3e, 0x55, 0x09, 0xa5, 0x3e, 0x29, 0x58, 0xdf, 0x3e,
+  0xa9, 0xce, 0xa7, 0x3e, 0xf4, 0x82, 0x49, 0x3e, 0x35, 0x9a, 0x5e, 0x3e,
+  0x4b, 0x9c, 0xad, 0x3e, 0x20, 0x00, 0x00, 0x00, 0x52, 0x3d, 0x7b, 0xbe,
+  0x04, 0x29, 0x81, 0xbe, 0xf4, 0xb9, 0xe8, 0xbc, 0x15, 0xd7, 0xc7, 0xbe,
+  0xe3, 0x00, 0x2a, 0xbf, 0x25, 0x3b, 0xbc, 0xbe, 0x04, 0x1c, 0x40, 0xbe,
+  0x07, 0x9d, 0xd5, 0xbe, 0x3c, 0xbb, 0xf6, 0xbd, 0xc9, 0x13, 0xe6, 0xbe,
+  0xb9, 0xfd, 0xdc, 0xbd, 0x62, 0xbf, 0x82, 0xbe, 0xcd, 0x1a, 0x6d, 0xbe,
+  0xf2, 0x0f, 0x5d, 0xbe, 0x9f, 0x73, 0xeb, 0xbe, 0x0d, 0x76, 0x8e, 0xbe,
+  0xd5, 0x1b, 0xaf, 0xbe, 0x19, 0x30, 0x92, 0xbe, 0xda, 0x15, 0xcd, 0xbd,
+  0x64, 0xde, 0x12, 0xbf, 0x82, 0x04, 0xcb, 0xbe, 0xdf, 0xf0, 0xb8, 0xbe,
+  0x5b, 0x0c, 0x90, 0xbe, 0xbc, 0xac, 0x8e, 0xbe, 0x37, 0xcf, 0xe2, 0xbc,
+  0x68, 0x61, 0xea, 0xbe, 0x39, 0x66, 0xcb, 0xbe, 0x73, 0x25, 0xd6, 0xbe,
+  0xa9, 0xbb, 0xde, 0xbe, 0xf8, 0xc4, 0x90, 0xbe, 0xd5, 0xdc, 0xb9, 0xbe,
+  0xe6, 0x21, 0xab, 0xbe, 0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e,
+  0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x68, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x7c, 0xfb, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1a, 0x5b, 0x38, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x5e, 0xb1, 0x1d, 0x3f,
+  0x01, 0x00, 0x00, 0x00, 0x64, 0xea, 0xb6, 0xbf, 0x1b, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32,
+  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x74,
+  0x4d, 0x75, 0x6c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x2c, 0x01, 0x00, 0x00, 0x2e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x3c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e,
+  0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7a, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x53, 0x89, 0x39, 0x34, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32,
+  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61,
+  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
+  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x2f, 0x72, 0x65, 0x73, 0x6f,
+  0x75, 0x72, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xfa, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0xf4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xbc, 0x75, 0x9a, 0x37, 0x30, 0xc0, 0x8f, 0x37,
+  0x8f, 0xc4, 0xa0, 0x37, 0x3f, 0x46, 0xcc, 0x37, 0x90, 0x91, 0xb2, 0x37,
+  0xd6, 0xe7, 0x92, 0x37, 0x91, 0xbe, 0xba, 0x37, 0x17, 0x08, 0x95, 0x37,
+  0x73, 0x74, 0x8d, 0x37, 0x60, 0x3a, 0x9b, 0x37, 0x4f, 0x99, 0xd8, 0x37,
+  0x44, 0x94, 0xc1, 0x37, 0x35, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e,
+  0x76, 0x32, 0x64, 0x5f, 0x35, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64,
+  0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x4f, 0x70, 0x2f, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xec, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xf9, 0x35, 0xfe, 0x36, 0x5e, 0x6e, 0x0e, 0x37,
+  0xa7, 0x97, 0xf4, 0x36, 0x1e, 0x34, 0x4a, 0x37, 0x96, 0x03, 0xac, 0x37,
+  0x08, 0x75, 0x3e, 0x37, 0x04, 0xb4, 0x0d, 0x37, 0xc3, 0x23, 0x58, 0x37,
+  0x72, 0xd2, 0x87, 0x36, 0x5d, 0xcc, 0x68, 0x37, 0x9e, 0x1d, 0xa0, 0x36,
+  0x3c, 0x4b, 0x04, 0x37, 0xab, 0xb3, 0xf0, 0x36, 0x3b, 0xad, 0xdf, 0x36,
+  0x78, 0x3c, 0x6e, 0x37, 0x5d, 0x25, 0x10, 0x37, 0xfe, 0x2d, 0x31, 0x37,
+  0xb2, 0xea, 0x13, 0x37, 0x1c, 0x83, 0xeb, 0x36, 0x0d, 0x9b, 0x94, 0x37,
+  0x29, 0x6b, 0x4d, 0x37, 0x79, 0x23, 0x4a, 0x37, 0x79, 0xc0, 0x11, 0x37,
+  0xb2, 0x5c, 0x10, 0x37, 0xa6, 0x53, 0xe8, 0x36, 0x04, 0x27, 0x6d, 0x37,
+  0x08, 0xce, 0x4d, 0x37, 0x5b, 0xfc, 0x61, 0x37, 0x01, 0x5e, 0x61, 0x37,
+  0x46, 0x7b, 0x12, 0x37, 0x8c, 0x0f, 0x3c, 0x37, 0xea, 0xa9, 0x2f, 0x37,
+  0x35, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
+  0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65,
+  0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70,
+  0x2f, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00,
+  0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x34, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x50, 0x61, 0x74, 0x63, 0x68, 0x53, 0x74, 0x61,
+  0x67, 0x65, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0a, 0x00, 0x0e, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x03, 0x00, 0x00, 0x00
+};
+unsigned int model_patched_tflite_len = 11440;
@@ -0,0 +1,421 @@
+const unsigned char model_small_tflite[] = {
+  0x10, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4e, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0xfc, 0x12, 0x00, 0x00, 0x9c, 0x0c, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x68, 0x0c, 0x00, 0x00,
+  0x04, 0x0c, 0x00, 0x00, 0xc0, 0x0b, 0x00, 0x00, 0x9c, 0x0b, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0xf4, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x09, 0xf1, 0xff, 0xff,
+  0x76, 0xff, 0xff, 0xff, 0x9d, 0x15, 0x00, 0x00, 0xb3, 0xe6, 0xff, 0xff,
+  0x27, 0xff, 0xff, 0xff, 0xd0, 0x16, 0x00, 0x00, 0xa8, 0xee, 0xff, 0xff,
+  0x48, 0x27, 0x00, 0x00, 0x9d, 0xed, 0xff, 0xff, 0xac, 0xf9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x56, 0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00,
+  0xf8, 0x03, 0xec, 0xfa, 0x01, 0xf5, 0xea, 0xf8, 0x02, 0xfe, 0xe5, 0x04,
+  0x02, 0x04, 0xfe, 0x08, 0xfe, 0x01, 0xf2, 0x08, 0xf6, 0xfe, 0xe0, 0xf3,
+  0xfd, 0xf7, 0xe8, 0x08, 0x1c, 0xf5, 0xf8, 0xf5, 0x00, 0x09, 0xe4, 0x04,
+  0x14, 0x03, 0x20, 0x03, 0x09, 0xf0, 0xf2, 0x0c, 0xfa, 0x00, 0xfc, 0xf5,
+  0xf1, 0xf7, 0xf6, 0x01, 0xfe, 0xfd, 0xff, 0xdf, 0x03, 0x01, 0xf4, 0x19,
+  0xf8, 0x06, 0xec, 0xed, 0x03, 0x00, 0xf8, 0x0b, 0x0e, 0xe4, 0x10, 0xfc,
+  0x17, 0x01, 0xf3, 0x28, 0x29, 0xeb, 0xfd, 0x11, 0x2f, 0x03, 0xe5, 0x04,
+  0x14, 0xfe, 0xf6, 0x34, 0x05, 0x04, 0xff, 0x0e, 0x0c, 0xde, 0xfa, 0x1e,
+  0xf3, 0x06, 0x1e, 0xf7, 0x38, 0xe7, 0x24, 0xeb, 0xed, 0xfc, 0x3c, 0xf3,
+  0x33, 0xea, 0x14, 0xed, 0xf3, 0x00, 0x18, 0xe1, 0xfa, 0xe8, 0x03, 0x05,
+  0x1b, 0x01, 0xdd, 0xff, 0xf1, 0x07, 0x82, 0xf3, 0xff, 0x06, 0xf6, 0x0e,
+  0x3d, 0xd4, 0xbc, 0x1f, 0xef, 0x01, 0x13, 0x02, 0x14, 0xb3, 0x06, 0x35,
+  0xe2, 0xf8, 0x23, 0xdc, 0x0b, 0xf8, 0x26, 0x16, 0xda, 0x04, 0x3a, 0xcd,
+  0x0d, 0xce, 0x08, 0x0d, 0xe5, 0xfd, 0x1b, 0xe0, 0x09, 0xc4, 0xc0, 0x05,
+  0x05, 0xf7, 0xc3, 0xdd, 0x12, 0xad, 0xe0, 0xc6, 0x02, 0x00, 0x0e, 0xe2,
+  0x3f, 0xe9, 0x1f, 0xf7, 0x07, 0xf7, 0x25, 0xd8, 0xe8, 0x11, 0xd5, 0xf4,
+  0x0a, 0xf1, 0xf8, 0x02, 0x07, 0xf3, 0xf0, 0x1a, 0xfe, 0xfe, 0x04, 0x06,
+  0xec, 0x0a, 0xf3, 0x1c, 0x1c, 0xfa, 0x20, 0x08, 0xe8, 0x09, 0xf7, 0x2f,
+  0xfc, 0xff, 0x04, 0x16, 0xf0, 0xec, 0x08, 0xf8, 0x19, 0x04, 0x13, 0xf6,
+  0x22, 0x18, 0x1e, 0xe7, 0x04, 0x04, 0xf5, 0xf4, 0x11, 0x16, 0xf1, 0xe4,
+  0x19, 0x00, 0xe5, 0x0b, 0xff, 0x05, 0xef, 0xf1, 0x20, 0x0d, 0x16, 0x0e,
+  0x0c, 0x0b, 0xfa, 0x2f, 0x24, 0x03, 0x12, 0x0c, 0x07, 0x3a, 0xf5, 0x1e,
+  0xe9, 0xff, 0x08, 0xff, 0xf6, 0x0d, 0x01, 0x02, 0xe2, 0xfb, 0xd6, 0xf5,
+  0x1f, 0xe6, 0x1d, 0xfe, 0x19, 0x09, 0x14, 0x0c, 0xfe, 0x11, 0x0d, 0xee,
+  0xff, 0x03, 0xf5, 0xf9, 0xf5, 0xf4, 0xeb, 0xff, 0x06, 0xfe, 0xed, 0xeb,
+  0x0b, 0x0c, 0x03, 0xff, 0xfb, 0xf9, 0x09, 0xf9, 0x1d, 0xfd, 0xfd, 0xfd,
+  0xf8, 0x09, 0x35, 0xfd, 0x30, 0xff, 0xf8, 0x07, 0xfe, 0xfb, 0x13, 0xf9,
+  0x37, 0x01, 0x08, 0xf7, 0xfa, 0xfd, 0x22, 0xfe, 0x0e, 0x16, 0xf2, 0x0b,
+  0xf6, 0xfc, 0xf6, 0xfa, 0xf1, 0x03, 0xf1, 0x08, 0x19, 0x00, 0xf7, 0x0a,
+  0xf8, 0xf1, 0xf1, 0xf5, 0x02, 0x01, 0xf1, 0xfd, 0x16, 0xe9, 0xd2, 0xe3,
+  0xf2, 0x0b, 0x37, 0x14, 0x2b, 0xeb, 0x07, 0x15, 0xfc, 0xff, 0x15, 0xe1,
+  0x1b, 0xe9, 0xfa, 0xf3, 0x04, 0x01, 0x1e, 0xf0, 0xf9, 0xef, 0xf0, 0x18,
+  0xf5, 0xfd, 0xf1, 0xfc, 0xf8, 0xf6, 0xea, 0xf7, 0xed, 0xf8, 0xe7, 0xf4,
+  0xdf, 0xf3, 0xd0, 0xf7, 0xec, 0xfd, 0xf4, 0xf4, 0x2a, 0xdd, 0xe9, 0xe5,
+  0xd9, 0x00, 0x4a, 0xcd, 0x2a, 0xd7, 0x23, 0x14, 0x08, 0x02, 0x24, 0xf0,
+  0xfa, 0xf9, 0xde, 0xe8, 0x03, 0x04, 0xfb, 0xe9, 0x07, 0x08, 0xe5, 0xfe,
+  0xf9, 0xf9, 0xf0, 0xfb, 0xf0, 0xf5, 0xf5, 0xff, 0x00, 0x00, 0xe6, 0x11,
+  0xf0, 0xf0, 0xe3, 0xf6, 0xf1, 0xfa, 0x07, 0xfa, 0x2c, 0x00, 0x07, 0xf1,
+  0xf2, 0xfc, 0x3e, 0xf1, 0xfb, 0xf8, 0xcb, 0x02, 0x0a, 0xff, 0xd6, 0x12,
+  0xde, 0xda, 0xe5, 0x03, 0x11, 0x02, 0xea, 0x10, 0x0c, 0xf9, 0xfd, 0x0c,
+  0xeb, 0x05, 0xff, 0x19, 0x09, 0xf7, 0x25, 0x03, 0xfe, 0x04, 0x07, 0x0b,
+  0xf9, 0xfc, 0x18, 0x00, 0x0b, 0xfd, 0x07, 0x0a, 0x1b, 0xd5, 0x05, 0xeb,
+  0x15, 0xfd, 0xe4, 0x01, 0x17, 0xff, 0xec, 0x42, 0x26, 0xfc, 0xe7, 0x45,
+  0xd8, 0xe7, 0x15, 0x33, 0x01, 0x04, 0xf4, 0x0b, 0x08, 0x00, 0x1c, 0xf7,
+  0x00, 0xf8, 0x12, 0x04, 0x0c, 0xfd, 0x31, 0xfa, 0xfd, 0xfe, 0x1f, 0xfd,
+  0xf6, 0xef, 0x0d, 0xfc, 0xf6, 0xf8, 0x0d, 0x09, 0x08, 0xfb, 0x0c, 0xfd,
+  0x23, 0xfb, 0xfb, 0x16, 0xe5, 0x03, 0xe7, 0xfe, 0x08, 0x02, 0xff, 0x11,
+  0xf4, 0x09, 0xf9, 0x1e, 0xed, 0xfe, 0xf8, 0x0a, 0xfa, 0xf9, 0x09, 0xef,
+  0xfb, 0xf8, 0x0f, 0xd0, 0xed, 0x22, 0x0c, 0xff, 0xf4, 0xff, 0x04, 0xdf,
+  0xc2, 0x3b, 0x1d, 0xfc, 0x03, 0x0d, 0x3d, 0x04, 0x11, 0x3f, 0xfb, 0x06,
+  0x09, 0x01, 0x2c, 0xf5, 0x01, 0x19, 0xed, 0xfa, 0xfa, 0xf3, 0xcb, 0x0b,
+  0xd4, 0xc8, 0xef, 0x37, 0xf2, 0x06, 0xd8, 0x0f, 0xe8, 0xd8, 0x03, 0xf9,
+  0x0c, 0xfd, 0x21, 0xff, 0xed, 0x1f, 0xf6, 0xf6, 0x11, 0x03, 0x0d, 0xc5,
+  0xef, 0x09, 0x09, 0xdf, 0x1f, 0x04, 0x0f, 0xf7, 0xc4, 0x4a, 0x08, 0x0f,
+  0x19, 0x06, 0xf9, 0x18, 0xee, 0x34, 0xe2, 0x1b, 0x03, 0x01, 0xed, 0x10,
+  0xf4, 0xda, 0x91, 0x18, 0xf7, 0x07, 0x0c, 0xf8, 0xfc, 0xeb, 0xe6, 0x10,
+  0x15, 0xf9, 0x10, 0x19, 0xed, 0x30, 0x32, 0x34, 0x23, 0x02, 0x99, 0x36,
+  0xdd, 0x30, 0x25, 0xdc, 0x44, 0xfb, 0xa0, 0x3b, 0xca, 0x16, 0x2d, 0xde,
+  0x15, 0x03, 0xee, 0x15, 0xf9, 0xf8, 0x01, 0xe4, 0xee, 0xf9, 0x11, 0xf9,
+  0x20, 0xc7, 0xe6, 0x08, 0x03, 0x06, 0x21, 0xe6, 0xfb, 0xe4, 0x1a, 0xf6,
+  0x08, 0xf8, 0xfd, 0x04, 0x26, 0xf7, 0x3b, 0x00, 0xe8, 0xfd, 0x0c, 0x0a,
+  0x2a, 0xf7, 0x61, 0xaf, 0xb6, 0xfb, 0x04, 0xf1, 0x21, 0xf0, 0x61, 0xee,
+  0xd8, 0xfa, 0x0b, 0xf5, 0x0d, 0xed, 0x51, 0xfc, 0xf8, 0xfe, 0xfb, 0x00,
+  0x15, 0xf7, 0x5b, 0xea, 0x03, 0x00, 0xff, 0xfa, 0x0f, 0x29, 0x40, 0xff,
+  0xf9, 0x07, 0x45, 0xed, 0x01, 0x25, 0x0e, 0x07, 0xd9, 0xfd, 0x68, 0xe9,
+  0x22, 0xef, 0x08, 0xe3, 0xd2, 0xfb, 0x34, 0xfc, 0x06, 0x23, 0x10, 0x05,
+  0x00, 0x05, 0xe9, 0x38, 0xd7, 0x23, 0x08, 0x21, 0x4d, 0x03, 0xbe, 0x47,
+  0xc5, 0x3c, 0x45, 0x23, 0x05, 0xfd, 0xc5, 0x32, 0xeb, 0x23, 0x2d, 0x1c,
+  0xe7, 0xff, 0x0f, 0xe5, 0x10, 0xfd, 0xe4, 0x00, 0x03, 0xf7, 0xe8, 0xfd,
+  0xea, 0x0e, 0xe5, 0x0f, 0x03, 0xfd, 0xfa, 0x0e, 0xe6, 0xfe, 0xfb, 0x12,
+  0x06, 0x03, 0xea, 0x1c, 0xe2, 0x15, 0xec, 0x16, 0x2d, 0xef, 0x0d, 0x1a,
+  0xd4, 0x18, 0xfc, 0x30, 0xe8, 0x07, 0x07, 0x06, 0x02, 0xf1, 0x1b, 0x28,
+  0xe5, 0xfb, 0x0e, 0xff, 0x1a, 0xfc, 0x0d, 0xf5, 0xfe, 0xfc, 0xe9, 0x12,
+  0xe5, 0x01, 0x09, 0x16, 0x12, 0x03, 0xf7, 0xff, 0xf5, 0x4c, 0x11, 0x1d,
+  0xf0, 0xfd, 0xfa, 0x10, 0xf2, 0x27, 0xff, 0x14, 0x06, 0x00, 0x05, 0x0b,
+  0xb7, 0xd6, 0xea, 0x0b, 0x05, 0xfe, 0xf4, 0x09, 0xe7, 0xe7, 0xe6, 0xfd,
+  0x0a, 0xf5, 0x0d, 0xf3, 0x02, 0x0d, 0x12, 0x08, 0x0d, 0x10, 0xf9, 0x21,
+  0xe6, 0x3f, 0xfc, 0xfc, 0x4d, 0xff, 0xb5, 0x21, 0xe1, 0x42, 0xfc, 0x02,
+  0x1f, 0xfa, 0x08, 0x16, 0x0a, 0xf4, 0xed, 0x0f, 0x07, 0xfc, 0x0e, 0xf8,
+  0xf9, 0xc5, 0xe0, 0x16, 0x01, 0x01, 0x22, 0xf3, 0xfd, 0x0c, 0xf8, 0xfd,
+  0xfc, 0xf8, 0x01, 0xf9, 0xe0, 0xfa, 0xe0, 0xf8, 0x2f, 0xff, 0xdb, 0xf7,
+  0xfd, 0xfa, 0xf7, 0xf0, 0x35, 0xfd, 0xea, 0x0f, 0x12, 0x05, 0xfd, 0xab,
+  0x0b, 0xff, 0x08, 0x0b, 0x0b, 0x22, 0x1d, 0xfc, 0xdb, 0xf6, 0x2a, 0x20,
+  0xf1, 0x38, 0xfa, 0xf0, 0x0d, 0xfd, 0xf0, 0xfb, 0xf8, 0x36, 0x02, 0xe0,
+  0xe4, 0x01, 0xf4, 0xfe, 0xf5, 0xf0, 0xef, 0xfb, 0xf7, 0xf8, 0xd4, 0x0d,
+  0xfa, 0xee, 0xda, 0x03, 0x37, 0xff, 0xbe, 0x08, 0x00, 0x27, 0x19, 0xfd,
+  0x38, 0xfd, 0xf1, 0xf8, 0xc4, 0x40, 0x11, 0x22, 0xfa, 0x03, 0x06, 0x10,
+  0xf2, 0xe8, 0xf1, 0xfc, 0x00, 0xfe, 0xe0, 0x15, 0x07, 0xde, 0x08, 0x0a,
+  0xf3, 0x0c, 0xfb, 0xf4, 0x09, 0xf6, 0x00, 0x02, 0x06, 0xfa, 0xe9, 0x11,
+  0xed, 0xde, 0x0a, 0x05, 0x0f, 0x04, 0xc3, 0x16, 0xe7, 0x1f, 0x19, 0xef,
+  0x01, 0x04, 0xf4, 0xf0, 0x0f, 0x1f, 0x10, 0xec, 0xd3, 0x03, 0x33, 0xd1,
+  0x24, 0xef, 0xf1, 0xed, 0xfa, 0xfd, 0x1e, 0xdf, 0x05, 0xe9, 0x01, 0xff,
+  0xfe, 0xfd, 0xfb, 0xfe, 0xfa, 0xff, 0xfa, 0xfc, 0xeb, 0x05, 0xf7, 0xf5,
+  0x05, 0x06, 0x0d, 0x02, 0xfd, 0x02, 0xec, 0xfc, 0xfe, 0xe6, 0x25, 0xf1,
+  0xf3, 0xf4, 0xf6, 0xfa, 0x02, 0x02, 0x3e, 0xeb, 0xf5, 0xfe, 0x15, 0xfb,
+  0x0c, 0xf1, 0x14, 0xf8, 0xf0, 0x09, 0x06, 0xf5, 0x00, 0x09, 0x07, 0xf4,
+  0x32, 0x09, 0x07, 0x1b, 0xfd, 0x0a, 0x03, 0xfb, 0xfb, 0xf5, 0x2d, 0x14,
+  0x13, 0xf1, 0xff, 0x03, 0x1c, 0xfd, 0x3c, 0x0a, 0x1c, 0xe3, 0xef, 0xfc,
+  0x1e, 0xff, 0x47, 0xea, 0x29, 0xc6, 0xda, 0xf2, 0xf6, 0xf6, 0x26, 0xf2,
+  0x4f, 0xb5, 0xff, 0xfd, 0xff, 0x03, 0x39, 0xfe, 0x27, 0xe9, 0x1f, 0x1c,
+  0x11, 0xfb, 0x0e, 0x09, 0x06, 0x1f, 0x18, 0x1c, 0xdf, 0xfe, 0x3f, 0xec,
+  0x16, 0xfb, 0x02, 0x20, 0xbf, 0xfe, 0x34, 0xd7, 0x2d, 0x8e, 0xed, 0x27,
+  0xc7, 0x02, 0x4a, 0xbf, 0x46, 0x9d, 0xdd, 0x07, 0xbf, 0xfd, 0x4a, 0xcc,
+  0x65, 0xb9, 0xee, 0xf1, 0x02, 0xf7, 0x1c, 0xf6, 0x07, 0x11, 0x0a, 0x01,
+  0xf7, 0x0a, 0xf5, 0x0b, 0xf4, 0x13, 0x0c, 0xec, 0xce, 0xfe, 0x1d, 0xd0,
+  0x02, 0xe7, 0x18, 0x38, 0xca, 0xf9, 0x26, 0xe2, 0xe1, 0xea, 0x10, 0x37,
+  0xfe, 0x00, 0xdd, 0xe2, 0x19, 0xd4, 0xe1, 0x00, 0x10, 0xff, 0x36, 0xf8,
+  0x0f, 0xf1, 0x05, 0xf8, 0xe4, 0xfe, 0xeb, 0x04, 0xdf, 0x15, 0xe8, 0xfd,
+  0x21, 0xfe, 0x01, 0x1f, 0x00, 0xfb, 0x2f, 0xdf, 0x31, 0xfc, 0x1d, 0xdd,
+  0xd4, 0x24, 0x11, 0x2d, 0x40, 0xf8, 0xf1, 0x26, 0xca, 0x55, 0xe3, 0x2c,
+  0x08, 0x02, 0xd3, 0x28, 0x06, 0x0f, 0x2d, 0x04, 0x16, 0xff, 0x00, 0xfd,
+  0xed, 0x5c, 0xe6, 0x1c, 0xed, 0xfc, 0x04, 0x09, 0xed, 0x20, 0xf9, 0x0a,
+  0x11, 0x04, 0x18, 0xfd, 0x10, 0x31, 0xf7, 0x04, 0xfa, 0x04, 0x0a, 0xe7,
+  0x17, 0x31, 0xde, 0xde, 0x0a, 0x01, 0x31, 0xe0, 0x1b, 0xf7, 0xec, 0xd1,
+  0x05, 0x03, 0x19, 0xf5, 0xf5, 0xe2, 0xe0, 0xe4, 0x0c, 0xfc, 0xfa, 0x0d,
+  0x0f, 0xf0, 0xe1, 0xf1, 0x07, 0x01, 0x0a, 0x19, 0xfa, 0x03, 0xe5, 0x15,
+  0xe6, 0x09, 0xf7, 0x18, 0xf7, 0x04, 0x06, 0x0a, 0xf7, 0x02, 0xe5, 0xfe,
+  0x0b, 0xd6, 0x03, 0xf2, 0xec, 0xfb, 0xd5, 0x04, 0xf3, 0xeb, 0xfd, 0xd9,
+  0x13, 0xfa, 0xeb, 0x01, 0xfc, 0xe7, 0xf3, 0xf7, 0x03, 0xfb, 0x0e, 0x19,
+  0x00, 0x11, 0xf5, 0x00, 0xed, 0x07, 0x0c, 0x17, 0x07, 0x09, 0x04, 0x22,
+  0xf4, 0xfc, 0xd4, 0x01, 0x14, 0xe6, 0xee, 0xf0, 0xfe, 0x04, 0xcf, 0x14,
+  0x14, 0xd7, 0xf7, 0xf9, 0xfe, 0x01, 0xd3, 0xde, 0xff, 0xfc, 0xef, 0xef,
+  0x01, 0xf8, 0xd8, 0xf4, 0x04, 0x05, 0x12, 0xf3, 0x14, 0x00, 0x2a, 0x18,
+  0x2f, 0x5e, 0x04, 0xeb, 0xfc, 0xfa, 0x12, 0xd7, 0x15, 0x24, 0x19, 0x04,
+  0xf0, 0xfe, 0xfe, 0xf0, 0x0c, 0xe2, 0xe9, 0xfe, 0xe8, 0xfc, 0x0f, 0x0a,
+  0x0b, 0xb7, 0xd7, 0x07, 0xfe, 0x02, 0x1e, 0xed, 0xfe, 0x00, 0xe6, 0x05,
+  0x2b, 0x07, 0xf1, 0xe9, 0xca, 0x49, 0x1c, 0xd2, 0xf2, 0x03, 0xbb, 0x0e,
+  0xd3, 0x6f, 0x66, 0xc8, 0x0d, 0xfa, 0xe6, 0xfc, 0x00, 0x36, 0x1e, 0xe2,
+  0xed, 0xfc, 0xfe, 0xe1, 0xf6, 0xf4, 0xfe, 0x06, 0x0a, 0x04, 0x0d, 0xf4,
+  0x08, 0x09, 0xc9, 0x08, 0x2d, 0x01, 0x1f, 0x06, 0xeb, 0x16, 0x05, 0x1b,
+  0x22, 0xf7, 0xf4, 0x27, 0xd0, 0x3e, 0x07, 0x04, 0x06, 0xff, 0x81, 0x2b,
+  0xb4, 0x15, 0x34, 0xfd, 0x0d, 0x01, 0xc4, 0x1d, 0xf0, 0x29, 0x07, 0xe2,
+  0x0e, 0xfb, 0x02, 0x30, 0xe6, 0x03, 0x0e, 0x1e, 0x35, 0x01, 0xad, 0x48,
+  0xc9, 0x2c, 0x41, 0x05, 0x2e, 0x04, 0x0f, 0x0b, 0xe4, 0x2b, 0xec, 0x1e,
+  0x09, 0xfc, 0xf9, 0xf7, 0xf6, 0xff, 0xc3, 0x22, 0xfa, 0x03, 0xef, 0x25,
+  0x09, 0xc1, 0xdb, 0x15, 0x1a, 0x05, 0xe5, 0x11, 0x10, 0xb5, 0xfe, 0x09,
+  0x0b, 0xf9, 0x11, 0x17, 0xe9, 0x08, 0x12, 0x1b, 0x1c, 0x08, 0xb9, 0x41,
+  0xe8, 0x32, 0x3b, 0x1f, 0x1d, 0x01, 0xec, 0x40, 0x08, 0x12, 0x52, 0x0a,
+  0xfa, 0x02, 0x0b, 0xfe, 0x20, 0x07, 0x27, 0x07, 0xee, 0x08, 0x05, 0xdd,
+  0x23, 0xfa, 0xf0, 0x10, 0x04, 0x0a, 0x2a, 0x05, 0x0f, 0xfd, 0x06, 0x19,
+  0xf9, 0xfb, 0x05, 0x03, 0x0d, 0xef, 0xf7, 0x17, 0x29, 0x00, 0x0b, 0x1d,
+  0xfe, 0xf6, 0x1f, 0xff, 0x0c, 0xfb, 0xf6, 0xf7, 0x07, 0x0c, 0x35, 0xe8,
+  0xe3, 0xf5, 0x0e, 0xd5, 0x09, 0x04, 0x37, 0xd3, 0xde, 0x08, 0xfa, 0xdd,
+  0x06, 0xfc, 0x15, 0xc7, 0x1c, 0xff, 0xe6, 0xf0, 0x08, 0x01, 0xf7, 0x03,
+  0x02, 0xfc, 0xfd, 0x0d, 0x17, 0xf8, 0x13, 0x0a, 0xf8, 0xf5, 0x19, 0x00,
+  0x0b, 0x05, 0x11, 0xfa, 0x09, 0xf9, 0x0f, 0xf7, 0xfc, 0x0d, 0x0b, 0x07,
+  0xfb, 0x02, 0x04, 0xf7, 0x06, 0x16, 0xf7, 0xec, 0xff, 0x02, 0x11, 0xde,
+  0x03, 0x0e, 0x06, 0xf0, 0x06, 0x00, 0x27, 0xe5, 0x04, 0x24, 0x02, 0x28,
+  0x10, 0x02, 0x03, 0xee, 0x02, 0xff, 0xe8, 0xf3, 0xf9, 0xfe, 0x0f, 0xec,
+  0x1a, 0x08, 0xdb, 0xe3, 0xf7, 0xfa, 0x1c, 0x0a, 0x24, 0xe7, 0xd7, 0xd9,
+  0xeb, 0xfc, 0xed, 0xdf, 0xe9, 0x09, 0xe7, 0xb3, 0x1f, 0xf6, 0xf2, 0xf9,
+  0xc2, 0x52, 0x01, 0xe2, 0x07, 0x04, 0xda, 0xf9, 0x05, 0x37, 0x06, 0xfb,
+  0xf5, 0x06, 0xfd, 0xfd, 0x0d, 0xf5, 0xdc, 0xf5, 0xe1, 0xfe, 0x1c, 0x03,
+  0x2a, 0xdb, 0x02, 0xee, 0xae, 0x03, 0x2e, 0xe5, 0x35, 0xce, 0x1e, 0x03,
+  0xe8, 0xf9, 0x05, 0xf5, 0x08, 0x07, 0x6e, 0x16, 0x19, 0xff, 0xb1, 0xf7,
+  0xee, 0x2d, 0x49, 0x04, 0xfe, 0x07, 0x0e, 0x1e, 0x09, 0xd2, 0x27, 0x17,
+  0xed, 0x02, 0xf6, 0xfe, 0x1b, 0xf8, 0xe8, 0x00, 0xce, 0xfe, 0x24, 0xc9,
+  0x2b, 0xbc, 0xe4, 0x27, 0xe0, 0x03, 0x21, 0xd8, 0x2a, 0x9c, 0x09, 0x15,
+  0x18, 0xfd, 0xef, 0x13, 0xd4, 0xfb, 0x33, 0xf4, 0x0b, 0x00, 0xf0, 0x19,
+  0xd5, 0xf1, 0x19, 0xf7, 0xfe, 0x08, 0x17, 0x07, 0xfa, 0x02, 0x30, 0xf1,
+  0x07, 0x09, 0xf5, 0x0f, 0xf8, 0xea, 0xe7, 0xf8, 0x00, 0x04, 0xf3, 0xf2,
+  0x04, 0xef, 0xa7, 0x06, 0xfe, 0xfc, 0xe0, 0xfd, 0xf4, 0xff, 0xb7, 0x25,
+  0x10, 0x02, 0xf5, 0x12, 0xce, 0x1b, 0xf3, 0xef, 0xe0, 0x02, 0x1b, 0xec,
+  0xf8, 0x23, 0x11, 0xe3, 0xf8, 0x00, 0xfa, 0xd9, 0x18, 0x0e, 0xf8, 0xf5,
+  0xf0, 0xfc, 0xf5, 0x00, 0xec, 0xff, 0xee, 0xfd, 0x20, 0x04, 0xe7, 0x0e,
+  0x0b, 0x02, 0xd7, 0x04, 0x22, 0xfa, 0xfc, 0x17, 0xf0, 0x3d, 0xec, 0xf9,
+  0x1b, 0xf3, 0xee, 0x0a, 0xf6, 0x07, 0xe4, 0x15, 0x10, 0x01, 0xf7, 0x05,
+  0x08, 0x00, 0xf7, 0xed, 0x02, 0x08, 0xff, 0x00, 0xfc, 0x05, 0xee, 0xe9,
+  0x0a, 0x01, 0x2b, 0x03, 0xe9, 0xed, 0x20, 0x19, 0xec, 0xff, 0x4a, 0x07,
+  0x0d, 0xe4, 0xfc, 0x1b, 0xde, 0xff, 0xf1, 0x0e, 0xe6, 0xa7, 0xf4, 0xf9,
+  0x02, 0xf1, 0xd9, 0x19, 0xa9, 0xf1, 0x1c, 0x1d, 0xf4, 0x08, 0xff, 0xfc,
+  0xcd, 0x18, 0xf4, 0xce, 0xff, 0x00, 0xf9, 0x0c, 0xe2, 0xe0, 0x01, 0xd7,
+  0x21, 0xfd, 0xf2, 0x2a, 0xd8, 0xfe, 0x19, 0x36, 0x27, 0xf8, 0xbd, 0x3f,
+  0xd8, 0x4a, 0x12, 0x64, 0x20, 0xfe, 0xcc, 0x19, 0xe0, 0x42, 0x19, 0x33,
+  0xff, 0x08, 0xd1, 0x1c, 0xe0, 0x33, 0x2b, 0xfd, 0xf5, 0x01, 0x14, 0x06,
+  0x08, 0x2b, 0x31, 0xdb, 0xfc, 0x00, 0xf8, 0xfa, 0xf4, 0xdc, 0x23, 0xfa,
+  0x44, 0xfd, 0x19, 0x3c, 0xf6, 0x10, 0xf8, 0x11, 0x34, 0xf7, 0x0a, 0x32,
+  0xe6, 0x18, 0x13, 0x01, 0x22, 0xfe, 0x2d, 0x2a, 0x04, 0x4f, 0xea, 0xe0,
+  0x1a, 0x01, 0x18, 0xe7, 0x2b, 0x0c, 0x03, 0xd1, 0x01, 0x04, 0x24, 0xfa,
+  0x1c, 0xf8, 0x1c, 0x08, 0xfa, 0x05, 0x04, 0x09, 0x0e, 0xf4, 0x0f, 0x12,
+  0xfd, 0xfe, 0x28, 0xdc, 0xe8, 0x33, 0xfc, 0xf3, 0xff, 0x01, 0x55, 0x12,
+  0x24, 0x29, 0xff, 0xcd, 0xc2, 0x02, 0x0a, 0x05, 0x0c, 0x2b, 0xf0, 0xc0,
+  0xf8, 0x01, 0xdb, 0x0a, 0x20, 0xe9, 0x03, 0xec, 0x22, 0xf8, 0x20, 0x12,
+  0x0d, 0x37, 0xff, 0x1c, 0xef, 0xfe, 0x09, 0x0a, 0xe3, 0x31, 0x0c, 0x02,
+  0x1a, 0x05, 0xf4, 0x14, 0xf4, 0xf7, 0xf8, 0xc8, 0xff, 0xfa, 0xfd, 0xd5,
+  0x08, 0xdf, 0x13, 0xf3, 0xe7, 0xf9, 0x04, 0xd2, 0x0b, 0xb4, 0xf5, 0xcb,
+  0xe3, 0x01, 0x10, 0xec, 0x0f, 0xd9, 0xef, 0xe3, 0xea, 0xf6, 0x10, 0xd8,
+  0xf4, 0x14, 0xdb, 0xc8, 0xf9, 0xf8, 0x00, 0xe3, 0xde, 0xfb, 0xec, 0xf4,
+  0xf9, 0xfb, 0x38, 0xef, 0x0b, 0x06, 0x17, 0xef, 0xc9, 0xf7, 0x28, 0xed,
+  0xed, 0x08, 0x15, 0xd5, 0xea, 0x07, 0x02, 0xf2, 0x0d, 0xc6, 0xe8, 0xee,
+  0xec, 0x03, 0x21, 0xf3, 0x34, 0xe7, 0xe4, 0x03, 0xf5, 0xfe, 0x16, 0xf0,
+  0xfd, 0xf5, 0xdc, 0x0e, 0x1b, 0xfe, 0x08, 0xed, 0xf8, 0xea, 0xe0, 0xeb,
+  0xff, 0xfa, 0xf1, 0xfa, 0xee, 0x05, 0xf3, 0xfb, 0x02, 0x04, 0xe7, 0xf2,
+  0xf4, 0x04, 0x04, 0xff, 0xfa, 0x08, 0xf1, 0x08, 0x02, 0x08, 0x09, 0x0f,
+  0xf8, 0x03, 0xee, 0x08, 0xf7, 0xfb, 0x0f, 0x0d, 0xfe, 0x04, 0xee, 0x0a,
+  0x04, 0xff, 0xfd, 0xf8, 0xf7, 0xfb, 0xeb, 0xff, 0x0d, 0xf4, 0xf6, 0xf2,
+  0xf0, 0x00, 0xee, 0xfb, 0x0d, 0xf3, 0x04, 0xf5, 0xe7, 0xfb, 0xfb, 0xfb,
+  0x18, 0xf8, 0x38, 0xf0, 0xfa, 0x02, 0x0a, 0xf1, 0xf9, 0xf3, 0x25, 0x05,
+  0xf7, 0x02, 0xde, 0xeb, 0xe6, 0x00, 0x0e, 0xed, 0xf1, 0x02, 0xf7, 0x09,
+  0x0d, 0xf9, 0x1b, 0x11, 0xf4, 0x0e, 0xf6, 0x11, 0xfe, 0xfd, 0x00, 0xeb,
+  0x08, 0x03, 0xf8, 0x13, 0x01, 0xeb, 0xf4, 0x00, 0x0d, 0x0d, 0xfc, 0x13,
+  0xf2, 0x1c, 0x01, 0x26, 0xf9, 0xff, 0xe1, 0x0b, 0xf0, 0xea, 0xca, 0x40,
+  0xf1, 0xf9, 0xeb, 0x06, 0xe7, 0xe9, 0xe2, 0x05, 0xe8, 0xf7, 0x04, 0xfa,
+  0xfb, 0x30, 0xf4, 0xec, 0xff, 0x02, 0x09, 0xed, 0xf8, 0x14, 0xf6, 0xee,
+  0x1f, 0x00, 0xea, 0x1f, 0x08, 0xf4, 0xe8, 0xff, 0x2a, 0x05, 0xe0, 0xe9,
+  0x15, 0xfa, 0x0f, 0xf5, 0xe6, 0xff, 0x11, 0xe7, 0x08, 0xe0, 0xf1, 0x02,
+  0xec, 0x05, 0x26, 0x13, 0xf0, 0x08, 0xe2, 0x31, 0xf1, 0x01, 0xec, 0x11,
+  0xfa, 0x25, 0xfd, 0x05, 0xf5, 0x06, 0xef, 0xfd, 0xf0, 0xf7, 0xef, 0xfd,
+  0xd7, 0xfc, 0xf3, 0xd4, 0x24, 0xde, 0x07, 0xf2, 0xe2, 0x05, 0x0e, 0xd8,
+  0xff, 0xdc, 0x23, 0xef, 0xeb, 0x09, 0x02, 0xe0, 0xf0, 0xf2, 0xe0, 0x12,
+  0xf9, 0xf2, 0x0d, 0xde, 0xfa, 0xfc, 0xcd, 0x26, 0xfd, 0xff, 0xfd, 0xef,
+  0x03, 0xfd, 0xef, 0x12, 0xf6, 0x08, 0x01, 0xf9, 0xfe, 0xfa, 0xf1, 0xf4,
+  0x0e, 0x03, 0x00, 0x05, 0xec, 0xec, 0xed, 0xfe, 0x10, 0x00, 0x01, 0x06,
+  0x0e, 0x07, 0xe0, 0x1b, 0x19, 0x03, 0x1e, 0x12, 0x18, 0x0f, 0xfb, 0x10,
+  0x05, 0xfb, 0x22, 0xff, 0xf9, 0x30, 0x09, 0x1c, 0x04, 0xfd, 0x02, 0xfa,
+  0xf6, 0xf9, 0xfc, 0x00, 0xfa, 0x01, 0x07, 0xf0, 0xfa, 0x0c, 0xfb, 0x03,
+  0x05, 0xfc, 0xea, 0xfe, 0x01, 0x01, 0xde, 0xf7, 0x18, 0xfc, 0xd9, 0xea,
+  0xf9, 0x18, 0xf0, 0xd3, 0x0a, 0xf3, 0xcb, 0x01, 0xeb, 0x10, 0x10, 0xef,
+  0xf1, 0x09, 0xd8, 0x22, 0xdc, 0x0b, 0x0c, 0x02, 0x02, 0x03, 0xd0, 0x05,
+  0xe6, 0x0e, 0x03, 0x0e, 0x01, 0x02, 0xdc, 0x10, 0x00, 0x05, 0xe7, 0xf5,
+  0xe5, 0xfe, 0xe6, 0xec, 0x0a, 0xec, 0x03, 0xf6, 0xe6, 0x02, 0x04, 0xc6,
+  0x14, 0xe6, 0x36, 0xce, 0xcf, 0xf9, 0x1e, 0xf8, 0x0a, 0xe8, 0x47, 0xd4,
+  0xf7, 0x08, 0x05, 0xff, 0xfa, 0xe2, 0x21, 0x12, 0x02, 0xff, 0xee, 0x11,
+  0xcb, 0xea, 0x0a, 0x25, 0xfb, 0x01, 0xe4, 0x1b, 0xf2, 0x0a, 0xf3, 0xed,
+  0xd4, 0xfb, 0x00, 0xd1, 0x1a, 0x02, 0x0e, 0xed, 0xf4, 0xfc, 0x29, 0xe6,
+  0x10, 0xed, 0xf9, 0xf0, 0x11, 0x08, 0xe9, 0xe9, 0x0a, 0x1d, 0x12, 0x10,
+  0xde, 0x00, 0x20, 0xfe, 0xd1, 0x1a, 0xf9, 0x16, 0x0a, 0xf8, 0x0e, 0xd9,
+  0xf0, 0xe3, 0xe6, 0x22, 0x0c, 0xfc, 0x23, 0xfe, 0xfa, 0x03, 0xf7, 0xf9,
+  0xf9, 0xfc, 0xdf, 0xea, 0x01, 0xf2, 0xc1, 0xf6, 0x0a, 0x0c, 0xf7, 0x1c,
+  0xce, 0x07, 0xae, 0x43, 0x26, 0xf9, 0xce, 0x18, 0xe4, 0x20, 0xfd, 0x0b,
+  0xef, 0xfe, 0x30, 0xd6, 0x56, 0x56, 0xee, 0xd2, 0xc5, 0x0b, 0x1f, 0xd5,
+  0xfc, 0xf5, 0xcc, 0xd0, 0x03, 0xfc, 0x0d, 0xe6, 0xf8, 0xeb, 0xd8, 0xee,
+  0x0d, 0xfc, 0xde, 0x0a, 0xf5, 0xfd, 0xf3, 0x01, 0x27, 0x03, 0xcd, 0x2c,
+  0xf3, 0x16, 0xfc, 0x17, 0xf8, 0x04, 0xe8, 0x0b, 0xfa, 0x1a, 0x16, 0x09,
+  0xf3, 0xfa, 0x0c, 0xfd, 0x2b, 0xf6, 0x1c, 0xcf, 0xfe, 0x01, 0xe9, 0xf0,
+  0x07, 0xba, 0xeb, 0xfd, 0xfb, 0x05, 0x03, 0x04, 0xf9, 0xd5, 0xfb, 0xfe,
+  0x06, 0x03, 0xef, 0x04, 0x04, 0x08, 0x0a, 0xf5, 0xde, 0xfd, 0xe9, 0xfa,
+  0xff, 0x06, 0x0a, 0xf7, 0xcd, 0xfe, 0xee, 0xe8, 0xe8, 0xef, 0xfb, 0xe6,
+  0xf9, 0xff, 0xfa, 0xfb, 0x0c, 0xe1, 0xf0, 0xf3, 0x19, 0xfc, 0x0e, 0xf7,
+  0x0e, 0x04, 0x00, 0x0a, 0x03, 0xfd, 0xed, 0x05, 0xfe, 0x15, 0x07, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc6, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x6a, 0xfe, 0xff, 0xff, 0x84, 0xf1, 0xff, 0xff, 0xa5, 0xd7, 0xff, 0xff,
+  0xd0, 0x04, 0x00, 0x00, 0xe1, 0xf4, 0xff, 0xff, 0x5c, 0xfe, 0xff, 0xff,
+  0x96, 0xed, 0xff, 0xff, 0x3c, 0x93, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xd9, 0x43, 0x7f, 0xab, 0xbe, 0xc0, 0xf3, 0xe4,
+  0x03, 0xe6, 0x2a, 0xbf, 0xc4, 0x14, 0xf7, 0x81, 0x36, 0xa5, 0x5b, 0x00,
+  0x00, 0x45, 0xf5, 0x81, 0x4d, 0xd2, 0xdf, 0xd0, 0xdc, 0x2e, 0x00, 0xd4,
+  0x81, 0x39, 0x3d, 0x17, 0xf9, 0xdb, 0x12, 0xd1, 0xc4, 0x3f, 0xac, 0xff,
+  0x7f, 0x5c, 0x64, 0x28, 0x06, 0xf4, 0xff, 0x81, 0x99, 0xcb, 0x81, 0xb2,
+  0xd0, 0xfb, 0x30, 0x3e, 0x2f, 0x39, 0x11, 0x71, 0xc7, 0x81, 0x1b, 0x51,
+  0xb3, 0xea, 0x6c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x2f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x73,
+  0x6d, 0x61, 0x6c, 0x6c, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2e, 0x63,
+  0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0x9c, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xbe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x56, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x07, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x3c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00,
+  0x98, 0x01, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfc, 0xfb, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x57, 0x39, 0x23, 0x3e, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x67, 0x69,
+  0x74, 0x73, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x76, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4c, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x47, 0x1d, 0x39,
+  0x0a, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x62, 0x69,
+  0x61, 0x73, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0xc6, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x48, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x9c, 0xfc, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x3e, 0x2b, 0x3c,
+  0x0d, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x77, 0x65,
+  0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x02, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xf4, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xa1, 0x1e, 0x6b, 0x3c,
+  0x07, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x0c, 0x00, 0x14, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x73, 0x68, 0x61, 0x70,
+  0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x8a, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7c, 0xfd, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0xa1, 0x1e, 0x6b, 0x3c, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x78, 0x5f,
+  0x70, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xe2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd4, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0xa1, 0x1e, 0x6b, 0x3c, 0x04, 0x00, 0x00, 0x00,
+  0x63, 0x6f, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x98, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2c, 0xfe, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6d, 0xc5, 0x77, 0x38,
+  0x5f, 0x90, 0xe8, 0x37, 0x1d, 0xb0, 0x65, 0x38, 0x72, 0xe9, 0x9c, 0x38,
+  0x81, 0xf0, 0x71, 0x38, 0xca, 0x54, 0x40, 0x38, 0x8f, 0x6b, 0x74, 0x38,
+  0xb8, 0x1a, 0x5d, 0x38, 0x09, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x76,
+  0x2f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0xff,
+  0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xa7, 0xcd, 0x76, 0x3c, 0xce, 0xa7, 0xe7, 0x3b, 0x6c, 0xca, 0x64, 0x3c,
+  0x88, 0x4c, 0x9c, 0x3c, 0x90, 0xfe, 0x70, 0x3c, 0x74, 0x94, 0x3f, 0x3c,
+  0x22, 0x77, 0x73, 0x3c, 0x9c, 0x3d, 0x5c, 0x3c, 0x0b, 0x00, 0x00, 0x00,
+  0x63, 0x6f, 0x6e, 0x76, 0x2f, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b,
+  0x0c, 0x00, 0x00, 0x00, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f,
+  0x70, 0x6f, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x08, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x48, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x81, 0x80, 0x80, 0x3b, 0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xb8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x16, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x11,
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00
+};
+unsigned int model_small_tflite_len = 5008;
@@ -0,0 +1,93 @@
+/*
+ * model_source.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Where the model flatbuffer comes from. tflite::GetModel reads it
+ *         in place, wherever it is: the weights and the other constants are
+ *         never copied into the tensor arena.
+ *
+ *         MODEL_SOURCE_ARRAY  a flatbuffer already in memory: the const
+ *                             array compiled into flash, or a copy in SDRAM
+ *         MODEL_SOURCE_FILE   a file copied into memory, host only
+ *         MODEL_SOURCE_MMAP   a file mapped into memory, host only
+ *
+ *         The file backends are built with MODEL_SOURCE_HOST, stdio and
+ *         POSIX, for tools/model_load_bench.cc. The tree has no FatFs
+ *         middleware, so the firmware has no file backend.
+ */
+
+
+#ifndef MODEL_SOURCE_H_
+#define MODEL_SOURCE_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+#define MODEL_SOURCE_ARRAY			0U
+#define MODEL_SOURCE_FILE			1U
+#define MODEL_SOURCE_MMAP			2U
+#define MODEL_SOURCES				3U
+
+/* The flatbuffer keeps its buffers 16 byte aligned relative to its start */
+#define MODEL_SOURCE_ALIGNMENT		16U
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+typedef struct
+{
+	const uint8_t * data;	/* the flatbuffer, for tflite::GetModel */
+	uint32_t size;
+	uint32_t kind;			/* MODEL_SOURCE_xxx */
+} model_source_t;
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* The model is the size bytes at data, in flash or RAM. Returns 1 */
+uint8_t model_source_array (model_source_t * source, const uint8_t * data, uint32_t size);
+
+/* Reads the file at path into buffer, MODEL_SOURCE_ALIGNMENT aligned.
+ * Returns 0 when it cannot be read or is larger than capacity, or always
+ * without MODEL_SOURCE_HOST */
+uint8_t model_source_file (model_source_t * source, const char * path, uint8_t * buffer, uint32_t capacity);
+
+/* Maps the file at path read only. Returns 0 when it cannot be mapped, or
+ * always without MODEL_SOURCE_HOST */
+uint8_t model_source_mmap (model_source_t * source, const char * path);
+
+/* Unmaps a mapped file, the memory of the others stays the caller's. The
+ * interpreter reads the model until it is destroyed, close it after */
+void model_source_close (model_source_t * source);
+
+const char * model_source_name (uint32_t kind);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MODEL_SOURCE_H_ */
@@ -0,0 +1,1834 @@
+const unsigned char model_stroke_tflite[] = {
+  0x0c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0xd6, 0xb4, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x7c, 0x55, 0x00, 0x00,
+  0x14, 0x4b, 0x00, 0x00, 0xf0, 0x4a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xe0, 0x4a, 0x00, 0x00, 0x08, 0x4a, 0x00, 0x00,
+  0xe4, 0x48, 0x00, 0x00, 0xd0, 0x38, 0x00, 0x00, 0xfc, 0x37, 0x00, 0x00,
+  0xe8, 0x36, 0x00, 0x00, 0xd4, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+  0xec, 0x24, 0x00, 0x00, 0xd8, 0x14, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00,
+  0xf0, 0x12, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0xb6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x06, 0xfc, 0xff, 0xff, 0xd7, 0xfd, 0xff, 0xff,
+  0x93, 0x05, 0x00, 0x00, 0x53, 0xff, 0xff, 0xff, 0x5d, 0xfb, 0xff, 0xff,
+  0x19, 0x09, 0x00, 0x00, 0x74, 0xfa, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff,
+  0x0e, 0xf3, 0xff, 0xff, 0x2f, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb6, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x0e, 0xff, 0xec, 0x34,
+  0xff, 0x1b, 0x0f, 0x21, 0xce, 0x02, 0x2f, 0xda, 0x0e, 0xda, 0x07, 0xec,
+  0x19, 0xaf, 0x05, 0xd5, 0xdd, 0x0d, 0x0b, 0x15, 0xaf, 0xc4, 0x19, 0xf5,
+  0x00, 0xc2, 0xfc, 0xde, 0xd9, 0x09, 0xdf, 0xd7, 0x1d, 0x3d, 0x2c, 0xfe,
+  0x09, 0xe8, 0x02, 0x13, 0x08, 0x23, 0xec, 0xe1, 0xe6, 0xf4, 0x17, 0xee,
+  0xd5, 0xee, 0x23, 0xfb, 0xfc, 0xf3, 0x26, 0xeb, 0xfd, 0xff, 0x43, 0x13,
+  0xe2, 0xf1, 0xe2, 0xe4, 0x0d, 0x36, 0x06, 0x42, 0xd6, 0x2a, 0x8b, 0xd0,
+  0x23, 0xd8, 0xf8, 0xbe, 0x40, 0x28, 0xe7, 0x1d, 0x0b, 0x08, 0xe1, 0x04,
+  0xdb, 0x10, 0xef, 0x0e, 0x0b, 0x12, 0x0f, 0xd8, 0xf1, 0x5d, 0x26, 0x02,
+  0xcb, 0x19, 0x04, 0xf9, 0xe1, 0xed, 0xff, 0x01, 0x0b, 0x08, 0xfe, 0x22,
+  0x06, 0x05, 0x0b, 0x08, 0xf5, 0xe2, 0xf1, 0x08, 0xf3, 0xea, 0x2e, 0xdb,
+  0xf8, 0x07, 0x12, 0xf1, 0xf8, 0x05, 0x21, 0xfc, 0xf2, 0x12, 0xe3, 0xed,
+  0xff, 0xf8, 0x15, 0x2a, 0x30, 0x09, 0xf9, 0xe5, 0xd1, 0xe1, 0x05, 0xff,
+  0x30, 0xe9, 0x00, 0xe5, 0x32, 0x46, 0x01, 0x10, 0xff, 0xfe, 0x2a, 0x12,
+  0x2c, 0xeb, 0x2e, 0x3e, 0x04, 0x1f, 0xf8, 0xe6, 0x00, 0x24, 0xe9, 0x32,
+  0x09, 0x20, 0xf6, 0xf8, 0x12, 0x08, 0xf4, 0x03, 0x08, 0x1f, 0x1f, 0x02,
+  0xfb, 0x04, 0xff, 0x0c, 0x10, 0x10, 0x42, 0x14, 0x25, 0xfd, 0x14, 0xef,
+  0x0b, 0x16, 0x24, 0x16, 0xd8, 0x00, 0xd3, 0x18, 0xdb, 0xc3, 0xfc, 0x04,
+  0xed, 0xde, 0xf0, 0x2d, 0xd3, 0x01, 0xfd, 0x04, 0x14, 0xfe, 0xf6, 0x02,
+  0x02, 0x2d, 0x35, 0x0a, 0xc2, 0x10, 0xff, 0x0d, 0x1d, 0xe8, 0xe2, 0x0a,
+  0x17, 0x21, 0x09, 0xea, 0xe7, 0xe0, 0x15, 0x0c, 0xf9, 0x04, 0x16, 0x0c,
+  0xe1, 0x36, 0x1c, 0x04, 0x01, 0x09, 0x1d, 0x0b, 0xe4, 0xdb, 0xc2, 0xf9,
+  0x0e, 0x0d, 0xdf, 0xfb, 0x06, 0x0c, 0x18, 0xe1, 0x1e, 0xf0, 0x27, 0xd7,
+  0xde, 0xee, 0xea, 0xa8, 0x48, 0xe7, 0xef, 0x14, 0x2c, 0x0f, 0xfc, 0xf7,
+  0xdd, 0xfd, 0x03, 0xb5, 0xfb, 0x0d, 0xd1, 0x04, 0x0f, 0xf1, 0xbc, 0xef,
+  0xcf, 0x00, 0x1a, 0x03, 0xfc, 0xee, 0x1a, 0xe1, 0x0d, 0xef, 0xf1, 0xeb,
+  0xe9, 0x01, 0x0b, 0xd0, 0x22, 0x0b, 0xd1, 0x0c, 0xf6, 0x0a, 0xd4, 0x14,
+  0x23, 0xfa, 0xe2, 0xf6, 0xfa, 0x0d, 0x0d, 0x06, 0x03, 0xe6, 0x11, 0x03,
+  0x04, 0xff, 0xe5, 0xe4, 0xcf, 0xe8, 0x10, 0x7f, 0x03, 0x24, 0x16, 0xdf,
+  0xf5, 0xf5, 0x13, 0xef, 0xaa, 0x16, 0x00, 0x06, 0x20, 0xf8, 0xb7, 0xfd,
+  0x1e, 0x1e, 0x3b, 0xe9, 0xe5, 0xee, 0xfa, 0x19, 0x0b, 0x07, 0x04, 0xcd,
+  0x05, 0xe0, 0x1b, 0x3a, 0x15, 0xfd, 0x04, 0x1c, 0x01, 0xdd, 0x0d, 0x34,
+  0xf8, 0x0d, 0xe5, 0x08, 0xf5, 0x0c, 0x31, 0xf8, 0xd9, 0xf0, 0x24, 0xfe,
+  0xfb, 0x16, 0xf6, 0xdd, 0xfc, 0xd2, 0xc9, 0xd9, 0xef, 0x24, 0xf0, 0xce,
+  0x0f, 0xc7, 0x03, 0x15, 0xfd, 0xfb, 0xf7, 0x02, 0x21, 0x32, 0x2b, 0x03,
+  0xf2, 0xcd, 0xfb, 0x07, 0x0c, 0xee, 0xd1, 0x16, 0x2f, 0xe3, 0xf9, 0xf1,
+  0x00, 0xf8, 0x05, 0xd7, 0x11, 0x1b, 0xf2, 0xfe, 0xf0, 0x01, 0xf7, 0xe3,
+  0x15, 0xd4, 0x02, 0xf2, 0xf3, 0x2b, 0x25, 0x04, 0xfd, 0xf5, 0xe4, 0xc5,
+  0x20, 0x12, 0xde, 0xfe, 0xde, 0xd9, 0xe1, 0x08, 0x1f, 0x0e, 0x2b, 0x41,
+  0x00, 0x36, 0x0d, 0xfb, 0xcf, 0x1c, 0x03, 0xf4, 0xcf, 0xf8, 0x04, 0xfe,
+  0x1b, 0xb7, 0xeb, 0x1c, 0x08, 0x11, 0xfa, 0x12, 0xfc, 0xdc, 0xd3, 0xe6,
+  0x16, 0xea, 0xe4, 0x0d, 0xf6, 0x07, 0x07, 0x11, 0x06, 0x02, 0x14, 0x02,
+  0x0b, 0x0b, 0xfc, 0x19, 0xf8, 0x09, 0xf6, 0xdc, 0x1b, 0xdb, 0xf2, 0x0a,
+  0x01, 0x06, 0xbe, 0x16, 0xdd, 0xe7, 0xe9, 0x1a, 0x29, 0x01, 0x05, 0xd5,
+  0xd6, 0xf1, 0xfb, 0x18, 0x01, 0xbe, 0x01, 0x06, 0x22, 0x01, 0xf9, 0xf2,
+  0x01, 0x13, 0xe6, 0x1f, 0xc0, 0xcd, 0x25, 0xb9, 0xea, 0x03, 0x20, 0xe1,
+  0xe9, 0x0b, 0xf9, 0x05, 0x3d, 0xf5, 0x19, 0x00, 0x05, 0xb3, 0x2a, 0xce,
+  0x15, 0xf7, 0xf3, 0xdb, 0xf0, 0x04, 0xec, 0xba, 0xe1, 0xe1, 0x04, 0xef,
+  0x0d, 0x07, 0xe6, 0xe2, 0xe3, 0xe1, 0xe8, 0xf1, 0xf7, 0xe9, 0xeb, 0xfa,
+  0x06, 0xfc, 0x3d, 0xec, 0xfb, 0xf7, 0xf9, 0x0b, 0x1e, 0xc8, 0xe3, 0x3d,
+  0x1c, 0xc5, 0xf7, 0x06, 0xec, 0x0b, 0xee, 0x18, 0xd7, 0xf5, 0x27, 0xd6,
+  0xd8, 0x0d, 0x33, 0xf6, 0xf0, 0x1c, 0xf0, 0xdd, 0x3c, 0xed, 0x05, 0xfd,
+  0x04, 0xe1, 0x13, 0xb8, 0xf5, 0xe5, 0x21, 0xbf, 0x0e, 0xfb, 0xe4, 0xf3,
+  0x20, 0xf1, 0xe4, 0xfa, 0x1a, 0x2f, 0xff, 0xdb, 0xed, 0xe9, 0xbf, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0xd8, 0xd8, 0x0b, 0x01, 0x08, 0x3c, 0xdc, 0xe1,
+  0xf6, 0x1d, 0x1b, 0xfb, 0x0c, 0x1b, 0xfc, 0x18, 0x2b, 0xd0, 0xf7, 0xff,
+  0xf6, 0x2d, 0xca, 0x1a, 0xf8, 0xdd, 0xf0, 0x09, 0xf2, 0xc3, 0xf8, 0x03,
+  0xdd, 0x23, 0xf8, 0xd9, 0x02, 0xf1, 0xe3, 0xf1, 0x13, 0xd9, 0x22, 0xe4,
+  0xef, 0x25, 0xff, 0xbd, 0xcc, 0x23, 0x03, 0x12, 0xf6, 0xf6, 0xd8, 0xce,
+  0xd6, 0xc4, 0x08, 0xf8, 0x20, 0xec, 0xe5, 0x11, 0x3d, 0x27, 0x0d, 0x12,
+  0x2a, 0x2e, 0x0e, 0xfa, 0x05, 0x20, 0x2c, 0x15, 0x06, 0x3e, 0xf9, 0xd3,
+  0x06, 0xeb, 0xd0, 0xd2, 0xf5, 0xf0, 0xe6, 0x27, 0xdb, 0xe6, 0xce, 0xfc,
+  0xca, 0xee, 0xd2, 0xf2, 0x45, 0x3c, 0xd0, 0x0c, 0xec, 0xea, 0xfc, 0x27,
+  0x09, 0xcf, 0xf6, 0xa8, 0x0c, 0xed, 0xed, 0xef, 0xe4, 0x04, 0x0f, 0xc1,
+  0x19, 0x0b, 0x05, 0x10, 0x01, 0x1c, 0xf3, 0x08, 0x06, 0xdc, 0xf9, 0x36,
+  0x3b, 0x17, 0x03, 0x47, 0xd8, 0x14, 0x17, 0x0b, 0xeb, 0x28, 0xc9, 0xfa,
+  0xfb, 0xad, 0x3f, 0x00, 0x0e, 0xe9, 0xe7, 0x05, 0xfe, 0xe1, 0x22, 0xfc,
+  0xcd, 0x02, 0xb1, 0x09, 0xde, 0xda, 0xdf, 0x10, 0xb1, 0x21, 0xa0, 0xd1,
+  0xdc, 0x1d, 0x05, 0x1c, 0x36, 0x0e, 0xee, 0xc0, 0x24, 0x23, 0xea, 0xec,
+  0x0f, 0x2b, 0x67, 0x31, 0xea, 0xed, 0x97, 0x06, 0xe8, 0xd4, 0x2a, 0x06,
+  0x18, 0x3e, 0x1e, 0xf3, 0x31, 0xf3, 0xaa, 0x47, 0x17, 0x46, 0xc2, 0x0c,
+  0xf6, 0x03, 0xe9, 0xcc, 0x00, 0xee, 0x12, 0x0c, 0xfa, 0xb5, 0x0f, 0x02,
+  0x0a, 0x03, 0x05, 0x39, 0xaf, 0x07, 0x00, 0x24, 0xce, 0xdd, 0xf4, 0xe9,
+  0x33, 0xd8, 0x14, 0xee, 0x07, 0x20, 0x1c, 0x02, 0x0b, 0xfc, 0x1c, 0x2f,
+  0xd8, 0x17, 0xd3, 0x22, 0x03, 0x15, 0x05, 0x25, 0xf9, 0x0a, 0xe6, 0xda,
+  0xef, 0x14, 0x3e, 0x0d, 0x16, 0xdf, 0x30, 0x16, 0xec, 0xe7, 0x02, 0xfc,
+  0xfd, 0xde, 0x15, 0x0b, 0x05, 0x34, 0x3b, 0x2f, 0x05, 0xef, 0xf3, 0x27,
+  0xce, 0x1f, 0xed, 0x19, 0x22, 0x0f, 0x14, 0xfe, 0x04, 0xfc, 0xfb, 0xee,
+  0x1c, 0xf8, 0xe5, 0x0e, 0x06, 0xe0, 0xc0, 0xe9, 0x2e, 0x3f, 0xf8, 0xe2,
+  0x03, 0xfc, 0xbe, 0x39, 0x10, 0xea, 0xef, 0xce, 0xf6, 0x00, 0x09, 0x03,
+  0xf4, 0x33, 0xe5, 0xd2, 0x28, 0xfa, 0x3c, 0xec, 0x0d, 0x07, 0xf2, 0xe8,
+  0x15, 0xf2, 0x0e, 0xea, 0x10, 0x20, 0xec, 0x10, 0x0a, 0x2d, 0x49, 0xe2,
+  0xf4, 0xd1, 0xee, 0xe8, 0x21, 0x16, 0x21, 0x0f, 0x0c, 0x34, 0xdd, 0xef,
+  0xea, 0xe3, 0xb3, 0x01, 0xf7, 0xe2, 0xe5, 0x0b, 0x3a, 0x3d, 0xfb, 0xd2,
+  0x43, 0xd5, 0x0c, 0x1e, 0xf4, 0x3f, 0x26, 0xb7, 0x1c, 0xe0, 0xfc, 0x42,
+  0x35, 0x05, 0xe0, 0x27, 0x38, 0x27, 0xef, 0xf6, 0x02, 0xf5, 0xfd, 0x05,
+  0x24, 0xdb, 0xb8, 0x39, 0xd4, 0xd0, 0x16, 0x07, 0xf3, 0x03, 0xf1, 0xe4,
+  0x17, 0xc0, 0x0a, 0xf9, 0x14, 0xfd, 0x12, 0x2a, 0xf0, 0x0b, 0x0f, 0xf8,
+  0x1f, 0xf3, 0x05, 0x26, 0xcd, 0x2c, 0x4f, 0xf0, 0xee, 0xda, 0xe9, 0xea,
+  0xec, 0x2c, 0xfd, 0x2a, 0x3b, 0x26, 0x04, 0xc6, 0xf4, 0xda, 0xf7, 0x28,
+  0x0d, 0xf4, 0xe8, 0xbb, 0xe9, 0xec, 0x1b, 0xdd, 0x21, 0x0f, 0xf3, 0xff,
+  0xef, 0x00, 0x07, 0x00, 0xd0, 0xe8, 0x11, 0xce, 0x2a, 0x31, 0xe4, 0x3e,
+  0x1f, 0x10, 0xed, 0x09, 0x1f, 0xe0, 0x11, 0x05, 0x2f, 0xca, 0xfc, 0x4d,
+  0xfa, 0x2c, 0xfe, 0xee, 0xe0, 0xc1, 0xfb, 0xf9, 0x01, 0x04, 0xf5, 0x09,
+  0x1d, 0x25, 0xe5, 0x14, 0x34, 0x40, 0xe3, 0x1a, 0xec, 0xf6, 0xf7, 0x27,
+  0xf9, 0x1a, 0xd4, 0x2a, 0xd5, 0x09, 0xe4, 0xf1, 0x1c, 0x20, 0x32, 0x33,
+  0x49, 0xd9, 0x05, 0x19, 0xcd, 0xe2, 0xcc, 0x0e, 0x40, 0xf7, 0xeb, 0x20,
+  0x07, 0x0f, 0xdb, 0xca, 0x00, 0xf4, 0xc5, 0x07, 0x0b, 0x11, 0x09, 0x13,
+  0xfe, 0x10, 0xf0, 0x1c, 0x0a, 0xfe, 0xd3, 0xeb, 0xed, 0xfa, 0xf2, 0x0a,
+  0x0e, 0x03, 0xd3, 0x15, 0xe9, 0xe8, 0xfe, 0xdf, 0xfa, 0x06, 0x0c, 0xea,
+  0x04, 0x20, 0x0f, 0xed, 0xf9, 0xfd, 0xf5, 0x20, 0x61, 0xc4, 0x0a, 0xe9,
+  0xce, 0xc1, 0xf2, 0xdc, 0x12, 0x21, 0xef, 0xf7, 0x18, 0x0c, 0xc1, 0xd5,
+  0x08, 0xdc, 0xfa, 0x14, 0x0a, 0x02, 0xe4, 0xf5, 0xf0, 0xb5, 0xce, 0xf7,
+  0xdc, 0x37, 0xde, 0x14, 0xe7, 0x34, 0xef, 0x10, 0xe1, 0x13, 0xdf, 0xe4,
+  0xe0, 0xd7, 0xdf, 0x09, 0xe3, 0x49, 0x0b, 0x0c, 0x05, 0xe0, 0x1c, 0xdf,
+  0xe6, 0xfc, 0x42, 0xfe, 0xfe, 0x2c, 0x0f, 0x08, 0xf9, 0xb8, 0xd7, 0x0c,
+  0xd4, 0xe2, 0xf9, 0x01, 0xb4, 0xf7, 0xf4, 0x0c, 0xef, 0x15, 0x27, 0x07,
+  0xf4, 0xfc, 0x2b, 0xe4, 0xcf, 0x13, 0x2a, 0xe9, 0xfc, 0xf8, 0xf6, 0x09,
+  0x11, 0x14, 0xb6, 0xbe, 0x0f, 0xf1, 0xde, 0x50, 0x24, 0x42, 0x08, 0xde,
+  0xfb, 0xea, 0xe3, 0x1d, 0xf6, 0xd7, 0x0a, 0xff, 0x24, 0x26, 0x24, 0x03,
+  0xf1, 0x0b, 0xfe, 0x26, 0xdf, 0x0e, 0xfe, 0xfd, 0xf1, 0x2b, 0xdb, 0x10,
+  0x06, 0xfd, 0xe3, 0xeb, 0xe1, 0x0a, 0xc9, 0xf7, 0xf9, 0x1c, 0xf9, 0xfa,
+  0xe6, 0xb7, 0xee, 0xf0, 0xf7, 0x0f, 0x00, 0x0e, 0x25, 0x23, 0x27, 0x47,
+  0x25, 0x02, 0x52, 0x27, 0x12, 0xff, 0x29, 0x1d, 0x09, 0xf8, 0x0f, 0x0f,
+  0x32, 0xe5, 0x36, 0xe3, 0x35, 0xe2, 0x08, 0x16, 0xec, 0x00, 0x21, 0xc4,
+  0xf8, 0xca, 0xac, 0xdd, 0x11, 0xde, 0xfe, 0x0d, 0xb7, 0x30, 0xdc, 0x07,
+  0x04, 0xd0, 0xde, 0x32, 0x27, 0x2f, 0xf0, 0xc3, 0xd9, 0x26, 0xde, 0xf4,
+  0x3c, 0x2c, 0x19, 0x08, 0xd7, 0xd9, 0x1d, 0x34, 0xe7, 0xe5, 0x06, 0x29,
+  0x1f, 0x24, 0x0d, 0x0c, 0x02, 0xe1, 0x08, 0x93, 0xfa, 0x05, 0x17, 0x21,
+  0xd9, 0x44, 0xdc, 0x3f, 0xbe, 0xee, 0xcc, 0xce, 0x07, 0x12, 0xea, 0xc0,
+  0x34, 0xf2, 0xe5, 0xdb, 0xf0, 0x24, 0x17, 0x03, 0xfb, 0xff, 0x54, 0xd9,
+  0x20, 0x1b, 0x19, 0x35, 0xf5, 0x0c, 0x0f, 0xf2, 0x05, 0xe6, 0xfd, 0x06,
+  0x26, 0xc9, 0x38, 0xc2, 0xfa, 0xdc, 0xe9, 0x04, 0x05, 0xf6, 0xf3, 0x20,
+  0x42, 0x05, 0x1a, 0xc4, 0xed, 0xfa, 0x1d, 0x04, 0xd7, 0xfe, 0xe9, 0xbc,
+  0x06, 0xee, 0x3f, 0x22, 0x14, 0x2d, 0x42, 0x1c, 0x3c, 0x1b, 0xdf, 0xd9,
+  0xdb, 0x07, 0x03, 0x0c, 0xee, 0x38, 0xeb, 0xf2, 0x3e, 0xbb, 0xfe, 0x22,
+  0x21, 0x25, 0xe7, 0xf7, 0x08, 0xef, 0xe7, 0xea, 0xf4, 0xef, 0xec, 0xf4,
+  0xb0, 0x00, 0x1b, 0xce, 0x08, 0x0e, 0x46, 0xee, 0xef, 0xc8, 0x01, 0x0d,
+  0x04, 0xe9, 0x01, 0x08, 0x22, 0xff, 0xa4, 0x0b, 0xf3, 0xea, 0xea, 0x31,
+  0x06, 0xfc, 0xe2, 0x0b, 0xfd, 0x15, 0xf7, 0x00, 0xf0, 0x1e, 0x01, 0xea,
+  0xfb, 0x1b, 0xe7, 0x0b, 0xfc, 0xfd, 0x2c, 0xf2, 0x32, 0x07, 0xfc, 0x10,
+  0xfe, 0xee, 0x0a, 0x23, 0x0f, 0xfb, 0x16, 0xe7, 0x22, 0xd1, 0x43, 0xf8,
+  0x1a, 0xd9, 0x36, 0xde, 0xf0, 0xfd, 0x11, 0x26, 0xee, 0xf9, 0xfe, 0x22,
+  0x04, 0xe4, 0xd7, 0x29, 0x29, 0x10, 0x34, 0x0a, 0xf5, 0x27, 0x14, 0xe9,
+  0x19, 0xf6, 0xf0, 0x12, 0xe8, 0x22, 0x23, 0xd9, 0x1d, 0x08, 0x0b, 0xfc,
+  0x27, 0xd0, 0xfc, 0xdf, 0x0e, 0xe9, 0x19, 0x1f, 0xfd, 0x20, 0x27, 0xf3,
+  0xf5, 0xd5, 0x2a, 0xb1, 0xf9, 0x1e, 0xca, 0xdd, 0x14, 0xef, 0xf9, 0x22,
+  0x18, 0xfd, 0x2f, 0xf3, 0x0c, 0xf0, 0xf7, 0x28, 0x00, 0x2c, 0xf8, 0xc4,
+  0xdd, 0xf8, 0xf8, 0xee, 0x15, 0xf6, 0xfd, 0x26, 0xe2, 0xeb, 0x38, 0xd9,
+  0xf7, 0xea, 0x1f, 0x36, 0x28, 0x16, 0x11, 0x2a, 0x43, 0x28, 0x06, 0x13,
+  0x25, 0x11, 0xc5, 0xca, 0x26, 0xdd, 0x08, 0xec, 0x23, 0xe4, 0x1b, 0x23,
+  0xea, 0xc7, 0xd6, 0x47, 0xed, 0xe7, 0x27, 0x07, 0xe1, 0xfb, 0xec, 0xc1,
+  0x92, 0xdd, 0xf2, 0x54, 0xc3, 0x44, 0xef, 0xe8, 0x0c, 0x65, 0xdf, 0x16,
+  0x3c, 0x1d, 0xf7, 0xfd, 0xfe, 0xcb, 0xbb, 0x11, 0x35, 0x1d, 0x0b, 0x11,
+  0xed, 0x35, 0xdc, 0xce, 0xf1, 0xd3, 0xd5, 0x44, 0x45, 0xc7, 0xf6, 0x30,
+  0xc4, 0x01, 0x21, 0xca, 0x3d, 0xf6, 0xe6, 0x43, 0x1c, 0x3f, 0xcc, 0xf7,
+  0x17, 0xff, 0xf4, 0xe1, 0x00, 0x1f, 0x0f, 0xb7, 0x18, 0x21, 0xd6, 0xf3,
+  0x42, 0xe3, 0xc9, 0x0e, 0x46, 0xec, 0xf2, 0xe3, 0x2d, 0x14, 0x30, 0xc2,
+  0xd8, 0xdb, 0x17, 0xfe, 0xf0, 0x00, 0xdd, 0x16, 0xec, 0x12, 0x0a, 0x57,
+  0xe9, 0xfa, 0x10, 0x10, 0xf6, 0xf3, 0x07, 0x0f, 0xd5, 0xfb, 0xac, 0xeb,
+  0x07, 0xfe, 0x09, 0x33, 0xe7, 0x04, 0x25, 0x20, 0x3f, 0x23, 0x15, 0x14,
+  0x07, 0x04, 0xed, 0xfe, 0x13, 0xbe, 0xf9, 0x04, 0xf9, 0xf4, 0x1e, 0x1b,
+  0xea, 0x0c, 0x01, 0xc5, 0x14, 0x08, 0xe7, 0x04, 0x30, 0xcb, 0xf3, 0x00,
+  0x0e, 0x1b, 0x15, 0x0a, 0x3b, 0x12, 0x05, 0x02, 0x0a, 0x0b, 0x23, 0xf2,
+  0xdd, 0x2a, 0xdb, 0x19, 0x23, 0x19, 0x03, 0xbd, 0x16, 0xf2, 0x2a, 0x2b,
+  0xd3, 0xaf, 0x0b, 0xfc, 0x09, 0x48, 0xed, 0x33, 0x04, 0xcf, 0x05, 0x07,
+  0x05, 0xe5, 0x07, 0x23, 0xf7, 0x0a, 0xbf, 0xb2, 0xf1, 0xf9, 0xf4, 0xe6,
+  0x0e, 0xe1, 0xf3, 0x04, 0x26, 0x01, 0xf6, 0x30, 0x06, 0x03, 0x1c, 0xbc,
+  0xf1, 0x0d, 0x2c, 0xfd, 0xe6, 0x12, 0x03, 0x08, 0x41, 0x0a, 0x0a, 0xbf,
+  0xf6, 0x06, 0x42, 0xfe, 0xcb, 0xe3, 0x09, 0x24, 0xf8, 0xf0, 0x21, 0xfb,
+  0xc8, 0x16, 0xe8, 0xe7, 0x04, 0xf7, 0x2b, 0xf2, 0xd9, 0xb8, 0xf5, 0xc7,
+  0xde, 0x09, 0xcf, 0xf2, 0x03, 0x18, 0xd3, 0x17, 0xd9, 0x33, 0xfc, 0x6b,
+  0x1f, 0x1c, 0xd7, 0x96, 0x02, 0xf9, 0x04, 0xd1, 0xff, 0xec, 0xdb, 0x2b,
+  0x07, 0x3c, 0xef, 0x2b, 0x14, 0xd4, 0x10, 0x02, 0x1c, 0xd9, 0x1a, 0xd1,
+  0xf3, 0xea, 0x0c, 0xea, 0xf1, 0xe0, 0xe7, 0xe0, 0x06, 0x0f, 0x3e, 0xcb,
+  0xde, 0xc7, 0xda, 0xc3, 0x10, 0x16, 0x0f, 0xdf, 0x24, 0x1d, 0x02, 0xea,
+  0xf4, 0x11, 0x18, 0x05, 0xcf, 0x15, 0xf9, 0xfa, 0x01, 0x28, 0xe7, 0xf1,
+  0x0b, 0xe0, 0xf2, 0xfa, 0x1f, 0xfd, 0x13, 0x04, 0xdc, 0x24, 0xd4, 0xed,
+  0xf8, 0xf6, 0x26, 0xf7, 0x07, 0x2a, 0xe5, 0x19, 0x0c, 0x15, 0xe6, 0x0b,
+  0x33, 0x00, 0x0f, 0x03, 0x17, 0x0f, 0xe8, 0x17, 0x1e, 0xd9, 0xd4, 0x24,
+  0xdc, 0x0b, 0xe3, 0xe6, 0xfa, 0xf4, 0x0e, 0xfc, 0x2a, 0xe5, 0x1e, 0x33,
+  0x05, 0xf8, 0x1d, 0x1b, 0xdb, 0x0b, 0x34, 0x14, 0x13, 0xe2, 0xd0, 0x0f,
+  0xf0, 0xf7, 0x0e, 0x07, 0xda, 0x06, 0x19, 0xec, 0xd5, 0xcd, 0xeb, 0xf4,
+  0xdc, 0x1c, 0x29, 0xf4, 0x0a, 0x2b, 0x17, 0xc8, 0xdc, 0x0b, 0xff, 0x16,
+  0xfe, 0xe1, 0xfd, 0xf8, 0xee, 0xe2, 0x18, 0xfa, 0x20, 0x1e, 0x29, 0xdc,
+  0xf5, 0x0f, 0x3a, 0x23, 0xee, 0xe3, 0x20, 0xd9, 0xc9, 0xc3, 0xea, 0xf8,
+  0xe7, 0x19, 0x39, 0xec, 0x12, 0xbf, 0x11, 0xf0, 0x16, 0x2a, 0xf4, 0xda,
+  0xfa, 0xcb, 0xf6, 0xb9, 0xf3, 0xf9, 0xd0, 0xf4, 0xee, 0xf9, 0x37, 0x2e,
+  0xde, 0x12, 0xd3, 0xe6, 0x07, 0xfa, 0x10, 0xea, 0x38, 0x39, 0xef, 0xf5,
+  0xe9, 0x3b, 0x13, 0x05, 0xf9, 0xfd, 0x15, 0xec, 0xe9, 0x1e, 0xf2, 0x0b,
+  0xf9, 0xf4, 0x15, 0xed, 0xdd, 0x16, 0x00, 0xe8, 0xed, 0xea, 0x21, 0xf5,
+  0x00, 0xbe, 0xd2, 0x13, 0x50, 0x21, 0x36, 0xfa, 0x22, 0xed, 0xf9, 0xcb,
+  0xeb, 0xcd, 0x03, 0xe7, 0xa9, 0xe9, 0x06, 0xf3, 0x5a, 0x2a, 0x02, 0x58,
+  0x0e, 0x1f, 0x1d, 0x64, 0x4b, 0x67, 0xe7, 0xa8, 0xd4, 0xf2, 0x05, 0x00,
+  0xe7, 0x59, 0xd7, 0xe1, 0x22, 0xef, 0xfb, 0x34, 0xf6, 0x0a, 0x35, 0xf4,
+  0x0e, 0xf2, 0x1c, 0x21, 0x29, 0xd9, 0xe7, 0xe5, 0xf1, 0x2f, 0xfa, 0xba,
+  0xb1, 0xfb, 0x30, 0x58, 0x19, 0xee, 0xe6, 0xc5, 0x2a, 0xed, 0x5d, 0xb9,
+  0x15, 0xfd, 0xb2, 0xf5, 0xc7, 0x07, 0xe2, 0x22, 0x01, 0xe4, 0x12, 0x0c,
+  0x1b, 0xf7, 0xcf, 0x08, 0x29, 0x07, 0x06, 0x25, 0x29, 0x21, 0x0f, 0x00,
+  0xcf, 0x14, 0x27, 0x27, 0xfa, 0xba, 0x06, 0xe8, 0x27, 0xe9, 0xe2, 0xf2,
+  0xe1, 0xe9, 0x0e, 0x19, 0xe2, 0x40, 0xff, 0xe9, 0x07, 0x38, 0xde, 0x01,
+  0x0d, 0x26, 0x1d, 0x03, 0x0c, 0x08, 0x01, 0xd8, 0x3e, 0xfd, 0x00, 0x15,
+  0xd6, 0xf0, 0xe6, 0xd3, 0x0f, 0x0c, 0xff, 0x03, 0x08, 0x05, 0x06, 0xe4,
+  0xee, 0xe0, 0xbd, 0xf3, 0x39, 0x04, 0x1c, 0xf5, 0x2d, 0xfb, 0xe0, 0xef,
+  0x1f, 0x33, 0x04, 0xba, 0x01, 0x17, 0x06, 0xf4, 0xfa, 0x24, 0xf0, 0x35,
+  0xd1, 0xef, 0xec, 0x1c, 0xe7, 0x07, 0x0c, 0xef, 0x0f, 0x35, 0xee, 0xd6,
+  0x2b, 0x03, 0xd4, 0x1e, 0x06, 0xd1, 0xec, 0x08, 0xd0, 0xd8, 0x12, 0xf9,
+  0x17, 0xe6, 0x3b, 0xe4, 0xfc, 0xe3, 0xdc, 0xe3, 0x0c, 0x3d, 0xee, 0xf4,
+  0x3b, 0xb9, 0x06, 0x2e, 0x04, 0xcf, 0x0f, 0xc6, 0x25, 0x33, 0x25, 0x18,
+  0xd6, 0x11, 0x36, 0x42, 0x0d, 0x1e, 0xf0, 0x01, 0x03, 0xf7, 0xfe, 0x0f,
+  0xf5, 0x1e, 0xd8, 0x0f, 0x08, 0xa4, 0xe9, 0x1b, 0xe5, 0x21, 0xf6, 0xcc,
+  0x2e, 0xfa, 0x06, 0x20, 0xfd, 0x28, 0x18, 0xf2, 0xe4, 0x23, 0x03, 0xdc,
+  0x08, 0x02, 0x2d, 0x1b, 0x0f, 0xea, 0x04, 0xc5, 0x12, 0xf9, 0x13, 0xdc,
+  0x04, 0x2f, 0x02, 0xdf, 0xff, 0xea, 0xdd, 0x39, 0xf5, 0x02, 0xee, 0x18,
+  0xe6, 0x04, 0xfe, 0xf3, 0x1b, 0x15, 0xec, 0xe2, 0xfc, 0x17, 0xff, 0x0b,
+  0xdc, 0x4b, 0x54, 0xe0, 0xbc, 0xf5, 0x29, 0xaf, 0x14, 0xd0, 0xc5, 0xce,
+  0x21, 0xf4, 0xf1, 0x06, 0xec, 0x1b, 0xfa, 0x06, 0xec, 0xf3, 0x08, 0x23,
+  0xf5, 0x08, 0x0e, 0xd5, 0xb4, 0x05, 0xfd, 0x0d, 0x04, 0xf4, 0x24, 0x18,
+  0xe0, 0xdb, 0xe4, 0x4f, 0xe7, 0xdb, 0xd5, 0x19, 0x17, 0x37, 0x30, 0xe5,
+  0xf4, 0xfd, 0xc3, 0xff, 0x22, 0x09, 0x1b, 0x1d, 0x00, 0xfa, 0xef, 0x0a,
+  0xfa, 0xfc, 0x1a, 0xf9, 0x0a, 0xfc, 0x08, 0xfe, 0xed, 0x26, 0xe6, 0x19,
+  0xdb, 0xfa, 0x0f, 0xe3, 0xe7, 0xe5, 0x10, 0xcf, 0xc5, 0x03, 0x08, 0xb0,
+  0x47, 0xd9, 0x1a, 0xf3, 0xfa, 0x00, 0xfa, 0xef, 0xe2, 0xf1, 0x08, 0xf6,
+  0xf9, 0x0b, 0xf5, 0xf7, 0x0a, 0xdd, 0x08, 0xe9, 0xf1, 0x20, 0x04, 0xc7,
+  0xe7, 0xcc, 0x98, 0xfe, 0x04, 0xed, 0xcd, 0x0a, 0x2e, 0x12, 0xf2, 0x5a,
+  0x0f, 0xda, 0xf2, 0xdc, 0xe7, 0xbd, 0xdd, 0x16, 0x03, 0xf7, 0x2f, 0xf8,
+  0x1c, 0x1d, 0x19, 0xfa, 0xe3, 0xf4, 0x07, 0x25, 0x10, 0xb3, 0xf4, 0x13,
+  0xfe, 0xe7, 0x1b, 0xea, 0xf9, 0x17, 0x36, 0xd8, 0xfd, 0x1e, 0xea, 0x55,
+  0xd0, 0xd6, 0x05, 0x34, 0x0b, 0xea, 0x02, 0x08, 0xe3, 0xf8, 0x1a, 0xf3,
+  0x2e, 0xcd, 0x17, 0xe0, 0x1d, 0xe7, 0xe2, 0x08, 0xd8, 0xfe, 0xca, 0xff,
+  0xb9, 0xfe, 0xd9, 0xed, 0xf9, 0x2a, 0xf9, 0x25, 0xd7, 0x28, 0xea, 0x04,
+  0xe3, 0x1f, 0xf1, 0xf2, 0xfe, 0xd2, 0x04, 0x05, 0x07, 0xfa, 0xdb, 0xfa,
+  0x2e, 0xf7, 0xf4, 0xf6, 0x2c, 0xf7, 0xfb, 0x3d, 0xf2, 0x09, 0x0b, 0xf9,
+  0xe8, 0xd8, 0x03, 0x19, 0x1c, 0xf2, 0x0f, 0x04, 0x0d, 0x1d, 0xdc, 0x26,
+  0x19, 0x3b, 0xe9, 0xf3, 0x21, 0x0c, 0x0a, 0x0a, 0x09, 0x00, 0xf4, 0xfc,
+  0xfe, 0xf3, 0x18, 0x0c, 0x43, 0x19, 0x1a, 0xf7, 0x2d, 0xda, 0xe5, 0xf2,
+  0x3d, 0x24, 0xfd, 0x08, 0xe1, 0x29, 0xee, 0x3b, 0xb7, 0xe8, 0xe6, 0xfb,
+  0xe3, 0xcf, 0xe8, 0x06, 0xbb, 0xdc, 0x1d, 0x0b, 0x15, 0xfe, 0xff, 0x0b,
+  0x09, 0x00, 0x14, 0xf5, 0xf6, 0x3c, 0x02, 0x0a, 0x21, 0x44, 0xef, 0x01,
+  0x26, 0xe8, 0xcb, 0xd4, 0x02, 0xe3, 0x35, 0xb7, 0x1a, 0xfb, 0x46, 0x0c,
+  0x13, 0xfd, 0x05, 0xf9, 0xde, 0xfd, 0xd4, 0xe1, 0xca, 0xf2, 0x30, 0xeb,
+  0x25, 0xd8, 0x24, 0x18, 0x42, 0x2d, 0xd0, 0xe5, 0x10, 0x09, 0xf9, 0x1b,
+  0xf1, 0xee, 0xe0, 0x4e, 0x0f, 0x07, 0x14, 0x20, 0x23, 0x1d, 0x27, 0x03,
+  0x01, 0xf4, 0xe8, 0x1b, 0xff, 0x10, 0x14, 0xd9, 0xf1, 0xd7, 0x09, 0x07,
+  0x19, 0xdb, 0x12, 0xf4, 0xe4, 0xe4, 0x3b, 0xe8, 0x22, 0x08, 0x0b, 0xc0,
+  0xf4, 0x27, 0xff, 0xe6, 0xba, 0xcf, 0x00, 0x05, 0xd5, 0xd3, 0x04, 0x1e,
+  0x0c, 0xd2, 0xdd, 0x3e, 0x36, 0xfc, 0xd5, 0x20, 0x27, 0xbd, 0xf3, 0x2c,
+  0xfc, 0x24, 0xe1, 0xea, 0x2d, 0xfd, 0x0a, 0xd3, 0x0d, 0x27, 0xfa, 0x19,
+  0xb8, 0xde, 0xf0, 0x06, 0x37, 0x32, 0xf8, 0x1a, 0xf7, 0x50, 0xfd, 0xe7,
+  0xd8, 0x19, 0xf1, 0xf7, 0x49, 0xe2, 0x10, 0xb3, 0x0b, 0x05, 0x0b, 0x04,
+  0x12, 0xfd, 0x04, 0xf7, 0x2e, 0xe3, 0x54, 0x1f, 0x19, 0xe0, 0x54, 0xe1,
+  0x0b, 0xfc, 0xd0, 0x35, 0xdd, 0x18, 0x1d, 0xea, 0xe5, 0xde, 0xf0, 0xcd,
+  0x15, 0xf3, 0x01, 0xea, 0xed, 0x10, 0xdb, 0x2c, 0xfb, 0xff, 0xee, 0xe4,
+  0xd4, 0xe9, 0xf1, 0xf3, 0xf9, 0x01, 0x36, 0x0d, 0x3e, 0x33, 0xe0, 0x33,
+  0x18, 0x17, 0xf4, 0xfa, 0x39, 0xf4, 0x0f, 0xdb, 0x06, 0x1f, 0xf0, 0x11,
+  0x18, 0x08, 0x07, 0xe1, 0x0a, 0x13, 0xe8, 0x42, 0xf2, 0xe3, 0x2f, 0x08,
+  0x17, 0x01, 0x07, 0x00, 0xcf, 0xec, 0xba, 0x26, 0xfd, 0x02, 0xd0, 0x40,
+  0xeb, 0x1f, 0xd9, 0x15, 0x07, 0x38, 0x11, 0xc2, 0x0e, 0xfa, 0x07, 0xe3,
+  0x01, 0x1b, 0x02, 0x30, 0xe4, 0x41, 0x11, 0x15, 0x06, 0xeb, 0xdc, 0xf9,
+  0x1e, 0x13, 0xfa, 0xfd, 0x09, 0xbe, 0x3d, 0x24, 0x0a, 0xdb, 0xfa, 0x02,
+  0xf6, 0xf8, 0xf6, 0x03, 0xf0, 0x07, 0x1a, 0xf5, 0x1a, 0xf3, 0xd8, 0x05,
+  0xf2, 0x14, 0xd9, 0xf6, 0x09, 0xfc, 0x10, 0x07, 0x1d, 0x25, 0x09, 0xe3,
+  0x24, 0x1f, 0x0c, 0xd7, 0x33, 0xff, 0xff, 0xff, 0x1b, 0xf5, 0x0d, 0x49,
+  0xd9, 0x06, 0xce, 0x10, 0xf3, 0xe7, 0xed, 0xfc, 0x26, 0xf0, 0xfc, 0xf7,
+  0xda, 0xfd, 0xf1, 0xf5, 0xfb, 0x20, 0x30, 0x19, 0x14, 0x1b, 0xf7, 0xf7,
+  0xfe, 0x05, 0xf2, 0x1b, 0x17, 0x24, 0xf5, 0x09, 0x1d, 0x2b, 0x17, 0x2b,
+  0x14, 0xf3, 0x01, 0x08, 0xd1, 0xed, 0xdb, 0x19, 0x00, 0xec, 0xd0, 0x42,
+  0x0b, 0xfe, 0xdc, 0x03, 0xf9, 0xf1, 0xcf, 0x0e, 0x00, 0x17, 0xef, 0x2f,
+  0xd0, 0x2f, 0xdc, 0x03, 0xca, 0xf8, 0xf9, 0xf8, 0xdf, 0xf3, 0xe2, 0xfe,
+  0x0c, 0x24, 0xee, 0x2e, 0xd4, 0xf2, 0xbc, 0x16, 0x10, 0xf5, 0xd9, 0xec,
+  0x1f, 0x09, 0x13, 0x0a, 0xeb, 0xf9, 0x0b, 0xff, 0x14, 0xd5, 0x32, 0x00,
+  0xfc, 0xf8, 0xef, 0x0c, 0xfd, 0x13, 0x08, 0xfb, 0x16, 0x19, 0x05, 0xef,
+  0x13, 0xee, 0xe2, 0xd9, 0x3a, 0x18, 0xe9, 0x04, 0xcf, 0x27, 0xdf, 0xdc,
+  0x1d, 0x23, 0xf8, 0x36, 0xff, 0x1a, 0x06, 0xf8, 0x1a, 0xec, 0xf6, 0x1e,
+  0x08, 0xbd, 0xec, 0x08, 0xde, 0xf8, 0xd9, 0xfc, 0xde, 0x1f, 0xfc, 0x0a,
+  0x1b, 0xf5, 0x20, 0xd2, 0x08, 0x0d, 0xf3, 0x08, 0xf9, 0xec, 0xfb, 0x02,
+  0xe4, 0xf0, 0x11, 0x06, 0xc5, 0x00, 0x00, 0x19, 0x1f, 0x0e, 0x21, 0x08,
+  0x06, 0x21, 0xf4, 0x07, 0x2c, 0xf1, 0xe4, 0x1b, 0xfa, 0x08, 0xf7, 0xf3,
+  0x0e, 0xf2, 0x23, 0x0b, 0xf8, 0x2c, 0x1b, 0xf1, 0x12, 0xf6, 0xe0, 0xf4,
+  0x11, 0xfd, 0xb4, 0x03, 0x21, 0x18, 0xd4, 0x1b, 0xe1, 0xff, 0x1f, 0xed,
+  0xec, 0x12, 0xfe, 0xe1, 0x38, 0xf6, 0xf7, 0x08, 0x26, 0xc6, 0x16, 0xfb,
+  0xf0, 0xef, 0x1b, 0xe3, 0x08, 0xcf, 0x2b, 0xf2, 0xd8, 0xf4, 0xf9, 0xf0,
+  0x10, 0xf2, 0x0b, 0xfc, 0x0f, 0x30, 0x24, 0xeb, 0xde, 0xbb, 0xee, 0x08,
+  0x44, 0x24, 0x11, 0x06, 0xfb, 0x02, 0x0a, 0x15, 0x2a, 0x0e, 0x09, 0xed,
+  0x30, 0xc6, 0xf0, 0x24, 0xc2, 0x35, 0xe1, 0x33, 0xfc, 0xd9, 0xed, 0xb4,
+  0x0e, 0xcd, 0xdf, 0x0a, 0xe6, 0xfa, 0xf5, 0x27, 0x08, 0x33, 0xf2, 0x1f,
+  0xff, 0xd6, 0xef, 0x11, 0x16, 0x1b, 0xe2, 0xe8, 0x02, 0x29, 0xeb, 0xfd,
+  0x10, 0x13, 0x0f, 0xfb, 0xf2, 0xd2, 0x29, 0xe6, 0x2f, 0xe6, 0x2e, 0xfa,
+  0xed, 0xed, 0xe7, 0xf2, 0xcc, 0xef, 0x05, 0xfc, 0x04, 0xeb, 0xfe, 0xf2,
+  0x19, 0x27, 0x05, 0x63, 0xea, 0x32, 0xfd, 0x0b, 0xfd, 0xd5, 0xf5, 0x01,
+  0x15, 0x03, 0xe4, 0x26, 0x0b, 0xf2, 0xe2, 0xfb, 0x0f, 0x01, 0x14, 0xf2,
+  0xd6, 0xf6, 0xde, 0xcf, 0x1d, 0x20, 0xdc, 0xe8, 0xd6, 0xef, 0xfd, 0xe5,
+  0x2f, 0x11, 0x0f, 0xdd, 0xe1, 0x06, 0xe9, 0xc7, 0x08, 0x27, 0x14, 0xe4,
+  0x08, 0x3f, 0xed, 0xd7, 0x16, 0xea, 0x30, 0x0b, 0x01, 0x01, 0x07, 0xeb,
+  0xe9, 0xbd, 0xeb, 0xf1, 0xf1, 0x0c, 0xd1, 0xe6, 0xc6, 0xf2, 0x23, 0xfa,
+  0xba, 0xe9, 0x1b, 0xfb, 0xec, 0x0b, 0x0f, 0x29, 0xd5, 0x33, 0x0f, 0xab,
+  0x8d, 0xfe, 0xff, 0xdf, 0x81, 0x43, 0xfa, 0xf3, 0xff, 0x57, 0x17, 0xb3,
+  0xd9, 0x34, 0x07, 0xee, 0x01, 0xbb, 0x11, 0xfd, 0xd7, 0xeb, 0x23, 0x18,
+  0x10, 0x66, 0x22, 0xec, 0x1a, 0xe0, 0x2f, 0xf2, 0xe4, 0xe0, 0x00, 0xd3,
+  0xf2, 0xeb, 0xc1, 0x01, 0xf3, 0x11, 0xf2, 0xcd, 0x27, 0xfe, 0xe9, 0x26,
+  0xdf, 0xe1, 0x23, 0xff, 0xf5, 0xf4, 0xe4, 0xfa, 0xd4, 0xd6, 0xfa, 0x06,
+  0xe0, 0x2e, 0x14, 0x09, 0x08, 0xf3, 0x0e, 0x15, 0xd6, 0xfa, 0xf7, 0xd6,
+  0xf4, 0xe1, 0xeb, 0x0f, 0x1c, 0xe2, 0xec, 0x49, 0x1c, 0x01, 0xec, 0x0f,
+  0x1a, 0xf8, 0x3a, 0xfa, 0x19, 0x09, 0x13, 0xf2, 0xfb, 0x06, 0xf8, 0x14,
+  0x12, 0xe5, 0xec, 0x05, 0xf7, 0x01, 0xf9, 0xf9, 0x1f, 0xf3, 0xea, 0x11,
+  0x0f, 0x04, 0xff, 0x38, 0x09, 0x04, 0x0b, 0xdb, 0xf8, 0x27, 0xff, 0x04,
+  0xdb, 0x0a, 0xf8, 0xe4, 0xfe, 0xef, 0x12, 0xe6, 0x18, 0x41, 0x27, 0xf7,
+  0x02, 0x05, 0x27, 0xf8, 0x2f, 0x24, 0xf5, 0xe9, 0x16, 0x10, 0x07, 0xd9,
+  0x0c, 0x11, 0xfc, 0x3f, 0x19, 0xf9, 0x11, 0x11, 0x3d, 0xf9, 0x01, 0x0b,
+  0x0b, 0x10, 0xf4, 0x05, 0x2f, 0x08, 0x01, 0x18, 0x31, 0x08, 0x11, 0x19,
+  0x37, 0xee, 0x03, 0xf4, 0xeb, 0x0f, 0xcf, 0xd2, 0xd4, 0xf9, 0x00, 0xc9,
+  0x0d, 0x09, 0x23, 0x11, 0x09, 0x22, 0x22, 0xf5, 0xf7, 0xf9, 0x16, 0xf6,
+  0xfc, 0x12, 0x26, 0xf2, 0xd6, 0x3a, 0x0b, 0xfe, 0xd2, 0x2d, 0xff, 0xe1,
+  0xd4, 0x0e, 0x10, 0xce, 0xf3, 0xbe, 0x0b, 0xdb, 0xc0, 0x14, 0xf2, 0xdf,
+  0xdd, 0x06, 0xfd, 0x18, 0xd6, 0x04, 0xf7, 0xe0, 0x0a, 0x04, 0xd6, 0x29,
+  0x23, 0xf6, 0x28, 0x22, 0xf8, 0xd9, 0x07, 0x06, 0x45, 0x11, 0xda, 0xff,
+  0x37, 0x05, 0x1c, 0x1a, 0x15, 0x02, 0xcf, 0x04, 0xf9, 0xe1, 0xe9, 0xdd,
+  0x13, 0x1d, 0xd4, 0xf1, 0x45, 0xfc, 0xd9, 0xfd, 0xf1, 0x27, 0xfc, 0x01,
+  0xf7, 0xb2, 0xfa, 0x18, 0x21, 0xf6, 0xc4, 0xb4, 0xf6, 0x1c, 0xca, 0x17,
+  0xf8, 0x2e, 0x05, 0x5a, 0xe9, 0xe8, 0x05, 0x14, 0xd6, 0xf2, 0x2b, 0xfd,
+  0xf5, 0x27, 0x15, 0x2d, 0x04, 0xd4, 0x3b, 0x0e, 0x1a, 0xd5, 0xf1, 0x0d,
+  0x1f, 0xe8, 0x08, 0x04, 0x31, 0xda, 0x2a, 0x19, 0xf5, 0x0b, 0xef, 0x45,
+  0x3b, 0x05, 0xfa, 0xf0, 0x09, 0xd6, 0x2c, 0xd2, 0xf5, 0xe4, 0xe0, 0xff,
+  0xed, 0x2b, 0xf0, 0x0f, 0xfd, 0xde, 0x05, 0x08, 0x17, 0x36, 0xfc, 0xd3,
+  0x06, 0x24, 0xba, 0xfb, 0x22, 0x05, 0x04, 0x0b, 0xf2, 0xea, 0x06, 0xf9,
+  0xf2, 0xe7, 0x0c, 0x0f, 0xf7, 0x04, 0x05, 0x02, 0x3c, 0x23, 0xb4, 0x35,
+  0xe8, 0x44, 0x11, 0xe7, 0xde, 0x2d, 0xe7, 0x08, 0xe1, 0x12, 0x00, 0xf8,
+  0x2c, 0xf7, 0xf4, 0xe5, 0xf4, 0x09, 0xf7, 0x25, 0xeb, 0x08, 0xf2, 0x38,
+  0xe1, 0x2e, 0x02, 0xe3, 0x31, 0xe0, 0xf9, 0x1c, 0x3b, 0x0b, 0xfd, 0x14,
+  0xe6, 0xe4, 0xfe, 0xf9, 0x13, 0xfd, 0x0b, 0x02, 0xfe, 0x08, 0xf0, 0xdf,
+  0x23, 0x12, 0x24, 0x1c, 0x02, 0x00, 0xfd, 0x00, 0x23, 0xda, 0xe0, 0x16,
+  0xe9, 0x06, 0xc8, 0xe7, 0x26, 0xe0, 0x31, 0x10, 0x18, 0x15, 0x1d, 0xf1,
+  0x04, 0x23, 0xf2, 0xdf, 0x01, 0x1e, 0x01, 0xd9, 0xfa, 0x0c, 0xc9, 0x1d,
+  0x0b, 0xf7, 0x22, 0x2a, 0x0d, 0x29, 0x27, 0xef, 0x1b, 0x04, 0xee, 0xe8,
+  0xed, 0xf4, 0xef, 0xf4, 0xd8, 0xf3, 0xd8, 0x2d, 0x0f, 0xda, 0x11, 0x1b,
+  0xe9, 0xe0, 0xde, 0xe5, 0x24, 0xe8, 0xee, 0xe7, 0x0a, 0x3c, 0xf9, 0x0c,
+  0x28, 0xdf, 0xfc, 0x05, 0xe8, 0x2c, 0xd7, 0x16, 0xe6, 0xef, 0x07, 0x00,
+  0x03, 0x3e, 0x11, 0x31, 0x01, 0x1d, 0xf1, 0x2f, 0xbd, 0xea, 0x12, 0xf1,
+  0xdb, 0xf1, 0x13, 0xe2, 0x1e, 0xea, 0x0b, 0x0b, 0xf1, 0x29, 0x18, 0x29,
+  0xfe, 0x12, 0x15, 0x00, 0x3e, 0xed, 0xef, 0xf7, 0xfe, 0x13, 0x04, 0xc8,
+  0xed, 0x39, 0x37, 0x01, 0x29, 0x07, 0xd2, 0x14, 0xfc, 0x2a, 0x09, 0xf1,
+  0x06, 0x3b, 0x0e, 0x11, 0x28, 0x19, 0xe5, 0x07, 0xd8, 0xde, 0x01, 0x0f,
+  0xe3, 0x15, 0x10, 0x09, 0xc2, 0x2f, 0xf8, 0x04, 0xf8, 0x12, 0xdc, 0xd8,
+  0x25, 0xd7, 0xf7, 0x12, 0x0d, 0x37, 0xd5, 0x3b, 0xe4, 0xf8, 0x28, 0xe7,
+  0xfa, 0xe3, 0x43, 0xd1, 0xf6, 0xdd, 0xbb, 0xff, 0xf4, 0xf4, 0x32, 0xf4,
+  0x07, 0xe5, 0xf5, 0x0e, 0x04, 0xe4, 0x47, 0xd0, 0x09, 0xda, 0xe8, 0xcd,
+  0xf6, 0xdb, 0xcf, 0xe8, 0xf9, 0x27, 0x2c, 0xef, 0xff, 0xed, 0x11, 0xce,
+  0xe8, 0x07, 0x16, 0xeb, 0x31, 0x18, 0x0f, 0xf4, 0x01, 0x0a, 0x2c, 0xd6,
+  0x24, 0xdf, 0x10, 0x16, 0x03, 0xff, 0x01, 0xf1, 0x33, 0xed, 0xfd, 0xdf,
+  0x0d, 0xe9, 0x00, 0x11, 0x0a, 0xea, 0xef, 0x15, 0x05, 0x0d, 0xe9, 0x31,
+  0xf5, 0x09, 0x01, 0x0f, 0x1f, 0xf9, 0xe2, 0xdb, 0x0a, 0x2c, 0x01, 0x01,
+  0x23, 0x0f, 0x16, 0xdd, 0x10, 0xae, 0xea, 0x2b, 0x04, 0xe0, 0x33, 0x13,
+  0x4f, 0x4a, 0x17, 0x2a, 0x12, 0xf3, 0xad, 0xd5, 0x2e, 0xf6, 0x11, 0xe4,
+  0xe7, 0x29, 0x39, 0xca, 0xf6, 0x08, 0xee, 0x16, 0x12, 0xeb, 0x1c, 0x22,
+  0x11, 0x1c, 0xed, 0x22, 0x11, 0xd1, 0x4a, 0xfd, 0xee, 0xfb, 0x22, 0xe7,
+  0xed, 0xd4, 0xcd, 0xd9, 0x2f, 0x0e, 0xff, 0xc1, 0x33, 0x01, 0x05, 0x27,
+  0xf7, 0x18, 0x05, 0x05, 0x01, 0xf0, 0xe8, 0xdc, 0xf7, 0xf2, 0x9c, 0xf7,
+  0xfe, 0x04, 0x08, 0xf1, 0x17, 0xf6, 0xcf, 0xf6, 0x0d, 0x04, 0x23, 0xde,
+  0xe9, 0x3e, 0xeb, 0x05, 0xf8, 0xf3, 0x0b, 0xad, 0x0b, 0x03, 0x06, 0xd8,
+  0x16, 0x07, 0xf4, 0x14, 0x0c, 0x06, 0x0c, 0xf6, 0xe6, 0xf6, 0x07, 0xe6,
+  0x0b, 0x01, 0x24, 0xf0, 0x1e, 0xff, 0xf3, 0x1a, 0x25, 0xd8, 0x05, 0xf6,
+  0x02, 0x3f, 0x0a, 0xe7, 0x17, 0xf1, 0x04, 0x06, 0xf0, 0x0a, 0xeb, 0xf7,
+  0x20, 0x08, 0xce, 0x24, 0xed, 0xfb, 0xf6, 0x13, 0x14, 0xf8, 0xfc, 0x0c,
+  0x2a, 0x06, 0xcf, 0xf0, 0xf7, 0x19, 0x39, 0xf0, 0xee, 0x09, 0xf6, 0x1a,
+  0x06, 0x23, 0xe3, 0xc4, 0xf5, 0xf9, 0x06, 0xf2, 0x09, 0x50, 0xf5, 0x17,
+  0xd7, 0x23, 0xf0, 0xfa, 0x01, 0xff, 0x2d, 0xf0, 0x1c, 0xd4, 0xfe, 0xe8,
+  0xe4, 0xf1, 0x05, 0xee, 0xfc, 0x17, 0x05, 0xd8, 0x2d, 0x02, 0xf9, 0x12,
+  0xe9, 0xef, 0xe8, 0xeb, 0x5f, 0x42, 0x0c, 0xf7, 0xf5, 0x25, 0xe4, 0xee,
+  0x1e, 0xed, 0xf6, 0x15, 0xfc, 0xf5, 0xfa, 0xf7, 0xd3, 0xda, 0x09, 0x18,
+  0x07, 0xfd, 0xfb, 0x23, 0xef, 0x00, 0xf3, 0xea, 0x0b, 0xe5, 0xe4, 0xf3,
+  0xf8, 0x1b, 0xce, 0x07, 0xf4, 0x14, 0xfb, 0xf2, 0x19, 0xf5, 0xff, 0xf9,
+  0xed, 0x2d, 0xd5, 0x12, 0xc4, 0xe3, 0x03, 0x03, 0xfa, 0xe3, 0xf6, 0xff,
+  0xd6, 0x10, 0x0e, 0xe7, 0xd4, 0x01, 0x18, 0x2c, 0x0e, 0x06, 0x0e, 0xe7,
+  0xfa, 0xff, 0xe1, 0xe4, 0xe9, 0xf3, 0xf3, 0xea, 0xe2, 0x02, 0x17, 0xd4,
+  0x12, 0xe9, 0x2a, 0x1a, 0xd9, 0x00, 0x0e, 0x5e, 0x13, 0x09, 0xd6, 0xe8,
+  0x34, 0xde, 0x0c, 0xff, 0xe0, 0xd1, 0xeb, 0x05, 0xd2, 0x16, 0x23, 0xcd,
+  0xee, 0x0f, 0x0b, 0xe6, 0xd6, 0x16, 0x1b, 0xe0, 0xf7, 0xec, 0x0b, 0x0e,
+  0xf0, 0x0c, 0x3b, 0xc9, 0xf4, 0x01, 0x1e, 0xdf, 0x16, 0xed, 0xfa, 0xfd,
+  0x28, 0xfc, 0x1c, 0x19, 0x24, 0x1c, 0xce, 0xe2, 0xe8, 0xdf, 0xf7, 0x0b,
+  0xe6, 0xf5, 0xdb, 0x08, 0xde, 0x29, 0x09, 0xda, 0xf7, 0x25, 0x0b, 0xf9,
+  0xfe, 0x19, 0xe1, 0xef, 0x0b, 0x31, 0xee, 0xde, 0x3a, 0x0b, 0xf2, 0x1f,
+  0xf0, 0x30, 0xe6, 0x05, 0x19, 0xf8, 0xf8, 0xdc, 0x2e, 0x0f, 0x0e, 0x31,
+  0xe8, 0x25, 0x2f, 0xea, 0xef, 0xf4, 0x26, 0xfd, 0xf1, 0xcb, 0x15, 0x16,
+  0xf0, 0x0c, 0xd4, 0xf2, 0x2d, 0x41, 0xf1, 0x18, 0xfa, 0x16, 0xf4, 0xef,
+  0x0e, 0xda, 0xec, 0xfa, 0x3e, 0xf0, 0xda, 0xf7, 0xf2, 0x18, 0x20, 0xf3,
+  0xd7, 0xe7, 0xf7, 0xdc, 0xd9, 0xf2, 0xe9, 0xf9, 0x25, 0xd5, 0x30, 0x06,
+  0xef, 0x12, 0xff, 0xf7, 0xf3, 0xe2, 0xcc, 0xfc, 0x1a, 0xee, 0x07, 0xec,
+  0xfb, 0x1e, 0x02, 0xf6, 0x0f, 0x06, 0x03, 0xf7, 0x11, 0x1b, 0x0c, 0x23,
+  0x03, 0xf4, 0xeb, 0x2d, 0x1f, 0xee, 0x10, 0x22, 0x0b, 0x37, 0xde, 0x1b,
+  0x04, 0xd3, 0xfb, 0x02, 0x3b, 0x0d, 0xda, 0x0c, 0xf4, 0xf7, 0xe2, 0xcd,
+  0xe5, 0x33, 0xe8, 0x2a, 0x10, 0x1c, 0x35, 0x0b, 0xfb, 0x29, 0xe7, 0xc2,
+  0x09, 0xc6, 0x16, 0xef, 0xe7, 0x17, 0xf6, 0xe7, 0x06, 0x18, 0x11, 0x28,
+  0xfd, 0x08, 0x03, 0xf9, 0x28, 0x0f, 0xfc, 0x0c, 0xe2, 0x11, 0x28, 0xfc,
+  0xd6, 0x09, 0xf8, 0x01, 0xf2, 0x15, 0x0c, 0xfa, 0xf2, 0xd2, 0xff, 0x20,
+  0x2a, 0x20, 0x08, 0xfa, 0x14, 0xe7, 0x34, 0xe8, 0x21, 0x0c, 0x13, 0xf9,
+  0xf9, 0x14, 0xec, 0x48, 0xfe, 0x04, 0xf8, 0xd9, 0x13, 0xfc, 0x00, 0x18,
+  0x0e, 0xdf, 0x0f, 0x04, 0xfb, 0xd1, 0xf5, 0x24, 0xf6, 0xf6, 0x13, 0x07,
+  0x05, 0xe9, 0xfa, 0xdf, 0xff, 0x0a, 0x27, 0x23, 0xf9, 0x3e, 0xc3, 0x03,
+  0x26, 0x39, 0xe5, 0x1a, 0x0c, 0x1a, 0xdf, 0x3b, 0xf5, 0x06, 0xf1, 0xbf,
+  0x11, 0x29, 0x23, 0xfb, 0xf8, 0xc3, 0xe1, 0xe4, 0xe6, 0x19, 0xeb, 0x21,
+  0x22, 0x01, 0x05, 0x2a, 0x04, 0xc4, 0x11, 0xe2, 0x0a, 0x05, 0x60, 0x1d,
+  0xe8, 0x1f, 0x14, 0x78, 0x04, 0xe1, 0xf8, 0xdb, 0x19, 0xc3, 0xdb, 0xfb,
+  0x1b, 0x01, 0xb9, 0x2a, 0xef, 0x06, 0xd3, 0x0c, 0x23, 0x41, 0xfa, 0xe0,
+  0x3d, 0x05, 0xeb, 0xf2, 0x24, 0xb8, 0x0c, 0x1a, 0xe5, 0xf9, 0xf4, 0xe9,
+  0x1f, 0xfc, 0x1a, 0x03, 0x0d, 0xdb, 0xfc, 0x13, 0x37, 0xd9, 0x1d, 0xe9,
+  0x12, 0x31, 0x18, 0xd2, 0xd4, 0xe2, 0x15, 0xe8, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0xc9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x2f, 0xfa, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xe7, 0x04, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0xff, 0x6e, 0xfb, 0xff, 0xff, 0xe7, 0x04, 0x00, 0x00,
+  0x70, 0xfd, 0xff, 0xff, 0xe1, 0x01, 0x00, 0x00, 0x8a, 0xfc, 0xff, 0xff,
+  0xd5, 0xfc, 0xff, 0xff, 0x97, 0x00, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00,
+  0x82, 0xfb, 0xff, 0xff, 0x1b, 0xfe, 0xff, 0xff, 0x51, 0xf7, 0xff, 0xff,
+  0x3f, 0x07, 0x00, 0x00, 0x8f, 0x06, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0xdd, 0xfb, 0xff, 0xff, 0xb7, 0xfd, 0xff, 0xff, 0x63, 0xf7, 0xff, 0xff,
+  0xe4, 0xfe, 0xff, 0xff, 0x09, 0xfa, 0xff, 0xff, 0x55, 0xfa, 0xff, 0xff,
+  0x8f, 0xfc, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0xff, 0xff,
+  0x8a, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0xd8, 0xfa, 0xff, 0xff,
+  0xe7, 0xfc, 0xff, 0xff, 0x8f, 0xfb, 0xff, 0xff, 0x67, 0xfc, 0xff, 0xff,
+  0xe1, 0x00, 0x00, 0x00, 0xe3, 0xfe, 0xff, 0xff, 0x02, 0x01, 0x00, 0x00,
+  0x2a, 0xff, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0x38, 0xfb, 0xff, 0xff,
+  0x7a, 0xfd, 0xff, 0xff, 0x31, 0xf9, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+  0x95, 0xf9, 0xff, 0xff, 0x81, 0xfe, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff,
+  0xc8, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 0xff, 0x91, 0x01, 0x00, 0x00,
+  0x60, 0x01, 0x00, 0x00, 0x9d, 0xfa, 0xff, 0xff, 0x57, 0xf7, 0xff, 0xff,
+  0x32, 0x02, 0x00, 0x00, 0x05, 0xf6, 0xff, 0xff, 0x4b, 0x03, 0x00, 0x00,
+  0xee, 0xf7, 0xff, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x52, 0xf8, 0xff, 0xff,
+  0x26, 0xfc, 0xff, 0xff, 0x40, 0xfe, 0xff, 0xff, 0xe1, 0xfa, 0xff, 0xff,
+  0xe9, 0xfd, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x3a, 0x01, 0x00, 0x00,
+  0x2e, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x26, 0xca, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb7, 0xed, 0xd8, 0xe6,
+  0x2c, 0xed, 0x24, 0x29, 0x20, 0x09, 0x35, 0x0c, 0x75, 0xca, 0x09, 0x12,
+  0xf9, 0x1b, 0x03, 0x4c, 0xeb, 0x12, 0x19, 0xea, 0xee, 0x61, 0xd1, 0xc6,
+  0xdf, 0x2b, 0xf6, 0x16, 0xca, 0x12, 0xd9, 0xc8, 0xfe, 0x52, 0x02, 0xf3,
+  0xce, 0x0e, 0x37, 0xec, 0x36, 0x03, 0xab, 0xb2, 0x3d, 0x09, 0x27, 0xfc,
+  0xec, 0x25, 0x23, 0x01, 0x3b, 0x22, 0xfc, 0xfb, 0x15, 0xee, 0x10, 0xf6,
+  0x3e, 0xf9, 0x3b, 0xd3, 0xe3, 0xe8, 0xcb, 0xc9, 0xfb, 0x09, 0x1c, 0x1e,
+  0xb8, 0xcc, 0xe0, 0xd6, 0x62, 0x28, 0xea, 0x30, 0x37, 0xed, 0xcc, 0x00,
+  0x37, 0xc8, 0xe7, 0xf5, 0xee, 0xee, 0x37, 0x06, 0x2b, 0x99, 0x45, 0xea,
+  0x63, 0x06, 0x03, 0x30, 0xf4, 0x04, 0xd9, 0xc6, 0x61, 0xff, 0xba, 0xdb,
+  0x26, 0x06, 0xdf, 0x09, 0x23, 0xfe, 0x5a, 0x22, 0xc2, 0x33, 0x12, 0xf2,
+  0xf9, 0x06, 0x31, 0x1b, 0x09, 0x90, 0xd2, 0x15, 0x2b, 0xeb, 0x0b, 0x14,
+  0x38, 0xcb, 0xec, 0x1b, 0x32, 0x10, 0x1a, 0xbf, 0xf5, 0xeb, 0x20, 0xcd,
+  0x38, 0x0d, 0x4d, 0x26, 0x1e, 0xed, 0xe5, 0xaa, 0xdb, 0xc5, 0x11, 0x0b,
+  0x02, 0xf3, 0xf6, 0x14, 0x4e, 0x1e, 0x21, 0x81, 0xf2, 0x08, 0x0b, 0xa1,
+  0xf3, 0xf5, 0x97, 0xea, 0x03, 0x13, 0x0e, 0xfa, 0x01, 0xad, 0xe5, 0xea,
+  0xd4, 0xbf, 0xf3, 0x55, 0xcf, 0xf8, 0x51, 0x2a, 0x00, 0x00, 0x00, 0x00,
+  0xf6, 0xca, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0xf1, 0x06, 0xfd, 0xef, 0x08, 0x3c, 0xd7, 0x2c, 0x21, 0x0c, 0x0e, 0x28,
+  0xfa, 0xff, 0x00, 0x04, 0xdf, 0x00, 0xdf, 0x05, 0xe7, 0xcd, 0xe6, 0xe2,
+  0x1d, 0xe3, 0xdc, 0x18, 0xdf, 0x27, 0xdc, 0x00, 0xf8, 0x0a, 0x0c, 0xe3,
+  0x0c, 0xee, 0xf8, 0x06, 0xf9, 0x23, 0xee, 0xc7, 0xeb, 0xfd, 0x0f, 0xf4,
+  0x08, 0x11, 0x1b, 0x2e, 0x0f, 0x1a, 0xfd, 0xe9, 0x1f, 0xee, 0x0f, 0x25,
+  0x14, 0x25, 0xe9, 0x0a, 0xed, 0x0c, 0x00, 0x08, 0x0d, 0x28, 0xef, 0xc7,
+  0x24, 0xf9, 0x17, 0x1d, 0x03, 0x1e, 0x0f, 0xfa, 0xde, 0xfe, 0xff, 0xf9,
+  0xfb, 0xc6, 0xf9, 0xee, 0x18, 0xe1, 0x1a, 0x31, 0xfb, 0x07, 0xfd, 0x2b,
+  0x2e, 0x0f, 0xf3, 0xe8, 0xfa, 0xfe, 0xde, 0x15, 0xee, 0xfa, 0x04, 0xf8,
+  0xda, 0xfc, 0xef, 0x09, 0x18, 0x09, 0x1b, 0x02, 0x18, 0x15, 0xe6, 0x09,
+  0x1a, 0x12, 0xfe, 0xf9, 0x0a, 0x1e, 0x1c, 0xfa, 0x22, 0xfb, 0xe8, 0x01,
+  0xff, 0xfa, 0x13, 0x16, 0x18, 0x0b, 0xf8, 0x2c, 0x02, 0xf1, 0xfb, 0x01,
+  0x02, 0xe7, 0xff, 0xf0, 0x06, 0x25, 0xf1, 0xef, 0x1b, 0x2c, 0xce, 0xf2,
+  0xfd, 0xee, 0xfc, 0x06, 0xf6, 0x11, 0x07, 0x03, 0x06, 0x01, 0x07, 0x0c,
+  0xee, 0x20, 0x2b, 0xe7, 0x05, 0x00, 0x09, 0x10, 0xf0, 0x14, 0xe9, 0xfc,
+  0xf8, 0x03, 0x27, 0xf9, 0xdf, 0xe2, 0xf3, 0x11, 0xea, 0x0f, 0x00, 0x0e,
+  0x10, 0x03, 0x09, 0x02, 0x04, 0xe5, 0xfc, 0xe1, 0xf1, 0xd8, 0x18, 0xf8,
+  0x1e, 0x23, 0x1c, 0x23, 0xe2, 0xea, 0xe5, 0x0f, 0xd6, 0x11, 0x13, 0x09,
+  0x08, 0xf0, 0x1d, 0x20, 0xea, 0xee, 0xfa, 0x13, 0x0a, 0xd1, 0xef, 0xf8,
+  0x12, 0xf5, 0x07, 0xf8, 0x16, 0x04, 0xe6, 0x20, 0x0c, 0xff, 0x00, 0x26,
+  0x08, 0xce, 0x10, 0xe2, 0x08, 0x00, 0xeb, 0xf7, 0x14, 0xfd, 0x28, 0x15,
+  0x34, 0xf7, 0x0d, 0x03, 0x0a, 0xf5, 0x0c, 0xf6, 0xda, 0x0d, 0x06, 0x13,
+  0xda, 0xf8, 0x00, 0x1b, 0xe2, 0x0e, 0xf3, 0x05, 0x10, 0x03, 0x25, 0x0b,
+  0x11, 0x0f, 0xda, 0x02, 0x14, 0xf6, 0x1a, 0x03, 0xf6, 0xda, 0x13, 0xdb,
+  0xe0, 0xd8, 0x16, 0xfc, 0x0e, 0x14, 0x0b, 0xf3, 0xe3, 0xf8, 0x07, 0xe4,
+  0x13, 0xf3, 0x02, 0x12, 0xff, 0x0f, 0x08, 0xdc, 0x1f, 0xeb, 0x05, 0xe4,
+  0xe8, 0x13, 0xe2, 0x03, 0xf6, 0xe7, 0xf5, 0x10, 0x13, 0xd0, 0x0b, 0x0a,
+  0x1d, 0xf2, 0xd4, 0xdc, 0xe6, 0xee, 0xdc, 0x16, 0xec, 0x0c, 0x0d, 0xf3,
+  0x17, 0xfd, 0x3d, 0xe4, 0xdc, 0x41, 0xf5, 0x01, 0xf1, 0xfe, 0x06, 0x01,
+  0xb4, 0xea, 0xf5, 0x01, 0xfa, 0xd4, 0xe5, 0x0e, 0xfa, 0x1f, 0xec, 0x16,
+  0x24, 0xf2, 0xec, 0x3c, 0xd9, 0x0b, 0x0c, 0x10, 0x01, 0xec, 0x08, 0xed,
+  0xee, 0xf9, 0xdc, 0xef, 0xfe, 0xf4, 0x17, 0xeb, 0xf1, 0x14, 0x2b, 0x08,
+  0xeb, 0xf8, 0x11, 0x01, 0x02, 0x0e, 0x01, 0xf9, 0xf8, 0xed, 0x3e, 0xfa,
+  0x13, 0xf9, 0xfe, 0xca, 0x2f, 0xe2, 0x0e, 0xfd, 0xff, 0x04, 0xfe, 0xf5,
+  0x0f, 0xd2, 0x14, 0x28, 0xeb, 0x05, 0x31, 0x1c, 0xf8, 0x00, 0xfc, 0x0c,
+  0x01, 0x02, 0xf0, 0x01, 0xea, 0x21, 0x21, 0xd9, 0xf9, 0xf4, 0x21, 0xfa,
+  0x37, 0xfd, 0x19, 0xec, 0x18, 0xdf, 0x13, 0xfd, 0xff, 0xfb, 0xcc, 0xff,
+  0xfd, 0x00, 0xff, 0x16, 0xea, 0xff, 0xf3, 0xfc, 0xfa, 0x03, 0x04, 0x14,
+  0xf3, 0x14, 0xd7, 0x0b, 0xed, 0x00, 0xfa, 0xf4, 0xf3, 0x18, 0x14, 0xd4,
+  0xfc, 0x30, 0x06, 0xf1, 0xec, 0xfb, 0xe8, 0xfe, 0xe1, 0xf5, 0xf2, 0xf1,
+  0x09, 0x33, 0xfe, 0x08, 0x06, 0xf1, 0x03, 0x07, 0xe6, 0x02, 0xf6, 0xf8,
+  0xef, 0xff, 0x03, 0x06, 0x00, 0x30, 0xf5, 0xfc, 0x04, 0x03, 0xfc, 0xf3,
+  0x07, 0xfd, 0x20, 0xe9, 0x13, 0xfd, 0x09, 0x05, 0x1c, 0xe7, 0xef, 0xe4,
+  0x15, 0xe7, 0xf5, 0xef, 0x3d, 0xf0, 0x1b, 0x08, 0x16, 0xf2, 0xc6, 0x1d,
+  0xe3, 0x25, 0xfc, 0xe6, 0x01, 0x1a, 0x11, 0xd7, 0xfa, 0xed, 0xe2, 0x11,
+  0xd9, 0x2e, 0x0e, 0xdb, 0x10, 0x32, 0xf0, 0xfa, 0x0d, 0x1c, 0xe1, 0xf1,
+  0xe1, 0x03, 0xf4, 0x1f, 0xfa, 0xf2, 0x19, 0xe5, 0xee, 0xed, 0xc9, 0x18,
+  0x3f, 0x0c, 0x24, 0xe0, 0x08, 0x14, 0xef, 0x0f, 0x17, 0xfd, 0xfa, 0x22,
+  0xf8, 0x10, 0xf4, 0x10, 0xeb, 0x2f, 0xef, 0xfe, 0xf8, 0x04, 0xe1, 0x2a,
+  0xf2, 0x24, 0xff, 0x00, 0xe3, 0x0d, 0xed, 0xf6, 0xfe, 0xe9, 0xfb, 0x20,
+  0xff, 0x2a, 0xed, 0x03, 0xe2, 0x0e, 0x1f, 0x05, 0x23, 0xef, 0xfa, 0xf9,
+  0x19, 0x05, 0xe2, 0x13, 0x0d, 0xc8, 0xdc, 0x0e, 0x03, 0xfe, 0x12, 0x0d,
+  0xc5, 0xfd, 0xfc, 0xdc, 0xff, 0x0d, 0x00, 0xe6, 0xec, 0x1e, 0x02, 0xf9,
+  0xef, 0xe6, 0x26, 0xf3, 0xe7, 0xda, 0xf2, 0xef, 0x2a, 0xc1, 0xe6, 0xd4,
+  0x04, 0x1f, 0xec, 0x35, 0xf5, 0x04, 0x10, 0x12, 0x05, 0xfc, 0xf9, 0xe7,
+  0xff, 0x0f, 0xfc, 0xf7, 0x0f, 0xf1, 0xd9, 0xf9, 0xf7, 0x0a, 0xf6, 0x0a,
+  0x00, 0x21, 0xfa, 0xff, 0x15, 0x1b, 0xfa, 0x02, 0xe9, 0x0b, 0x07, 0xe7,
+  0xfe, 0x1b, 0xe8, 0xef, 0x05, 0x05, 0x01, 0xd9, 0xe6, 0x22, 0xf9, 0xfd,
+  0xca, 0x39, 0xc3, 0x03, 0x17, 0xe4, 0x09, 0x3f, 0xfb, 0x02, 0xfc, 0x06,
+  0xee, 0x26, 0x02, 0x03, 0x19, 0x06, 0xfa, 0xe1, 0x23, 0x09, 0x04, 0xdf,
+  0xf5, 0xff, 0xf9, 0xf6, 0x12, 0x15, 0x06, 0xf4, 0x0f, 0xfd, 0xe8, 0x0f,
+  0xe4, 0xfa, 0x18, 0x15, 0x00, 0xfa, 0xf7, 0xff, 0x14, 0x07, 0xf3, 0x10,
+  0xf5, 0x0b, 0xf8, 0x01, 0x24, 0x01, 0xef, 0x0f, 0x0f, 0x06, 0x07, 0xd5,
+  0x08, 0xf7, 0x08, 0xf6, 0xf5, 0x0c, 0xe5, 0x0c, 0xed, 0xe8, 0xfc, 0x00,
+  0xf8, 0x09, 0xe7, 0xf1, 0x32, 0xf4, 0xef, 0xe0, 0x37, 0xfb, 0xe2, 0xf8,
+  0xf7, 0x1b, 0x07, 0xe0, 0xb8, 0x0e, 0xf4, 0xf8, 0xe2, 0xeb, 0x32, 0xfd,
+  0x1d, 0x04, 0xda, 0x73, 0x12, 0x04, 0xe8, 0x12, 0x21, 0xe1, 0x1e, 0xfb,
+  0xd4, 0x2a, 0xcb, 0xea, 0x0b, 0x2b, 0xd6, 0x01, 0x10, 0xde, 0xea, 0x11,
+  0x03, 0xfd, 0x1a, 0xe1, 0xc7, 0xf7, 0x24, 0xf1, 0x26, 0x01, 0x35, 0x07,
+  0x30, 0x08, 0x10, 0x41, 0xc9, 0x19, 0x26, 0xda, 0xfb, 0x0c, 0xf8, 0xc8,
+  0x05, 0xf3, 0x0c, 0x23, 0x37, 0xef, 0xe0, 0xf4, 0xf3, 0x10, 0x0d, 0x08,
+  0xc3, 0x0e, 0xed, 0xfe, 0xf1, 0xe5, 0xf8, 0x0a, 0x0e, 0x03, 0x1e, 0xf3,
+  0x11, 0xee, 0x1e, 0x16, 0x13, 0x18, 0xf8, 0x0a, 0xe9, 0x04, 0xec, 0x00,
+  0xfa, 0xff, 0x1a, 0x40, 0x15, 0x05, 0x00, 0x19, 0xf8, 0xf8, 0xf6, 0x1a,
+  0xe2, 0x28, 0xd2, 0xf6, 0x0c, 0xeb, 0x01, 0x10, 0xf4, 0x1b, 0xea, 0x0e,
+  0x19, 0x0c, 0xfc, 0xf6, 0x22, 0xf7, 0xe4, 0xef, 0x02, 0x01, 0x02, 0x0a,
+  0xe4, 0xe4, 0xd7, 0x18, 0xf6, 0xe5, 0x07, 0x0d, 0x02, 0x0a, 0xee, 0x1e,
+  0xee, 0x09, 0xf1, 0x17, 0xf3, 0x12, 0xf1, 0xdc, 0xf0, 0x14, 0xf5, 0x04,
+  0xe4, 0x04, 0xfd, 0x08, 0x0e, 0x04, 0xe6, 0x10, 0x22, 0x16, 0x0b, 0x05,
+  0xff, 0xe7, 0xf7, 0x00, 0x08, 0xfb, 0x28, 0x10, 0x0e, 0x0b, 0x0b, 0x1a,
+  0xf1, 0x0b, 0x1a, 0x09, 0x15, 0x08, 0x31, 0x09, 0xea, 0x32, 0xf8, 0x0e,
+  0x00, 0xed, 0x0d, 0xee, 0x07, 0x0a, 0xd6, 0xf7, 0xe2, 0xfb, 0xf6, 0x03,
+  0xd8, 0x03, 0x18, 0xe7, 0xf4, 0x07, 0xe9, 0xfd, 0xf9, 0xe7, 0x10, 0x16,
+  0x04, 0xee, 0x07, 0x0e, 0x17, 0xfd, 0x1e, 0xb0, 0x0e, 0xf7, 0x14, 0x36,
+  0x26, 0x0c, 0xf6, 0x1f, 0x01, 0xed, 0x0f, 0x0d, 0x07, 0x19, 0xe8, 0x0e,
+  0xf1, 0xda, 0xf6, 0x2b, 0x00, 0x0a, 0x15, 0x1b, 0x04, 0xff, 0x26, 0xf0,
+  0xfe, 0xe9, 0xfb, 0xca, 0x22, 0x1c, 0xfc, 0xf3, 0x05, 0xd5, 0x2e, 0x04,
+  0xdc, 0x00, 0x18, 0xde, 0x0e, 0xf9, 0xe7, 0xf5, 0x02, 0x15, 0x17, 0xf3,
+  0x01, 0x21, 0xdc, 0xff, 0xd2, 0xfc, 0xf2, 0xea, 0x05, 0x00, 0xfe, 0xdc,
+  0xef, 0xed, 0xde, 0xf9, 0xe7, 0xfb, 0x20, 0xe8, 0xed, 0xe8, 0xe8, 0x0c,
+  0xd9, 0x13, 0xff, 0x0b, 0x24, 0x03, 0x01, 0xf4, 0x1b, 0x0a, 0xea, 0x07,
+  0x0c, 0xf9, 0x04, 0x27, 0x13, 0x22, 0xee, 0x1f, 0x0e, 0xf4, 0x09, 0x1f,
+  0x1a, 0xf0, 0xed, 0x12, 0x09, 0xec, 0x06, 0x04, 0xef, 0xff, 0xe6, 0xec,
+  0x27, 0x04, 0xc8, 0xf2, 0xff, 0x22, 0x00, 0xf9, 0xf2, 0xe7, 0xfe, 0x17,
+  0xfe, 0xe0, 0x17, 0xe5, 0xff, 0x16, 0x35, 0xe1, 0xf0, 0xf0, 0xfa, 0x24,
+  0xf8, 0xe8, 0xff, 0x26, 0xe6, 0xef, 0xfe, 0xf7, 0xe4, 0x07, 0xfd, 0x14,
+  0xef, 0x05, 0x03, 0x0e, 0x0e, 0xe3, 0x00, 0xff, 0x06, 0xf2, 0x04, 0x00,
+  0xf7, 0xfa, 0x10, 0x03, 0xfa, 0x18, 0xec, 0x05, 0xf4, 0x0c, 0xf4, 0xf7,
+  0x0e, 0x09, 0x01, 0xfa, 0x14, 0x0c, 0x04, 0x01, 0x02, 0x0f, 0xe1, 0x00,
+  0xf4, 0x03, 0x04, 0xf3, 0xf2, 0x11, 0xe6, 0x00, 0xf0, 0x03, 0x08, 0xf8,
+  0x1b, 0xff, 0x17, 0x03, 0x00, 0xf4, 0x1f, 0xfd, 0xf3, 0xf4, 0x01, 0x07,
+  0x09, 0x0b, 0x05, 0x07, 0xc8, 0xf8, 0xe9, 0x1f, 0x22, 0x31, 0xee, 0x03,
+  0x13, 0xc7, 0x07, 0xc5, 0xfa, 0x17, 0x0e, 0x27, 0xf3, 0x21, 0x00, 0x2f,
+  0xe8, 0x07, 0x12, 0x10, 0x00, 0xee, 0x12, 0x0b, 0x01, 0x1c, 0x0a, 0x05,
+  0x08, 0x09, 0x1d, 0x18, 0x13, 0x07, 0x12, 0xce, 0xf8, 0x25, 0x01, 0x35,
+  0xe5, 0xfc, 0xe8, 0xfe, 0x1f, 0x0f, 0xfb, 0xf3, 0x1f, 0x1f, 0x08, 0xfa,
+  0x11, 0x13, 0x0f, 0x0f, 0xf6, 0x0e, 0xdc, 0xe3, 0xec, 0xf0, 0x73, 0x12,
+  0x03, 0xf7, 0x23, 0x08, 0x26, 0x2d, 0x03, 0x0a, 0xfc, 0x07, 0x17, 0x0c,
+  0x0f, 0x26, 0xed, 0xf4, 0x13, 0xf9, 0x1d, 0xd2, 0x33, 0x1a, 0xef, 0xe6,
+  0x13, 0x47, 0x09, 0xfd, 0xff, 0x0b, 0xd1, 0x31, 0xe5, 0xe5, 0x00, 0xdd,
+  0xfb, 0x19, 0xe6, 0x0e, 0x1a, 0x02, 0xeb, 0xca, 0x0c, 0x21, 0x03, 0xf5,
+  0xf4, 0xeb, 0xfa, 0x21, 0x03, 0x05, 0x0a, 0xfc, 0xd8, 0x24, 0x06, 0x20,
+  0x1d, 0xf5, 0x07, 0xe3, 0x1b, 0xe3, 0x10, 0x03, 0xf9, 0x08, 0x16, 0xf6,
+  0xfa, 0xc0, 0xfb, 0xfc, 0x0e, 0xe7, 0x19, 0xf4, 0x09, 0x0d, 0xe9, 0x13,
+  0xf8, 0x01, 0xf0, 0xeb, 0xfe, 0x0f, 0xfe, 0xf2, 0xe4, 0xed, 0x0a, 0xfd,
+  0x09, 0xf4, 0xfc, 0xfd, 0xeb, 0x01, 0x19, 0xfa, 0x10, 0x05, 0xf0, 0xfd,
+  0x1c, 0xfe, 0xf4, 0xe9, 0xed, 0x0e, 0xfe, 0xf7, 0xfe, 0xfc, 0xf4, 0xf9,
+  0x1a, 0x00, 0xf1, 0xd4, 0x4e, 0x05, 0x0e, 0x1f, 0x23, 0x0c, 0x11, 0xe8,
+  0x3a, 0x16, 0x2d, 0x09, 0x07, 0xf4, 0x05, 0x02, 0xf9, 0xfe, 0x16, 0xf6,
+  0xfd, 0xf8, 0x21, 0x01, 0xf6, 0xf7, 0xa0, 0xef, 0xf6, 0x07, 0xd1, 0x14,
+  0xed, 0xea, 0xe1, 0xc6, 0xea, 0xff, 0xf5, 0x28, 0x1b, 0x0e, 0xe3, 0xe3,
+  0x13, 0xe6, 0xec, 0xf3, 0xf2, 0xff, 0x13, 0x1b, 0x01, 0x07, 0x03, 0xf9,
+  0x00, 0xe2, 0x05, 0x15, 0x2c, 0xfc, 0x05, 0x22, 0xe7, 0xde, 0xe7, 0x11,
+  0xc3, 0x02, 0x2a, 0x06, 0xd2, 0x26, 0x2d, 0x11, 0x0f, 0x24, 0x25, 0xff,
+  0x0d, 0xc0, 0x07, 0xf6, 0xf2, 0x7f, 0xe9, 0x2e, 0xfc, 0x1f, 0x11, 0xee,
+  0x12, 0x06, 0xf6, 0xe7, 0xcf, 0xd9, 0x02, 0xff, 0x04, 0xd8, 0x26, 0xe4,
+  0x01, 0xdd, 0x2d, 0xed, 0x06, 0x04, 0x2a, 0x2a, 0xcf, 0xe0, 0xf8, 0x21,
+  0x0c, 0x33, 0xdf, 0xee, 0xe4, 0x2c, 0xec, 0xa9, 0xd5, 0xce, 0xc4, 0xee,
+  0xf8, 0x05, 0xeb, 0x01, 0x1d, 0xf0, 0xd6, 0x05, 0x0e, 0xf1, 0x1f, 0x25,
+  0x23, 0x1a, 0xde, 0xf7, 0xcf, 0xff, 0xf1, 0x12, 0xf9, 0xff, 0x2b, 0xcd,
+  0x10, 0xf7, 0x12, 0x03, 0x08, 0x0f, 0x1b, 0x0d, 0x0f, 0xfb, 0x14, 0x29,
+  0x05, 0x05, 0xcc, 0x04, 0x06, 0x16, 0x02, 0x0c, 0xd3, 0x0a, 0x07, 0xd9,
+  0x3a, 0xec, 0xdd, 0xd9, 0xf3, 0xf1, 0x0e, 0xf7, 0x27, 0x12, 0xe1, 0xfe,
+  0x14, 0x2e, 0xcf, 0x16, 0x04, 0x21, 0x19, 0xf1, 0x09, 0x27, 0xef, 0x0d,
+  0xe1, 0x06, 0xf6, 0x2d, 0xf7, 0xfc, 0x01, 0xe8, 0xf8, 0x0a, 0xf3, 0xf4,
+  0xe8, 0xf9, 0xed, 0x0d, 0x06, 0xfa, 0x0c, 0xf7, 0x01, 0x0a, 0xfd, 0xfe,
+  0x06, 0x06, 0xfd, 0xfa, 0x15, 0x11, 0xf4, 0x13, 0x20, 0x02, 0x01, 0xe7,
+  0x09, 0x11, 0x12, 0x07, 0xa8, 0x03, 0x06, 0xd9, 0xf0, 0x0b, 0x06, 0x08,
+  0x07, 0x08, 0x17, 0xfa, 0xc6, 0xfa, 0x02, 0x19, 0xed, 0xf9, 0x1d, 0xe4,
+  0xfa, 0xdd, 0xec, 0x18, 0x00, 0x00, 0x14, 0xf3, 0x01, 0x0b, 0x1b, 0xfa,
+  0x15, 0xf8, 0xfe, 0x1b, 0x0e, 0xfd, 0x05, 0x06, 0x13, 0xf5, 0x06, 0x08,
+  0xf2, 0x12, 0x14, 0x04, 0xec, 0xfa, 0xed, 0x03, 0x07, 0xf7, 0x02, 0xed,
+  0xfe, 0xfc, 0x08, 0xe6, 0xf2, 0xf1, 0x07, 0x0e, 0x06, 0xf7, 0xf9, 0xf8,
+  0x02, 0xff, 0x0c, 0x13, 0xfc, 0xec, 0xf7, 0x16, 0xed, 0x0c, 0xfc, 0xf9,
+  0xf5, 0xf5, 0xed, 0x0b, 0x1c, 0x25, 0xe3, 0x27, 0x01, 0x11, 0x04, 0x0e,
+  0x22, 0x03, 0xf0, 0xe8, 0x01, 0x0e, 0x2e, 0x1c, 0x0d, 0xdf, 0xea, 0xe9,
+  0x1c, 0xc6, 0x0d, 0x04, 0x04, 0x12, 0x01, 0x18, 0x2d, 0xe6, 0x05, 0xfb,
+  0x1b, 0xde, 0x09, 0x18, 0xf0, 0x33, 0x04, 0xe6, 0x11, 0x0b, 0xfc, 0x0e,
+  0x2f, 0x11, 0xdf, 0xe9, 0x18, 0xe6, 0xf5, 0x04, 0x0a, 0xfc, 0xe9, 0xfb,
+  0x10, 0xf6, 0xdf, 0xfa, 0x17, 0x00, 0xd8, 0x14, 0xc9, 0xf5, 0x27, 0xf9,
+  0xff, 0x10, 0xdb, 0x0c, 0xfb, 0x09, 0x34, 0xd7, 0x18, 0xe4, 0x0e, 0x03,
+  0xd5, 0x08, 0x04, 0xeb, 0x03, 0xf8, 0xdb, 0x13, 0xed, 0x1e, 0x00, 0x1c,
+  0x0a, 0x0e, 0x14, 0xd4, 0xc2, 0xef, 0x05, 0x25, 0xee, 0xfa, 0x21, 0xff,
+  0x03, 0x09, 0x06, 0x15, 0x1a, 0x09, 0x0e, 0x3b, 0x0a, 0xf0, 0xf3, 0x11,
+  0xd9, 0x02, 0x0e, 0x0f, 0x24, 0x25, 0x25, 0x02, 0x05, 0xfc, 0x01, 0x21,
+  0xee, 0x1e, 0x27, 0x04, 0x06, 0xdf, 0xf2, 0x21, 0x47, 0x1a, 0x03, 0xd9,
+  0xde, 0xf5, 0xf3, 0x37, 0xe7, 0x04, 0xff, 0x10, 0x22, 0xba, 0xd7, 0xfa,
+  0x15, 0x0e, 0x15, 0x1e, 0xfc, 0x21, 0xcb, 0x1e, 0x01, 0xf7, 0xef, 0xfd,
+  0x25, 0x15, 0x15, 0x29, 0x17, 0x22, 0x00, 0x03, 0x05, 0x13, 0x10, 0xcb,
+  0x02, 0xf8, 0xe6, 0x06, 0xec, 0x08, 0x10, 0xf9, 0xfd, 0xe7, 0xef, 0x25,
+  0x14, 0xec, 0x34, 0xd7, 0x06, 0xf8, 0x08, 0xc1, 0x01, 0xe1, 0x29, 0x2c,
+  0xec, 0x03, 0xfd, 0x00, 0x0a, 0x05, 0x38, 0x1b, 0x0f, 0x15, 0x0b, 0x0b,
+  0xff, 0x02, 0xe2, 0xde, 0x0a, 0xfc, 0xe4, 0x00, 0xea, 0xef, 0xf6, 0x07,
+  0x07, 0x04, 0xf1, 0xf1, 0x01, 0x07, 0x12, 0xfe, 0xd0, 0x06, 0xf3, 0xf2,
+  0xf1, 0x07, 0x0a, 0x0d, 0xe4, 0x02, 0xf4, 0xf5, 0x00, 0xfb, 0xd2, 0x00,
+  0xf9, 0xfd, 0xea, 0x02, 0xce, 0xf0, 0x1d, 0x09, 0x26, 0x08, 0xee, 0xfc,
+  0x1a, 0x17, 0x0e, 0xfe, 0x1f, 0x3f, 0xee, 0xff, 0xcb, 0xdb, 0xff, 0x16,
+  0xec, 0x1f, 0x15, 0xf5, 0x23, 0x1b, 0x00, 0x1b, 0xee, 0xe1, 0xf1, 0x16,
+  0xf2, 0xfb, 0xf6, 0xeb, 0x24, 0x0b, 0xfa, 0xfb, 0x20, 0x1c, 0xf4, 0xce,
+  0x1c, 0x15, 0x0b, 0x21, 0x11, 0xf5, 0xf1, 0xec, 0x0e, 0x0b, 0x08, 0xfa,
+  0x14, 0x29, 0xca, 0x12, 0x0a, 0x06, 0xfd, 0x01, 0x11, 0xec, 0x18, 0x0c,
+  0x1c, 0x0a, 0x11, 0x06, 0xf4, 0x03, 0x0d, 0xd1, 0xf5, 0xfc, 0xf5, 0xf9,
+  0x01, 0xf4, 0x21, 0x1e, 0xfb, 0x10, 0xec, 0xe3, 0x11, 0xdf, 0x25, 0x17,
+  0x0e, 0x0e, 0xf6, 0x1b, 0xf3, 0xea, 0xf8, 0xff, 0xf8, 0xec, 0xfb, 0x0e,
+  0x06, 0x20, 0xf9, 0x04, 0xf6, 0x11, 0xfc, 0x0c, 0x0e, 0x00, 0xf4, 0xf4,
+  0x03, 0x04, 0xf8, 0x13, 0xf7, 0xfb, 0xdf, 0x0e, 0x14, 0x22, 0xee, 0xeb,
+  0x08, 0xc2, 0x2b, 0x08, 0x04, 0x0a, 0x0c, 0xe9, 0xf0, 0xfb, 0xe8, 0xcd,
+  0xe9, 0xf1, 0xf5, 0x1b, 0x2f, 0xfc, 0xef, 0x17, 0xec, 0x44, 0xfc, 0x27,
+  0xd9, 0x1b, 0x19, 0xf2, 0xf3, 0xce, 0x13, 0xec, 0xd2, 0xea, 0x0c, 0x0e,
+  0x0b, 0xe3, 0x0d, 0xff, 0x04, 0xe1, 0x0c, 0x1c, 0xcb, 0xf7, 0x03, 0xf5,
+  0xf7, 0xf3, 0xf3, 0x02, 0x01, 0xf4, 0xef, 0xd7, 0xd7, 0xe7, 0xf5, 0xdc,
+  0x16, 0xd8, 0xe4, 0x1e, 0xe3, 0xfc, 0xe2, 0xf8, 0x03, 0x34, 0x16, 0x24,
+  0xfc, 0xfc, 0xd3, 0xdf, 0x17, 0xe6, 0x15, 0xf8, 0xde, 0x04, 0x15, 0xf4,
+  0xef, 0xf5, 0x06, 0xf5, 0xfc, 0x1e, 0x06, 0x0a, 0xd0, 0x28, 0x01, 0xfb,
+  0x33, 0x15, 0xe9, 0x12, 0x13, 0x21, 0xf0, 0x0e, 0xff, 0x14, 0xfb, 0x31,
+  0xe2, 0xfb, 0x0d, 0x01, 0x0b, 0xf3, 0xfe, 0xe1, 0xf8, 0xd7, 0x01, 0xf5,
+  0x02, 0xf5, 0x0b, 0x07, 0x13, 0x03, 0x0f, 0x06, 0xee, 0x0f, 0x0b, 0x17,
+  0xf5, 0x2a, 0xe7, 0xe2, 0xf9, 0xf4, 0xf9, 0x0f, 0x2f, 0x1b, 0x15, 0xf9,
+  0xf3, 0x21, 0xfd, 0xe8, 0xdc, 0x09, 0x0e, 0xe3, 0x1a, 0x00, 0x1a, 0x2a,
+  0x29, 0x0a, 0x2e, 0x08, 0x1f, 0xc9, 0x13, 0xdf, 0xe9, 0xfa, 0xf4, 0x30,
+  0xfb, 0xf8, 0xfc, 0x2e, 0xc0, 0x38, 0xed, 0x2b, 0xf8, 0x11, 0x09, 0x00,
+  0x01, 0x00, 0x11, 0x21, 0xf5, 0xf9, 0x00, 0x06, 0xd6, 0x07, 0x12, 0xbd,
+  0xe5, 0xc6, 0x1b, 0xf2, 0xf0, 0x0a, 0xdc, 0xb6, 0x18, 0xe6, 0x1f, 0xf1,
+  0xff, 0x14, 0x0c, 0x33, 0x0a, 0xf4, 0x39, 0xec, 0x3c, 0x05, 0x09, 0x02,
+  0xee, 0xe9, 0x2b, 0xee, 0x13, 0xde, 0x24, 0x02, 0xf9, 0x0c, 0x29, 0x17,
+  0xf4, 0x00, 0xfe, 0xf5, 0x16, 0xf8, 0xfe, 0x3a, 0xf5, 0x26, 0xe2, 0xe5,
+  0x15, 0xec, 0x00, 0x00, 0xe5, 0x0e, 0x14, 0xd9, 0x12, 0xed, 0x07, 0xf0,
+  0xe5, 0xf8, 0xf6, 0x15, 0xfa, 0x25, 0xd4, 0xe9, 0xd4, 0x03, 0xfb, 0x11,
+  0x12, 0x07, 0xe8, 0xce, 0x0b, 0xff, 0x02, 0xed, 0x02, 0x10, 0x07, 0xe7,
+  0x07, 0xe1, 0x05, 0x00, 0xde, 0x0b, 0x11, 0xf2, 0x0e, 0xf7, 0x04, 0xf2,
+  0xe5, 0xe6, 0x18, 0x01, 0xd6, 0xff, 0x02, 0xf2, 0x15, 0xe2, 0x00, 0x16,
+  0x05, 0xfa, 0xed, 0xc9, 0xe2, 0xed, 0xf8, 0x11, 0xe7, 0xf5, 0x18, 0x0d,
+  0x04, 0x18, 0x2a, 0xe2, 0xe8, 0x0d, 0x15, 0xfe, 0x05, 0xf0, 0xe4, 0x0c,
+  0x0d, 0x0d, 0x01, 0x29, 0x04, 0xf8, 0x11, 0xf3, 0x13, 0xf1, 0xff, 0x05,
+  0x11, 0xfe, 0xfd, 0xe6, 0x1b, 0x0d, 0xf6, 0xf5, 0xfc, 0x0d, 0x16, 0x1f,
+  0x04, 0xd4, 0xca, 0x09, 0x17, 0x08, 0x23, 0x10, 0xfa, 0xcf, 0x24, 0xf1,
+  0x03, 0x06, 0xf9, 0x22, 0xe6, 0x08, 0xf5, 0x06, 0xf8, 0xf7, 0xea, 0xff,
+  0xfd, 0x02, 0xfc, 0x05, 0xf7, 0x00, 0x21, 0xe1, 0x02, 0x1a, 0xde, 0xfb,
+  0x29, 0x02, 0x12, 0x2a, 0x0e, 0xea, 0x0c, 0x12, 0x00, 0x01, 0x06, 0xf2,
+  0xfd, 0xf6, 0x23, 0xfb, 0x09, 0x00, 0x05, 0x09, 0xee, 0xfc, 0x1f, 0xf8,
+  0x06, 0x0f, 0xee, 0x02, 0x02, 0x0c, 0xed, 0x1c, 0xbf, 0xd9, 0xdb, 0xda,
+  0xe8, 0xea, 0xe1, 0x01, 0x0d, 0x11, 0xf2, 0xfa, 0x1b, 0x01, 0xfe, 0x21,
+  0x0f, 0x08, 0x21, 0x14, 0x0a, 0xd0, 0x01, 0x2d, 0xfb, 0xe9, 0x14, 0x05,
+  0xfe, 0x2c, 0x03, 0xec, 0x10, 0x06, 0x20, 0x12, 0xf9, 0x17, 0xf1, 0xd6,
+  0xf1, 0x19, 0xe1, 0x16, 0xe1, 0xf2, 0x10, 0xcb, 0xef, 0xde, 0xf9, 0x0d,
+  0x26, 0x1c, 0xff, 0xfd, 0xc2, 0xfc, 0x26, 0xeb, 0xdb, 0x08, 0x10, 0x0f,
+  0xdd, 0x04, 0xee, 0xfd, 0x06, 0x0d, 0xec, 0x0c, 0x0f, 0xf3, 0xe8, 0x01,
+  0xf1, 0x0f, 0xc7, 0xf7, 0xf7, 0x04, 0xe6, 0x29, 0xf8, 0x11, 0xe3, 0xf7,
+  0xe7, 0xf4, 0x15, 0xfe, 0xf8, 0xf2, 0xfe, 0x0a, 0xfd, 0xe2, 0x05, 0xe4,
+  0xfd, 0xeb, 0xea, 0x10, 0xf3, 0x10, 0x04, 0xdd, 0xdc, 0x0a, 0xf4, 0x03,
+  0x0a, 0xe8, 0x0c, 0xdf, 0x01, 0x22, 0x13, 0xe8, 0x09, 0x0c, 0xf3, 0xf6,
+  0x0d, 0xe8, 0xd5, 0xf4, 0x13, 0x03, 0x1d, 0xfb, 0xf0, 0xfe, 0x0f, 0xe0,
+  0xe7, 0x0a, 0x06, 0xee, 0xf8, 0xf2, 0xf7, 0x1a, 0xf9, 0xe8, 0xcb, 0x22,
+  0xfb, 0x1c, 0x02, 0xf8, 0x10, 0xe5, 0xff, 0xf7, 0x17, 0x10, 0x01, 0xee,
+  0x10, 0xf0, 0xd1, 0xf5, 0xef, 0x19, 0x20, 0xf0, 0xe7, 0xe4, 0x1c, 0xdb,
+  0xf8, 0xe8, 0xde, 0xfe, 0x1a, 0xce, 0x5e, 0xf1, 0xfb, 0x0a, 0x1e, 0xff,
+  0xdb, 0x03, 0xff, 0xd9, 0xf2, 0x14, 0xf7, 0xf6, 0x17, 0x18, 0x18, 0xf3,
+  0x1b, 0xf7, 0x0d, 0xd7, 0x05, 0x04, 0xee, 0x17, 0xe6, 0x00, 0x15, 0xfe,
+  0xf8, 0xf8, 0xf5, 0x25, 0xfc, 0x0d, 0xf7, 0x00, 0x0e, 0xe0, 0x08, 0xfe,
+  0x22, 0xee, 0x02, 0xe6, 0xff, 0x0b, 0xfd, 0x2d, 0x2e, 0xee, 0x10, 0xed,
+  0x0a, 0xf8, 0x03, 0xd3, 0x18, 0xed, 0x13, 0x11, 0xd7, 0x3d, 0xe1, 0xeb,
+  0x05, 0x12, 0x03, 0xfd, 0x28, 0x0f, 0x24, 0xf7, 0x02, 0xf8, 0xe0, 0x0a,
+  0xf5, 0xdf, 0xfe, 0x0c, 0xcc, 0x0b, 0x02, 0x00, 0x0a, 0x0f, 0xd9, 0xf7,
+  0x06, 0x1a, 0xf3, 0xd8, 0x34, 0x03, 0x07, 0x06, 0xfd, 0x11, 0x04, 0x1d,
+  0xee, 0xff, 0x07, 0xf9, 0x1e, 0xfe, 0xe5, 0x00, 0x13, 0x09, 0x10, 0xea,
+  0x10, 0xec, 0xf7, 0xfd, 0xf1, 0x02, 0x1d, 0xe4, 0xf8, 0xf3, 0x11, 0x0b,
+  0xfe, 0xe6, 0x14, 0x02, 0xfa, 0x03, 0xfe, 0xf9, 0x04, 0xe2, 0x09, 0x20,
+  0xd9, 0xea, 0xfb, 0x02, 0x00, 0x0e, 0xf3, 0x03, 0x19, 0x0a, 0xf5, 0xed,
+  0x0b, 0x17, 0x06, 0xd4, 0xe5, 0x04, 0xf5, 0xf1, 0x12, 0xfc, 0xf9, 0xeb,
+  0xf1, 0x03, 0xe9, 0x0c, 0x03, 0xe7, 0xf8, 0x18, 0x0e, 0xf9, 0xfd, 0xfc,
+  0xf7, 0xf4, 0x05, 0x09, 0xda, 0x10, 0xdd, 0xfc, 0x03, 0xe0, 0xf0, 0x28,
+  0x15, 0x21, 0x11, 0xe1, 0x08, 0xf4, 0x10, 0xf0, 0x06, 0x02, 0x2e, 0xed,
+  0xf1, 0xfc, 0x0f, 0x45, 0x08, 0xe3, 0x2b, 0x12, 0x1c, 0xf8, 0xea, 0x48,
+  0x13, 0x28, 0x08, 0x0c, 0xfb, 0xe9, 0xd8, 0x31, 0x0e, 0xec, 0xe7, 0xd8,
+  0x15, 0xff, 0xf8, 0xed, 0xfc, 0xf2, 0xf4, 0x05, 0x14, 0x18, 0x17, 0x13,
+  0x13, 0x02, 0x34, 0xfc, 0x2a, 0x09, 0xe9, 0xf2, 0xff, 0xe0, 0x31, 0x20,
+  0xe3, 0xf4, 0xfa, 0x01, 0xf0, 0x12, 0xe5, 0xf2, 0xfa, 0xe3, 0xf9, 0xf2,
+  0xd8, 0x15, 0x05, 0x16, 0x06, 0xf5, 0xf4, 0x17, 0xee, 0x0e, 0xf7, 0xef,
+  0x26, 0x1c, 0xed, 0xfc, 0x0d, 0xfb, 0xeb, 0x0e, 0x06, 0xf9, 0x17, 0xd2,
+  0x23, 0xf5, 0x1f, 0x09, 0x07, 0x02, 0xe6, 0xbe, 0x04, 0x2b, 0x23, 0xe5,
+  0x20, 0x0b, 0x23, 0xe9, 0xcb, 0xd5, 0x1e, 0xf6, 0x28, 0x31, 0x03, 0xf9,
+  0x1c, 0x00, 0x16, 0xfb, 0xe6, 0x29, 0xe8, 0xf1, 0xfe, 0xdd, 0x05, 0x19,
+  0xf6, 0x1f, 0x30, 0xfa, 0xf2, 0x1a, 0x17, 0xf3, 0x08, 0xf6, 0x02, 0xfe,
+  0xe1, 0xe3, 0x03, 0xff, 0xfb, 0xf0, 0x04, 0x0b, 0x04, 0xff, 0xf6, 0x03,
+  0xf8, 0xf8, 0xf0, 0xdf, 0xda, 0x04, 0xf4, 0xf1, 0x05, 0x05, 0xef, 0xf2,
+  0xfe, 0x0a, 0x06, 0xf6, 0xfa, 0xe3, 0xfd, 0x05, 0x1e, 0x08, 0x09, 0x04,
+  0xf6, 0xd6, 0xfe, 0x00, 0x04, 0x22, 0xf4, 0x03, 0xee, 0x2a, 0x04, 0xf9,
+  0xfb, 0x12, 0x09, 0xef, 0x07, 0x10, 0x34, 0x11, 0x22, 0x18, 0x23, 0xf4,
+  0x0c, 0xf4, 0xf5, 0x2b, 0xf0, 0xe2, 0x05, 0xdf, 0x24, 0xbf, 0x3d, 0x17,
+  0x22, 0xe8, 0x16, 0xfd, 0xe2, 0x1a, 0x36, 0x1e, 0xe9, 0xfc, 0xf5, 0x13,
+  0xf7, 0x0c, 0xee, 0x0f, 0x0b, 0x0a, 0xc4, 0x03, 0xf2, 0x19, 0xd0, 0xf5,
+  0x02, 0xf9, 0xf3, 0xfd, 0xe6, 0xf4, 0x1d, 0x38, 0x0e, 0x0d, 0xf2, 0xee,
+  0x12, 0xdb, 0xf5, 0xf9, 0x03, 0x13, 0x1c, 0x10, 0xf4, 0x20, 0xe4, 0x0e,
+  0x06, 0x0a, 0xfe, 0x05, 0x05, 0xf1, 0x05, 0xe8, 0x11, 0x05, 0x12, 0x0c,
+  0xed, 0x1f, 0x30, 0x22, 0xef, 0x06, 0xf5, 0xe3, 0x03, 0x0d, 0xea, 0xfd,
+  0xef, 0x1a, 0xd8, 0xfe, 0x03, 0x01, 0xfa, 0x09, 0xf0, 0xb7, 0xfb, 0xfe,
+  0xf2, 0x02, 0x07, 0xfe, 0xf8, 0xfb, 0xee, 0xf7, 0x1e, 0x0d, 0x1c, 0x14,
+  0xfb, 0xf2, 0xe7, 0x03, 0x1f, 0xef, 0xf4, 0x04, 0x01, 0xf6, 0x10, 0x1b,
+  0xf3, 0x0b, 0x03, 0xf8, 0xff, 0xee, 0x2c, 0xf7, 0xfe, 0x06, 0xd1, 0xf7,
+  0xff, 0xee, 0xf1, 0xf8, 0xee, 0x0c, 0xed, 0xe6, 0x02, 0x15, 0x08, 0x04,
+  0xfb, 0xff, 0xf0, 0x0e, 0xf8, 0xe6, 0xf5, 0xf1, 0xe2, 0x01, 0x14, 0x01,
+  0xef, 0x1f, 0xfa, 0xf6, 0x00, 0xea, 0x07, 0x0b, 0x17, 0x0e, 0x16, 0xfa,
+  0x2f, 0xf8, 0xf2, 0x15, 0x11, 0x03, 0xeb, 0x1d, 0x2c, 0xe5, 0xd8, 0x02,
+  0xfe, 0xef, 0x0c, 0x11, 0x07, 0xf4, 0xcb, 0x02, 0xef, 0xe3, 0xf4, 0x0e,
+  0x1b, 0xdd, 0xf8, 0x01, 0xc2, 0x00, 0xc5, 0x23, 0xf4, 0x45, 0x09, 0xec,
+  0xf4, 0x13, 0x10, 0x23, 0xfb, 0xfa, 0x11, 0x1a, 0xfe, 0x01, 0xff, 0xcc,
+  0x12, 0x17, 0x1a, 0x04, 0x01, 0xeb, 0x21, 0xfe, 0x04, 0xe4, 0xf6, 0xfa,
+  0x0e, 0xf6, 0xeb, 0x2a, 0xfa, 0xd8, 0x22, 0xff, 0xf8, 0x38, 0x34, 0x17,
+  0xf6, 0xf5, 0xf8, 0x03, 0x0b, 0x03, 0x09, 0xf2, 0x2c, 0x00, 0x0e, 0xe7,
+  0xed, 0x0c, 0xea, 0x17, 0x0a, 0xfe, 0xdf, 0x1d, 0xf9, 0x18, 0xf6, 0xee,
+  0x1a, 0xf4, 0x00, 0x0c, 0xf4, 0xea, 0x05, 0x03, 0xe3, 0x02, 0x25, 0xe7,
+  0x22, 0xe5, 0xff, 0x12, 0x16, 0x11, 0xf1, 0x09, 0x2b, 0xea, 0xf2, 0x27,
+  0xda, 0x28, 0xdb, 0x0b, 0x0c, 0x0c, 0xdf, 0x05, 0xfe, 0x14, 0xac, 0xe8,
+  0xfa, 0xdb, 0xf8, 0xd5, 0xed, 0xfd, 0xf9, 0x15, 0xf4, 0x06, 0x08, 0x01,
+  0xc5, 0xd5, 0xc5, 0xf2, 0x1d, 0xff, 0xf8, 0x27, 0xe0, 0x38, 0x0a, 0x01,
+  0xed, 0xef, 0xf1, 0x0d, 0xd5, 0x13, 0x0b, 0x1f, 0x16, 0xff, 0x0e, 0xf2,
+  0x1c, 0xf5, 0x02, 0x0b, 0xe7, 0x1d, 0x00, 0xfb, 0xf9, 0xff, 0xe4, 0xec,
+  0xee, 0xef, 0x37, 0xf4, 0x14, 0xdf, 0x2f, 0x02, 0xc4, 0xf0, 0xc4, 0xe5,
+  0xee, 0x23, 0x1a, 0xe3, 0x20, 0x13, 0x19, 0x21, 0xfb, 0x06, 0x07, 0x32,
+  0x17, 0xea, 0xfa, 0xf5, 0xfb, 0x13, 0xcd, 0x06, 0xfd, 0x0e, 0xbb, 0x11,
+  0x12, 0x0c, 0xf7, 0x02, 0xe8, 0xf4, 0x1a, 0x06, 0xdf, 0x22, 0xee, 0xeb,
+  0xf5, 0xfc, 0x17, 0x13, 0xeb, 0xed, 0xf5, 0xfb, 0xfc, 0x1c, 0x20, 0x0f,
+  0xd1, 0x01, 0xfd, 0xf4, 0x1a, 0xf4, 0x12, 0x04, 0xfe, 0x06, 0x20, 0xd3,
+  0xb2, 0xd4, 0x1c, 0x24, 0xee, 0x1b, 0x30, 0x2e, 0x06, 0x11, 0x11, 0x00,
+  0xf3, 0xf9, 0xc4, 0xc3, 0x02, 0xb0, 0x07, 0x1e, 0x1a, 0x26, 0xfe, 0xd2,
+  0x01, 0xdb, 0x1b, 0xcd, 0xef, 0x02, 0x0e, 0xf6, 0xda, 0xfb, 0xf8, 0x07,
+  0x2a, 0x08, 0xf8, 0x02, 0x09, 0xec, 0xf4, 0x1f, 0x5c, 0xf4, 0xeb, 0xe8,
+  0x2d, 0xf5, 0xe4, 0x10, 0x06, 0x18, 0x13, 0x07, 0xe5, 0xe1, 0xf2, 0x28,
+  0xd0, 0xf5, 0x0b, 0x14, 0x27, 0xff, 0x39, 0xec, 0xe6, 0x06, 0xfc, 0xe5,
+  0xea, 0xfa, 0xdf, 0xfe, 0x0a, 0xf6, 0x27, 0x34, 0x0b, 0x2f, 0xcb, 0x09,
+  0xf7, 0x0d, 0xf6, 0x07, 0x21, 0xcf, 0x0f, 0xf8, 0xc8, 0x0a, 0xfa, 0x25,
+  0x08, 0x0f, 0x10, 0xf4, 0x10, 0x0f, 0x0a, 0xee, 0x2d, 0x05, 0x09, 0xe9,
+  0xef, 0x12, 0xf1, 0xf0, 0x1a, 0xf7, 0x17, 0xde, 0xf5, 0xef, 0xd4, 0x21,
+  0x0a, 0x1b, 0x07, 0xf5, 0xfc, 0x21, 0x03, 0xdd, 0xed, 0x0d, 0xfa, 0xe2,
+  0xf6, 0x1d, 0xfc, 0xf9, 0xfb, 0x1e, 0x08, 0x06, 0x0a, 0xf2, 0x26, 0xd7,
+  0x15, 0x06, 0xe6, 0xf0, 0x10, 0x16, 0x08, 0xff, 0x19, 0xf7, 0xef, 0xe6,
+  0x04, 0xed, 0x25, 0x03, 0xff, 0xed, 0x0f, 0xe8, 0x0a, 0xcc, 0xf6, 0xe4,
+  0xfb, 0xfc, 0x02, 0xe1, 0x12, 0x04, 0x1d, 0xf2, 0x19, 0xf3, 0xed, 0xfb,
+  0x20, 0xf3, 0xfb, 0x0c, 0x0b, 0x11, 0x1f, 0x16, 0xfc, 0xfc, 0xd9, 0xfe,
+  0xef, 0xff, 0x10, 0xed, 0xf5, 0xf8, 0xdb, 0xf0, 0xfb, 0xf6, 0xf7, 0xfd,
+  0x08, 0x19, 0xf0, 0xe2, 0xec, 0x1b, 0xe7, 0x23, 0xdf, 0xe9, 0xee, 0xf5,
+  0x07, 0xef, 0xfe, 0x19, 0xee, 0x10, 0x16, 0x30, 0x13, 0xf3, 0xe7, 0x00,
+  0x4d, 0x00, 0xfb, 0xf8, 0x02, 0x1c, 0x0d, 0xe4, 0x02, 0xf9, 0xff, 0x1d,
+  0x0b, 0xeb, 0x12, 0xdd, 0xf6, 0xf0, 0xe5, 0xfb, 0x0d, 0x26, 0xe8, 0xed,
+  0x28, 0xf2, 0x13, 0x0d, 0x07, 0xf6, 0x24, 0xfb, 0xf1, 0x13, 0xd5, 0x0f,
+  0xfd, 0x36, 0xd4, 0xce, 0x20, 0xee, 0x25, 0xd7, 0xf1, 0x14, 0x08, 0x50,
+  0xce, 0x10, 0x15, 0x01, 0x13, 0xe9, 0x36, 0xd4, 0x1b, 0xf2, 0x1c, 0x0c,
+  0x29, 0xca, 0xdf, 0x0f, 0x1a, 0xea, 0x01, 0x00, 0xec, 0x06, 0xfc, 0x0f,
+  0x0c, 0x34, 0xfd, 0x0c, 0xf9, 0x05, 0xcf, 0x1a, 0x22, 0xf8, 0xfd, 0xe5,
+  0xf2, 0x29, 0x14, 0x18, 0x24, 0xe6, 0xf8, 0x1c, 0x1b, 0x15, 0x0a, 0x01,
+  0xf5, 0xf4, 0xd4, 0x12, 0x07, 0xe5, 0x0e, 0xd8, 0x11, 0xf7, 0x1a, 0xfa,
+  0xe7, 0xf5, 0x0d, 0x06, 0x09, 0x12, 0xfd, 0xf5, 0xdb, 0xe8, 0x1a, 0xee,
+  0xfa, 0xfa, 0x05, 0x04, 0xf7, 0x04, 0xf9, 0xff, 0x14, 0xe1, 0x07, 0x09,
+  0x17, 0x15, 0x06, 0x16, 0xee, 0x21, 0xf3, 0x18, 0xf6, 0xe1, 0xf8, 0x0f,
+  0x00, 0xf3, 0xf7, 0xec, 0x0b, 0x00, 0xf6, 0xf5, 0x08, 0x01, 0xda, 0x05,
+  0xea, 0x20, 0xfb, 0x01, 0xf4, 0xf1, 0x19, 0x1c, 0x1a, 0xec, 0x11, 0xf8,
+  0x26, 0x03, 0xf0, 0xe9, 0xf8, 0x1d, 0x1c, 0x07, 0xf0, 0xfa, 0xfe, 0xf5,
+  0xcb, 0xb8, 0x2a, 0xff, 0x1f, 0xff, 0xfc, 0x79, 0xa8, 0x26, 0xcd, 0x2b,
+  0xf7, 0x20, 0x0f, 0x15, 0xef, 0x08, 0xf3, 0x2d, 0xd2, 0x15, 0xe8, 0xdb,
+  0xca, 0x39, 0x11, 0xe0, 0x24, 0x24, 0xe9, 0xe6, 0x02, 0xd0, 0x1f, 0x07,
+  0x04, 0x1d, 0xe7, 0x1a, 0x03, 0xf7, 0x18, 0x3a, 0xf2, 0x22, 0x00, 0xf7,
+  0xfb, 0x05, 0xd5, 0xf6, 0x10, 0x1f, 0xe6, 0x27, 0x02, 0xfe, 0xf4, 0x13,
+  0xdb, 0x13, 0xe4, 0xe4, 0x09, 0xd7, 0xf9, 0x1d, 0xfd, 0x1b, 0xeb, 0x0d,
+  0xce, 0x15, 0xec, 0x1f, 0x1e, 0x08, 0x0f, 0xff, 0x05, 0x1d, 0x05, 0x1c,
+  0x09, 0xcc, 0xe8, 0xf4, 0x0b, 0xda, 0x04, 0xf4, 0xd3, 0x14, 0x08, 0xdb,
+  0xfa, 0x0c, 0xff, 0xdf, 0x0c, 0x13, 0xf7, 0xf6, 0xf1, 0xf7, 0xee, 0x06,
+  0xfd, 0x19, 0x08, 0xeb, 0x26, 0x0a, 0xfe, 0xfe, 0x0b, 0x37, 0xef, 0x30,
+  0x04, 0xf9, 0xf7, 0xf8, 0x22, 0xf1, 0x29, 0xe5, 0x08, 0x1f, 0x00, 0x2c,
+  0xf1, 0xe7, 0x11, 0xe3, 0xc3, 0xe9, 0x32, 0xe1, 0xf4, 0xe3, 0xff, 0x0f,
+  0xfd, 0x33, 0xe7, 0x18, 0xdc, 0xe5, 0x00, 0x07, 0xd0, 0xf7, 0x2e, 0x01,
+  0xfc, 0xf7, 0x17, 0xeb, 0x10, 0x00, 0x19, 0xef, 0x0d, 0x09, 0xdf, 0xe1,
+  0x1d, 0xdd, 0x08, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x06, 0xdb, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7e, 0x05, 0x00, 0x00,
+  0xcf, 0xff, 0xff, 0xff, 0x29, 0x03, 0x00, 0x00, 0x76, 0xf1, 0xff, 0xff,
+  0x1e, 0xfc, 0xff, 0xff, 0xf2, 0xf9, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
+  0xf3, 0xff, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x9d, 0xfd, 0xff, 0xff,
+  0x9c, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x7e, 0xfa, 0xff, 0xff,
+  0x33, 0xfd, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff,
+  0x37, 0x00, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0xff, 0x82, 0x01, 0x00, 0x00,
+  0xce, 0xfe, 0xff, 0xff, 0x25, 0x05, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
+  0x24, 0x03, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x66, 0xfb, 0xff, 0xff,
+  0x04, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x13, 0xf9, 0xff, 0xff,
+  0xab, 0x04, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00,
+  0xd9, 0x02, 0x00, 0x00, 0x86, 0xfb, 0xff, 0xff, 0xf3, 0x07, 0x00, 0x00,
+  0x83, 0x03, 0x00, 0x00, 0x96, 0xfb, 0xff, 0xff, 0x59, 0xfd, 0xff, 0xff,
+  0x31, 0x00, 0x00, 0x00, 0x3d, 0xfd, 0xff, 0xff, 0x7a, 0xfa, 0xff, 0xff,
+  0x3b, 0x01, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+  0xde, 0xff, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x59, 0xfc, 0xff, 0xff,
+  0x13, 0x06, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0xc6, 0xf9, 0xff, 0xff,
+  0xbe, 0x02, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0xf4, 0x07, 0x00, 0x00,
+  0xe9, 0xfd, 0xff, 0xff, 0x6f, 0x03, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00,
+  0xbd, 0x02, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x42, 0xfd, 0xff, 0xff,
+  0xe7, 0xff, 0xff, 0xff, 0xb4, 0x03, 0x00, 0x00, 0xbc, 0xf6, 0xff, 0xff,
+  0x1a, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0x57, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0xdc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x19, 0x04, 0x12, 0xf0, 0xb0, 0xdf,
+  0xf8, 0x0d, 0xf3, 0x42, 0x17, 0xd4, 0x30, 0x05, 0xb2, 0x27, 0xed, 0xf2,
+  0x08, 0xfe, 0xe1, 0xdb, 0x2b, 0xf8, 0x30, 0xa6, 0x0d, 0xd6, 0x13, 0xd2,
+  0xeb, 0xb0, 0x36, 0xed, 0x01, 0xdb, 0x23, 0xfb, 0x0e, 0xea, 0xe1, 0x37,
+  0x05, 0x46, 0x11, 0xf4, 0xe4, 0xca, 0xde, 0x1a, 0xca, 0xf4, 0xe1, 0x91,
+  0xec, 0x07, 0xdf, 0x16, 0x53, 0x04, 0xd2, 0xee, 0xa3, 0x1a, 0x28, 0x38,
+  0x20, 0x01, 0x03, 0x04, 0xdf, 0xf8, 0x06, 0x21, 0x3d, 0xfe, 0x7f, 0x0a,
+  0xfd, 0xfe, 0x0c, 0xe9, 0x15, 0xdb, 0xce, 0xe3, 0x14, 0xf7, 0xde, 0xf0,
+  0x01, 0x0e, 0x38, 0x22, 0x1a, 0xd5, 0xdd, 0xfc, 0x03, 0x2b, 0x28, 0xeb,
+  0xe1, 0x0e, 0xfc, 0xed, 0x04, 0x0b, 0x06, 0x04, 0x29, 0x1e, 0x19, 0xfe,
+  0xe2, 0xe5, 0x06, 0x0c, 0x39, 0x08, 0x20, 0x07, 0xbb, 0x20, 0xe4, 0xe7,
+  0x0c, 0x5a, 0xed, 0xe8, 0xd5, 0x56, 0xee, 0xfd, 0xc7, 0x08, 0xd2, 0x0c,
+  0xe9, 0x0a, 0xb3, 0x03, 0x0d, 0xcc, 0x21, 0xe1, 0x49, 0x05, 0xbd, 0x14,
+  0x20, 0x06, 0x12, 0xe6, 0xec, 0xf2, 0xfd, 0x2c, 0x06, 0xcf, 0x06, 0xed,
+  0x10, 0xec, 0xfd, 0x07, 0x1f, 0x17, 0x01, 0xd9, 0x04, 0xc6, 0x20, 0x20,
+  0x29, 0x09, 0x21, 0x0a, 0x24, 0x01, 0x24, 0x0c, 0x26, 0x0c, 0xe7, 0x39,
+  0xf7, 0x0d, 0xdd, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xdc, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe8, 0x10, 0xf6, 0xea,
+  0x04, 0x45, 0xff, 0x06, 0x07, 0x1c, 0x38, 0xd8, 0xeb, 0x1a, 0xe5, 0x03,
+  0x12, 0xc6, 0x03, 0x07, 0xf9, 0x03, 0xdf, 0xf2, 0x19, 0xdd, 0xd5, 0xef,
+  0x11, 0xe0, 0xfe, 0xed, 0x01, 0xdc, 0xf0, 0xe6, 0xee, 0xc7, 0xe8, 0x05,
+  0x1e, 0xc6, 0x2c, 0xdd, 0xe8, 0x1a, 0x04, 0xff, 0x06, 0x17, 0xef, 0x1e,
+  0x02, 0x03, 0xdb, 0x01, 0x0f, 0x0e, 0x1b, 0x0d, 0x28, 0x22, 0xd0, 0xfb,
+  0x3f, 0x1e, 0xc6, 0xf7, 0xd2, 0xff, 0xe2, 0xd1, 0x38, 0xe8, 0xe5, 0xf2,
+  0xf7, 0xf7, 0x00, 0x0d, 0xe0, 0xd4, 0x8b, 0x06, 0xdc, 0xe3, 0xe5, 0x04,
+  0xef, 0xff, 0x02, 0x1f, 0xde, 0x04, 0x09, 0x1f, 0xf1, 0x11, 0xbc, 0xde,
+  0x11, 0x19, 0xcf, 0x23, 0x25, 0xe3, 0xd1, 0xf6, 0x30, 0xbe, 0xf5, 0xd1,
+  0xf0, 0x08, 0x04, 0xf6, 0xfd, 0x15, 0xe1, 0xf2, 0xfc, 0xef, 0x15, 0x16,
+  0xd0, 0xe4, 0xf1, 0x0b, 0x00, 0xea, 0xe1, 0x4a, 0xef, 0x2d, 0x1f, 0xf2,
+  0x1c, 0xdd, 0xef, 0xd6, 0x41, 0xef, 0x22, 0x08, 0xd0, 0xe9, 0xdd, 0x08,
+  0xcd, 0xf2, 0xf0, 0x05, 0x04, 0x06, 0xf8, 0x05, 0xe9, 0xff, 0x03, 0x22,
+  0xdc, 0x48, 0xf7, 0x0c, 0xee, 0xf2, 0xf6, 0xf9, 0x04, 0x02, 0xef, 0x07,
+  0x13, 0x09, 0x04, 0xda, 0x11, 0x0e, 0x14, 0xd9, 0x0a, 0x01, 0xe0, 0xf6,
+  0xfd, 0x06, 0x2c, 0x07, 0x11, 0xe9, 0xeb, 0xd8, 0x23, 0x02, 0x25, 0x25,
+  0x09, 0xef, 0x2f, 0xf0, 0x3a, 0xbd, 0x17, 0x33, 0x14, 0xdd, 0x16, 0xea,
+  0x09, 0xef, 0xfd, 0x0f, 0x12, 0xf5, 0x2c, 0xfd, 0x30, 0xb1, 0x06, 0x0b,
+  0xe6, 0xf6, 0x07, 0x00, 0xd7, 0x0a, 0xd9, 0xe4, 0x24, 0xfa, 0xe4, 0x1f,
+  0xfe, 0x27, 0xec, 0xf2, 0x0a, 0x34, 0xfa, 0xcd, 0x06, 0x03, 0x02, 0x21,
+  0xe7, 0xc3, 0x3b, 0x15, 0x01, 0x03, 0x00, 0x13, 0x0a, 0x2a, 0x01, 0x41,
+  0xd1, 0xe7, 0xf4, 0x08, 0xf7, 0xf9, 0x1c, 0x18, 0x19, 0x37, 0x05, 0xe1,
+  0x29, 0xf9, 0xfd, 0x52, 0x01, 0x4a, 0xf1, 0x2c, 0x34, 0x0e, 0xfe, 0xf3,
+  0xf7, 0xee, 0xf1, 0x0d, 0x62, 0xea, 0xe0, 0xef, 0x29, 0xfc, 0x17, 0x0e,
+  0x16, 0xcf, 0x35, 0xe5, 0x02, 0xf1, 0x2d, 0x28, 0xf6, 0x19, 0xde, 0xc6,
+  0xff, 0x11, 0xe1, 0x24, 0xf4, 0x13, 0x12, 0xef, 0xfb, 0x1a, 0x45, 0xf1,
+  0xf9, 0x04, 0x0b, 0xee, 0x3b, 0xfc, 0xe8, 0x15, 0xe0, 0x39, 0xf5, 0x09,
+  0x08, 0xed, 0x0e, 0x00, 0x1c, 0xef, 0x0d, 0xbe, 0x1b, 0xdf, 0xcc, 0x09,
+  0x1a, 0x41, 0xfd, 0xdc, 0x13, 0x21, 0xec, 0x1d, 0x0b, 0xdd, 0x0f, 0x20,
+  0x1d, 0x24, 0x02, 0xfd, 0x30, 0x03, 0xf6, 0x08, 0xfc, 0x30, 0xd7, 0x1a,
+  0x0f, 0x38, 0xe6, 0x3a, 0x2d, 0x16, 0xfb, 0xe5, 0x28, 0x0a, 0xd6, 0xf8,
+  0xe2, 0xe6, 0x31, 0x1e, 0x13, 0x2e, 0xeb, 0x1e, 0x15, 0xcf, 0x26, 0xd0,
+  0x3d, 0x12, 0xe7, 0xfe, 0x16, 0x1c, 0xb0, 0x23, 0x0f, 0xdb, 0xdd, 0x36,
+  0xc9, 0x03, 0x0d, 0xec, 0x10, 0x01, 0xfd, 0xe5, 0x08, 0x4c, 0x0f, 0xfd,
+  0xef, 0xc0, 0xd5, 0xfe, 0xce, 0x1b, 0xf2, 0xe1, 0xf4, 0x2b, 0x1e, 0xf7,
+  0xf6, 0x12, 0xda, 0x11, 0xf9, 0xf8, 0x00, 0xde, 0x03, 0xf2, 0x12, 0xfb,
+  0xe4, 0x10, 0xf6, 0xfc, 0x17, 0xf9, 0x21, 0xf7, 0xea, 0x07, 0x1d, 0x04,
+  0x14, 0x1b, 0x3a, 0x13, 0x33, 0x07, 0xff, 0x0b, 0x09, 0xb5, 0xcb, 0xf2,
+  0x47, 0xc9, 0x07, 0x0c, 0x1c, 0x16, 0xf8, 0x22, 0x3e, 0xdf, 0x07, 0xea,
+  0x0b, 0x06, 0x17, 0xfd, 0xf6, 0x0c, 0xf0, 0x1d, 0xf3, 0x1e, 0xfb, 0x1a,
+  0x02, 0x12, 0xc9, 0x24, 0x26, 0x20, 0xe1, 0x44, 0xc9, 0x09, 0xb9, 0xff,
+  0x0a, 0x11, 0x22, 0x2d, 0x10, 0xc9, 0x16, 0x32, 0xdc, 0xcb, 0xd4, 0x12,
+  0x1d, 0xec, 0xee, 0x3a, 0x1a, 0x1d, 0xea, 0xd2, 0xee, 0xc2, 0xf0, 0xf1,
+  0x0e, 0xfd, 0x46, 0x27, 0xed, 0xe6, 0xea, 0x0b, 0xec, 0x1d, 0x12, 0x04,
+  0xf3, 0x1a, 0x01, 0xe5, 0xf5, 0xdd, 0x01, 0x10, 0x01, 0x1f, 0xf0, 0xd7,
+  0x0b, 0x06, 0x10, 0x08, 0x1b, 0xe4, 0xf7, 0x03, 0xf8, 0x0e, 0xfd, 0x0c,
+  0x24, 0xc4, 0x29, 0xf5, 0x10, 0xf7, 0xde, 0x35, 0x29, 0x1d, 0x01, 0x17,
+  0x08, 0x1b, 0xb2, 0x15, 0x19, 0xf6, 0xd5, 0xf1, 0x21, 0x1c, 0xf1, 0x0b,
+  0x0f, 0xed, 0x0d, 0xf3, 0xef, 0x0f, 0xf6, 0xda, 0xea, 0x00, 0x05, 0x01,
+  0x0d, 0xb4, 0xe5, 0x3c, 0xef, 0xd2, 0x0d, 0x24, 0x12, 0x08, 0x00, 0x05,
+  0xc8, 0x22, 0x18, 0x28, 0x0b, 0x2d, 0x04, 0x1c, 0xf3, 0x23, 0xdf, 0x30,
+  0x28, 0xca, 0xee, 0xf8, 0xe4, 0xf2, 0xff, 0xe9, 0x0f, 0x14, 0x07, 0x1f,
+  0xf9, 0xe2, 0xd2, 0xe9, 0x07, 0xe3, 0xfd, 0xff, 0x21, 0x1d, 0x2b, 0x35,
+  0xef, 0x46, 0x18, 0x23, 0xf1, 0x50, 0xee, 0xf0, 0x5b, 0x01, 0x06, 0xf4,
+  0x1f, 0x03, 0x16, 0x18, 0x0d, 0x1d, 0xb8, 0x22, 0xfa, 0xd5, 0x28, 0xe2,
+  0x32, 0xc6, 0xdf, 0xc3, 0x33, 0x05, 0x11, 0x0f, 0xf4, 0x1d, 0xe7, 0xf8,
+  0xe0, 0x03, 0xcb, 0x27, 0x54, 0x19, 0xe2, 0xf3, 0x18, 0x0e, 0xf8, 0x04,
+  0x24, 0x27, 0x1d, 0x08, 0xd6, 0xe6, 0xf3, 0x3c, 0xf5, 0xf0, 0x12, 0x32,
+  0x1c, 0x15, 0xfe, 0x16, 0x0e, 0x36, 0xe1, 0x33, 0xf9, 0x09, 0xcb, 0xfc,
+  0x08, 0xfc, 0x09, 0xf0, 0x18, 0x0b, 0x08, 0x0f, 0x23, 0x07, 0x07, 0x17,
+  0x05, 0xe2, 0xf2, 0xf2, 0x33, 0xfb, 0x8c, 0x0e, 0x43, 0x06, 0xf1, 0x29,
+  0x1b, 0xbf, 0xd7, 0x14, 0xe2, 0xdb, 0xeb, 0x36, 0x28, 0xee, 0xef, 0xd7,
+  0x14, 0x1c, 0xdd, 0xeb, 0x19, 0x35, 0xf7, 0x7f, 0xf2, 0xe6, 0x10, 0x1e,
+  0xbd, 0xe1, 0x02, 0x2b, 0x0a, 0x19, 0xe8, 0xfb, 0x08, 0x17, 0x01, 0xec,
+  0x27, 0x10, 0xed, 0xd2, 0xee, 0x1d, 0xc8, 0x0b, 0x0f, 0x0c, 0xe8, 0xca,
+  0xef, 0xf4, 0x22, 0x1a, 0x08, 0xe8, 0x07, 0xfa, 0xf3, 0x09, 0x0d, 0x07,
+  0x07, 0x1f, 0x3b, 0x06, 0xf3, 0x32, 0xff, 0x21, 0xfa, 0x45, 0xd0, 0x11,
+  0xf9, 0xc1, 0xe4, 0x09, 0x07, 0x09, 0xed, 0xed, 0xf2, 0x03, 0xf4, 0xd0,
+  0xd7, 0xf1, 0xea, 0x18, 0x0a, 0xf4, 0xf3, 0xff, 0x20, 0x24, 0x01, 0x18,
+  0xdd, 0xf8, 0xd8, 0xfb, 0xf6, 0xf1, 0x0c, 0x0a, 0x03, 0x1f, 0x0b, 0xf5,
+  0x12, 0xf7, 0x0a, 0x0a, 0xe5, 0x1d, 0xed, 0x10, 0x18, 0x22, 0x06, 0xfb,
+  0xf6, 0xfd, 0x0b, 0xd5, 0x1a, 0xdb, 0xe3, 0xeb, 0xf4, 0x05, 0x0a, 0xf8,
+  0x0c, 0x06, 0x16, 0xe8, 0x18, 0xf3, 0xfc, 0x08, 0x00, 0x12, 0x11, 0xf0,
+  0xe5, 0xf1, 0x09, 0xea, 0xeb, 0x05, 0x0c, 0x0d, 0x10, 0x02, 0xee, 0xec,
+  0xe7, 0x0c, 0x10, 0x04, 0x32, 0x32, 0x2c, 0x3e, 0x0c, 0x17, 0xff, 0xe8,
+  0xf6, 0xf0, 0xe0, 0xde, 0x07, 0x10, 0x25, 0xf9, 0xd2, 0xfa, 0x1f, 0x0e,
+  0x02, 0xef, 0xf4, 0xfa, 0x15, 0x02, 0xf1, 0xf7, 0x2e, 0x17, 0x05, 0x1f,
+  0xe5, 0xf6, 0xf8, 0xe8, 0x11, 0xf8, 0xf5, 0x0e, 0x39, 0xe7, 0xf0, 0xde,
+  0x08, 0xf8, 0xe0, 0x20, 0x12, 0x29, 0x0f, 0x0c, 0xf5, 0xcd, 0xf5, 0x1b,
+  0xde, 0xe2, 0x07, 0x24, 0xfb, 0x32, 0x0c, 0xf6, 0xea, 0xff, 0xe8, 0x04,
+  0x16, 0x3e, 0xee, 0xfd, 0x0a, 0x0a, 0xe3, 0xf2, 0x20, 0x07, 0x00, 0xfe,
+  0xdf, 0x12, 0x17, 0x1f, 0xf1, 0xc0, 0x1a, 0xd4, 0x4d, 0xfc, 0xbf, 0xf5,
+  0x28, 0x34, 0x19, 0x32, 0x31, 0x00, 0x16, 0x10, 0xe4, 0x04, 0xcb, 0x2b,
+  0x23, 0xf7, 0xf0, 0x59, 0xeb, 0x22, 0xda, 0xf0, 0x22, 0x03, 0x16, 0xfb,
+  0xf4, 0xe8, 0x10, 0x2f, 0xc7, 0x04, 0xca, 0x17, 0x14, 0x2d, 0x00, 0x30,
+  0x06, 0x3b, 0xd6, 0x10, 0xed, 0xfb, 0xd0, 0xb4, 0x5e, 0xdb, 0xfb, 0xb8,
+  0xfa, 0x19, 0x0c, 0x0d, 0x00, 0x24, 0xd3, 0x10, 0xd7, 0xb0, 0x27, 0xe5,
+  0x0e, 0x06, 0xd7, 0x33, 0x26, 0x01, 0xdd, 0x32, 0xd5, 0xef, 0x0d, 0xf6,
+  0xdc, 0xf1, 0xd4, 0x17, 0x2e, 0x05, 0xe1, 0x11, 0xdf, 0x16, 0xea, 0xd3,
+  0xfb, 0x23, 0xef, 0x1c, 0xe1, 0xf9, 0x06, 0x23, 0x0f, 0x10, 0xc9, 0x2e,
+  0x27, 0x14, 0xde, 0xd2, 0xe1, 0xe0, 0xcb, 0xff, 0x1c, 0xf7, 0xfa, 0x11,
+  0xd6, 0x00, 0xd1, 0x0f, 0x30, 0x01, 0x09, 0xfd, 0xd4, 0xf5, 0xf9, 0x02,
+  0x06, 0x3c, 0xd4, 0x37, 0xfc, 0x19, 0xd1, 0xf1, 0xc5, 0xf9, 0xed, 0xff,
+  0x04, 0xef, 0xf0, 0xfa, 0x02, 0x08, 0x0a, 0x05, 0x32, 0xcf, 0xe8, 0x22,
+  0xc1, 0x32, 0xe6, 0xde, 0xde, 0x03, 0x02, 0xff, 0xdb, 0x21, 0xe7, 0xc1,
+  0xc5, 0xf0, 0x4c, 0xca, 0xfc, 0x12, 0xf6, 0x11, 0x18, 0x29, 0xea, 0x08,
+  0x04, 0xf9, 0xf6, 0xd5, 0x24, 0xd5, 0xf4, 0xe3, 0xff, 0xf3, 0x09, 0x09,
+  0xea, 0xf1, 0xe7, 0x04, 0x05, 0xcc, 0x03, 0x09, 0x0d, 0xfe, 0xeb, 0xfb,
+  0xf0, 0xde, 0xe4, 0x37, 0x15, 0x07, 0xee, 0x15, 0xe1, 0x23, 0xed, 0x1e,
+  0x23, 0xf5, 0xec, 0x0e, 0xd0, 0x01, 0xdc, 0x0f, 0x0e, 0x18, 0x09, 0x0a,
+  0xfe, 0x18, 0x0c, 0x0a, 0xdd, 0xfc, 0x09, 0x32, 0x17, 0x12, 0x11, 0xfd,
+  0x30, 0x4e, 0xec, 0xf4, 0x1f, 0xf4, 0xfb, 0xd6, 0x3a, 0xf2, 0xf3, 0xe9,
+  0xf8, 0xe7, 0x14, 0xfd, 0xdc, 0xe2, 0xe3, 0x20, 0xd5, 0xd5, 0x07, 0xe1,
+  0x00, 0xe6, 0xd6, 0xdb, 0x0d, 0x22, 0x31, 0x34, 0xd1, 0x2f, 0xc8, 0xda,
+  0xf9, 0x12, 0xb4, 0x3e, 0x0a, 0xe1, 0xe5, 0xe7, 0x03, 0xe6, 0xe5, 0xe8,
+  0xfc, 0x29, 0x20, 0x1c, 0xd1, 0xce, 0x01, 0xf7, 0xe4, 0xed, 0x07, 0x27,
+  0x06, 0xf6, 0xec, 0xfc, 0xef, 0xe1, 0xf0, 0xfb, 0x05, 0x3d, 0xe5, 0x0f,
+  0xcf, 0x3c, 0xd2, 0x64, 0x2d, 0xd6, 0xf1, 0xdd, 0xe8, 0xee, 0x18, 0xa5,
+  0x17, 0xe6, 0x03, 0x2c, 0xc3, 0x3b, 0xfb, 0xfc, 0xf2, 0xcd, 0x23, 0xe1,
+  0xe5, 0x14, 0x29, 0xc7, 0x18, 0x20, 0x0e, 0xf7, 0x1b, 0xf3, 0x09, 0xe5,
+  0x14, 0xfc, 0x2d, 0xde, 0xd9, 0xeb, 0xf1, 0xf3, 0xeb, 0x13, 0xe8, 0xd4,
+  0xf9, 0xe8, 0xf7, 0x08, 0x34, 0xec, 0x1a, 0x09, 0xf4, 0x09, 0xf9, 0xf7,
+  0xce, 0x19, 0xda, 0xcf, 0x11, 0xe9, 0xed, 0x22, 0x05, 0xfb, 0x1e, 0x00,
+  0xfd, 0xec, 0xee, 0xe9, 0x10, 0xe3, 0x05, 0x19, 0xd9, 0x07, 0xfb, 0x33,
+  0x10, 0x03, 0xf0, 0x19, 0x28, 0x16, 0xdf, 0x1f, 0x1a, 0x1b, 0x06, 0xf3,
+  0x1f, 0xde, 0xf1, 0x15, 0x2a, 0xfe, 0xe0, 0xea, 0xda, 0x05, 0x35, 0x12,
+  0x05, 0x0d, 0x1c, 0x14, 0xf7, 0x1d, 0x0d, 0x0f, 0xe5, 0xfe, 0x33, 0x12,
+  0x12, 0xf0, 0xe7, 0x38, 0x08, 0x25, 0x07, 0xf5, 0x21, 0xf7, 0x27, 0x2a,
+  0x40, 0x07, 0x05, 0xb4, 0x0b, 0xfe, 0x0b, 0xdb, 0x32, 0xef, 0x07, 0xf0,
+  0x16, 0x13, 0xdf, 0x0f, 0x04, 0x35, 0x17, 0xfe, 0xd3, 0xf8, 0xd4, 0xf9,
+  0x07, 0xea, 0xee, 0x16, 0xfc, 0xe8, 0x03, 0xfb, 0x0e, 0x18, 0xe8, 0xcc,
+  0x02, 0xf7, 0x2a, 0xe8, 0xf6, 0xde, 0x1a, 0xfe, 0x18, 0xf7, 0xdf, 0xe3,
+  0x22, 0x14, 0xee, 0xf9, 0x37, 0x04, 0x36, 0xea, 0xff, 0x30, 0xdc, 0xeb,
+  0x2e, 0xca, 0x03, 0xf7, 0x03, 0xce, 0xe8, 0x37, 0x01, 0x24, 0x37, 0xe5,
+  0xfa, 0xf1, 0x42, 0xd4, 0xe4, 0x01, 0x18, 0xed, 0x08, 0x02, 0x05, 0xeb,
+  0xec, 0x2a, 0x09, 0xfc, 0x1b, 0x1f, 0xc2, 0x0e, 0x2e, 0x23, 0xf7, 0x2b,
+  0xe7, 0xfb, 0xf3, 0xeb, 0x1c, 0x0a, 0x22, 0x1e, 0xe5, 0xf8, 0x22, 0x15,
+  0x11, 0xa3, 0x06, 0x15, 0x31, 0xf7, 0x16, 0x2b, 0xdf, 0xef, 0xe3, 0x08,
+  0x2e, 0x01, 0x13, 0xed, 0xf3, 0x37, 0x27, 0x38, 0x07, 0x20, 0x0a, 0x26,
+  0x23, 0x07, 0xf9, 0xff, 0x27, 0x0b, 0xf0, 0xff, 0x0f, 0xe9, 0x22, 0xf1,
+  0x2e, 0x17, 0x01, 0xf2, 0x15, 0xd3, 0x13, 0x15, 0x1e, 0xc6, 0xed, 0x1d,
+  0x17, 0xe3, 0x04, 0xe3, 0xea, 0x18, 0xe7, 0x08, 0x13, 0x07, 0x25, 0xe0,
+  0xff, 0x10, 0xec, 0x0f, 0xe1, 0x43, 0xce, 0xeb, 0xea, 0x00, 0xee, 0xe6,
+  0xde, 0xfa, 0x11, 0x16, 0x09, 0xc6, 0x0b, 0xde, 0x10, 0xca, 0xf8, 0x33,
+  0x1c, 0x0b, 0x44, 0x1b, 0xfb, 0xf4, 0xed, 0x2a, 0x0c, 0xd5, 0x65, 0xe6,
+  0x23, 0xce, 0xe7, 0xda, 0x13, 0x19, 0xf3, 0x1b, 0xb2, 0x3f, 0xf7, 0x04,
+  0x16, 0x1b, 0xcb, 0x2b, 0xfe, 0x17, 0xe8, 0xe7, 0xd8, 0x0b, 0xe2, 0xce,
+  0x2e, 0x1a, 0x37, 0x1a, 0xdc, 0xee, 0x06, 0x1a, 0x0e, 0xff, 0xec, 0x21,
+  0x13, 0x01, 0x0f, 0x1c, 0x04, 0x1e, 0xc9, 0xf7, 0xf0, 0x21, 0xeb, 0xe9,
+  0x0f, 0x03, 0xf9, 0x34, 0x11, 0x00, 0x0a, 0xc0, 0x24, 0xe3, 0xf0, 0xde,
+  0xe9, 0xe4, 0xfe, 0x32, 0xf2, 0x04, 0xcf, 0x2e, 0xfc, 0xe4, 0x2b, 0x02,
+  0x18, 0xf6, 0x37, 0x0b, 0x41, 0x0d, 0xe0, 0x12, 0xe1, 0xdb, 0xe6, 0x0f,
+  0xb9, 0x16, 0x2a, 0xfc, 0x05, 0x17, 0x28, 0xeb, 0xf9, 0xfe, 0xf1, 0xd5,
+  0xfd, 0x13, 0xf2, 0x0c, 0x1a, 0xdc, 0x2a, 0x46, 0x1f, 0xf1, 0x20, 0xd9,
+  0x10, 0x06, 0x26, 0x02, 0xdf, 0x03, 0x0a, 0xf9, 0x08, 0xfe, 0xf1, 0x01,
+  0x02, 0xef, 0x0c, 0xe9, 0x1a, 0x42, 0xe5, 0x0d, 0x03, 0xfc, 0x02, 0xf0,
+  0x26, 0x0b, 0xef, 0xf4, 0x26, 0xf2, 0xfe, 0x01, 0xff, 0xe6, 0x1a, 0xf4,
+  0x1d, 0x16, 0xf7, 0xfe, 0x11, 0xf6, 0x1c, 0x14, 0xf4, 0x22, 0x01, 0xcb,
+  0xf5, 0xfe, 0xf6, 0x0d, 0xe7, 0xf8, 0x06, 0x10, 0xfc, 0x0b, 0xef, 0xf6,
+  0x06, 0xe4, 0xbf, 0xfb, 0x06, 0xfc, 0xfb, 0xeb, 0x37, 0xf9, 0x06, 0x01,
+  0x05, 0x18, 0xf4, 0xfd, 0xf6, 0xf4, 0x10, 0x46, 0xb4, 0x0a, 0xec, 0x1d,
+  0xc4, 0x02, 0x21, 0x03, 0x17, 0xc6, 0x0f, 0xf6, 0x03, 0xf7, 0xff, 0xfa,
+  0x1b, 0xf8, 0x1b, 0xb8, 0xfe, 0x1b, 0x10, 0x2c, 0xc6, 0x2c, 0x20, 0x12,
+  0x0c, 0xd0, 0x00, 0x26, 0x07, 0x30, 0xdf, 0xf5, 0xfb, 0x03, 0xf8, 0xef,
+  0x14, 0xfd, 0xfb, 0x1c, 0xef, 0x24, 0xe6, 0x32, 0xf1, 0x1f, 0xf1, 0xef,
+  0x48, 0xb8, 0x00, 0xf5, 0x61, 0xda, 0x1f, 0xfd, 0x1b, 0x00, 0xde, 0x16,
+  0xd1, 0xe5, 0x29, 0xe4, 0x22, 0xe0, 0x03, 0xd8, 0x13, 0x03, 0x0a, 0x17,
+  0x01, 0x40, 0xed, 0x02, 0x02, 0xf3, 0xdc, 0x25, 0x59, 0x18, 0xaf, 0xf0,
+  0xc6, 0x37, 0xbd, 0xe5, 0x1d, 0x32, 0x1e, 0x0d, 0xf9, 0xe4, 0x1c, 0x1f,
+  0xef, 0xf9, 0xea, 0x37, 0x4c, 0x10, 0xfe, 0x58, 0xdb, 0x0d, 0xc7, 0x2e,
+  0x30, 0x21, 0x02, 0x3b, 0x05, 0x00, 0xe0, 0xda, 0x2e, 0xed, 0x12, 0x07,
+  0xfe, 0x2f, 0x45, 0xe1, 0xf8, 0x3f, 0xf4, 0xff, 0x06, 0xff, 0xf1, 0x40,
+  0x1f, 0xde, 0xff, 0x01, 0x0b, 0xf5, 0xf5, 0xdb, 0xe5, 0xeb, 0x1a, 0x11,
+  0xfe, 0x18, 0xe8, 0x36, 0xcb, 0x02, 0x06, 0x36, 0x1b, 0xf8, 0x1c, 0xe3,
+  0xf5, 0xef, 0x36, 0xf8, 0x05, 0xcb, 0x25, 0x0a, 0xfb, 0xe4, 0x08, 0x1a,
+  0xe4, 0x27, 0x24, 0x3e, 0x0b, 0x04, 0xf1, 0xfa, 0x07, 0x08, 0xec, 0xdd,
+  0x06, 0xe0, 0x22, 0x0f, 0xf3, 0x06, 0xfa, 0xfd, 0x04, 0xec, 0x09, 0xf5,
+  0x0f, 0xcf, 0xca, 0xcc, 0x0f, 0xce, 0xf4, 0x1d, 0x19, 0xd2, 0xd7, 0x0d,
+  0xc0, 0xe9, 0x02, 0x28, 0x20, 0xf8, 0xda, 0xfb, 0x10, 0xfb, 0xd0, 0x06,
+  0x35, 0x03, 0x12, 0xeb, 0xce, 0x0b, 0xfa, 0x0e, 0xf3, 0xfd, 0xeb, 0x2c,
+  0x03, 0xeb, 0x06, 0x09, 0x43, 0x21, 0xf2, 0x2c, 0x1c, 0x52, 0xff, 0x3a,
+  0x0c, 0xe7, 0xf8, 0xfb, 0x13, 0xea, 0x14, 0xdf, 0xde, 0x0d, 0x0b, 0x1a,
+  0xd1, 0xd8, 0xee, 0xda, 0xeb, 0xed, 0xe2, 0x28, 0xdb, 0xff, 0xe6, 0x13,
+  0x35, 0xff, 0xe6, 0xc9, 0xd1, 0x0b, 0x16, 0xf3, 0x2d, 0x2c, 0xff, 0xfd,
+  0x1e, 0x33, 0xfb, 0x18, 0x21, 0x32, 0xf6, 0x05, 0x05, 0xe5, 0xf7, 0xfd,
+  0xf8, 0xdb, 0x23, 0x22, 0x06, 0x57, 0x0d, 0x02, 0xd5, 0x0b, 0xd5, 0xee,
+  0xe9, 0x04, 0x30, 0x1f, 0x2a, 0xe4, 0xf4, 0xe4, 0x14, 0x27, 0xef, 0xc8,
+  0xff, 0x1a, 0x04, 0x20, 0xfd, 0x05, 0xd5, 0x2f, 0x15, 0x10, 0x4a, 0x03,
+  0x4f, 0x4a, 0x1c, 0xff, 0xf7, 0xc3, 0x05, 0x24, 0xed, 0x15, 0x07, 0xe8,
+  0xee, 0xcb, 0x12, 0x03, 0x04, 0xdf, 0x30, 0xfd, 0xeb, 0xeb, 0xee, 0xe2,
+  0x18, 0xf1, 0x1f, 0xf1, 0x1f, 0x12, 0x17, 0xcc, 0x96, 0xdf, 0xf8, 0xf2,
+  0xe4, 0xe7, 0x16, 0x12, 0x1b, 0xc6, 0xfe, 0x19, 0x19, 0xd8, 0x32, 0x19,
+  0xff, 0xf0, 0xfa, 0xe6, 0x1d, 0x18, 0xed, 0x0d, 0xf6, 0x06, 0xc9, 0x1e,
+  0x32, 0xaf, 0x28, 0xcf, 0xec, 0xee, 0x1c, 0xff, 0xfd, 0xf0, 0xe1, 0xeb,
+  0xf2, 0x18, 0x14, 0xe2, 0xee, 0xf5, 0x10, 0x11, 0x27, 0x36, 0xed, 0xeb,
+  0x0a, 0xec, 0x1e, 0xcd, 0x17, 0x10, 0x03, 0x07, 0x03, 0x10, 0xe3, 0xfd,
+  0xf8, 0xb4, 0xfb, 0xea, 0xf7, 0x22, 0xe9, 0x01, 0x09, 0x04, 0x1a, 0x09,
+  0x0e, 0xe2, 0x28, 0xfc, 0x25, 0xff, 0x20, 0xe5, 0x05, 0x09, 0xff, 0x1d,
+  0xb1, 0xf3, 0x20, 0xd9, 0x29, 0xe4, 0xed, 0xf0, 0x31, 0x25, 0x00, 0x2f,
+  0xd9, 0xf3, 0xf5, 0x5b, 0x0e, 0xd8, 0xe9, 0x29, 0x21, 0xef, 0xf6, 0xcd,
+  0x02, 0x34, 0xe0, 0x22, 0x2a, 0x01, 0x19, 0xff, 0x20, 0xe1, 0xd5, 0x29,
+  0xce, 0xef, 0xb8, 0x09, 0x16, 0x2d, 0x08, 0x4e, 0x8f, 0xeb, 0x06, 0x26,
+  0x34, 0xeb, 0x21, 0x24, 0x09, 0xe5, 0xce, 0xe3, 0x1d, 0x28, 0x10, 0xc5,
+  0x11, 0xeb, 0xe8, 0xe0, 0x06, 0x0c, 0xdc, 0x13, 0x44, 0x30, 0xf6, 0xf7,
+  0xe5, 0x09, 0xde, 0xe2, 0xf0, 0x1b, 0xf8, 0xd9, 0x07, 0x1a, 0x30, 0x0a,
+  0xf8, 0xf9, 0xf0, 0xf1, 0xfe, 0xf8, 0x04, 0x22, 0xf7, 0x07, 0x0c, 0xc6,
+  0x17, 0xc5, 0x20, 0xfe, 0xeb, 0x12, 0xc9, 0x04, 0x09, 0xd6, 0x12, 0x17,
+  0x1e, 0x1c, 0xf4, 0x18, 0x61, 0x2d, 0xee, 0xd5, 0x2f, 0xe4, 0xbd, 0xb5,
+  0x2c, 0xee, 0x21, 0x1b, 0xf9, 0xfd, 0x03, 0x1e, 0xf0, 0xe3, 0x05, 0xfd,
+  0x17, 0xf7, 0xf7, 0xfc, 0xd7, 0x09, 0xde, 0x27, 0x17, 0xff, 0x22, 0x11,
+  0xf8, 0x2a, 0xe7, 0x08, 0x25, 0x2f, 0xf0, 0x0f, 0xf7, 0x20, 0xb0, 0x28,
+  0x6f, 0x35, 0xfc, 0xf4, 0xe4, 0x0d, 0xfa, 0xea, 0xdb, 0xd9, 0x00, 0x31,
+  0x4e, 0x0a, 0x03, 0x0b, 0x1d, 0x3a, 0xfc, 0x18, 0x24, 0xee, 0x15, 0x33,
+  0x08, 0x14, 0xe8, 0xc3, 0xf2, 0x07, 0x1b, 0x29, 0xe7, 0x13, 0x0c, 0x09,
+  0xd4, 0xe3, 0x1d, 0xd2, 0x3b, 0xc7, 0xdf, 0x15, 0x2e, 0xf9, 0xb0, 0x52,
+  0x3a, 0x13, 0xf0, 0xd2, 0xd9, 0xb0, 0xff, 0x22, 0x20, 0x41, 0xff, 0xf8,
+  0xf0, 0xf4, 0xd4, 0x10, 0x38, 0x25, 0x18, 0x1f, 0xec, 0xcd, 0x02, 0x3a,
+  0xe3, 0xc6, 0xed, 0x3c, 0x3a, 0x2b, 0xdf, 0x0f, 0x60, 0x21, 0x31, 0x04,
+  0xf8, 0x0a, 0xde, 0x09, 0x22, 0xeb, 0xf1, 0xf4, 0x0c, 0xec, 0x15, 0x1d,
+  0x12, 0x15, 0xe0, 0xdb, 0xfd, 0xdd, 0x0b, 0xdd, 0x05, 0x21, 0xc9, 0xd0,
+  0xf7, 0x10, 0x01, 0x0c, 0x0e, 0x27, 0xf0, 0x17, 0x00, 0xf0, 0xde, 0x2e,
+  0x12, 0x03, 0xc6, 0x1e, 0xf3, 0xf0, 0xd4, 0x00, 0x1b, 0x02, 0x21, 0x1a,
+  0xfc, 0xea, 0x07, 0x11, 0xfd, 0xb3, 0x15, 0x36, 0x27, 0x30, 0x1e, 0x1a,
+  0xf1, 0x07, 0x13, 0x0c, 0xe3, 0x19, 0x05, 0xf2, 0x38, 0xf7, 0x0c, 0x04,
+  0x63, 0x2e, 0x17, 0xe3, 0x17, 0x15, 0xfc, 0x09, 0xa6, 0xe6, 0x17, 0xce,
+  0x2b, 0xfb, 0xd7, 0xfe, 0x47, 0x14, 0x2a, 0x30, 0xed, 0x13, 0x07, 0x26,
+  0xf0, 0xe3, 0xdb, 0x05, 0xf5, 0x1e, 0xdd, 0xec, 0x06, 0x46, 0xd6, 0x3c,
+  0x43, 0x21, 0x27, 0xdc, 0xf8, 0xf6, 0x0c, 0x39, 0xe8, 0xe3, 0xe7, 0x26,
+  0x1b, 0x14, 0xff, 0x10, 0x25, 0x25, 0xec, 0xe6, 0x01, 0x23, 0x1a, 0xd0,
+  0xf3, 0xed, 0x14, 0xf8, 0x16, 0x05, 0xf7, 0xda, 0xf5, 0xec, 0x01, 0x04,
+  0xf0, 0xf1, 0x0b, 0xe1, 0x0c, 0xf4, 0xe1, 0x26, 0x07, 0xfc, 0x15, 0x19,
+  0xfb, 0xfb, 0x0e, 0xec, 0xf7, 0x03, 0xda, 0x28, 0x2f, 0x12, 0xf0, 0xf1,
+  0x09, 0x2b, 0xff, 0x0b, 0x03, 0xfe, 0x08, 0xe8, 0xf1, 0xec, 0x1d, 0xf9,
+  0x05, 0xf8, 0x19, 0x05, 0x0c, 0x1c, 0x11, 0xef, 0x24, 0xf4, 0x36, 0x16,
+  0x23, 0x1f, 0xf3, 0xf6, 0x11, 0x1e, 0xdf, 0xde, 0x28, 0xd6, 0x07, 0x02,
+  0xf6, 0xde, 0x17, 0x24, 0xf1, 0xf6, 0xde, 0x1f, 0xb4, 0xfe, 0xe5, 0xf8,
+  0xcc, 0xd8, 0xe6, 0x16, 0x0e, 0x1f, 0x05, 0x01, 0xed, 0xff, 0xfc, 0x09,
+  0x17, 0xfd, 0xd0, 0x02, 0xe0, 0xfd, 0xee, 0x30, 0x0e, 0x13, 0x3b, 0x13,
+  0xe0, 0xef, 0xc0, 0xd8, 0xdd, 0xbd, 0x1c, 0x00, 0x1f, 0x00, 0xfc, 0xf7,
+  0xf8, 0x1c, 0xb2, 0x1a, 0xec, 0x1e, 0x09, 0xfe, 0xf9, 0x05, 0xe7, 0xe1,
+  0x04, 0xf6, 0x2b, 0xf8, 0xeb, 0xdf, 0xfb, 0x15, 0xc4, 0xd8, 0xde, 0x23,
+  0xdf, 0xcc, 0x20, 0x0f, 0xf2, 0x30, 0xf4, 0xff, 0xf8, 0xe0, 0xf1, 0xcd,
+  0x0e, 0x07, 0xff, 0x03, 0x02, 0xfe, 0x13, 0x05, 0x22, 0xeb, 0x31, 0x01,
+  0x25, 0xef, 0x11, 0xeb, 0x17, 0x21, 0x2e, 0xc9, 0x0f, 0xf0, 0x05, 0xe1,
+  0xe8, 0xe2, 0xf0, 0xe4, 0xf7, 0x14, 0x0f, 0x06, 0x06, 0x24, 0xe6, 0xdb,
+  0x16, 0x1b, 0x0c, 0xfe, 0xed, 0x29, 0xfd, 0xf9, 0x14, 0xf1, 0x09, 0xe7,
+  0xfb, 0xdf, 0xff, 0x20, 0xd0, 0x25, 0xe2, 0x40, 0xee, 0xea, 0x0d, 0x10,
+  0x0b, 0xf4, 0x21, 0xcf, 0x0c, 0x0f, 0xf0, 0xff, 0x1b, 0xc5, 0x0d, 0x01,
+  0x09, 0xf7, 0x03, 0xf5, 0x20, 0xf8, 0x0f, 0x0c, 0xda, 0x1e, 0xf9, 0xdf,
+  0xf0, 0x22, 0xe8, 0xff, 0x15, 0xd9, 0x20, 0x1b, 0x3e, 0x2f, 0x29, 0x19,
+  0x26, 0x1e, 0xd9, 0xf6, 0xea, 0x00, 0xfb, 0x13, 0xf2, 0xfa, 0x2f, 0xb2,
+  0xee, 0x03, 0xca, 0x0b, 0xda, 0xc3, 0x1e, 0xd1, 0x07, 0xe0, 0x27, 0x20,
+  0x01, 0x27, 0x2a, 0x23, 0x27, 0x5d, 0xea, 0xff, 0xec, 0x0f, 0xdf, 0x29,
+  0x25, 0x03, 0xee, 0xbd, 0xe4, 0x16, 0xf4, 0x2d, 0x26, 0x20, 0x07, 0x10,
+  0x0b, 0xe6, 0xf2, 0x4a, 0xe5, 0x09, 0xf4, 0x2c, 0x1a, 0x1d, 0x2d, 0x10,
+  0xfa, 0x0a, 0xbc, 0x43, 0x17, 0x18, 0xdb, 0xcb, 0x0e, 0xb5, 0xf1, 0xe2,
+  0x24, 0x09, 0x11, 0xe7, 0xff, 0xf0, 0xe5, 0x31, 0xe4, 0xee, 0x23, 0xe8,
+  0x06, 0x0c, 0xcd, 0xd2, 0x11, 0x19, 0xef, 0x24, 0x0e, 0x3d, 0xd2, 0x06,
+  0xd6, 0x19, 0xf9, 0x18, 0x37, 0x1c, 0xed, 0x03, 0xd7, 0xf9, 0xc5, 0xe1,
+  0x0e, 0x18, 0x27, 0x09, 0xf9, 0x11, 0xe7, 0x28, 0xf0, 0xf7, 0xd5, 0x3b,
+  0x47, 0xf5, 0xd0, 0xf3, 0xff, 0xfc, 0xd9, 0x4a, 0x1e, 0x2d, 0x02, 0x00,
+  0x58, 0xea, 0xec, 0xf9, 0x60, 0x0f, 0x27, 0xf6, 0x0f, 0xf5, 0xf3, 0x2f,
+  0xd8, 0x0a, 0xee, 0xfe, 0x0b, 0xc6, 0xcf, 0x14, 0x1d, 0x01, 0xf7, 0x14,
+  0xf2, 0xfb, 0x09, 0x01, 0xf5, 0xc3, 0xf5, 0x11, 0x35, 0x17, 0xf9, 0xf8,
+  0xac, 0x2c, 0xe9, 0x03, 0x1d, 0x12, 0xfc, 0xfd, 0xed, 0xc4, 0xe6, 0xf9,
+  0xe8, 0xf2, 0xfe, 0x24, 0x40, 0xf5, 0xff, 0x3f, 0xf8, 0xfc, 0x2d, 0x10,
+  0x0b, 0x21, 0xfa, 0xe2, 0x14, 0xc8, 0x21, 0x01, 0x16, 0x17, 0x07, 0xfc,
+  0x05, 0x15, 0x06, 0x1a, 0x17, 0xf6, 0x07, 0xd5, 0x14, 0xd6, 0xfa, 0x1b,
+  0x2c, 0x0c, 0xf8, 0xfc, 0xfa, 0x0c, 0x10, 0x07, 0x0d, 0xda, 0xfd, 0xf9,
+  0x07, 0x16, 0x0c, 0xc8, 0xcd, 0x0e, 0xe2, 0x22, 0xfc, 0x12, 0xf7, 0x24,
+  0xfe, 0xef, 0x10, 0x18, 0xf0, 0x0a, 0xfd, 0x06, 0x12, 0x1c, 0x07, 0x2d,
+  0x40, 0x12, 0xf0, 0x14, 0x1a, 0x17, 0xbf, 0xcc, 0xfd, 0xdd, 0xe3, 0xef,
+  0xfa, 0xf6, 0xff, 0xfa, 0xb4, 0x1d, 0x37, 0x0e, 0x0e, 0xf0, 0x1e, 0x0f,
+  0xe9, 0x06, 0xf7, 0xfb, 0x03, 0x01, 0x11, 0xe9, 0xeb, 0x15, 0x31, 0x0e,
+  0x2f, 0x02, 0xda, 0xf7, 0x11, 0xe8, 0xeb, 0x68, 0xaa, 0x19, 0xe2, 0xfe,
+  0xf4, 0x28, 0x1a, 0xeb, 0xf0, 0x02, 0x07, 0xe5, 0xf9, 0xb9, 0x3f, 0x04,
+  0x2a, 0x12, 0xd4, 0x22, 0x1b, 0x17, 0x17, 0x1c, 0x31, 0x0d, 0x22, 0x1b,
+  0x05, 0xe3, 0x00, 0xee, 0x14, 0xee, 0xfb, 0x0a, 0xe4, 0x1b, 0xfa, 0x02,
+  0xed, 0xe3, 0x02, 0x04, 0xec, 0xeb, 0xf6, 0x16, 0x06, 0x0c, 0xfb, 0x3d,
+  0x0c, 0x0f, 0xd6, 0xd0, 0xe1, 0xf1, 0xdf, 0x12, 0x23, 0x05, 0xd0, 0x10,
+  0x18, 0x2c, 0xda, 0xfe, 0x17, 0x1a, 0x04, 0x13, 0xd5, 0xd3, 0x0e, 0x10,
+  0xe4, 0xe0, 0x21, 0x03, 0x26, 0x2d, 0xfa, 0x0e, 0xe5, 0x0d, 0xbe, 0x09,
+  0xe5, 0xdf, 0xe9, 0xc3, 0x05, 0xe7, 0x28, 0x27, 0x20, 0x28, 0xfa, 0xe5,
+  0x06, 0xbf, 0x0b, 0xf9, 0xb5, 0x05, 0xfe, 0xff, 0x18, 0xcc, 0x2d, 0x20,
+  0xe7, 0x0a, 0x29, 0x1d, 0x1b, 0x04, 0x1d, 0xfd, 0x4c, 0x06, 0xda, 0xf9,
+  0x00, 0xe1, 0xf1, 0x32, 0x1f, 0x2e, 0x01, 0xc8, 0xfb, 0xfd, 0xcd, 0x21,
+  0x19, 0x24, 0x10, 0xe5, 0xfa, 0x40, 0xd9, 0x04, 0x30, 0xf1, 0xc9, 0x00,
+  0x0a, 0x36, 0x1c, 0x28, 0xf8, 0x24, 0xfc, 0x07, 0x35, 0xa9, 0xdf, 0xcb,
+  0x2d, 0xfb, 0x27, 0xfa, 0x17, 0xfa, 0xfd, 0x2a, 0x15, 0xdc, 0x20, 0x04,
+  0x05, 0xbc, 0xf3, 0x05, 0xf0, 0x1b, 0xf7, 0x29, 0xce, 0xf5, 0xcd, 0xed,
+  0xdd, 0x1d, 0xe5, 0x2a, 0x1f, 0x02, 0xfa, 0x10, 0x19, 0x02, 0xcb, 0x10,
+  0x37, 0x27, 0x48, 0x38, 0x15, 0xec, 0x0b, 0x14, 0xf8, 0x0e, 0x15, 0x2f,
+  0x3e, 0xfd, 0xdb, 0xfd, 0xf4, 0x4c, 0x14, 0x2d, 0x29, 0xfe, 0x0f, 0xf4,
+  0x33, 0xcc, 0x0d, 0xb7, 0xff, 0xef, 0x11, 0x3f, 0xf2, 0x22, 0xe1, 0x1b,
+  0x01, 0xd7, 0x16, 0xd6, 0x09, 0xcb, 0x10, 0x1c, 0x19, 0xef, 0xe9, 0x11,
+  0xfa, 0x29, 0xe8, 0x2b, 0x24, 0xe0, 0xfc, 0xec, 0x16, 0xc7, 0xd4, 0xe0,
+  0xf1, 0xe8, 0xd0, 0xf5, 0x08, 0x24, 0xed, 0xf7, 0xe8, 0xe2, 0xdf, 0x3b,
+  0xf4, 0xe5, 0x1a, 0x26, 0xfe, 0x24, 0x12, 0xdb, 0xee, 0xca, 0x03, 0xed,
+  0x1a, 0x2f, 0x18, 0xf9, 0xf3, 0x15, 0x35, 0xe1, 0x11, 0x02, 0xf2, 0x14,
+  0x16, 0x22, 0x30, 0x14, 0x0c, 0x17, 0xdd, 0x0b, 0x1d, 0xd1, 0x01, 0x17,
+  0x11, 0xf3, 0x21, 0xde, 0x15, 0xdf, 0x05, 0x30, 0x11, 0xf2, 0xea, 0xe4,
+  0x12, 0x15, 0x1e, 0x32, 0xdc, 0x1e, 0x0e, 0x1a, 0x19, 0xd4, 0xe2, 0xcb,
+  0xe8, 0xea, 0x07, 0xf4, 0x0d, 0x07, 0xf6, 0xf9, 0x08, 0xef, 0xe7, 0x12,
+  0x52, 0x15, 0x49, 0x36, 0x00, 0x00, 0x0c, 0xd7, 0x2e, 0xdb, 0xc9, 0xdd,
+  0x0a, 0xd4, 0xff, 0x1c, 0xf1, 0xda, 0xf0, 0xf9, 0xcc, 0xeb, 0x12, 0xda,
+  0xe7, 0x0f, 0x03, 0xe6, 0x13, 0xfd, 0xb7, 0x17, 0xef, 0xe8, 0xfa, 0xf0,
+  0xd2, 0x1c, 0xf9, 0x0e, 0x0f, 0x0c, 0x0b, 0xfb, 0xc5, 0xf0, 0xf4, 0x05,
+  0x07, 0x05, 0xe6, 0x23, 0x0b, 0xfa, 0x26, 0x22, 0x03, 0xa5, 0xff, 0x0e,
+  0xfc, 0x32, 0xfc, 0xfb, 0xef, 0x1e, 0xdf, 0x11, 0x10, 0xf2, 0xb2, 0xcb,
+  0xfe, 0xe3, 0x07, 0xf8, 0xe4, 0x2d, 0x19, 0xf3, 0xf4, 0xf2, 0x0c, 0x05,
+  0x13, 0x15, 0x1e, 0xed, 0xe3, 0x29, 0xf8, 0xea, 0x27, 0xeb, 0xf1, 0x15,
+  0xdd, 0x16, 0x0c, 0x23, 0x10, 0x12, 0x01, 0x0b, 0x1a, 0xea, 0xd0, 0x19,
+  0xcf, 0x22, 0xb5, 0xe7, 0xf3, 0x15, 0x1e, 0x10, 0xe0, 0x0b, 0xfe, 0x17,
+  0xda, 0x0b, 0xf5, 0x1a, 0x29, 0x14, 0x2a, 0xf5, 0xe6, 0x15, 0xea, 0x08,
+  0xfd, 0xea, 0x01, 0x24, 0x19, 0x0c, 0x18, 0xf8, 0xfa, 0xf3, 0xf2, 0x35,
+  0xd3, 0xf9, 0xf6, 0x0a, 0x18, 0xfc, 0x09, 0xff, 0x1d, 0x2b, 0x01, 0x12,
+  0x0b, 0xdc, 0xfe, 0x04, 0x29, 0xea, 0x22, 0x2b, 0xea, 0xe1, 0x1a, 0x15,
+  0xf7, 0xfe, 0xe9, 0x33, 0xdb, 0x32, 0xf5, 0x22, 0x09, 0xee, 0xed, 0x20,
+  0xf2, 0x08, 0xe3, 0x0b, 0x11, 0x07, 0x2c, 0x0b, 0xfd, 0x16, 0xf3, 0xd2,
+  0xfc, 0x0a, 0xf3, 0x0d, 0x06, 0xe9, 0xe3, 0xec, 0x1b, 0xee, 0xe3, 0xed,
+  0x01, 0xf4, 0x16, 0x28, 0xfb, 0xf8, 0xfb, 0xf0, 0xef, 0xbf, 0x03, 0x01,
+  0xf3, 0x0e, 0x03, 0xee, 0xf2, 0x13, 0x03, 0x1f, 0xfd, 0x2c, 0x02, 0xff,
+  0xeb, 0x53, 0xe8, 0x0d, 0x13, 0x0f, 0xf9, 0x0d, 0xdf, 0x06, 0xdc, 0xf1,
+  0x07, 0x12, 0x10, 0xe9, 0x21, 0xf4, 0x28, 0x14, 0xe8, 0xf9, 0xe0, 0x12,
+  0x0d, 0x09, 0x32, 0x1f, 0xef, 0x1f, 0x25, 0x22, 0xee, 0x28, 0xe5, 0xb9,
+  0xed, 0xf4, 0xd8, 0x00, 0x26, 0xe9, 0x2e, 0x05, 0xf5, 0x06, 0xdd, 0x03,
+  0x0a, 0xde, 0x13, 0xde, 0xe6, 0x00, 0xf2, 0xd6, 0xff, 0xf0, 0x27, 0x06,
+  0xd7, 0x05, 0xe8, 0xe5, 0xf1, 0x32, 0xc7, 0x31, 0x40, 0xf8, 0xeb, 0xf2,
+  0x11, 0xf8, 0xd7, 0x06, 0xf2, 0x3c, 0x22, 0xda, 0xdb, 0xd9, 0x10, 0x0b,
+  0xff, 0xe1, 0x02, 0xfd, 0xd5, 0x08, 0x0e, 0xf2, 0x35, 0x28, 0xd0, 0x1e,
+  0x0d, 0x11, 0xff, 0xd6, 0xfb, 0xf6, 0x46, 0xfe, 0xd7, 0xe8, 0x09, 0xde,
+  0x34, 0x19, 0x22, 0x12, 0x09, 0x19, 0x0a, 0xe5, 0xf7, 0xc7, 0xdc, 0x00,
+  0xfa, 0x01, 0xf3, 0x12, 0x0c, 0x1a, 0x08, 0x22, 0x05, 0x33, 0xff, 0x1c,
+  0x10, 0x1a, 0x23, 0x34, 0x12, 0xff, 0xed, 0xe7, 0x18, 0x0f, 0xfd, 0x23,
+  0xf3, 0x42, 0xcb, 0x2e, 0xe0, 0x07, 0xd8, 0x0f, 0x2c, 0x04, 0xf5, 0xf6,
+  0x24, 0xd6, 0x26, 0x19, 0x21, 0x1b, 0xdb, 0xf3, 0x2f, 0xec, 0xc5, 0x21,
+  0x0d, 0xcf, 0x38, 0x09, 0x02, 0x1b, 0xfd, 0x1c, 0xfa, 0xd5, 0x03, 0xef,
+  0xbf, 0x33, 0x04, 0xee, 0xed, 0xed, 0xe9, 0x05, 0xe7, 0x13, 0xec, 0x2c,
+  0xfb, 0x34, 0xf5, 0x15, 0xee, 0x28, 0xe5, 0x05, 0xbb, 0x54, 0xb6, 0xfe,
+  0xe6, 0x02, 0x2c, 0xfc, 0xfd, 0xdf, 0xfc, 0xea, 0xf7, 0xca, 0x0c, 0x11,
+  0xec, 0x2e, 0x29, 0xf6, 0xf4, 0x11, 0x48, 0x11, 0xe7, 0xdb, 0xd8, 0xc3,
+  0x1b, 0xcb, 0x04, 0xfc, 0xef, 0x1c, 0x1d, 0x2d, 0x0d, 0xd2, 0x06, 0x28,
+  0x28, 0xb8, 0x05, 0xeb, 0x4c, 0xeb, 0xd9, 0xb8, 0x4c, 0x18, 0x5a, 0x14,
+  0xcd, 0x41, 0x06, 0x39, 0x08, 0x15, 0xaf, 0x1c, 0xf7, 0x2c, 0xf4, 0x01,
+  0x19, 0x16, 0xe9, 0xec, 0xf9, 0x4a, 0x37, 0x30, 0xbf, 0xd9, 0xf4, 0x63,
+  0xf7, 0xf6, 0xdf, 0x21, 0x27, 0x0a, 0x1d, 0x03, 0xf9, 0xb6, 0x2a, 0x1b,
+  0x0f, 0xdc, 0x0b, 0x05, 0x02, 0x14, 0xe8, 0x4e, 0x20, 0xdb, 0x12, 0x2e,
+  0x3d, 0xdd, 0xf9, 0x01, 0x15, 0x12, 0xe1, 0x18, 0x02, 0x06, 0xdc, 0xe1,
+  0x40, 0x1d, 0xfc, 0x01, 0xe6, 0x46, 0x14, 0xf1, 0x0d, 0xb9, 0x09, 0x1a,
+  0xfd, 0xe1, 0x0b, 0xdb, 0xed, 0xf6, 0x06, 0x29, 0x03, 0x00, 0xf8, 0xfc,
+  0x01, 0xd4, 0x04, 0xdf, 0xd3, 0x0d, 0xdf, 0xc5, 0xf9, 0xde, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf6, 0xec, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x92, 0x12, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00,
+  0xbc, 0x13, 0x00, 0x00, 0xb2, 0x1b, 0x00, 0x00, 0x81, 0x0e, 0x00, 0x00,
+  0x9b, 0x11, 0x00, 0x00, 0x7a, 0x11, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00,
+  0x92, 0x11, 0x00, 0x00, 0x38, 0x14, 0x00, 0x00, 0xa3, 0x1a, 0x00, 0x00,
+  0x55, 0x15, 0x00, 0x00, 0x65, 0x13, 0x00, 0x00, 0xbf, 0x0e, 0x00, 0x00,
+  0x89, 0x15, 0x00, 0x00, 0xac, 0x19, 0x00, 0x00, 0xd9, 0x18, 0x00, 0x00,
+  0x49, 0x09, 0x00, 0x00, 0x80, 0x14, 0x00, 0x00, 0x2e, 0x1a, 0x00, 0x00,
+  0x14, 0x0c, 0x00, 0x00, 0xaa, 0x13, 0x00, 0x00, 0x1a, 0x10, 0x00, 0x00,
+  0x84, 0x16, 0x00, 0x00, 0x95, 0x10, 0x00, 0x00, 0xa5, 0x19, 0x00, 0x00,
+  0x38, 0x0e, 0x00, 0x00, 0x57, 0x0f, 0x00, 0x00, 0xd8, 0x08, 0x00, 0x00,
+  0x49, 0x19, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x67, 0x18, 0x00, 0x00,
+  0x28, 0x15, 0x00, 0x00, 0x8a, 0x0c, 0x00, 0x00, 0x6e, 0x0d, 0x00, 0x00,
+  0x71, 0x16, 0x00, 0x00, 0x7f, 0x13, 0x00, 0x00, 0xdd, 0x18, 0x00, 0x00,
+  0xc7, 0x1d, 0x00, 0x00, 0x55, 0x17, 0x00, 0x00, 0xc8, 0x19, 0x00, 0x00,
+  0xb4, 0x16, 0x00, 0x00, 0x48, 0x11, 0x00, 0x00, 0x46, 0x12, 0x00, 0x00,
+  0xb3, 0x11, 0x00, 0x00, 0x53, 0x1a, 0x00, 0x00, 0x7d, 0x1b, 0x00, 0x00,
+  0x97, 0x15, 0x00, 0x00, 0x4e, 0x15, 0x00, 0x00, 0xb0, 0x0e, 0x00, 0x00,
+  0xc7, 0x14, 0x00, 0x00, 0xe8, 0x0d, 0x00, 0x00, 0xa4, 0x17, 0x00, 0x00,
+  0x17, 0x19, 0x00, 0x00, 0xb9, 0x0e, 0x00, 0x00, 0x75, 0x19, 0x00, 0x00,
+  0x40, 0x13, 0x00, 0x00, 0x9e, 0x12, 0x00, 0x00, 0x18, 0x17, 0x00, 0x00,
+  0x76, 0x17, 0x00, 0x00, 0x2a, 0x12, 0x00, 0x00, 0x4f, 0x15, 0x00, 0x00,
+  0xb5, 0x19, 0x00, 0x00, 0xa5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xee, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xbe, 0x0c, 0xb9, 0xfa, 0x26, 0xee, 0xf2, 0x05, 0x13, 0xef, 0xde, 0x50,
+  0x6e, 0xcf, 0xcf, 0xef, 0x0b, 0xe5, 0x21, 0x19, 0xf2, 0x3c, 0xd6, 0x24,
+  0x37, 0xe4, 0xf3, 0xe8, 0x31, 0x12, 0x0f, 0x29, 0x17, 0xc2, 0xd0, 0x2d,
+  0xf5, 0xdf, 0x0a, 0x13, 0xbe, 0xb8, 0x2d, 0xdf, 0x12, 0xfc, 0x16, 0x20,
+  0x2f, 0xfd, 0x0a, 0xe4, 0xa3, 0xd9, 0xf1, 0x29, 0xf3, 0xe5, 0x0b, 0x2d,
+  0xbd, 0x12, 0xe8, 0x07, 0x24, 0xaf, 0x59, 0xd2, 0xe0, 0xfe, 0x16, 0xfc,
+  0x11, 0x34, 0xdc, 0x03, 0xfa, 0x03, 0x90, 0x19, 0xfa, 0xec, 0xca, 0xeb,
+  0x9e, 0xc9, 0xfc, 0x19, 0x12, 0x38, 0x0b, 0xcb, 0x21, 0x12, 0x5e, 0xff,
+  0x28, 0x81, 0xe1, 0xec, 0x2a, 0x30, 0xd6, 0x45, 0xdc, 0x08, 0x10, 0x23,
+  0xf4, 0x2f, 0x28, 0x4c, 0xff, 0xde, 0xf6, 0xdb, 0x11, 0x03, 0xfc, 0x22,
+  0xe9, 0x03, 0x03, 0xd9, 0xca, 0x13, 0xfd, 0x14, 0x1b, 0x2a, 0xf1, 0xcc,
+  0xde, 0xfc, 0x0b, 0xfe, 0x12, 0xfa, 0x22, 0x11, 0x09, 0x34, 0x2d, 0xff,
+  0x05, 0xd1, 0x2a, 0x27, 0xbc, 0xe2, 0x03, 0x01, 0xec, 0xfe, 0xf5, 0x9b,
+  0xda, 0x4f, 0x0d, 0x0a, 0x35, 0x12, 0x19, 0xc5, 0xe2, 0xe4, 0xee, 0x15,
+  0x2d, 0xf2, 0x0c, 0x01, 0xa8, 0x04, 0x09, 0x1a, 0x1e, 0xac, 0x2b, 0x08,
+  0x14, 0xb9, 0xcd, 0xf0, 0x05, 0x16, 0x17, 0x09, 0x0f, 0x13, 0x21, 0xdf,
+  0x00, 0x00, 0x00, 0x00, 0xd6, 0xee, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0xe4, 0x14, 0x00, 0xf2, 0x03, 0x27, 0xdd, 0x26,
+  0xd8, 0x24, 0x1d, 0xd5, 0xfe, 0xf3, 0xd2, 0x23, 0xe8, 0x28, 0xff, 0xe4,
+  0xed, 0x0b, 0xd6, 0xf1, 0x3e, 0xda, 0xe7, 0x07, 0x16, 0xc9, 0xe3, 0xe7,
+  0x28, 0xeb, 0x20, 0xdc, 0xdc, 0xc8, 0x07, 0xf7, 0xf9, 0xed, 0x1f, 0xda,
+  0x00, 0x1f, 0x12, 0x07, 0xf8, 0xe4, 0xdb, 0xe0, 0xfe, 0x20, 0x0c, 0xf6,
+  0x21, 0xd0, 0x1a, 0x04, 0xf1, 0x26, 0xdb, 0xfb, 0x18, 0x11, 0x95, 0xff,
+  0xe8, 0xf3, 0xeb, 0xfb, 0x10, 0xec, 0x22, 0xfb, 0xd9, 0x24, 0xee, 0xe0,
+  0xdb, 0x10, 0xdb, 0xf8, 0xd1, 0xff, 0xe4, 0x19, 0xee, 0xf9, 0xfe, 0x0a,
+  0xaf, 0xeb, 0xe1, 0xfc, 0xe6, 0x04, 0xd5, 0xfa, 0x20, 0x10, 0xfa, 0x18,
+  0xee, 0x06, 0x12, 0x10, 0x30, 0xbe, 0x1b, 0xcf, 0x05, 0xf3, 0x14, 0xdf,
+  0x24, 0x12, 0x13, 0xea, 0xee, 0x01, 0x25, 0xf7, 0xd2, 0xce, 0xda, 0xf4,
+  0xf8, 0xf1, 0x06, 0x0f, 0xdf, 0xf7, 0xfd, 0x0d, 0xf6, 0xff, 0x01, 0xc8,
+  0x02, 0x0c, 0x01, 0x0c, 0xde, 0xd8, 0x0a, 0x0e, 0xfe, 0x1f, 0xe9, 0x2d,
+  0xd7, 0x11, 0xf4, 0x10, 0xd3, 0xeb, 0xf1, 0xe0, 0x04, 0xfe, 0xdb, 0xe1,
+  0x33, 0x14, 0x25, 0xdd, 0x08, 0x1f, 0x14, 0xd2, 0x47, 0xe8, 0xeb, 0xf8,
+  0xdd, 0xe9, 0xf3, 0xef, 0xf2, 0x3b, 0xf9, 0xed, 0x1a, 0xf1, 0x2f, 0x05,
+  0xd6, 0xc9, 0x0e, 0xcc, 0xf5, 0xf9, 0xe0, 0x20, 0x15, 0xec, 0x3b, 0x01,
+  0xe8, 0x15, 0x03, 0xfa, 0x00, 0xfb, 0xfa, 0x0a, 0xf3, 0xd5, 0xd3, 0xef,
+  0xdc, 0x2d, 0xc3, 0x61, 0xdc, 0xf7, 0x25, 0x0e, 0xf2, 0x01, 0xf4, 0xf7,
+  0x1a, 0x0c, 0xe3, 0x1c, 0xf2, 0x09, 0x3b, 0xfd, 0xd6, 0xde, 0x0a, 0x12,
+  0x10, 0x1e, 0x10, 0x14, 0xfb, 0xf2, 0xee, 0xdd, 0x09, 0x0e, 0xeb, 0xaf,
+  0xfd, 0x1c, 0x38, 0xde, 0xe7, 0xf5, 0x23, 0xff, 0x13, 0xf3, 0xde, 0x0e,
+  0x04, 0x02, 0x35, 0x15, 0xec, 0xfc, 0xf7, 0xfd, 0x34, 0xeb, 0x00, 0xf4,
+  0x08, 0x0f, 0xf2, 0x43, 0xd0, 0xf9, 0xda, 0x03, 0x2c, 0xc8, 0xd3, 0xf8,
+  0xed, 0x20, 0xea, 0x09, 0x0b, 0x0b, 0xb7, 0xe4, 0x10, 0xf0, 0xfc, 0x19,
+  0x05, 0x17, 0x14, 0xd0, 0x31, 0xfa, 0xe1, 0xed, 0x34, 0x0d, 0xf8, 0xeb,
+  0x15, 0xdd, 0xf4, 0xf4, 0x15, 0xe8, 0xf5, 0xeb, 0x0c, 0xdb, 0xd0, 0xf6,
+  0x15, 0xe9, 0xd2, 0xf9, 0xfd, 0xf6, 0x15, 0x33, 0xf4, 0x12, 0x0e, 0xe8,
+  0xef, 0x0c, 0x0b, 0xc6, 0x35, 0xf1, 0x0a, 0x1e, 0x40, 0xe0, 0xe1, 0x04,
+  0x2b, 0xfa, 0x12, 0x47, 0xf7, 0xfe, 0x15, 0xfc, 0x12, 0xbe, 0x15, 0xf8,
+  0xf3, 0xb3, 0x1d, 0x00, 0xb3, 0x19, 0x11, 0x1c, 0x25, 0xef, 0x0e, 0x28,
+  0x23, 0xf1, 0xf5, 0xf1, 0x1e, 0xe6, 0xf7, 0xe8, 0x1c, 0xf2, 0x12, 0xe9,
+  0xfb, 0xff, 0xe7, 0xe3, 0xf2, 0xb9, 0x39, 0xf5, 0xf7, 0x08, 0xfc, 0x10,
+  0xfb, 0x22, 0xf3, 0xf0, 0x0f, 0xeb, 0xe7, 0x5f, 0xee, 0x37, 0x12, 0xee,
+  0x43, 0x1b, 0xdc, 0x1d, 0xfb, 0x19, 0xf6, 0xd7, 0x32, 0xfb, 0xce, 0xd4,
+  0xd2, 0x0c, 0x18, 0xe2, 0x04, 0x02, 0x2b, 0xaa, 0xfc, 0xfe, 0xef, 0xf6,
+  0x14, 0x07, 0x29, 0xbe, 0xf1, 0xd9, 0xe6, 0xef, 0x01, 0x20, 0x03, 0xea,
+  0xee, 0xf1, 0x1d, 0xe3, 0xdc, 0xd3, 0xec, 0xd9, 0xf7, 0xbe, 0x11, 0xff,
+  0x16, 0xe1, 0xe9, 0xf5, 0x07, 0xd0, 0x0a, 0x2c, 0x07, 0x07, 0xef, 0x17,
+  0x1b, 0x00, 0x25, 0xef, 0x11, 0x2c, 0xcc, 0x33, 0xd6, 0x09, 0x16, 0xf2,
+  0xd0, 0x02, 0xed, 0xf3, 0x07, 0xbc, 0x18, 0x01, 0x20, 0x13, 0x1a, 0xee,
+  0xfc, 0xf6, 0x07, 0x41, 0x11, 0xe8, 0xf1, 0xea, 0xbd, 0xdc, 0xdd, 0xdb,
+  0x0e, 0x0c, 0x03, 0xd5, 0x18, 0x11, 0xc6, 0xd7, 0xf6, 0xb8, 0xda, 0x05,
+  0x1d, 0xf5, 0x16, 0xfe, 0x36, 0xf6, 0x19, 0x16, 0x08, 0xfa, 0x17, 0x2c,
+  0x03, 0x02, 0x17, 0xfe, 0x1a, 0x07, 0xef, 0x09, 0xed, 0xf3, 0x09, 0xcf,
+  0x08, 0xcd, 0xfb, 0x0b, 0x06, 0xe8, 0xf2, 0x02, 0xe5, 0x1e, 0xec, 0x05,
+  0xf7, 0xcf, 0x1b, 0x17, 0x0a, 0x1d, 0xfb, 0x14, 0x04, 0xf8, 0x23, 0x34,
+  0x27, 0xe3, 0x36, 0x09, 0x14, 0xef, 0xf3, 0x02, 0x24, 0xfd, 0xd4, 0x08,
+  0x09, 0xe7, 0x07, 0x2c, 0x1b, 0xf8, 0x05, 0xd7, 0xdc, 0x09, 0x0d, 0x1b,
+  0xbd, 0xcb, 0x0a, 0xd5, 0x0c, 0x1b, 0xf4, 0x1b, 0x11, 0x26, 0x15, 0xe4,
+  0xd0, 0x00, 0xfb, 0x16, 0xef, 0xf1, 0x17, 0xe9, 0xf2, 0xf0, 0x1f, 0xdc,
+  0xf9, 0xf0, 0xeb, 0xf0, 0xeb, 0xff, 0xf4, 0xe9, 0xe5, 0xe2, 0x03, 0xea,
+  0x31, 0x17, 0x28, 0xe6, 0x02, 0xd2, 0x11, 0x00, 0x1d, 0x1c, 0xdd, 0x18,
+  0xf4, 0x09, 0x03, 0xf0, 0x09, 0xfc, 0xf7, 0xcc, 0xd1, 0xd2, 0xe0, 0xdf,
+  0x22, 0x1c, 0x2c, 0x0b, 0xea, 0xfb, 0x18, 0x38, 0xeb, 0xff, 0xb9, 0xb2,
+  0xf0, 0x07, 0x11, 0x16, 0x01, 0xfc, 0xff, 0x03, 0xee, 0x05, 0x22, 0xe4,
+  0xf2, 0xff, 0x38, 0xf8, 0xcf, 0x16, 0x02, 0xea, 0x1a, 0x3f, 0xea, 0xcb,
+  0xfd, 0xff, 0x51, 0xd5, 0xe8, 0xd5, 0x30, 0xe3, 0x0f, 0xd8, 0xea, 0xc8,
+  0xef, 0x07, 0xff, 0xeb, 0x05, 0xf5, 0x01, 0xfb, 0xd7, 0xdb, 0xe8, 0xee,
+  0x1d, 0xd3, 0x22, 0xde, 0xc0, 0x08, 0xf8, 0x30, 0xd1, 0x01, 0xfb, 0xcd,
+  0x20, 0xf9, 0xe4, 0x0c, 0x1c, 0xd0, 0x22, 0xf9, 0x08, 0xee, 0xd3, 0x1a,
+  0xe2, 0x0f, 0x03, 0xff, 0xcb, 0x14, 0x18, 0xfb, 0x04, 0x20, 0x1a, 0xd9,
+  0x1b, 0x19, 0x10, 0xd8, 0xf7, 0x32, 0x0b, 0xec, 0x05, 0xea, 0x30, 0xf7,
+  0xee, 0xfb, 0xdd, 0x39, 0xe8, 0x1f, 0x01, 0xf8, 0x19, 0x16, 0xe7, 0xde,
+  0x05, 0xf5, 0xfe, 0xe5, 0xda, 0xf6, 0x30, 0x03, 0x27, 0x1e, 0xfe, 0xdc,
+  0xe6, 0x12, 0x0b, 0x15, 0xf9, 0x13, 0xf1, 0xb5, 0x28, 0xd7, 0x34, 0xf7,
+  0xb2, 0x07, 0xe3, 0x20, 0x0d, 0xc3, 0x9e, 0xe3, 0x04, 0x13, 0x65, 0xf2,
+  0xe9, 0x0e, 0xc8, 0x45, 0x0f, 0x02, 0xea, 0x00, 0x08, 0xff, 0x25, 0x02,
+  0x0b, 0x23, 0x39, 0x2a, 0xf6, 0xe2, 0x17, 0x81, 0xf8, 0xff, 0xe4, 0x11,
+  0xf0, 0x1f, 0x00, 0xe7, 0x30, 0xcd, 0x1c, 0x15, 0xe1, 0x09, 0xde, 0xb4,
+  0x04, 0xf2, 0x15, 0x06, 0x01, 0x06, 0x37, 0x31, 0x06, 0x05, 0xf3, 0xe9,
+  0xfa, 0xe4, 0xcb, 0x04, 0x02, 0x23, 0x01, 0xf9, 0xfa, 0xe0, 0x1d, 0xf3,
+  0xd5, 0x0f, 0xf5, 0xdd, 0xef, 0xf3, 0xe2, 0xe1, 0x13, 0x05, 0x05, 0xfe,
+  0xda, 0xca, 0x0e, 0xfa, 0x07, 0xfc, 0x31, 0xe8, 0xfe, 0xd9, 0x0b, 0x1a,
+  0xfe, 0xdf, 0xff, 0xfb, 0x22, 0x12, 0xd6, 0xf1, 0x01, 0x00, 0xe3, 0x0e,
+  0xfd, 0x0c, 0xec, 0x3b, 0xd7, 0xdb, 0x2c, 0x1d, 0xe8, 0x05, 0x00, 0x17,
+  0x1f, 0xfe, 0x11, 0xf9, 0x03, 0xff, 0xab, 0xf7, 0x2c, 0xf4, 0xf5, 0x18,
+  0x12, 0x32, 0x26, 0x35, 0x12, 0x05, 0xca, 0xea, 0xe7, 0xce, 0xf9, 0xea,
+  0xe5, 0x06, 0x26, 0xe8, 0xd7, 0xf4, 0x04, 0xe0, 0x3a, 0xdc, 0x17, 0x10,
+  0xef, 0xef, 0xd9, 0xe7, 0x1d, 0xf5, 0x1a, 0x1c, 0x47, 0x37, 0x1f, 0xe4,
+  0xd6, 0xf7, 0x0a, 0xd2, 0xd8, 0xc2, 0x1a, 0xe2, 0x5a, 0xe9, 0xef, 0x28,
+  0x0d, 0x2a, 0x14, 0xf2, 0xc6, 0x01, 0xd4, 0x03, 0x06, 0xe3, 0x24, 0x01,
+  0xf3, 0xf0, 0xcf, 0x16, 0x0f, 0x09, 0x2c, 0x12, 0xb4, 0xe7, 0xf2, 0xe6,
+  0xfb, 0x09, 0xd0, 0xc1, 0xff, 0xfe, 0x1e, 0xe1, 0xfb, 0x2f, 0xe7, 0xdf,
+  0x05, 0xcd, 0x0f, 0xf9, 0xea, 0xc1, 0xf1, 0xc7, 0x08, 0x0e, 0xcd, 0xe7,
+  0x25, 0x2f, 0x01, 0xeb, 0x03, 0xce, 0xf2, 0xfc, 0xc8, 0xec, 0xfe, 0xcd,
+  0x05, 0x02, 0xff, 0x0b, 0xfd, 0x2e, 0x1d, 0xf5, 0xab, 0xf9, 0xf9, 0xde,
+  0xee, 0xe8, 0x2c, 0xd3, 0x0c, 0x17, 0xe2, 0x1c, 0xcc, 0x01, 0x1c, 0xf7,
+  0xf9, 0x1f, 0x1c, 0xb5, 0xfb, 0x9d, 0x14, 0x0d, 0x21, 0xe7, 0x1a, 0xc5,
+  0xfc, 0x02, 0x0f, 0xf2, 0x16, 0xf5, 0x27, 0x0e, 0xf7, 0xdb, 0xce, 0x30,
+  0xfb, 0xf7, 0xe7, 0xbf, 0x2f, 0x0b, 0xbe, 0xc9, 0xef, 0xe7, 0x03, 0xec,
+  0xcc, 0xf2, 0x08, 0xbb, 0x22, 0xf7, 0xee, 0x28, 0xe0, 0x43, 0xb3, 0x03,
+  0xbd, 0xf3, 0xde, 0xf7, 0xfd, 0x1c, 0x1e, 0xc8, 0x1e, 0x15, 0xea, 0xee,
+  0x02, 0xf8, 0x0b, 0xd6, 0x0c, 0xf3, 0x16, 0xe7, 0x11, 0x0b, 0x24, 0xf7,
+  0xfa, 0xe4, 0x11, 0x06, 0xe5, 0xf1, 0xfd, 0x13, 0xea, 0xf8, 0xf9, 0x15,
+  0xfb, 0xf9, 0xf7, 0x2d, 0xe6, 0xf5, 0xfd, 0x01, 0xe1, 0xf5, 0xc8, 0xc9,
+  0xf7, 0xf1, 0xfc, 0x0e, 0xfa, 0x4e, 0x07, 0xe5, 0xe5, 0xee, 0xd7, 0xef,
+  0x2b, 0x01, 0xe1, 0xfd, 0x16, 0x0b, 0x07, 0x15, 0xea, 0x1c, 0x07, 0x1b,
+  0xdb, 0xcc, 0x27, 0xdf, 0x3c, 0xe9, 0xdc, 0x2e, 0xf5, 0x03, 0x16, 0x23,
+  0x23, 0xe4, 0x0d, 0xee, 0x03, 0xdd, 0x05, 0x1f, 0xe2, 0xf2, 0xe5, 0x0a,
+  0x0f, 0xdd, 0xf1, 0x00, 0x14, 0x25, 0x18, 0x2c, 0xf7, 0xf7, 0xf6, 0xfc,
+  0xe8, 0xe8, 0xd7, 0x2a, 0x0c, 0x30, 0x1f, 0x18, 0x0e, 0x06, 0x0b, 0xea,
+  0xb9, 0xf0, 0x09, 0xc5, 0xde, 0x1a, 0x45, 0x11, 0xe9, 0x2b, 0x17, 0x0d,
+  0x13, 0xcf, 0x09, 0x0d, 0x10, 0xec, 0x2e, 0xf2, 0x0a, 0xf3, 0xf4, 0xbc,
+  0x0d, 0x33, 0x4b, 0x07, 0xcf, 0x03, 0xd0, 0x1f, 0x2f, 0x26, 0xd2, 0x22,
+  0xf1, 0xdb, 0x0b, 0x01, 0x09, 0x29, 0x0e, 0xde, 0xe0, 0x1b, 0x18, 0x26,
+  0xcd, 0x08, 0xea, 0xea, 0x05, 0x11, 0x40, 0x15, 0x13, 0x0e, 0xda, 0xf4,
+  0xdf, 0x03, 0xc1, 0xd3, 0xfd, 0x0d, 0x2f, 0x32, 0xf6, 0x14, 0xea, 0x1d,
+  0x0f, 0x15, 0xea, 0x98, 0x2d, 0xf7, 0xdf, 0xe6, 0xe7, 0xeb, 0xef, 0x28,
+  0xff, 0xfc, 0x09, 0x4b, 0x0b, 0xf6, 0x03, 0xed, 0x35, 0x00, 0xe8, 0xf9,
+  0xf8, 0xfc, 0x1e, 0x00, 0xf9, 0xd7, 0xf7, 0xe4, 0x22, 0xd3, 0x38, 0xd7,
+  0xe1, 0xc7, 0xec, 0xe0, 0x1c, 0xf6, 0x09, 0xe8, 0x26, 0x1c, 0xd9, 0xce,
+  0xed, 0x28, 0xe7, 0xee, 0x0c, 0x2e, 0xfe, 0x03, 0xce, 0x24, 0xf0, 0xd3,
+  0x02, 0x00, 0xc3, 0x30, 0x13, 0x1e, 0x08, 0xde, 0xd3, 0xf9, 0xea, 0xf6,
+  0xea, 0xbf, 0x0a, 0xed, 0x11, 0x10, 0xdb, 0x2d, 0x0e, 0x04, 0x0f, 0x32,
+  0x02, 0x04, 0x00, 0x00, 0xf5, 0x14, 0xe6, 0x2c, 0x1a, 0xc2, 0xf0, 0x1e,
+  0x08, 0x05, 0xee, 0xfe, 0x12, 0x2f, 0xfe, 0x17, 0x0a, 0xf3, 0x23, 0x0f,
+  0xdd, 0xfd, 0x10, 0x0d, 0xeb, 0x1a, 0x0d, 0x05, 0x3d, 0x03, 0x1f, 0x20,
+  0xe5, 0x03, 0x01, 0xe6, 0xf2, 0x00, 0x07, 0x03, 0xec, 0x24, 0x2a, 0xcf,
+  0xf1, 0xe8, 0x11, 0xf7, 0x13, 0x03, 0xe0, 0xfa, 0x06, 0x20, 0xc3, 0x1b,
+  0xf2, 0x0f, 0xfd, 0x16, 0xda, 0xc8, 0xc7, 0x0c, 0xe0, 0x21, 0xf8, 0x2c,
+  0x0c, 0xee, 0xe4, 0x26, 0x2c, 0xf9, 0xf0, 0xbf, 0xe5, 0xea, 0x08, 0x0f,
+  0xe6, 0x0b, 0x00, 0x0a, 0x07, 0xe3, 0x2e, 0x00, 0x07, 0x1a, 0x14, 0xe2,
+  0x33, 0x5b, 0x1d, 0xdd, 0x27, 0x13, 0xe2, 0x18, 0x26, 0xec, 0xdc, 0xdb,
+  0xff, 0xcd, 0xda, 0x1e, 0xed, 0x1e, 0xf1, 0x02, 0x44, 0x91, 0x25, 0x9c,
+  0xed, 0xfc, 0x2a, 0x07, 0x07, 0xe0, 0xfb, 0x1d, 0x25, 0x09, 0xfa, 0x1a,
+  0xe0, 0x30, 0xd7, 0x0f, 0x29, 0x06, 0xc0, 0x2a, 0x0b, 0xfd, 0xdf, 0xbe,
+  0x48, 0x10, 0xfb, 0x0d, 0xf7, 0xe3, 0x1c, 0xf1, 0x1e, 0xce, 0x1f, 0x49,
+  0x2e, 0x24, 0x48, 0x09, 0xc7, 0xee, 0xfd, 0xf8, 0xea, 0xed, 0xed, 0x01,
+  0xeb, 0x26, 0x17, 0x47, 0xee, 0x2a, 0xf0, 0xdf, 0xfc, 0x1c, 0xf7, 0xf9,
+  0x0a, 0x1b, 0x04, 0xdf, 0xf9, 0xf6, 0x03, 0xeb, 0x49, 0x1e, 0x1a, 0xe2,
+  0xf5, 0xd0, 0x18, 0x4c, 0x1a, 0xc6, 0x07, 0x08, 0x0e, 0xf6, 0x1b, 0xf7,
+  0xe2, 0x02, 0xfd, 0x0d, 0x01, 0xe7, 0x03, 0xc7, 0x05, 0x03, 0xd6, 0x08,
+  0xfd, 0x36, 0xed, 0xf1, 0xee, 0x10, 0xd4, 0xee, 0x0e, 0xdc, 0x2d, 0xbd,
+  0xfb, 0xe1, 0xfd, 0x21, 0xef, 0xed, 0xf2, 0x0b, 0xef, 0xb0, 0xf0, 0x25,
+  0xcf, 0xc3, 0x13, 0xc8, 0x0c, 0x3c, 0xf7, 0x11, 0xbd, 0x11, 0x1d, 0xef,
+  0xd4, 0xeb, 0xe6, 0xd1, 0xcc, 0xe9, 0x47, 0xca, 0x42, 0x13, 0xfe, 0xed,
+  0xfc, 0x2e, 0x1e, 0x0d, 0xfe, 0xc8, 0xfd, 0xf4, 0xe6, 0xee, 0xf3, 0xf6,
+  0x0c, 0x21, 0x37, 0xd4, 0x0d, 0xdf, 0x04, 0xdd, 0xd7, 0xd2, 0xf2, 0xe9,
+  0xf4, 0xc9, 0xbd, 0xf5, 0x17, 0x2c, 0x16, 0x03, 0xfa, 0xc8, 0xe7, 0xd3,
+  0x06, 0x16, 0x16, 0xf0, 0x09, 0xef, 0xf6, 0xfd, 0xf7, 0xf1, 0xc8, 0x05,
+  0x25, 0xfd, 0x37, 0x25, 0xba, 0x0e, 0xe4, 0xf6, 0x31, 0x18, 0xe3, 0xdd,
+  0x2f, 0x18, 0xf0, 0x10, 0x24, 0xfe, 0x08, 0x35, 0x1d, 0xe0, 0x19, 0x05,
+  0x19, 0xed, 0x01, 0xe0, 0x12, 0xd6, 0xea, 0xf7, 0x2e, 0x38, 0xfc, 0xfe,
+  0xf9, 0xd2, 0x21, 0xef, 0xf4, 0xc0, 0x36, 0xec, 0xf7, 0x1a, 0x3d, 0x2e,
+  0xbd, 0x0c, 0x1e, 0x22, 0x09, 0xea, 0x01, 0xe3, 0x14, 0xe7, 0x06, 0xe3,
+  0x0f, 0x3e, 0xda, 0x16, 0xf1, 0x0c, 0x1e, 0xf6, 0x09, 0x20, 0x00, 0xde,
+  0x0e, 0xf3, 0xf3, 0x11, 0x12, 0xec, 0x13, 0x07, 0x08, 0x02, 0xf8, 0xf4,
+  0x2c, 0x15, 0x23, 0xf9, 0xea, 0xfa, 0xf1, 0xda, 0x0c, 0x00, 0x0e, 0x07,
+  0xe4, 0x0f, 0x05, 0xde, 0xd8, 0xfa, 0xf0, 0x07, 0x18, 0x0e, 0xc7, 0xf8,
+  0xf2, 0x28, 0x0a, 0xe7, 0x1c, 0xf3, 0xe7, 0xe9, 0x0c, 0x15, 0xfe, 0xfa,
+  0xf4, 0xf1, 0x38, 0x0c, 0xab, 0xfa, 0x04, 0x04, 0xfc, 0xeb, 0xcb, 0x05,
+  0x00, 0xe6, 0x04, 0xf6, 0xe6, 0x19, 0xf0, 0xed, 0x16, 0xe7, 0x03, 0xf6,
+  0xf9, 0x11, 0xf6, 0x06, 0xcb, 0xe3, 0x04, 0xe4, 0xfb, 0xf5, 0x01, 0x07,
+  0x26, 0xf5, 0xda, 0x0c, 0xea, 0xe5, 0xc6, 0xf0, 0x28, 0x17, 0x10, 0xfa,
+  0x08, 0xc8, 0x26, 0xe6, 0x52, 0xf8, 0x11, 0x63, 0xf6, 0x1a, 0xbe, 0xef,
+  0x00, 0xf0, 0xc4, 0xc5, 0x33, 0xff, 0x20, 0x05, 0x12, 0x1b, 0xd5, 0x02,
+  0x1f, 0xef, 0xfb, 0xe1, 0xe6, 0xf1, 0x12, 0xcd, 0xe7, 0x27, 0xf6, 0xf7,
+  0xec, 0x32, 0x15, 0xd5, 0xde, 0x19, 0xf3, 0x9b, 0x18, 0xbe, 0x3d, 0x05,
+  0x28, 0xce, 0xcf, 0xde, 0xe8, 0xee, 0x03, 0xca, 0x10, 0x07, 0x1d, 0xdb,
+  0x18, 0xfa, 0xdb, 0x1f, 0xd6, 0xf5, 0xe2, 0xe6, 0x12, 0xc9, 0x15, 0x1e,
+  0xb5, 0x3d, 0xf0, 0x0b, 0xec, 0xf5, 0xd1, 0x06, 0xf8, 0x08, 0x29, 0xe7,
+  0x09, 0xfe, 0xe7, 0xee, 0x11, 0x36, 0x2f, 0xfd, 0x23, 0xdb, 0x16, 0xee,
+  0xf9, 0xba, 0x12, 0xf6, 0xf5, 0x25, 0x01, 0xe9, 0xf5, 0xf7, 0xdf, 0x1d,
+  0xee, 0xd3, 0x0d, 0xfa, 0x06, 0xd5, 0xe4, 0xe8, 0xdf, 0xe9, 0x21, 0xe1,
+  0x0e, 0x0b, 0x1f, 0xdf, 0xe1, 0x07, 0xfe, 0xc8, 0xac, 0xeb, 0x04, 0x21,
+  0x03, 0xf8, 0xf3, 0xe6, 0x0f, 0xfe, 0x2b, 0x0e, 0xe4, 0x09, 0xeb, 0xf6,
+  0xf3, 0xe3, 0xf2, 0x0b, 0xf8, 0x21, 0xf1, 0x0f, 0x0b, 0x09, 0x2a, 0xff,
+  0x1e, 0x07, 0x0b, 0x11, 0x12, 0x00, 0xe2, 0xf9, 0xe4, 0xeb, 0xfc, 0x04,
+  0x0b, 0x14, 0xf6, 0xff, 0xf9, 0x25, 0x01, 0x14, 0xeb, 0xdf, 0xf3, 0xed,
+  0x0a, 0xf5, 0xfd, 0xb9, 0x21, 0x0b, 0xdc, 0xe3, 0x0e, 0x07, 0xde, 0x02,
+  0xfb, 0xfc, 0x24, 0xd5, 0xed, 0xb6, 0x09, 0x14, 0x01, 0x06, 0xec, 0x02,
+  0xea, 0x1f, 0xdb, 0x07, 0x12, 0x11, 0x0c, 0xdc, 0x12, 0x32, 0xe5, 0xda,
+  0x09, 0xfc, 0x29, 0x0f, 0x02, 0xef, 0xf3, 0xc2, 0xe5, 0x07, 0x09, 0x04,
+  0x11, 0x09, 0x20, 0xab, 0xfa, 0x0b, 0x1e, 0xe8, 0x5c, 0xea, 0x2a, 0xf0,
+  0xe6, 0xd2, 0xcb, 0xf3, 0x08, 0xff, 0x2b, 0xfd, 0x15, 0xe7, 0xfd, 0xf3,
+  0x0a, 0xf9, 0x09, 0xd7, 0xc6, 0xe8, 0xf1, 0xde, 0xd8, 0x07, 0x0d, 0x04,
+  0xf8, 0x22, 0x3e, 0xed, 0x15, 0x1d, 0xdd, 0xbf, 0x10, 0x04, 0xe8, 0x01,
+  0x02, 0x04, 0xb7, 0x35, 0xf4, 0x1b, 0xff, 0xf5, 0x46, 0x36, 0x1e, 0xe9,
+  0x08, 0xf0, 0xf5, 0x07, 0x10, 0xf2, 0x02, 0xed, 0xec, 0xec, 0x18, 0x06,
+  0x5c, 0xce, 0x31, 0x00, 0xe9, 0xd0, 0xf7, 0xcc, 0x2f, 0x1d, 0x05, 0x00,
+  0x10, 0x3a, 0x04, 0xb2, 0xa7, 0xa7, 0x0e, 0xeb, 0xd3, 0xcc, 0x07, 0x0a,
+  0x25, 0xff, 0xe4, 0x34, 0x0d, 0xee, 0xeb, 0x1e, 0xed, 0x0d, 0xe9, 0xff,
+  0xf4, 0x12, 0xf0, 0xfa, 0x11, 0x25, 0xed, 0x04, 0x10, 0x35, 0xf6, 0x01,
+  0xbc, 0xff, 0x03, 0xfd, 0x14, 0x2b, 0xe8, 0x1a, 0xf6, 0x3c, 0x03, 0xe7,
+  0xea, 0x24, 0x09, 0x07, 0x1d, 0x12, 0x07, 0xf7, 0xed, 0xe6, 0x07, 0xbb,
+  0x29, 0x0c, 0xf8, 0xde, 0x29, 0x02, 0xf3, 0x06, 0xe8, 0xf8, 0x36, 0xe7,
+  0xc9, 0xe7, 0x04, 0x08, 0x27, 0x0a, 0xf8, 0x04, 0xfa, 0xd9, 0x01, 0xfc,
+  0x07, 0xfe, 0xd4, 0x17, 0xee, 0xf5, 0x05, 0xe9, 0xe2, 0xf4, 0xe4, 0x09,
+  0xe7, 0x1b, 0x5f, 0x00, 0xec, 0xd1, 0xdd, 0xdb, 0x13, 0x3d, 0x0a, 0x07,
+  0x51, 0x02, 0x1f, 0xcd, 0xc1, 0x09, 0x06, 0x1a, 0x0c, 0xc7, 0x14, 0xe4,
+  0xed, 0xe2, 0x05, 0xd6, 0x40, 0x20, 0x04, 0xe9, 0x46, 0x2c, 0xe5, 0xdd,
+  0xdf, 0xc7, 0xf5, 0xe5, 0xbf, 0xf0, 0x00, 0xf0, 0x00, 0xce, 0xf4, 0x49,
+  0xe7, 0x13, 0xb3, 0xe4, 0xec, 0x21, 0xf0, 0xdd, 0x09, 0xe7, 0x13, 0x85,
+  0x0d, 0x0f, 0x03, 0x05, 0xd3, 0x56, 0x13, 0x3b, 0x04, 0xe4, 0xd6, 0xda,
+  0x22, 0xfb, 0x1d, 0xe1, 0xf0, 0xfe, 0x4f, 0xfb, 0xba, 0xee, 0x14, 0xe4,
+  0x0f, 0xd0, 0x2f, 0x39, 0x05, 0x03, 0xed, 0xe0, 0x1d, 0xef, 0x2a, 0x26,
+  0x18, 0x1c, 0xf1, 0xed, 0xfc, 0x09, 0x12, 0xf9, 0xd9, 0xfb, 0xda, 0xe5,
+  0xe1, 0xed, 0xf3, 0x07, 0x04, 0xd7, 0x25, 0x04, 0xc6, 0xfa, 0xee, 0x17,
+  0xe0, 0x21, 0x30, 0xe2, 0x09, 0xf8, 0xf1, 0x0e, 0xcc, 0xf9, 0x3f, 0xde,
+  0x02, 0x11, 0x03, 0xed, 0x0a, 0xd1, 0x30, 0x2d, 0x29, 0x18, 0x33, 0xe2,
+  0xe2, 0xfb, 0x30, 0x35, 0xec, 0x1d, 0x16, 0xeb, 0xde, 0xfb, 0xe9, 0xd9,
+  0x20, 0x20, 0x14, 0xf0, 0xe9, 0x02, 0x09, 0xf5, 0x02, 0xf8, 0xfe, 0xc9,
+  0xc5, 0xd4, 0x08, 0xef, 0x03, 0x01, 0xd8, 0xd4, 0xfc, 0x18, 0xe3, 0x4b,
+  0xda, 0x3e, 0xf4, 0x06, 0x11, 0xf9, 0xe9, 0x00, 0x18, 0x11, 0xed, 0x0f,
+  0xef, 0x03, 0x14, 0xfa, 0xf7, 0x14, 0x22, 0xd2, 0xed, 0x01, 0x06, 0xf8,
+  0x10, 0x37, 0xd1, 0xfc, 0xf2, 0xdf, 0xf5, 0xec, 0x0b, 0xfb, 0x11, 0xf5,
+  0xe9, 0xea, 0xe3, 0xeb, 0x07, 0x3d, 0xe3, 0xc9, 0x2a, 0x2d, 0xdf, 0xec,
+  0x15, 0xd3, 0x0f, 0xdb, 0xff, 0x01, 0xdf, 0x28, 0x05, 0x1e, 0x08, 0x16,
+  0xeb, 0x0b, 0x10, 0x07, 0x19, 0x29, 0x04, 0xea, 0x1b, 0xe6, 0xf9, 0xdb,
+  0x13, 0xfe, 0xa0, 0x2a, 0xe3, 0xfc, 0xf2, 0x02, 0xfd, 0xf0, 0x15, 0xe6,
+  0x13, 0xe9, 0xf3, 0xcb, 0x1f, 0xe1, 0xf3, 0x03, 0x23, 0xdd, 0x13, 0x0d,
+  0x11, 0x0d, 0x1b, 0x1f, 0xec, 0xfc, 0xdd, 0xd8, 0x09, 0x0c, 0xed, 0xd8,
+  0x02, 0x1e, 0xda, 0xd5, 0x02, 0xe9, 0x01, 0xf7, 0xba, 0x0e, 0x23, 0xe0,
+  0xd8, 0x05, 0x19, 0x10, 0x10, 0x32, 0x15, 0xf5, 0x02, 0x1d, 0x09, 0xf5,
+  0x29, 0x1c, 0x0a, 0xd5, 0x25, 0x1a, 0xf0, 0x20, 0xfa, 0x1b, 0xe6, 0xc8,
+  0x2b, 0xf6, 0xf7, 0xeb, 0xe7, 0xeb, 0x18, 0xde, 0xf9, 0xdc, 0xf5, 0x05,
+  0x05, 0xcf, 0xe0, 0xe3, 0xfa, 0xef, 0xff, 0x26, 0xee, 0xe4, 0xf5, 0xe9,
+  0xca, 0x1a, 0x05, 0x13, 0x06, 0x15, 0xaf, 0xe9, 0xf9, 0xc8, 0x24, 0x35,
+  0xe8, 0x1e, 0x0a, 0xab, 0xef, 0xcc, 0x01, 0x27, 0x14, 0x0b, 0xfd, 0xf0,
+  0xd4, 0x10, 0xd5, 0x0d, 0x04, 0x09, 0x09, 0xdb, 0x08, 0xf2, 0xe5, 0xf3,
+  0xeb, 0x2b, 0x1a, 0x13, 0xf9, 0x01, 0x0f, 0xdd, 0x19, 0xed, 0xfa, 0xe2,
+  0x20, 0x05, 0x1a, 0xf0, 0xdb, 0xe5, 0x07, 0xfc, 0x19, 0xd5, 0x15, 0xd0,
+  0xd6, 0xcb, 0xe1, 0xf6, 0x16, 0x0b, 0x3f, 0xee, 0x3c, 0xf8, 0xfe, 0xda,
+  0xc7, 0xf8, 0xf1, 0xe5, 0x05, 0xe1, 0x40, 0x0b, 0x11, 0xe6, 0x01, 0xe5,
+  0x28, 0xfd, 0x1b, 0xfb, 0x07, 0x1d, 0xd7, 0x2d, 0xe9, 0x09, 0xea, 0x13,
+  0x20, 0x28, 0xf6, 0x2e, 0xed, 0x1f, 0xc3, 0x0e, 0xda, 0xcd, 0xee, 0xdc,
+  0xdc, 0xe0, 0x07, 0x46, 0x2e, 0x10, 0x05, 0xf3, 0xd0, 0xf5, 0xf2, 0x12,
+  0x03, 0xe1, 0x1a, 0xd2, 0xcb, 0xfd, 0xdf, 0xd8, 0xbe, 0x14, 0xe4, 0xa9,
+  0x21, 0xf9, 0x26, 0xe6, 0xe0, 0xf2, 0x1a, 0x10, 0xf4, 0xfc, 0xdf, 0x04,
+  0x18, 0x10, 0xc1, 0xf5, 0xe9, 0x14, 0xd2, 0xde, 0x29, 0xf6, 0x0d, 0x1b,
+  0xc1, 0x25, 0x2f, 0x04, 0xe9, 0x32, 0xfe, 0x0d, 0xd5, 0x19, 0xf7, 0xd9,
+  0xc3, 0xe4, 0xed, 0xd6, 0xd5, 0x06, 0x34, 0xfa, 0x19, 0x3c, 0x09, 0xc4,
+  0xf3, 0x1c, 0xf5, 0xdf, 0xf4, 0xf0, 0x04, 0x14, 0x1b, 0xf6, 0x00, 0xce,
+  0xf2, 0x50, 0x20, 0xec, 0x11, 0xeb, 0x1e, 0x06, 0xf2, 0xb2, 0x0d, 0xeb,
+  0xee, 0xfa, 0xf3, 0xf8, 0xf1, 0xfd, 0x11, 0x05, 0xf1, 0x14, 0x01, 0x17,
+  0xdd, 0xf8, 0xe8, 0xe5, 0x02, 0xe8, 0x11, 0x02, 0xd9, 0xda, 0x08, 0xed,
+  0xea, 0x02, 0x2a, 0xff, 0x05, 0xde, 0x05, 0x10, 0xee, 0x01, 0xe7, 0xe7,
+  0xf2, 0xd8, 0x1c, 0x0f, 0x17, 0xda, 0x15, 0xe9, 0xd6, 0xf5, 0x0b, 0xfa,
+  0xde, 0xe3, 0x03, 0x12, 0x00, 0xef, 0x25, 0xf1, 0xe4, 0x08, 0x16, 0xec,
+  0xe2, 0x15, 0xfb, 0x13, 0xc9, 0xd8, 0x1f, 0xde, 0xec, 0x15, 0xd1, 0x0c,
+  0x03, 0xda, 0xe8, 0x1e, 0x1d, 0xe5, 0x01, 0xdb, 0x00, 0x05, 0x3e, 0xf9,
+  0x1c, 0xed, 0xf4, 0xf2, 0xef, 0xec, 0xe9, 0x05, 0x19, 0xda, 0x23, 0xf0,
+  0xfc, 0xe4, 0x23, 0x07, 0x37, 0x22, 0x40, 0xf0, 0xd7, 0xde, 0x21, 0x2f,
+  0x1d, 0xf7, 0xfa, 0xcc, 0xeb, 0xdf, 0xf8, 0x08, 0x10, 0x05, 0xeb, 0xfb,
+  0x06, 0xf6, 0x06, 0xd8, 0x01, 0xb7, 0x1c, 0xec, 0xe4, 0xb0, 0xe5, 0x32,
+  0x09, 0x11, 0xfb, 0xfb, 0xe5, 0x1e, 0x01, 0x0a, 0xe0, 0xd3, 0x02, 0x33,
+  0x2d, 0x3d, 0x19, 0xe1, 0x00, 0x04, 0xd7, 0x43, 0xce, 0x31, 0x00, 0xbb,
+  0x05, 0xde, 0x03, 0xcd, 0x03, 0xe4, 0x0b, 0x36, 0x09, 0xfb, 0x12, 0xf1,
+  0xd8, 0xd3, 0xd5, 0x10, 0x02, 0x1a, 0xf7, 0xee, 0xdb, 0xe4, 0xee, 0xd6,
+  0xf3, 0x02, 0xeb, 0xe0, 0xe2, 0xe6, 0xf2, 0xe3, 0xfa, 0xd8, 0x18, 0x05,
+  0xf4, 0xc6, 0x14, 0xee, 0xf3, 0x0d, 0x33, 0x49, 0xf4, 0x47, 0xf9, 0xe8,
+  0x25, 0xf9, 0xca, 0xf3, 0x18, 0x0d, 0xfc, 0x0f, 0xfb, 0x2d, 0xc8, 0x23,
+  0xf9, 0xef, 0xf5, 0xf3, 0xd9, 0x03, 0xe6, 0xde, 0x24, 0xef, 0xee, 0xf2,
+  0x23, 0xbc, 0x2d, 0xee, 0xfc, 0x1f, 0x1d, 0xf0, 0x6b, 0xdb, 0x54, 0x0d,
+  0x0e, 0xcc, 0xc8, 0xef, 0xfe, 0x00, 0xf7, 0xf8, 0x2e, 0xff, 0x18, 0xd7,
+  0xdb, 0xa0, 0xed, 0x07, 0xfe, 0xf4, 0xd8, 0x15, 0x0a, 0x29, 0x30, 0x1d,
+  0xdd, 0xf7, 0x34, 0xd9, 0xfd, 0xe4, 0x03, 0xdf, 0x2b, 0x08, 0x19, 0x3d,
+  0x03, 0x1b, 0x06, 0xef, 0xf3, 0xef, 0x02, 0xeb, 0xfb, 0x11, 0x1c, 0xf1,
+  0x26, 0xf8, 0xec, 0xfb, 0xfb, 0x01, 0x2e, 0xdf, 0x00, 0x01, 0x0a, 0xf6,
+  0x22, 0x16, 0xf9, 0xf6, 0x02, 0xe8, 0x10, 0xd0, 0xf1, 0xf6, 0xe5, 0xef,
+  0xe3, 0xfe, 0x0f, 0xee, 0x24, 0xe6, 0xec, 0x07, 0x0e, 0xf3, 0x04, 0xfd,
+  0x29, 0x55, 0xfc, 0xf5, 0xe5, 0x0c, 0xfa, 0x1a, 0x13, 0x18, 0xf1, 0xe6,
+  0xc8, 0x16, 0x39, 0xf7, 0x09, 0x2c, 0xfb, 0x10, 0x0e, 0x1a, 0xff, 0x38,
+  0x0a, 0x02, 0x04, 0xeb, 0x14, 0xdc, 0x4b, 0xf2, 0xf3, 0x12, 0xe5, 0xff,
+  0xeb, 0xf4, 0xfd, 0x2c, 0xa5, 0x15, 0x00, 0x1b, 0xef, 0xfd, 0xe1, 0xd2,
+  0x16, 0xf9, 0x18, 0xe9, 0x0c, 0xf3, 0x02, 0xe1, 0x10, 0xf4, 0xe2, 0x25,
+  0x11, 0xef, 0x0d, 0xf3, 0x17, 0xe8, 0xf1, 0x16, 0x32, 0xe0, 0x01, 0x01,
+  0x39, 0x0e, 0xee, 0x07, 0xf6, 0x19, 0xda, 0x0e, 0x0c, 0x02, 0xee, 0xe9,
+  0x40, 0xff, 0x0b, 0x02, 0x01, 0x12, 0xdf, 0x04, 0xf6, 0xce, 0x0f, 0x11,
+  0xe1, 0xf4, 0x1c, 0x17, 0x31, 0x15, 0x0d, 0x35, 0xe1, 0xfa, 0xeb, 0x1f,
+  0x26, 0xdc, 0x12, 0x0b, 0xf3, 0xf6, 0x1b, 0xe2, 0x08, 0xe5, 0x0b, 0x00,
+  0x01, 0xf4, 0xe4, 0x00, 0xdc, 0xe9, 0xe9, 0xed, 0xf7, 0x17, 0xf4, 0x1a,
+  0xf8, 0x16, 0x15, 0x35, 0xf5, 0x1e, 0xe3, 0x62, 0x9a, 0xda, 0x19, 0xd5,
+  0x0a, 0xfd, 0xf3, 0xd9, 0x01, 0x0a, 0x14, 0xf7, 0xe3, 0x0d, 0xfc, 0xf8,
+  0xeb, 0x0d, 0x0c, 0xc8, 0x45, 0x04, 0x0d, 0xe1, 0xde, 0x12, 0xf8, 0xd5,
+  0x0b, 0xf3, 0x33, 0x21, 0x0a, 0xe7, 0xeb, 0x13, 0x08, 0x32, 0x3e, 0xee,
+  0x33, 0x01, 0x02, 0xe6, 0x05, 0x1b, 0x10, 0x0f, 0x04, 0x14, 0x01, 0x25,
+  0x02, 0x1e, 0x16, 0x2b, 0x15, 0x02, 0xf3, 0xee, 0x0f, 0xf1, 0xf8, 0x44,
+  0x11, 0x21, 0xf1, 0xea, 0x26, 0xf7, 0x29, 0xd3, 0xec, 0x1a, 0xfc, 0x0f,
+  0x0b, 0xf7, 0xe0, 0xed, 0xfa, 0xe3, 0x16, 0x12, 0xe7, 0xfc, 0x30, 0xec,
+  0x08, 0x18, 0x05, 0x22, 0x0b, 0x17, 0xf3, 0x32, 0x2d, 0xfd, 0xe3, 0xf8,
+  0x01, 0xed, 0x15, 0x14, 0x00, 0xe7, 0x23, 0x20, 0x1d, 0x42, 0x07, 0xea,
+  0xd1, 0xf9, 0x15, 0xd8, 0xd6, 0xe0, 0x6d, 0x2e, 0xc4, 0x22, 0x0e, 0x0d,
+  0xd0, 0x13, 0xff, 0xd8, 0x3a, 0xf7, 0x09, 0xee, 0x1a, 0x09, 0xdb, 0x35,
+  0xea, 0xf2, 0x38, 0x12, 0xfd, 0x04, 0x11, 0xca, 0x05, 0xf9, 0xf9, 0x08,
+  0x33, 0xf1, 0x1e, 0xde, 0xdd, 0xc8, 0x25, 0xf1, 0x21, 0xec, 0x41, 0xed,
+  0xe5, 0xef, 0xc5, 0xfe, 0x05, 0xf0, 0xdf, 0xcc, 0x00, 0x28, 0x1d, 0xb7,
+  0xd3, 0xe5, 0xfc, 0xc7, 0xdd, 0xa9, 0xd2, 0xd9, 0x03, 0x07, 0xf6, 0xe4,
+  0xb8, 0x36, 0x3b, 0xeb, 0xcb, 0xdd, 0xe4, 0x0f, 0x03, 0x15, 0x0a, 0x00,
+  0x04, 0x05, 0xe7, 0x2f, 0xdd, 0xfb, 0x41, 0xe4, 0xd5, 0x16, 0x27, 0xe3,
+  0x1c, 0xcf, 0x02, 0x1e, 0x38, 0xf7, 0x1d, 0xdf, 0x33, 0xe3, 0x1e, 0x4d,
+  0x10, 0x15, 0x2a, 0xf9, 0xfc, 0xd4, 0xdf, 0xf2, 0xef, 0x22, 0xd7, 0xe4,
+  0x22, 0x23, 0xef, 0xd7, 0x00, 0xbf, 0xe3, 0xf4, 0x16, 0x0f, 0x02, 0xf0,
+  0x24, 0x05, 0x3e, 0x0e, 0x02, 0x19, 0xbe, 0xdd, 0xe0, 0xe2, 0xe1, 0x40,
+  0x2a, 0x0a, 0xcf, 0xc6, 0xd8, 0xfa, 0xc1, 0x1e, 0x0d, 0x1b, 0x00, 0x0a,
+  0xe1, 0x00, 0xe2, 0xf0, 0x0e, 0x02, 0x05, 0x04, 0xdc, 0xe3, 0xec, 0x24,
+  0xfd, 0xc9, 0xf9, 0xd6, 0xff, 0xdb, 0x19, 0x0d, 0xe7, 0x07, 0xe7, 0x08,
+  0xdd, 0xd9, 0xff, 0xf4, 0xf4, 0x09, 0xec, 0x06, 0x04, 0xd6, 0x52, 0x1b,
+  0x1a, 0x1e, 0xc5, 0xff, 0x09, 0x02, 0x17, 0xe1, 0xfe, 0xfb, 0xf9, 0xfb,
+  0x03, 0xf3, 0x13, 0x02, 0x13, 0x0a, 0x0a, 0x13, 0x1a, 0x24, 0xf7, 0x1a,
+  0xb7, 0x11, 0x1c, 0xd7, 0x08, 0xde, 0xea, 0xd5, 0x01, 0xef, 0x24, 0x22,
+  0x15, 0xe1, 0x1a, 0x2b, 0x13, 0xae, 0xcb, 0x0f, 0xd2, 0xf7, 0xd9, 0xf8,
+  0xfb, 0xeb, 0xff, 0x02, 0x00, 0xf8, 0xd4, 0x18, 0xf0, 0xe9, 0xff, 0xf6,
+  0x10, 0x0a, 0x04, 0xfe, 0xcf, 0x0c, 0xd7, 0xee, 0xed, 0xe7, 0x25, 0x2b,
+  0x12, 0x2d, 0x0a, 0xff, 0xdf, 0x0e, 0xdc, 0x0b, 0x1c, 0x1f, 0x0a, 0xf2,
+  0x02, 0x29, 0xf4, 0x07, 0x47, 0x01, 0x1d, 0x24, 0x55, 0x08, 0xf2, 0xe1,
+  0x53, 0xdb, 0x39, 0xea, 0xe0, 0xd9, 0x12, 0xe7, 0xc9, 0xcc, 0x21, 0x17,
+  0x0b, 0x2e, 0x1c, 0xe9, 0xf8, 0xe4, 0xad, 0x10, 0xf0, 0x20, 0x21, 0xfc,
+  0x1c, 0x35, 0xc5, 0xd5, 0xd6, 0xfa, 0xfa, 0xfb, 0xee, 0xeb, 0x29, 0xc5,
+  0xc1, 0xde, 0xdd, 0x23, 0xf9, 0x11, 0x07, 0x29, 0xfa, 0xf2, 0x0c, 0xea,
+  0x02, 0x10, 0x11, 0xd6, 0x29, 0x00, 0x00, 0xf2, 0xcd, 0x18, 0x1b, 0xdd,
+  0xf7, 0x11, 0xe5, 0xf6, 0xec, 0x0c, 0x20, 0xe1, 0xca, 0x07, 0x19, 0xe7,
+  0xff, 0xf3, 0xfb, 0xfb, 0x0a, 0xc8, 0x11, 0xfa, 0xc3, 0xdd, 0xe4, 0x26,
+  0xfd, 0x13, 0x0a, 0xde, 0x1f, 0xd4, 0xe6, 0x14, 0xd7, 0x05, 0x31, 0xf6,
+  0x22, 0xf9, 0xfc, 0xfa, 0x06, 0x0a, 0x32, 0xeb, 0x12, 0xd0, 0x18, 0xf8,
+  0xe9, 0xf0, 0xfe, 0x0f, 0x1e, 0x14, 0xe8, 0x26, 0x07, 0x01, 0x06, 0xf6,
+  0x16, 0xff, 0x39, 0xf6, 0xff, 0x17, 0x19, 0xce, 0xf5, 0xf7, 0x07, 0xf7,
+  0x15, 0x15, 0xf3, 0xf7, 0x0b, 0x19, 0x1c, 0x31, 0x18, 0xf9, 0x10, 0xec,
+  0x25, 0xf6, 0xf0, 0xf3, 0x16, 0xf3, 0x01, 0xe0, 0x0f, 0xf3, 0x21, 0xff,
+  0x09, 0xf4, 0xd7, 0x0a, 0xdb, 0x09, 0xc2, 0x18, 0x07, 0xdb, 0x18, 0xef,
+  0xe5, 0x0b, 0x26, 0x24, 0xf4, 0x2c, 0xce, 0x0a, 0x30, 0x13, 0x1a, 0xf0,
+  0xf5, 0x1b, 0xdf, 0x13, 0x08, 0x10, 0xf7, 0x0e, 0xec, 0x0e, 0xea, 0xf0,
+  0x2f, 0xdb, 0x0a, 0x24, 0x13, 0x0b, 0x23, 0xec, 0xe1, 0xe7, 0x1e, 0x03,
+  0x10, 0x26, 0x06, 0xf8, 0xe3, 0xd9, 0xe0, 0x11, 0x1a, 0x32, 0xff, 0xd3,
+  0xfd, 0x1f, 0xeb, 0xf1, 0x0f, 0xf0, 0x15, 0xf4, 0x11, 0xdf, 0x1c, 0xfb,
+  0x06, 0xec, 0xdc, 0xfa, 0x28, 0xf0, 0x01, 0x05, 0x24, 0x19, 0x01, 0xf9,
+  0x35, 0x26, 0xf6, 0xe7, 0x11, 0x03, 0x13, 0x14, 0xf5, 0x08, 0x03, 0x2b,
+  0x10, 0x05, 0xb7, 0x11, 0x30, 0x0f, 0x37, 0xe1, 0xb7, 0x00, 0x08, 0x16,
+  0xbc, 0x17, 0xf1, 0x00, 0xcf, 0x15, 0xfb, 0xf7, 0xdd, 0xf0, 0xdc, 0x0e,
+  0x12, 0xdc, 0x37, 0xf9, 0xe8, 0x11, 0xe1, 0xe2, 0x2f, 0xfb, 0x24, 0x25,
+  0x1f, 0xe0, 0x21, 0xc0, 0x0c, 0xe1, 0x15, 0x31, 0xf4, 0xfc, 0x01, 0x1a,
+  0xef, 0xec, 0xd4, 0x01, 0xf8, 0x17, 0x01, 0x0a, 0x04, 0x15, 0xfa, 0x19,
+  0x0a, 0x0b, 0x32, 0x16, 0xe9, 0xef, 0xec, 0xde, 0xf2, 0xf5, 0xec, 0xae,
+  0xe1, 0x26, 0x24, 0xf9, 0xff, 0xff, 0x2b, 0x05, 0xf4, 0xd6, 0x22, 0xea,
+  0xd9, 0xbc, 0xeb, 0xfc, 0xf3, 0x20, 0x2a, 0xbf, 0x19, 0x13, 0xfa, 0xcd,
+  0xcb, 0xe5, 0xe1, 0x07, 0x06, 0xe3, 0x11, 0xf9, 0xd8, 0xe8, 0x3f, 0x10,
+  0xea, 0x1b, 0x09, 0x41, 0x14, 0xf0, 0x15, 0xf1, 0x2b, 0xd2, 0xcf, 0xec,
+  0x37, 0xe8, 0xcc, 0x46, 0x03, 0x05, 0xe3, 0xff, 0xfd, 0x21, 0x0e, 0xf9,
+  0xfa, 0x03, 0xdd, 0x10, 0xf4, 0xc1, 0x11, 0x1d, 0x02, 0xe4, 0xf2, 0xe4,
+  0x49, 0x0b, 0x1c, 0x18, 0xfd, 0xfe, 0xf6, 0xfc, 0x0d, 0xf2, 0x03, 0xf3,
+  0xf1, 0x1c, 0xef, 0xe6, 0xef, 0xd1, 0xfe, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0xe6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x34, 0xfa, 0xff, 0xff, 0xe8, 0xf8, 0xff, 0xff, 0x7d, 0xfb, 0xff, 0xff,
+  0x1f, 0xf9, 0xff, 0xff, 0xeb, 0xfc, 0xff, 0xff, 0xfd, 0xf8, 0xff, 0xff,
+  0x7b, 0xf6, 0xff, 0xff, 0x05, 0xf3, 0xff, 0xff, 0x92, 0x03, 0x00, 0x00,
+  0x66, 0xf7, 0xff, 0xff, 0x0f, 0xfa, 0xff, 0xff, 0xde, 0xec, 0xff, 0xff,
+  0xc6, 0xff, 0xff, 0xff, 0xe0, 0xf8, 0xff, 0xff, 0x49, 0xf2, 0xff, 0xff,
+  0xe5, 0xf6, 0xff, 0xff, 0x7f, 0xf2, 0xff, 0xff, 0x71, 0xf9, 0xff, 0xff,
+  0xc2, 0x04, 0x00, 0x00, 0xd4, 0xf9, 0xff, 0xff, 0x22, 0xf5, 0xff, 0xff,
+  0x48, 0xf8, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xff, 0xf2, 0xfd, 0xff, 0xff,
+  0x19, 0xf9, 0xff, 0xff, 0x62, 0xf2, 0xff, 0xff, 0xe4, 0xf3, 0xff, 0xff,
+  0xf7, 0xf9, 0xff, 0xff, 0x67, 0xfd, 0xff, 0xff, 0x51, 0xfe, 0xff, 0xff,
+  0x8a, 0xf2, 0xff, 0xff, 0x96, 0xf7, 0xff, 0xff, 0x49, 0xf7, 0xff, 0xff,
+  0x1e, 0xfe, 0xff, 0xff, 0xc8, 0xfb, 0xff, 0xff, 0x5f, 0xf9, 0xff, 0xff,
+  0xfa, 0xfb, 0xff, 0xff, 0xd1, 0xf9, 0xff, 0xff, 0x65, 0xf2, 0xff, 0xff,
+  0x35, 0xf2, 0xff, 0xff, 0x36, 0xfd, 0xff, 0xff, 0x02, 0xf2, 0xff, 0xff,
+  0xad, 0xf5, 0xff, 0xff, 0xe1, 0x02, 0x00, 0x00, 0x30, 0xfc, 0xff, 0xff,
+  0x88, 0xf7, 0xff, 0xff, 0xcb, 0xf8, 0xff, 0xff, 0xdf, 0xf2, 0xff, 0xff,
+  0x8b, 0xf2, 0xff, 0xff, 0x7d, 0xf4, 0xff, 0xff, 0xb5, 0xf4, 0xff, 0xff,
+  0xcd, 0xfe, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xed, 0xf1, 0xff, 0xff,
+  0x3e, 0xf2, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x49, 0xf8, 0xff, 0xff,
+  0x44, 0xf8, 0xff, 0xff, 0xc8, 0x01, 0x00, 0x00, 0x9d, 0xfd, 0xff, 0xff,
+  0x98, 0xf5, 0xff, 0xff, 0x64, 0x0b, 0x00, 0x00, 0xa6, 0xf0, 0xff, 0xff,
+  0x46, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xb0, 0xda, 0x0d, 0x03, 0x08, 0x9c, 0x9d, 0xee, 0xe3, 0xeb, 0x1b, 0xd7,
+  0xce, 0x11, 0xf6, 0xbe, 0x33, 0xbd, 0x3a, 0x17, 0x39, 0x20, 0xfd, 0xcc,
+  0x7f, 0x26, 0xff, 0xdb, 0xf4, 0x1b, 0x08, 0x22, 0xb9, 0xef, 0xf4, 0xfc,
+  0xa6, 0x09, 0xfa, 0xf2, 0xcf, 0xec, 0x06, 0xe7, 0x27, 0x42, 0xf0, 0xe0,
+  0x14, 0xeb, 0x00, 0xc2, 0xc8, 0xe6, 0xc8, 0xfd, 0x07, 0xbd, 0x43, 0x2f,
+  0x3f, 0x02, 0x44, 0x0b, 0x38, 0xc2, 0xdf, 0x1a, 0xeb, 0x0e, 0x1a, 0x08,
+  0xfd, 0x0d, 0xa3, 0x00, 0xce, 0xe1, 0xd2, 0x24, 0x3a, 0xe6, 0x8e, 0xd5,
+  0xf7, 0x32, 0xbc, 0x0f, 0x2d, 0xf1, 0x2f, 0xde, 0xf8, 0x3c, 0xbe, 0xe6,
+  0xe5, 0xc4, 0xfc, 0xef, 0x4f, 0x10, 0x4b, 0x29, 0xe9, 0x39, 0xf1, 0xd1,
+  0xcc, 0x1c, 0x21, 0xef, 0x21, 0x8e, 0x36, 0xfb, 0x01, 0xb8, 0x15, 0xb8,
+  0xd2, 0xc6, 0x33, 0xed, 0xe8, 0x11, 0xd2, 0xd4, 0x1b, 0xf8, 0xfb, 0x05,
+  0x09, 0x60, 0x34, 0xe9, 0x22, 0xf1, 0x35, 0xfd, 0xd1, 0xc7, 0x5c, 0x10,
+  0xfb, 0xfb, 0xeb, 0xe8, 0xf5, 0xfb, 0x05, 0xf9, 0x1f, 0x09, 0xd3, 0xd8,
+  0x3d, 0xf9, 0x22, 0x4e, 0x31, 0xff, 0x1e, 0xad, 0xff, 0x41, 0x08, 0xdd,
+  0x01, 0x29, 0x06, 0x39, 0xd8, 0xf7, 0xb7, 0x18, 0xe9, 0xef, 0x4f, 0x0e,
+  0x1f, 0xa1, 0xff, 0x03, 0xf8, 0xff, 0x21, 0x0d, 0xef, 0x15, 0x29, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff,
+  0x1a, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x2f, 0x6d, 0x61,
+  0x6b, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x5f, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x2e, 0x63, 0x63, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x48, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x9c, 0x08, 0x00, 0x00,
+  0x28, 0x08, 0x00, 0x00, 0xbc, 0x07, 0x00, 0x00, 0x58, 0x07, 0x00, 0x00,
+  0xf4, 0x06, 0x00, 0x00, 0x98, 0x06, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00,
+  0xc8, 0x05, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00,
+  0xa4, 0x04, 0x00, 0x00, 0x48, 0x04, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00,
+  0x7c, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00,
+  0x60, 0x02, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x5c, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd2, 0xf7, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xc4, 0xf7, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd6, 0xcb, 0x8b, 0x3d,
+  0x06, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x67, 0x69, 0x74, 0x73, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x8e, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x14, 0xf8, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xce, 0x9c, 0x06, 0x39, 0x0a, 0x00, 0x00, 0x00,
+  0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xde, 0xf8, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x48, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0xf8, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xce, 0x9c, 0x86, 0x3c, 0x0d, 0x00, 0x00, 0x00,
+  0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
+  0x73, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xca, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xbc, 0xf8, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x04, 0x00, 0x00, 0x00,
+  0x6c, 0x73, 0x74, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x1a, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0c, 0xf9, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x0b, 0x00, 0x00, 0x00,
+  0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xf9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x5c, 0xf9, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x39, 0x10, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x67, 0x61, 0x74, 0x65,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc2, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb4, 0xf9, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x39, 0x0e, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x63, 0x65, 0x6c, 0x6c, 0x5f, 0x67, 0x61, 0x74, 0x65, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfa, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0xfa, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x39, 0x10, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x61, 0x74, 0x65,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5c, 0xfa, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x67, 0x61, 0x74, 0x65, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x07, 0x01, 0x44, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xac, 0xfa, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3b, 0x0f, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x63, 0x65, 0x6c, 0x6c, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01,
+  0x48, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x14, 0xfb, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0x11, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xee, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x54, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x74, 0xfb, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x38, 0x50, 0x34, 0x3c,
+  0x18, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x72, 0x65, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x56, 0xfc, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xfb, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xca, 0x1a, 0x51, 0x39, 0x10, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x61, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xae, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x34, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xca, 0x1a, 0xd1, 0x3c, 0x14, 0x00, 0x00, 0x00,
+  0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x74,
+  0x6f, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0e, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x94, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x9b, 0x47, 0x3c, 0x16, 0x00, 0x00, 0x00,
+  0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x72, 0x65, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x63, 0x65, 0x6c, 0x6c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x6e, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xf4, 0xfc, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0x34, 0x90, 0x39,
+  0x0e, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x63, 0x65, 0x6c,
+  0x6c, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xc6, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x4c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4c, 0xfd, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xfd, 0x34, 0x10, 0x3d, 0x12, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x63, 0x65,
+  0x6c, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x26, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x54, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xac, 0xfd, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x51, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x72, 0x65, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74,
+  0x6f, 0x5f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x8e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x14, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xaa, 0xe1, 0x6f, 0x39, 0x10, 0x00, 0x00, 0x00,
+  0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x5f,
+  0x62, 0x69, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xe6, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6c, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0xe1, 0xef, 0x3c,
+  0x14, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x40, 0x51, 0x3c,
+  0x17, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x72, 0x65, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x19, 0x5d, 0x39, 0x0f, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d,
+  0x2f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x94, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x19, 0xdd, 0x3c,
+  0x13, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x48, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0x05, 0x00, 0x00, 0x00, 0x73, 0x74, 0x65, 0x70, 0x73, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2c, 0x2c, 0x00, 0x00, 0x00
+};
+unsigned int model_stroke_tflite_len = 21968;
@@ -0,0 +1,83 @@
+/*
+ * stroke.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Vector stroke capture. The touch points of the strokes are
+ *         recorded as they arrive and rasterized analytically, with the
+ *         coverage of the pen as anti-aliasing, straight into the 28x28
+ *         int8 model input. No framebuffer readback, rgb2gray or resize.
+ *         No HAL dependency, tools/stroke_equivalence.cc builds it on the
+ *         host to compare it with the pixel pipeline.
+ */
+
+
+#ifndef STROKE_H_
+#define STROKE_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+/* Points recorded until the next stroke_clear */
+#define STROKE_MAX_POINTS			1024U
+/* Largest input stroke_rasterize can fill, in pixels */
+#define STROKE_MAX_INPUT			(28U * 28U)
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* radius: pen radius in LCD pixels, as drawn by brush_stamp.
+ * The input pixel (i, j) samples the LCD at
+ *   (x + j * (width - 1) / in_width, y + i * (height - 1) / in_height)
+ * the same points resize_bilnear samples the captured working window at */
+void stroke_init (uint32_t radius, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/* Forgets every stroke (the working window was cleared) */
+void stroke_clear (void);
+
+/* Starts a stroke with a dot at x, y in color (ARGB8888) */
+void stroke_start (uint32_t x, uint32_t y, uint32_t color);
+
+/* Extends the current stroke with a segment to x, y */
+void stroke_continue (uint32_t x, uint32_t y);
+
+/* 1 if points were lost since stroke_clear, the strokes are then incomplete */
+uint8_t stroke_overflow (void);
+
+/* Rasterizes the strokes into input, in_width x in_height int8 pixels with
+ * the scaling of update_tensor_input: gray level + zero_point, the input
+ * tensor's zero point */
+void stroke_rasterize (int8_t * input, uint32_t in_width, uint32_t in_height, int32_t zero_point);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STROKE_H_ */
@@ -0,0 +1,94 @@
+/*
+ * stroke_sequence.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: The touch points of the strokes as timesteps of a sequence model,
+ *         for the stroke recognition of tools/make_stroke_model.cc. A step
+ *         is the pen move since the previous one and the pen state, three
+ *         int8 values, the model input with scale 1/128 and zero point 0:
+ *
+ *           dx, dy  STROKE_SEQ_UNIT per LCD pixel
+ *           pen     STROKE_SEQ_PEN_DOWN  the move was drawn
+ *                   STROKE_SEQ_PEN_UP    the pen moved to the start of a stroke
+ *                   STROKE_SEQ_PEN_END   the stroke ended, no move
+ *
+ *         Moves shorter than STROKE_SEQ_MIN_MOVE are merged into the next
+ *         one and longer than STROKE_SEQ_MAX_MOVE split, so the steps do
+ *         not depend much on the touch sample rate. No HAL dependency, the
+ *         tool builds it on the host to make its training sequences.
+ */
+
+
+#ifndef STROKE_SEQUENCE_H_
+#define STROKE_SEQUENCE_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+#define STROKE_SEQ_FEATURES			3U		/* dx, dy, pen */
+#define STROKE_SEQ_UNIT				8		/* int8 steps per LCD pixel */
+#define STROKE_SEQ_MIN_MOVE			2		/* LCD pixels, in x or y */
+#define STROKE_SEQ_MAX_MOVE			15		/* LCD pixels, in x and y */
+
+#define STROKE_SEQ_PEN_DOWN			127
+#define STROKE_SEQ_PEN_UP			0
+#define STROKE_SEQ_PEN_END			(-127)
+
+/* Most steps a call gives: a move across a 240 pixel wide screen */
+#define STROKE_SEQ_MAX_STEPS		16U
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* x, y: where the pen is before the first stroke, the working window center */
+void stroke_seq_init (uint32_t x, uint32_t y);
+
+/* Forgets the strokes, the pen is back at the init point */
+void stroke_seq_clear (void);
+
+/* The functions below write up to STROKE_SEQ_MAX_STEPS steps of
+ * STROKE_SEQ_FEATURES values in steps and return how many, the end step
+ * of stroke_seq_end included */
+
+/* A stroke starts at x, y: the pen up move there, at least one step */
+uint32_t stroke_seq_start (uint32_t x, uint32_t y, int8_t * steps);
+
+/* The stroke goes on to x, y: the drawn move, none while it is too short */
+uint32_t stroke_seq_continue (uint32_t x, uint32_t y, int8_t * steps);
+
+/* The pen was lifted: the rest of the move, if any, and the end step */
+uint32_t stroke_seq_end (int8_t * steps);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STROKE_SEQUENCE_H_ */
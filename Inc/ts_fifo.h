@@ -0,0 +1,87 @@
+/*
+ * ts_fifo.h
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Interrupt driven touch screen sampling. The STMPE811 FIFO is
+ *         drained in bursts (I2C DMA) from the touch interrupt and the
+ *         samples are handed to the main loop through a lock-free queue.
+ */
+
+
+#ifndef TS_FIFO_H_
+#define TS_FIFO_H_
+
+/*---------------------------------------------------------------------*
+ *  additional includes                                                *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/*---------------------------------------------------------------------*
+ *  global definitions                                                 *
+ *---------------------------------------------------------------------*/
+/* Samples in the STMPE811 FIFO that raise the interrupt (1..127) */
+#define TS_FIFO_THRESHOLD			4U
+/* Samples read from the controller in one I2C DMA burst */
+#define TS_FIFO_BURST				16U
+/* Samples in the queue to the main loop, power of 2 */
+#define TS_FIFO_QUEUE_SIZE			128U
+
+/* ts_sample_t flags */
+#define TS_SAMPLE_PEN_DOWN			0x01U	/* first sample of a stroke */
+#define TS_SAMPLE_PEN_UP			0x02U	/* end of stroke, no coordinates */
+
+/*---------------------------------------------------------------------*
+ *  type declarations                                                  *
+ *---------------------------------------------------------------------*/
+typedef struct
+{
+	uint16_t x;			/* screen coordinates, same mapping as BSP_TS_GetState */
+	uint16_t y;
+	uint32_t tick;		/* DWT cycle counter when the burst was drained */
+	uint8_t  flags;
+} ts_sample_t;
+
+/*---------------------------------------------------------------------*
+ *  function prototypes                                                *
+ *---------------------------------------------------------------------*/
+
+/* Call after BSP_TS_Init (Touchscreen_Calibration), it takes over the touch
+ * controller: BSP_TS_GetState must not be used afterwards */
+void ts_fifo_init (void);
+
+/* Moves up to max samples from the queue to samples, returns the count */
+uint32_t ts_fifo_read (ts_sample_t * samples, uint32_t max);
+
+/* Samples lost because the queue was full */
+uint32_t ts_fifo_dropped (void);
+
+/* CPU cycles spent on touch handling, in the interrupts and in
+ * ts_fifo_read, since boot */
+uint32_t ts_fifo_cpu_cycles (void);
+
+/* Adds cycles spent on touch outside this module (e.g. the polling path) */
+void ts_fifo_add_cpu_cycles (uint32_t cycles);
+
+/*---------------------------------------------------------------------*
+ *  global data                                                        *
+ *---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*
+ *  inline functions and function-like macros                          *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TS_FIFO_H_ */
@@ -0,0 +1,104 @@
+/*
+ * boot_trace.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Boot timeline.
+ *
+ *  The cycle counter runs at the core clock, which is the 16 MHz HSI until
+ *  SystemClock_Config switches to 168 MHz. Every phase is converted to us
+ *  with the clock it started with: the phase of the switch is counted at
+ *  16 MHz, right for the PLL lock that takes most of it. At 168 MHz the
+ *  counter wraps after 25 s, more than any phase takes.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <stdio.h>
+
+#include "main.h"
+
+#include "boot_trace.h"
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+typedef struct
+{
+	const char * name;
+	uint32_t us;		/* length of the phase */
+} boot_trace_phase_t;
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static boot_trace_phase_t boot_trace_phases[BOOT_TRACE_MAX_PHASES];
+static uint32_t boot_trace_count;
+
+/* start of the current phase, and the clock it started with */
+static uint32_t boot_trace_cycles;
+static uint32_t boot_trace_clock;
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+void boot_trace_init (void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	boot_trace_count = 0;
+	boot_trace_cycles = 0;
+	boot_trace_clock = SystemCoreClock;
+}
+
+void boot_trace_mark (const char * phase)
+{
+	uint32_t us = (uint32_t)((uint64_t)(DWT->CYCCNT - boot_trace_cycles) * 1000000U / boot_trace_clock);
+
+	boot_trace_cycles = DWT->CYCCNT;
+	boot_trace_clock = SystemCoreClock;
+
+	if (boot_trace_count < BOOT_TRACE_MAX_PHASES)
+	{
+		boot_trace_phases[boot_trace_count].name = phase;
+		boot_trace_phases[boot_trace_count].us = us;
+		boot_trace_count++;
+	}
+}
+
+void boot_trace_print (void)
+{
+	uint32_t end = 0;
+	uint32_t i;
+
+	for (i = 0; i < boot_trace_count; i++)
+	{
+		end += boot_trace_phases[i].us;
+		printf("Boot: %-10s %7lu us, at %7lu us\n", boot_trace_phases[i].name,
+			   (unsigned long)boot_trace_phases[i].us, (unsigned long)end);
+	}
+	/* one figure to compare builds with, whatever phases they mark */
+	printf("Boot: total      %7lu us to the main loop\n", (unsigned long)end);
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,289 @@
+/*
+ * brush.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Stroke rendering with DMA2D.
+ *
+ *  BSP_LCD_FillCircle draws the pencil with CPU DrawHLine loops into the
+ *  SDRAM framebuffer for every touch sample. Here the pencil is rasterized
+ *  once into an A8 coverage sprite and every stamp is a DMA2D_M2M_BLEND of
+ *  the sprite (in the pen color) over the framebuffer, written back in
+ *  place. Stamps are queued by the main loop and the DMA2D interrupt starts
+ *  the next one as each completes, so a whole batch of stamps costs the CPU
+ *  one short interrupt per stamp.
+ *
+ *  The DMA2D blends into ARGB8888 and RGB565 framebuffers. It cannot write
+ *  L8, where the CPU blends the sprite, a byte per pixel, as it is stamped.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "main.h"
+
+#include "brush.h"
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+#define BRUSH_MAX_SIZE				(2U * BRUSH_MAX_RADIUS + 1U)
+#define BRUSH_SUBSAMPLES			4U		/* per axis, for the edge coverage */
+#define BRUSH_DMA2D_PREPRIO			0x0F
+
+typedef struct
+{
+	uint16_t x;
+	uint16_t y;
+	uint32_t color;
+} brush_stamp_t;
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static DMA2D_HandleTypeDef brush_hdma2d;
+
+static uint8_t brush_sprite[BRUSH_MAX_SIZE * BRUSH_MAX_SIZE];
+static uint32_t brush_radius;
+static uint32_t brush_size;
+static uint32_t brush_framebuffer;
+static uint32_t brush_width;
+static uint32_t brush_height;
+static uint32_t brush_pixel_format;
+static uint32_t brush_bytes;
+
+/* DMA2D registers hold the blend setup for brush_color */
+static uint8_t brush_configured;
+static uint32_t brush_color;
+
+/* Queue: head written by brush_stamp only, tail by the DMA2D chain only.
+ * The stamp at tail is the one in flight while brush_busy is set */
+static brush_stamp_t brush_queue[BRUSH_QUEUE_SIZE];
+static volatile uint32_t brush_head;
+static volatile uint32_t brush_tail;
+static volatile uint8_t brush_busy;
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+static void brush_configure(uint32_t color);
+static void brush_start(void);
+static void brush_complete(DMA2D_HandleTypeDef * hdma2d);
+static void brush_blend_l8(uint32_t x, uint32_t y, uint32_t color);
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+void brush_init (uint32_t radius, uint32_t framebuffer, uint32_t width, uint32_t height, uint32_t pixel_format)
+{
+	uint32_t px, py, sx, sy, covered;
+	int32_t dx, dy, limit;
+
+	if (radius > BRUSH_MAX_RADIUS)
+		radius = BRUSH_MAX_RADIUS;
+
+	/* disc of radius + 1/2 pixel, like FillCircle, in half subsample units */
+	limit = (int32_t)((2U * radius + 1U) * BRUSH_SUBSAMPLES);
+
+	brush_wait();
+
+	brush_radius = radius;
+	brush_size = 2U * radius + 1U;
+	brush_framebuffer = framebuffer;
+	brush_width = width;
+	brush_height = height;
+	brush_pixel_format = pixel_format;
+	brush_bytes = (pixel_format == LTDC_PIXEL_FORMAT_RGB565) ? 2U :
+				  (pixel_format == LTDC_PIXEL_FORMAT_L8) ? 1U : 4U;
+	brush_configured = 0;
+
+	/* Coverage of every pixel by the disc, BRUSH_SUBSAMPLES^2 samples each */
+	for (py = 0; py < brush_size; py++)
+	{
+		for (px = 0; px < brush_size; px++)
+		{
+			covered = 0;
+			for (sy = 0; sy < BRUSH_SUBSAMPLES; sy++)
+			{
+				for (sx = 0; sx < BRUSH_SUBSAMPLES; sx++)
+				{
+					/* subsample center, relative to the brush center */
+					dx = (int32_t)(2U * (px * BRUSH_SUBSAMPLES + sx) + 1U) -
+						 (int32_t)(brush_size * BRUSH_SUBSAMPLES);
+					dy = (int32_t)(2U * (py * BRUSH_SUBSAMPLES + sy) + 1U) -
+						 (int32_t)(brush_size * BRUSH_SUBSAMPLES);
+					if ((dx * dx + dy * dy) <= limit * limit)
+						covered++;
+				}
+			}
+			brush_sprite[py * brush_size + px] =
+				(uint8_t)((covered * 255U) / (BRUSH_SUBSAMPLES * BRUSH_SUBSAMPLES));
+		}
+	}
+
+	brush_hdma2d.Instance = DMA2D;
+	brush_hdma2d.XferCpltCallback = brush_complete;
+
+	HAL_NVIC_SetPriority(DMA2D_IRQn, BRUSH_DMA2D_PREPRIO, 0);
+	HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+void brush_stamp (uint32_t x, uint32_t y, uint32_t color)
+{
+	uint32_t head = brush_head;
+	brush_stamp_t * slot;
+
+	if ((x < brush_radius) || (y < brush_radius) ||
+		(x + brush_radius >= brush_width) || (y + brush_radius >= brush_height))
+		return;
+
+	if (brush_pixel_format == LTDC_PIXEL_FORMAT_L8)
+	{
+		brush_blend_l8(x, y, color);
+		return;
+	}
+
+	/* back pressure: the DMA2D frees a slot every few microseconds */
+	while ((head - brush_tail) == BRUSH_QUEUE_SIZE)
+	{
+		brush_flush();
+	}
+
+	slot = &brush_queue[head & (BRUSH_QUEUE_SIZE - 1U)];
+	slot->x = (uint16_t)x;
+	slot->y = (uint16_t)y;
+	slot->color = color;
+	/* the slot is written before it is published to the interrupt */
+	__DMB();
+	brush_head = head + 1U;
+}
+
+void brush_flush (void)
+{
+	HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+	if (!brush_busy)
+	{
+		/* the BSP may have used the DMA2D since the last chain */
+		brush_configured = 0;
+		brush_start();
+	}
+	HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+void brush_wait (void)
+{
+	brush_flush();
+	while (brush_busy)
+	{
+	}
+}
+
+void DMA2D_IRQHandler (void)
+{
+	HAL_DMA2D_IRQHandler(&brush_hdma2d);
+}
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+static void brush_configure(uint32_t color)
+{
+	uint8_t rgb565 = (brush_pixel_format == LTDC_PIXEL_FORMAT_RGB565);
+
+	brush_hdma2d.Init.Mode         = DMA2D_M2M_BLEND;
+	brush_hdma2d.Init.ColorMode    = rgb565 ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+	brush_hdma2d.Init.OutputOffset = brush_width - brush_size;
+
+	/* Foreground: the coverage sprite, colored by FGCOLR */
+	brush_hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_A8;
+	brush_hdma2d.LayerCfg[1].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+	brush_hdma2d.LayerCfg[1].InputAlpha     = color;
+	brush_hdma2d.LayerCfg[1].InputOffset    = 0;
+
+	/* Background: the framebuffer under the stamp */
+	brush_hdma2d.LayerCfg[0].InputColorMode = rgb565 ? DMA2D_INPUT_RGB565 : DMA2D_INPUT_ARGB8888;
+	brush_hdma2d.LayerCfg[0].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+	brush_hdma2d.LayerCfg[0].InputAlpha     = 0xFF;
+	brush_hdma2d.LayerCfg[0].InputOffset    = brush_width - brush_size;
+
+	HAL_DMA2D_Init(&brush_hdma2d);
+	HAL_DMA2D_ConfigLayer(&brush_hdma2d, 0);
+	HAL_DMA2D_ConfigLayer(&brush_hdma2d, 1);
+
+	brush_color = color;
+	brush_configured = 1;
+}
+
+/* Starts the stamp at tail. Runs with the DMA2D interrupt masked or from it */
+static void brush_start(void)
+{
+	brush_stamp_t * stamp;
+	uint32_t address;
+
+	if (brush_tail == brush_head)
+	{
+		brush_busy = 0;
+		return;
+	}
+
+	stamp = &brush_queue[brush_tail & (BRUSH_QUEUE_SIZE - 1U)];
+	if (!brush_configured || (stamp->color != brush_color))
+	{
+		brush_configure(stamp->color);
+	}
+
+	address = brush_framebuffer +
+			  (((stamp->y - brush_radius) * brush_width) + (stamp->x - brush_radius)) * brush_bytes;
+	brush_busy = 1;
+	if (HAL_DMA2D_BlendingStart_IT(&brush_hdma2d, (uint32_t)brush_sprite, address, address,
+								   brush_size, brush_size) != HAL_OK)
+	{
+		/* skip the stamp rather than stall the queue */
+		brush_tail++;
+		brush_busy = 0;
+	}
+}
+
+static void brush_complete(DMA2D_HandleTypeDef * hdma2d)
+{
+	brush_tail++;
+	brush_start();
+}
+
+/* The sprite over an L8 framebuffer, in the luminance of color */
+static void brush_blend_l8(uint32_t x, uint32_t y, uint32_t color)
+{
+	int32_t ink = BSP_LCD_ColorToL8(color);
+	uint8_t * line = (uint8_t *)brush_framebuffer +
+					 ((y - brush_radius) * brush_width) + (x - brush_radius);
+	const uint8_t * cover = brush_sprite;
+	uint32_t px, py;
+
+	for (py = 0; py < brush_size; py++)
+	{
+		for (px = 0; px < brush_size; px++)
+		{
+			line[px] = (uint8_t)(line[px] + ((ink - line[px]) * cover[px]) / 255);
+		}
+		line += brush_width;
+		cover += brush_size;
+	}
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
@@ -24,6 +24,9 @@ extern void Error_Handler(void);
 /*---------------------------------------------------------------------*
  *  local definitions                                                  *
  *---------------------------------------------------------------------*/
+/* Output queued for the UART interrupt, 9600 baud is ~1 ms per char.
+ * A power of 2 */
+#define DEBUG_TX_SIZE		1024U
 
 /*---------------------------------------------------------------------*
  *  external declarations                                              *
@@ -35,6 +38,16 @@ extern void Error_Handler(void);
 
 UART_HandleTypeDef uart_debug_handle;
 
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static uint8_t debug_tx[DEBUG_TX_SIZE];
+/* free running, written by debug_chr and by the interrupt */
+static volatile uint32_t debug_tx_head;
+static volatile uint32_t debug_tx_tail;
+/* chars on the UART, 0 when it is idle */
+static volatile uint32_t debug_tx_chunk;
+
 
 
 /*---------------------------------------------------------------------*
@@ -45,6 +58,7 @@ UART_HandleTypeDef uart_debug_handle;
  *  private functions                                                  *
  *---------------------------------------------------------------------*/
 static void HAL_UART_Msp_Init(void);
+static void debug_tx_start(void);
 /*---------------------------------------------------------------------*
  *  public functions                                                   *
  *---------------------------------------------------------------------*/
@@ -108,16 +122,43 @@ static void HAL_UART_Msp_Init(void)
 }
 
 
+/* Queues chr, it only waits for the UART when the queue is full */
 void debug_chr (char chr)
 {
+	while ((debug_tx_head - debug_tx_tail) == DEBUG_TX_SIZE); /* wait until the uart makes room */
+
+	debug_tx[debug_tx_head % DEBUG_TX_SIZE] = (uint8_t)chr;
+	debug_tx_head++;
+
+	HAL_NVIC_DisableIRQ(DEBUGx_IRQn);
+	if (!debug_tx_chunk)
+		debug_tx_start();
+	HAL_NVIC_EnableIRQ(DEBUGx_IRQn);
+}
 
-	if(HAL_UART_Transmit_IT(&uart_debug_handle, (uint8_t*)&chr, 1) != HAL_OK)
+void HAL_UART_TxCpltCallback (UART_HandleTypeDef * huart)
+{
+	if (huart != &uart_debug_handle)
+		return;
+
+	debug_tx_tail += debug_tx_chunk;
+	debug_tx_start();
+}
+
+/* Sends the queued chars up to the end of the buffer, the rest when they
+ * are out */
+static void debug_tx_start(void)
+{
+	uint32_t tail = debug_tx_tail % DEBUG_TX_SIZE;
+	uint32_t count = debug_tx_head - debug_tx_tail;
+
+	if (count > DEBUG_TX_SIZE - tail)
+		count = DEBUG_TX_SIZE - tail;
+	debug_tx_chunk = count;
+	if (count && (HAL_UART_Transmit_IT(&uart_debug_handle, &debug_tx[tail], count) != HAL_OK))
 	{
 		Error_Handler();
 	}
-
-	while (HAL_UART_GetState(&uart_debug_handle) == HAL_UART_STATE_BUSY_TX ||
-	HAL_UART_GetState(&uart_debug_handle) == HAL_UART_STATE_BUSY_TX_RX); /* wait until the uart is ready */
 }
 
 void USART1_IRQHandler (void)
@@ -0,0 +1,273 @@
+/*
+ * display.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: LCD layer format.
+ *
+ *  The BSP drawing functions follow the pixel format of the layer: the
+ *  DMA2D fills and converts in ARGB8888 and RGB565, the CPU in L8, which
+ *  the DMA2D cannot write. An L8 layer holds the luminance of what is drawn
+ *  (BSP_LCD_ColorToL8) and its CLUT maps it back to gray, except for the
+ *  levels of the pen colors. The readback then has the gray levels as they
+ *  are, without the RGB888 conversion and rgb2gray.
+ *
+ *  The layers are cleared in the background, one DMA2D transfer each, so
+ *  the boot goes on while the DMA2D writes 2 x 300 KB of SDRAM. There is no
+ *  interrupt for it, the DMA2D one belongs to the brush: display_poll
+ *  starts the next clear and display_wait finishes them.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "display.h"
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+#define DISPLAY_CLUT_SIZE			256U
+#define DISPLAY_READ_TIMEOUT		10U		/* ms, 160x160 takes well under 1 */
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+/* the BSP LTDC handle, stm32f429i_discovery_lcd.c */
+extern LTDC_HandleTypeDef LtdcHandler;
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static DMA2D_HandleTypeDef display_hdma2d;
+
+static uint32_t display_clut[DISPLAY_CLUT_SIZE];
+static uint32_t display_current;
+
+/* layers still to clear, one bit each, and the clear on the DMA2D */
+static uint32_t display_clearing;
+static uint8_t display_busy;
+
+static const uint32_t display_pixel_formats[DISPLAY_FORMATS] =
+{
+	LTDC_PIXEL_FORMAT_ARGB8888, LTDC_PIXEL_FORMAT_RGB565, LTDC_PIXEL_FORMAT_L8
+};
+static const uint32_t display_bytes[DISPLAY_FORMATS] = { 4U, 2U, 1U };
+static const char * const display_names[DISPLAY_FORMATS] = { "ARGB8888", "RGB565", "L8" };
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+static void display_layer_init(uint16_t layer, uint32_t framebuffer);
+static void display_clear_next(void);
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+void display_init (uint32_t format, const uint32_t * pens, uint32_t count)
+{
+	uint32_t i;
+
+	if (format >= DISPLAY_FORMATS)
+		format = DISPLAY_ARGB8888;
+	display_current = format;
+
+	/* gray ramp, the pens at their own level */
+	for (i = 0; i < DISPLAY_CLUT_SIZE; i++)
+	{
+		display_clut[i] = (i << 16) | (i << 8) | i;
+	}
+	for (i = 0; i < count; i++)
+	{
+		display_clut[BSP_LCD_ColorToL8(pens[i])] = pens[i] & 0x00FFFFFFU;
+	}
+
+	/* Initialize the LCD */
+	BSP_LCD_Init();
+
+	/* Layer2 Init */
+	display_layer_init(1, LCD_FRAME_BUFFER_LAYER1);
+	BSP_LCD_SetColorKeying(1, LCD_COLOR_WHITE);
+	BSP_LCD_SetLayerVisible(1, DISABLE);
+
+	/* Layer1 Init */
+	display_layer_init(0, LCD_FRAME_BUFFER_LAYER0);
+
+	/* Set Foreground Layer */
+	BSP_LCD_SelectLayer(0);
+
+	/* Enable The LCD */
+	BSP_LCD_DisplayOn();
+
+	/* Clear the LCD, the shown layer first */
+	display_clearing = (1U << 0) | (1U << 1);
+	display_clear_next();
+}
+
+void display_poll (void)
+{
+	if (display_busy)
+	{
+		/* START drops when the transfer completes or fails */
+		if (display_hdma2d.Instance->CR & DMA2D_CR_START)
+			return;
+		/* returns at once: clears the flags and the handle state */
+		HAL_DMA2D_PollForTransfer(&display_hdma2d, DISPLAY_READ_TIMEOUT);
+		display_busy = 0;
+	}
+	if (display_clearing)
+		display_clear_next();
+}
+
+void display_wait (void)
+{
+	while (display_busy || display_clearing)
+	{
+		display_poll();
+	}
+}
+
+uint32_t display_format (void)
+{
+	return display_current;
+}
+
+uint32_t display_pixel_format (void)
+{
+	return display_pixel_formats[display_current];
+}
+
+const char * display_format_name (uint32_t format)
+{
+	return (format < DISPLAY_FORMATS) ? display_names[format] : "off";
+}
+
+void display_set_format (uint32_t format)
+{
+	if (format >= DISPLAY_FORMATS)
+		return;
+
+	HAL_LTDC_SetPixelFormat(&LtdcHandler, display_pixel_formats[format], 0);
+	if (format == DISPLAY_L8)
+	{
+		HAL_LTDC_ConfigCLUT(&LtdcHandler, display_clut, DISPLAY_CLUT_SIZE, 0);
+		HAL_LTDC_EnableCLUT(&LtdcHandler, 0);
+	}
+	display_current = format;
+}
+
+void display_enable (uint8_t enable)
+{
+	BSP_LCD_SetLayerVisible(0, enable ? ENABLE : DISABLE);
+}
+
+void display_read_rgb888 (uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t * rgb888)
+{
+	uint32_t bytes = display_bytes[display_current];
+	uint32_t address = LCD_FRAME_BUFFER_LAYER0 + ((y * BSP_LCD_GetXSize()) + x) * bytes;
+
+	if (display_current == DISPLAY_L8)
+		return;
+	display_wait();
+
+	/* Configure the DMA2D Mode, Color Mode and output offset */
+	display_hdma2d.Init.Mode         = DMA2D_M2M_PFC;
+	display_hdma2d.Init.ColorMode    = DMA2D_OUTPUT_RGB888;
+	display_hdma2d.Init.OutputOffset = 0;
+
+	/* Foreground Configuration: the window, in the layer format */
+	display_hdma2d.LayerCfg[1].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+	display_hdma2d.LayerCfg[1].InputAlpha     = 0xFF;
+	display_hdma2d.LayerCfg[1].InputColorMode =
+		(display_current == DISPLAY_RGB565) ? DMA2D_INPUT_RGB565 : DMA2D_INPUT_ARGB8888;
+	display_hdma2d.LayerCfg[1].InputOffset    = BSP_LCD_GetXSize() - width;
+
+	display_hdma2d.Instance = DMA2D;
+
+	/* the whole window in one transfer */
+	if ((HAL_DMA2D_Init(&display_hdma2d) == HAL_OK) &&
+		(HAL_DMA2D_ConfigLayer(&display_hdma2d, 1) == HAL_OK) &&
+		(HAL_DMA2D_Start(&display_hdma2d, address, (uint32_t)rgb888, width, height) == HAL_OK))
+	{
+		HAL_DMA2D_PollForTransfer(&display_hdma2d, DISPLAY_READ_TIMEOUT);
+	}
+}
+
+void display_read_gray (uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t * gray)
+{
+	const uint8_t * line = (const uint8_t *)LCD_FRAME_BUFFER_LAYER0 + (y * BSP_LCD_GetXSize()) + x;
+	uint32_t i, j;
+
+	if (display_current != DISPLAY_L8)
+		return;
+
+	for (i = 0; i < height; i++)
+	{
+		for (j = 0; j < width; j++)
+		{
+			gray[j] = (uint8_t)(255U - line[j]);
+		}
+		line += BSP_LCD_GetXSize();
+		gray += width;
+	}
+}
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+static void display_layer_init(uint16_t layer, uint32_t framebuffer)
+{
+	if (display_current == DISPLAY_RGB565)
+		BSP_LCD_LayerRgb565Init(layer, framebuffer);
+	else if (display_current == DISPLAY_L8)
+		BSP_LCD_LayerL8Init(layer, framebuffer, display_clut);
+	else
+		BSP_LCD_LayerDefaultInit(layer, framebuffer);
+}
+
+/* Starts clearing the next layer white, the DMA2D has no L8 output: the
+ * CPU clears those at once */
+static void display_clear_next(void)
+{
+	uint32_t layer = (display_clearing & (1U << 0)) ? 0U : 1U;
+	uint32_t framebuffer = layer ? LCD_FRAME_BUFFER_LAYER1 : LCD_FRAME_BUFFER_LAYER0;
+
+	display_clearing &= ~(1U << layer);
+
+	if (display_current == DISPLAY_L8)
+	{
+		memset((void *)framebuffer, BSP_LCD_ColorToL8(LCD_COLOR_WHITE),
+			   BSP_LCD_GetXSize() * BSP_LCD_GetYSize());
+		return;
+	}
+
+	/* Register to memory, the HAL converts the color to the output format */
+	display_hdma2d.Init.Mode         = DMA2D_R2M;
+	display_hdma2d.Init.ColorMode    =
+		(display_current == DISPLAY_RGB565) ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+	display_hdma2d.Init.OutputOffset = 0;
+	display_hdma2d.Instance = DMA2D;
+
+	if ((HAL_DMA2D_Init(&display_hdma2d) == HAL_OK) &&
+		(HAL_DMA2D_Start(&display_hdma2d, LCD_COLOR_WHITE, framebuffer,
+						 BSP_LCD_GetXSize(), BSP_LCD_GetYSize()) == HAL_OK))
+	{
+		display_busy = 1;
+	}
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
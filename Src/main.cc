@@ -9,18 +9,105 @@
 
 /* Start of includes */
 #include <stdio.h>
+#include <string.h>
 #include "main.h"
 #include "debug.h"
+#include "boot_trace.h"
 #include "menu_images.h"
+#include "ts_fifo.h"
+#include "brush.h"
+#include "display.h"
+#include "model_source.h"
+#include "stroke.h"
+#include "stroke_sequence.h"
 /* End of include */
 
 /* Start of Tiny ML includes */
 #include "tensorflow/lite/micro/tflite_bridge/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_cascade.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_kernel_tuner.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/streaming_micro_profiler.h"
+#include "tensorflow/lite/micro/memory_planner/tiered_memory_planner.h"
+#include "tensorflow/lite/micro/cortex_m_generic/debug_log_callback.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
+/* Model selection: 0 = int8 weights, 1 = int4 weights but the first and last layers (tools/quantize_int4_model.cc) */
+#ifndef MODEL_INT4
+#define MODEL_INT4			0
+#endif
+/* 1 = int8 weights, first conv and pool run in tiles (tools/patch_model.cc) */
+#ifndef MODEL_PATCHED
+#define MODEL_PATCHED		0
+#endif
+/* 1 = a small model (tools/make_small_model.cc) classifies first and the
+ * model above only runs when the gap between the two best small model logits
+ * is below CASCADE_MARGIN, tuned with tools/cascade_eval.cc: the lowest
+ * margin at which the cascade agrees with the model alone on 99.5% of inputs */
+#ifndef MODEL_CASCADE
+#define MODEL_CASCADE		0
+#endif
+#ifndef CASCADE_MARGIN
+#define CASCADE_MARGIN		4.0f
+#endif
+/* 1 = int8 weights, rgb2gray and the resize run inside the model on the
+ * 160x160 framebuffer readback (tools/prepend_preprocessing.cc) */
+#ifndef MODEL_PREPROCESS
+#define MODEL_PREPROCESS	0
+#endif
+/* 1 = int8 weights, conv filters stored in the SMLAD operand order
+ * (tools/pack_weights.cc) */
+#ifndef MODEL_PACKED
+#define MODEL_PACKED		0
+#endif
+
+/* 1 = also a stroke model (tools/make_stroke_model.cc), an LSTM that reads
+ * the touch points as they come: each one is a timestep (stroke_sequence.h),
+ * one Invoke() with the state kept in its arena. When the pen is lifted only
+ * the end step is left to run and its prediction is shown. The run button
+ * still runs the model above. Experimental: it is trained on synthetic
+ * strokes and agrees with the model above on about 64% of drawings */
+#ifndef MODEL_STROKE
+#define MODEL_STROKE		0
+#endif
+#define STROKE_ARENA_SIZE	(6U*1024U)
+
+#if MODEL_PREPROCESS && (MODEL_INT4 || MODEL_PATCHED || MODEL_CASCADE)
+#error "MODEL_PREPROCESS is its own model, with a 160x160 RGB input"
+#endif
+#if MODEL_PACKED && (MODEL_INT4 || MODEL_PATCHED || MODEL_PREPROCESS)
+#error "MODEL_PACKED is packed from the plain int8 model"
+#endif
+
+#if MODEL_INT4
+#include <model_int4.h> // Model
+#define MODEL_DATA			model_int4_tflite
+#define MODEL_NAME			"int4"
+#elif MODEL_PATCHED
+#include <model_patched.h> // Model
+#define MODEL_DATA			model_patched_tflite
+#define MODEL_NAME			"int8 patched"
+#elif MODEL_PREPROCESS
+#include <model_preprocess.h> // Model
+#define MODEL_DATA			model_preprocess_tflite
+#define MODEL_NAME			"int8 preprocess"
+#elif MODEL_PACKED
+#include <model_packed.h> // Model
+#define MODEL_DATA			model_packed_tflite
+#define MODEL_NAME			"int8 packed"
+#else
 #include <model_int8.h> // Model
+#define MODEL_DATA			model_int8_tflite
+#define MODEL_NAME			"int8"
+#endif
+#if MODEL_CASCADE
+#include <model_small.h> // Model
+#endif
+#if MODEL_STROKE
+#include <model_stroke.h> // Model
+#endif
 /* End of Tiny ML includes */
 
 /* Private defines */
@@ -32,30 +119,144 @@
 
 #define kNumberOfOutputs 	10U
 
+/* Touch input: 0 = interrupt driven FIFO bursts (ts_fifo.c), 1 = BSP_TS_GetState polling */
+#ifndef TS_POLLING
+#define TS_POLLING			0
+#endif
+#define TOUCH_BATCH			32U	/* samples handled per main loop spin */
+
+/* Model input: 0 = rasterized from the recorded strokes (stroke.c),
+ * 1 = framebuffer readback, rgb2gray and resize_bilnear */
+#ifndef INPUT_FRAMEBUFFER
+#define INPUT_FRAMEBUFFER	0
+#endif
+
+#if MODEL_STROKE && TS_POLLING
+#error "MODEL_STROKE needs the pen up samples of the touch FIFO"
+#endif
+
+/* LCD layer format (display.h): DISPLAY_ARGB8888, DISPLAY_RGB565 or DISPLAY_L8.
+ * The LTDC refresh reads 4, 2 or 1 byte per pixel from the SDRAM the readback
+ * and the spilled activations use. In L8 the readback is the gray image */
+#ifndef DISPLAY_FORMAT
+#define DISPLAY_FORMAT		DISPLAY_ARGB8888
+#endif
+/* 1 = at boot, time Invoke() and the framebuffer preprocessing with the LTDC
+ * reading layer 0 in each format, then with it off */
+#ifndef DISPLAY_BENCHMARK
+#define DISPLAY_BENCHMARK	0
+#endif
+#define DISPLAY_BENCHMARK_RUNS	10U
+
+/* Inference slice: the main loop gets control back (touch, drawing) after
+ * this much model time, 0 = the whole model in one Invoke() */
+#ifndef INVOKE_SLICE_US
+#define INVOKE_SLICE_US		5000U
+#endif
+
+/* Activations: 0 = all in tensor_arena (greedy plan). Otherwise at most this
+ * many bytes of tensor_arena hold them and the rest goes to CCM, then SDRAM,
+ * coldest first: the operators are timed at boot and the buffers of the
+ * slowest ones stay on-chip. The 76.8K input of MODEL_PREPROCESS needs it */
+#ifndef ARENA_ONCHIP_LIMIT
+#if MODEL_PREPROCESS
+#define ARENA_ONCHIP_LIMIT	(24U*1024U)
+#else
+#define ARENA_ONCHIP_LIMIT	0U
+#endif
+#endif
+#define ARENA_MAX_OPS		16U
+
+/* 1 = time each operator once at boot and print it. Build with
+ * TFLM_CMSIS_NN_SMALL_DEPTH_CONV defined to time the small input depth first
+ * CONV_2D. KERNEL_AUTOTUNE prints the cycles of both */
+#ifndef LAYER_TIMES
+#define LAYER_TIMES			0
+#endif
+
+#if MODEL_PREPROCESS && !ARENA_ONCHIP_LIMIT
+#error "MODEL_PREPROCESS needs ARENA_ONCHIP_LIMIT, its input only fits in SDRAM"
+#endif
+#if MODEL_CASCADE && (ARENA_ONCHIP_LIMIT || LAYER_TIMES || DISPLAY_BENCHMARK)
+#error "ARENA_ONCHIP_LIMIT, LAYER_TIMES and DISPLAY_BENCHMARK time a single interpreter, not the cascade"
+#endif
+#if MODEL_PREPROCESS && (DISPLAY_FORMAT == DISPLAY_L8)
+#error "MODEL_PREPROCESS converts the RGB888 readback itself, it has no L8 input"
+#endif
+
+/* 1 = the CONV_2D kernel of each layer is the fastest one measured at boot
+ * (micro_kernel_tuner.h). The table is kept in the last flash sector and only
+ * rebuilt when the model changes. The cycles of every kernel measured for a
+ * layer are printed when it is rebuilt */
+#ifndef KERNEL_AUTOTUNE
+#define KERNEL_AUTOTUNE		0
+#endif
+#define KERNEL_TUNE_RUNS	5U
+
+/* Profiler: DWT cycles, histogram buckets from 2^16 cycles (~0.4 ms) */
+#define PROFILER_MAX_TAGS	6
+#define PROFILER_HIST_SHIFT	16
+
 /* Private global variables */
 static uint8_t _run_model = 0;
+#if MODEL_STROKE
+static tflite::MicroInterpreter * _stroke_model = nullptr;
+static uint32_t _stroke_steps = 0;
+#endif
 
 /* Private function prototypes -----------------------------------------------*/
 static void SystemClock_Config(void);
 static void draw_menu(void);
 static void check_touch(void);
+static void check_menu(uint32_t x, uint32_t y);
+static uint8_t in_working_window(uint32_t x, uint32_t y);
+static void draw_segment(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1);
 static void update_color(void);
 static void prepare_working_window(void);
+static void read_framebuffer_input(TfLiteTensor * in);
+#if MODEL_PREPROCESS
+static void update_window_input(TfLiteTensor * in);
+#else
 static void rgb2gray(void);
 static void resize_bilnear(void);
 static void update_tensor_input(TfLiteTensor * in);
+#endif
 static uint8_t get_top_prediction(const int8_t* predictions, uint8_t num_categories);
-static void print_result(uint8_t number, uint32_t tim);
+static void print_result(uint8_t number, uint32_t tim, const char * unit);
+#if MODEL_STROKE
+static void stroke_model_start(uint32_t x, uint32_t y);
+static void stroke_model_continue(uint32_t x, uint32_t y);
+static void stroke_model_end(void);
+static void stroke_model_clear(void);
+static uint8_t stroke_model_run(const int8_t * steps, uint32_t count);
+#endif
+static void debug_log(const char * s);
+#if ARENA_ONCHIP_LIMIT || LAYER_TIMES
+static uint32_t time_operators(tflite::MicroInterpreter * interpreter, uint32_t * cycles);
+#endif
+#if DISPLAY_BENCHMARK
+static void display_benchmark(tflite::MicroInterpreter * interpreter, TfLiteTensor * in);
+#endif
+#if KERNEL_AUTOTUNE
+static uint8_t load_kernel_table(const model_source_t * source, const tflite::Model * model,
+								 const tflite::MicroOpResolver & resolver, uint8_t * arena, uint32_t arena_size);
+static uint8_t store_kernel_table(const tflite::KernelTuningTable * table);
+#endif
 
 int main(void)
 {
+	/* Boot timeline, printed once the main loop can take input */
+	boot_trace_init();
+
 	/* Hal Init */
 	HAL_Init();
+	boot_trace_mark("hal");
 
 	/* Configure the system clock to 168 MHz */
 	SystemClock_Config();
+	boot_trace_mark("clock");
 
-	/* Configure debug port */
+	/* Configure debug port, the output is queued from here on */
 	debug_init();
 
 	/* Sending msg by uart */
@@ -67,50 +268,53 @@ int main(void)
 
 	/* --- Start of LCD Initialization --- */
 
-	/* Initialize the LCD */
-	BSP_LCD_Init();
-
-	/* Layer2 Init */
-	BSP_LCD_LayerDefaultInit(1, LCD_FRAME_BUFFER_LAYER1);
-	/* Set Foreground Layer */
-	BSP_LCD_SelectLayer(1);
-	/* Clear the LCD */
-	BSP_LCD_Clear(LCD_COLOR_WHITE);
-	BSP_LCD_SetColorKeying(1, LCD_COLOR_WHITE);
-	BSP_LCD_SetLayerVisible(1, DISABLE);
-
-	/* Layer1 Init */
-	BSP_LCD_LayerDefaultInit(0, LCD_FRAME_BUFFER_LAYER0);
-
-	/* Set Foreground Layer */
-	BSP_LCD_SelectLayer(0);
-
-	/* Enable The LCD */
-	BSP_LCD_DisplayOn();
-
-	/* Clear the LCD */
-	BSP_LCD_Clear(LCD_COLOR_WHITE);
+	/* Both layers, in L8 the colors of the menu keep theirs */
+	static const uint32_t pens[] = { LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_BLUE,
+									 LCD_COLOR_DARKGREEN, LCD_COLOR_DARKRED };
+	display_init(DISPLAY_FORMAT, pens, sizeof(pens) / sizeof(pens[0]));
+	printf("Display: %s\n", display_format_name(display_format()));
+	boot_trace_mark("lcd");
+
+	/* Pencil sprite for the DMA2D stroke rendering */
+	brush_init(CIRCLE_PENCIL, LCD_FRAME_BUFFER_LAYER0, BSP_LCD_GetXSize(), BSP_LCD_GetYSize(),
+			   display_pixel_format());
+	/* Same sample points as the readback: it puts LCD row 6 + r in working row r */
+	stroke_init(CIRCLE_PENCIL, 67, 6, WORKING_WIDTH, WORKING_HEIGHT);
+#if MODEL_STROKE
+	/* the first stroke is a move from the window center */
+	stroke_seq_init(67 + WORKING_WIDTH / 2, 6 + WORKING_HEIGHT / 2);
+#endif
 
 	/* --- End of LCD Initialization --- */
 
 	/* --- Touch screen initialization --- */
-	Touchscreen_Calibration();
+	/* From flash, touch the screen while the board resets to calibrate again */
+	static const char * const calibration_origin[] = { "flash", "stored", "not stored" };
+	printf("Touchscreen calibration: %s\n", calibration_origin[Touchscreen_Calibration()]);
 
-	BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
-
-	/* Draw the menu */
-	draw_menu();
+#if !TS_POLLING
+	ts_fifo_init();
+#endif
+	/* the other layer clears while the model is set up */
+	display_poll();
+	boot_trace_mark("touch");
 
 	/* Start of TinyML Initialization */
 	/* Set Up Logging */
 	tflite::MicroErrorReporter micro_error_reporter;
 	tflite::ErrorReporter * error_reporter = &micro_error_reporter;
+	RegisterDebugLogCallback(debug_log);
+
+	/* Per op statistics, always on: a few hundred bytes of RAM */
+	static tflite::StreamingMicroProfiler<PROFILER_MAX_TAGS> profiler(PROFILER_HIST_SHIFT);
 
 	TfLiteTensor * input = nullptr;
 	TfLiteTensor * output = nullptr;
 
-	/* Loading the model */
-	const tflite::Model * model  = tflite::GetModel(model_int8_tflite);
+	/* Loading the model, read in place from wherever it is */
+	static model_source_t source;
+	model_source_array(&source, MODEL_DATA, sizeof(MODEL_DATA));
+	const tflite::Model * model  = tflite::GetModel(source.data);
 	if(model->version() != TFLITE_SCHEMA_VERSION)
 	{
 		error_reporter->Report("Model provided is schema version %d not equal"
@@ -119,16 +323,83 @@ int main(void)
 		return 1;
 	}
 
-	static tflite::MicroMutableOpResolver<4> micro_op_resolver;
+	static tflite::MicroMutableOpResolver<8> micro_op_resolver;
+	/* the int4 model keeps its first and last layers int8, these take both filter types */
 	micro_op_resolver.AddConv2D();
-	micro_op_resolver.AddMaxPool2D();
 	micro_op_resolver.AddFullyConnected();
+	micro_op_resolver.AddMaxPool2D();
 	micro_op_resolver.AddReshape();
-
+#if MODEL_PATCHED
+	micro_op_resolver.AddPatchStage();
+#endif
+#if MODEL_PREPROCESS
+	micro_op_resolver.AddResizeBilinear();
+#endif
+#if MODEL_PACKED
+	micro_op_resolver.AddPackedConv2D();
+	micro_op_resolver.AddPackedFullyConnected();
+#endif
+#if MODEL_CASCADE
+	micro_op_resolver.AddAveragePool2D();
+#endif
+
+#if MODEL_CASCADE
+	/* the models share their activations, not their persistent data */
+	const int tensor_arena_size = 32*1024;
+#elif MODEL_PATCHED
+	/* the tiles leave a 10688 byte peak (64-bit host, tools/patch_model.cc),
+	 * less on the target */
+	const int tensor_arena_size = 12*1024;
+#else
 	const int tensor_arena_size = 30*1024;
+#endif
 	static uint8_t tensor_arena[tensor_arena_size];
 
-	static tflite::MicroInterpreter static_interpreter(model, micro_op_resolver, tensor_arena, tensor_arena_size);
+	boot_trace_mark("model");
+
+#if KERNEL_AUTOTUNE
+	/* before any interpreter: the tuner builds its own in tensor_arena. Its
+	 * timings without the DMA2D on the bus */
+	display_wait();
+	if(!load_kernel_table(&source, model, micro_op_resolver, tensor_arena, tensor_arena_size))
+	{
+		TF_LITE_REPORT_ERROR(error_reporter, "Kernel tuning failed");
+		return 1;
+	}
+#endif
+
+#if MODEL_CASCADE
+	static tflite::MicroCascade static_interpreter(tflite::GetModel(model_small_tflite), model, micro_op_resolver,
+												   tensor_arena, tensor_arena_size, &profiler);
+	static_interpreter.SetMarginThreshold(CASCADE_MARGIN);
+#elif ARENA_ONCHIP_LIMIT
+	static tflite::TieredMemoryPlanner planner;
+	static uint32_t op_cycles[ARENA_MAX_OPS];
+	planner.AddTier((uint8_t *)TENSOR_ARENA_CCM, TENSOR_ARENA_CCM_SIZE);
+	planner.AddTier((uint8_t *)TENSOR_ARENA_SDRAM, TENSOR_ARENA_SDRAM_SIZE);
+	planner.SetArenaLimit(ARENA_ONCHIP_LIMIT);
+	/* the probe times the operators, without the DMA2D on the bus */
+	display_wait();
+	{
+		/* profiling run, every buffer weighted the same */
+		tflite::MicroInterpreter probe(model, micro_op_resolver,
+									   tflite::MicroAllocator::Create(tensor_arena, tensor_arena_size, &planner));
+		if((probe.AllocateTensors() != kTfLiteOk) || !time_operators(&probe, op_cycles))
+		{
+			TF_LITE_REPORT_ERROR(error_reporter, "Operator profiling failed");
+			return 1;
+		}
+	}
+	planner.SetOperatorCosts(op_cycles, ARENA_MAX_OPS);
+
+	/* the allocator lives in the arena, the probe one is overwritten */
+	static tflite::MicroInterpreter static_interpreter(model, micro_op_resolver,
+													   tflite::MicroAllocator::Create(tensor_arena, tensor_arena_size, &planner),
+													   nullptr, &profiler);
+#else
+	static tflite::MicroInterpreter static_interpreter(model, micro_op_resolver, tensor_arena, tensor_arena_size,
+													   nullptr, &profiler);
+#endif
 
 	TfLiteStatus allocate_status = static_interpreter.AllocateTensors();
 	if( allocate_status != kTfLiteOk)
@@ -136,42 +407,186 @@ int main(void)
 		TF_LITE_REPORT_ERROR(error_reporter, "AllocateTensor() failed");
 		return 1;
 	}
+	boot_trace_mark("allocate");
+
+#if MODEL_STROKE
+	/* Its own arena, the LSTM state stays there from one step to the next */
+	static tflite::MicroMutableOpResolver<2> stroke_op_resolver;
+	stroke_op_resolver.AddUnidirectionalSequenceLSTM();
+	stroke_op_resolver.AddFullyConnected();
+	static uint8_t stroke_arena[STROKE_ARENA_SIZE];
+	static tflite::MicroInterpreter stroke_interpreter(tflite::GetModel(model_stroke_tflite), stroke_op_resolver,
+													   stroke_arena, STROKE_ARENA_SIZE);
+	if(stroke_interpreter.AllocateTensors() != kTfLiteOk)
+	{
+		TF_LITE_REPORT_ERROR(error_reporter, "Stroke model AllocateTensors() failed");
+		return 1;
+	}
+	_stroke_model = &stroke_interpreter;
+	boot_trace_mark("stroke model");
+#endif
+
+	/* Draw the menu, on the cleared layer */
+	display_wait();
+	boot_trace_mark("clear");
+	draw_menu();
+	boot_trace_mark("menu");
+
+#if ARENA_ONCHIP_LIMIT
+	/* the planner copies these figures out of the plan while the arena is committed */
+	printf("Arena: %u SRAM, %u CCM, %u SDRAM bytes\n",
+		   (unsigned int)planner.GetTierUsedBytes(0), (unsigned int)planner.GetTierUsedBytes(1),
+		   (unsigned int)planner.GetTierUsedBytes(2));
+
+	/* cost of the placement: operator time, with the bytes it reads or writes per tier */
+	uint32_t op_count = time_operators(&static_interpreter, op_cycles);
+	for(uint32_t op = 0; op < op_count; op++)
+	{
+		printf("Op %lu: %lu us, %lu SRAM, %lu CCM, %lu SDRAM bytes\n", (unsigned long)op,
+			   (unsigned long)(op_cycles[op] / (SystemCoreClock / 1000000U)),
+			   (unsigned long)planner.GetOperatorBytes(op, 0), (unsigned long)planner.GetOperatorBytes(op, 1),
+			   (unsigned long)planner.GetOperatorBytes(op, 2));
+	}
+#elif LAYER_TIMES
+	static uint32_t op_cycles[ARENA_MAX_OPS];
+	uint32_t op_count = time_operators(&static_interpreter, op_cycles);
+	for(uint32_t op = 0; op < op_count; op++)
+	{
+		printf("Op %lu: %lu us\n", (unsigned long)op,
+			   (unsigned long)(op_cycles[op] / (SystemCoreClock / 1000000U)));
+	}
+#endif
 
 	input = static_interpreter.input(0);
 	output = static_interpreter.output(0);
 
+#if DISPLAY_BENCHMARK
+	display_benchmark(&static_interpreter, input);
+#endif
+
+	printf("Model: %s weights, %s, %u bytes, arena used %u bytes\n", MODEL_NAME,
+		   model_source_name(source.kind), (unsigned int)source.size,
+		   (unsigned int)static_interpreter.arena_used_bytes());
+#if MODEL_STROKE
+	printf("Stroke model: %u bytes, arena used %u bytes\n", (unsigned int)sizeof(model_stroke_tflite),
+		   (unsigned int)stroke_interpreter.arena_used_bytes());
+#endif
+
 	/* --- End of Tiny-ML Initialization --- */
 
+	/* the boot measurements and reports of the options above */
+	boot_trace_mark("reports");
+	boot_trace_print();
+
+	uint32_t touch_cycles = ts_fifo_cpu_cycles();
+	uint32_t touch_start = HAL_GetTick();
+
+	/* inference in progress (InvokeStep) and its statistics */
+	uint8_t inference = 0;
+	uint32_t inference_start = 0;
+	uint32_t inference_slices = 0;
+	uint32_t inference_cycles = 0;
+	uint32_t inference_max_slice = 0;
+
 	for(;;)
 	{
 		check_touch(); /* check if the touch was touched to draw or select something in the menu */
-		if(_run_model)
+		brush_flush(); /* the DMA2D draws the stamps while the loop goes on */
+		if(_run_model && !inference)
 		{
 			_run_model = 0; //clear the flag
-			/* save the image from working window  160x160 image */
-			prepare_working_window();
-			/* convert image from rgb to gray */
-			rgb2gray();
-			/* resize the image to 28x28 to be used in the model */
-			resize_bilnear();
-			/* data from buffer to tensor input */
-			update_tensor_input(input);
-
-			/* invoke interpreter and print the results */
-			uint32_t initial = HAL_GetTick();
+
+			/* CPU time spent on the touch screen while drawing */
+			uint32_t elapsed = HAL_GetTick() - touch_start;
+			if(elapsed > 0)
+			{
+				printf("Touch: %lu us CPU per second, %lu samples dropped\n",
+					   (unsigned long)(((uint64_t)(ts_fifo_cpu_cycles() - touch_cycles) * 1000U /
+										(SystemCoreClock / 1000000U)) / elapsed),
+					   (unsigned long)ts_fifo_dropped());
+			}
+			/* the strokes are incomplete if points were lost, read the screen then */
+			uint8_t from_framebuffer = INPUT_FRAMEBUFFER || MODEL_PREPROCESS || stroke_overflow();
+			uint32_t input_start = DWT->CYCCNT;
+			if (from_framebuffer)
+			{
+				brush_wait();
+				read_framebuffer_input(input);
+			}
+			else
+			{
+				/* strokes straight into the tensor input */
+				stroke_rasterize(input->data.int8, TRANSFORMED_WIDTH, TRANSFORMED_HEIGHT,
+								 input->params.zero_point);
+			}
+			printf("Input: %s, %lu us\n", from_framebuffer ? "framebuffer" : "strokes",
+				   (unsigned long)((DWT->CYCCNT - input_start) / (SystemCoreClock / 1000000U)));
+
+			/* start the inference, it runs in slices from here on */
+			inference = 1;
+			inference_start = HAL_GetTick();
+			inference_slices = 0;
+			inference_cycles = 0;
+			inference_max_slice = 0;
+		}
+
+		if(inference)
+		{
+			/* one slice of the model, then touch and display get their turn */
+			bool done = false;
+			uint32_t slice_start = DWT->CYCCNT;
+			uint32_t event = profiler.BeginEvent("Invoke");
+#if INVOKE_SLICE_US
+			TfLiteStatus invoke_status = static_interpreter.InvokeStep(
+				INVOKE_SLICE_US * (SystemCoreClock / 1000000U), &done);
+#else
 			TfLiteStatus invoke_status = static_interpreter.Invoke();
+			done = true;
+#endif
+			profiler.EndEvent(event);
+			uint32_t slice = DWT->CYCCNT - slice_start;
 			if( invoke_status != kTfLiteOk)
 			{
 				TF_LITE_REPORT_ERROR(error_reporter, "Invoke() failed");
 				return 1;
 			}
+			inference_slices++;
+			inference_cycles += slice;
+			if (slice > inference_max_slice)
+				inference_max_slice = slice;
+			if (!done)
+				continue;
+
+			inference = 0;
 			uint32_t current = HAL_GetTick();
 
+			/* compute time against wall time, and the longest the loop was held */
+			printf("Invoke: %lu slices, %lu us compute, longest slice %lu us\n",
+				   (unsigned long)inference_slices,
+				   (unsigned long)(inference_cycles / (SystemCoreClock / 1000000U)),
+				   (unsigned long)(inference_max_slice / (SystemCoreClock / 1000000U)));
+
+			/* running statistics since boot */
+			profiler.Log();
+
+#if MODEL_CASCADE
+			/* the output of the model that decided */
+			output = static_interpreter.output(0);
+			uint32_t margin = (uint32_t)(static_interpreter.margin() * 100.0f);
+			printf("Cascade: margin %lu.%02lu, %s model\n", (unsigned long)(margin / 100U),
+				   (unsigned long)(margin % 100U), static_interpreter.escalated() ? "full" : "small");
+#endif
+
 			int8_t result = get_top_prediction(output->data.int8, kNumberOfOutputs);
 
-			print_result(result, current - initial);
+			/* the result window is drawn with the BSP */
+			brush_wait();
+			print_result(result, current - inference_start, "ms");
 
 			BSP_LED_Off(LED4);
+
+			touch_cycles = ts_fifo_cpu_cycles();
+			touch_start = HAL_GetTick();
 		}
 	}
 }
@@ -194,7 +609,7 @@ static uint8_t get_top_prediction(const int8_t* predictions, uint8_t num_categor
 }
 
 /* print the results on the screen */
-static void print_result(uint8_t number, uint32_t time)
+static void print_result(uint8_t number, uint32_t time, const char * unit)
 {
 	static uint8_t op_buffer[30];
 	static uint32_t color = BSP_LCD_GetTextColor(); // saves the color in the pen
@@ -206,34 +621,385 @@ static void print_result(uint8_t number, uint32_t time)
 	snprintf((char *)op_buffer, 30, (char *)"The number is: %u", number);
 	BSP_LCD_DisplayStringAt(67, (BSP_LCD_GetYSize()-90),(uint8_t*)op_buffer, LEFT_MODE);
 
-	snprintf((char *)op_buffer, 30, (char *)"Time: %lu ms", time);
+	snprintf((char *)op_buffer, 30, (char *)"Time: %lu %s", time, unit);
 	BSP_LCD_DisplayStringAt(67, (BSP_LCD_GetYSize()-70), (uint8_t *)op_buffer, LEFT_MODE);
 	BSP_LCD_SetTextColor(color); // back the color to the pen
 }
 
+#if MODEL_STROKE
+/* A stroke starts: the pen up move to it */
+static void stroke_model_start(uint32_t x, uint32_t y)
+{
+	int8_t steps[STROKE_SEQ_MAX_STEPS * STROKE_SEQ_FEATURES];
+
+	stroke_model_run(steps, stroke_seq_start(x, y, steps));
+}
+
+/* The stroke goes on, a step once the pen moved far enough */
+static void stroke_model_continue(uint32_t x, uint32_t y)
+{
+	int8_t steps[STROKE_SEQ_MAX_STEPS * STROKE_SEQ_FEATURES];
+
+	stroke_model_run(steps, stroke_seq_continue(x, y, steps));
+}
+
+/* The pen was lifted: every point is in the state already, the end step
+ * gives the prediction */
+static void stroke_model_end(void)
+{
+	int8_t steps[STROKE_SEQ_MAX_STEPS * STROKE_SEQ_FEATURES];
+	uint32_t start = DWT->CYCCNT;
+	uint32_t us;
+	uint8_t result;
+
+	if (!stroke_model_run(steps, stroke_seq_end(steps)))
+		return;
+	result = get_top_prediction(_stroke_model->output(0)->data.int8, kNumberOfOutputs);
+	us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000U);
+	printf("Stroke model: %u after %lu steps, end step %lu us\n", result,
+		   (unsigned long)_stroke_steps, (unsigned long)us);
+
+	/* the result window is drawn with the BSP, the end step takes well
+	 * under a millisecond */
+	brush_wait();
+	print_result(result, us, "us");
+}
+
+/* The working window was cleared, a new drawing starts from a zero state */
+static void stroke_model_clear(void)
+{
+	stroke_seq_clear();
+	_stroke_model->Reset();
+	_stroke_steps = 0;
+}
+
+/* One Invoke() per step. Returns 0 on error */
+static uint8_t stroke_model_run(const int8_t * steps, uint32_t count)
+{
+	TfLiteTensor * in = _stroke_model->input(0);
+	uint32_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		memcpy(in->data.int8, &steps[i * STROKE_SEQ_FEATURES], STROKE_SEQ_FEATURES);
+		if (_stroke_model->Invoke() != kTfLiteOk)
+		{
+			printf("Stroke model Invoke() failed\n");
+			return 0;
+		}
+		_stroke_steps++;
+	}
+	return 1;
+}
+#endif
+
+#if !MODEL_PREPROCESS
 /* copy the image to the input tensor */
 static void update_tensor_input(TfLiteTensor * in)
 {
 	uint16_t idx;
 	uint8_t * src = (uint8_t*) TRANSFORMED_FRAME_BUFFER;
+	int32_t zero_point = in->params.zero_point; // -128: the input is int8 and the image is in uint8 format
+	for(idx = 0; idx < in->bytes; idx++)
+		in->data.int8[idx] = (int8_t)(src[idx] + zero_point);
+}
+#else
+/* copy the working window to the input tensor, the model does the rest */
+static void update_window_input(TfLiteTensor * in)
+{
+	uint32_t idx;
+	uint8_t * src = (uint8_t*) WORKING_FRAME_BUFFER;
+	int32_t zero_point = in->params.zero_point;
 	for(idx = 0; idx < in->bytes; idx++)
-		in->data.int8[idx] = (int8_t)(src[idx] - 127); // the input is int8 and the image is in uint8 format
+		in->data.int8[idx] = (int8_t)(src[idx] + zero_point);
+}
+#endif
+
+/* The working window to the input tensor, through the readback */
+static void read_framebuffer_input(TfLiteTensor * in)
+{
+	/* save the image from working window  160x160 image */
+	prepare_working_window();
+#if MODEL_PREPROCESS
+	/* the model converts and resizes it */
+	update_window_input(in);
+#else
+	/* convert image from rgb to gray, the L8 readback already is */
+	if (display_format() != DISPLAY_L8)
+		rgb2gray();
+	/* resize the image to 28x28 to be used in the model */
+	resize_bilnear();
+	/* data from buffer to tensor input */
+	update_tensor_input(in);
+#endif
+}
+
+#if DISPLAY_BENCHMARK
+/* Times Invoke() and the framebuffer input with the LTDC reading layer 0 in
+ * each format, then with the layer off. The layer is not converted, so the
+ * screen is garbled until the configured format is back */
+static void display_benchmark(tflite::MicroInterpreter * interpreter, TfLiteTensor * in)
+{
+	uint32_t format, run, start, invoke_cycles, input_cycles;
+	uint32_t us = SystemCoreClock / 1000000U;
+
+	brush_wait();
+	for(format = 0; format <= DISPLAY_FORMATS; format++)
+	{
+		if(format < DISPLAY_FORMATS)
+			display_set_format(format);
+		display_enable(format < DISPLAY_FORMATS);
+
+		invoke_cycles = 0;
+		input_cycles = 0;
+		for(run = 0; run < DISPLAY_BENCHMARK_RUNS; run++)
+		{
+			start = DWT->CYCCNT;
+			read_framebuffer_input(in);
+			input_cycles += DWT->CYCCNT - start;
+
+			start = DWT->CYCCNT;
+			if(interpreter->Invoke() != kTfLiteOk)
+				break;
+			invoke_cycles += DWT->CYCCNT - start;
+		}
+		printf("Display %s: Invoke %lu us, input %lu us\n", display_format_name(format),
+			   (unsigned long)(invoke_cycles / DISPLAY_BENCHMARK_RUNS / us),
+			   (unsigned long)(input_cycles / DISPLAY_BENCHMARK_RUNS / us));
+	}
+	display_set_format(DISPLAY_FORMAT);
+	display_enable(1);
+}
+#endif
+
+/* TFLM logs (MicroPrintf, profiler) go to the debug uart */
+#if ARENA_ONCHIP_LIMIT || LAYER_TIMES
+/* Runs the model one operator at a time and stores the cycles of each,
+ * returns the number of operators, 0 on error */
+static uint32_t time_operators(tflite::MicroInterpreter * interpreter, uint32_t * cycles)
+{
+	uint32_t count = 0;
+	bool done = false;
+
+	while(!done)
+	{
+		uint32_t start = DWT->CYCCNT;
+		if(interpreter->InvokeStep(0, &done) != kTfLiteOk)
+			return 0;
+		if(count < ARENA_MAX_OPS)
+			cycles[count] = DWT->CYCCNT - start;
+		count++;
+	}
+	return (count < ARENA_MAX_OPS) ? count : ARENA_MAX_OPS;
+}
+#endif
+
+#if KERNEL_AUTOTUNE
+/* Selects the CONV_2D kernels from the table in flash. When it is missing or
+ * was built for another model the kernels are timed and the new table is
+ * stored. Returns 0 on error */
+static uint8_t load_kernel_table(const model_source_t * source, const tflite::Model * model,
+								 const tflite::MicroOpResolver & resolver, uint8_t * arena, uint32_t arena_size)
+{
+	static tflite::KernelTuningTable table;
+	static tflite::KernelTuningReport report;
+	const tflite::KernelTuningTable * stored = (const tflite::KernelTuningTable *)KERNEL_TABLE_FLASH_ADDR;
+	uint32_t model_hash = tflite::KernelTuningHash(source->data, source->size);
+	const char * origin = "flash";
+	uint32_t i;
+
+	if(tflite::KernelTuningTableValid(*stored, model_hash))
+	{
+		table = *stored;
+	}
+	else
+	{
+		origin = "tuned";
+		if(tflite::TuneKernels(model, model_hash, resolver, arena, arena_size,
+							   KERNEL_TUNE_RUNS, &table, &report) != kTfLiteOk)
+			return 0;
+		/* per layer, the fastest run of each legal kernel */
+		for(i = 0; i < (uint32_t)report.layer_count; i++)
+		{
+			uint32_t k;
+			printf("Conv %lu cycles:", (unsigned long)i);
+			for(k = 0; k < tflite::kConvKernelCount; k++)
+			{
+				if(report.layers[i].legal_kernels & (1U << k))
+					printf(" %s %lu", tflite::ConvKernelName((tflite::ConvKernel)k),
+						   (unsigned long)report.ticks[i][k]);
+			}
+			printf("\n");
+		}
+		/* still used for this boot, tuned again on the next one */
+		if(!store_kernel_table(&table))
+			printf("Kernel table not stored\n");
+	}
+	tflite::SetKernelTuningTable(&table);
+
+	for(i = 0; i < table.entry_count; i++)
+	{
+		printf("Conv %lu: %s (%s)\n", (unsigned long)i,
+			   tflite::ConvKernelName((tflite::ConvKernel)table.entries[i].kernel), origin);
+	}
+	return 1;
+}
+
+/* Erases the table sector and programs the table word by word.
+ * Returns 0 on error */
+static uint8_t store_kernel_table(const tflite::KernelTuningTable * table)
+{
+	FLASH_EraseInitTypeDef erase;
+	uint32_t sector_error = 0;
+	const uint32_t * words = (const uint32_t *)table;
+	uint8_t ok = 1;
+	uint32_t i;
+
+	erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+	erase.Sector = KERNEL_TABLE_FLASH_SECTOR;
+	erase.NbSectors = 1;
+	erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+	HAL_FLASH_Unlock();
+	if(HAL_FLASHEx_Erase(&erase, &sector_error) != HAL_OK)
+		ok = 0;
+	for(i = 0; ok && (i < sizeof(*table) / sizeof(uint32_t)); i++)
+	{
+		if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, KERNEL_TABLE_FLASH_ADDR + i * sizeof(uint32_t),
+							 words[i]) != HAL_OK)
+			ok = 0;
+	}
+	HAL_FLASH_Lock();
+	return ok;
 }
+#endif
 
+static void debug_log(const char * s)
+{
+	printf("%s", s);
+}
+
+#if TS_POLLING
+/* One BSP_TS_GetState (blocking I2C) sample per main loop spin */
 static void check_touch(void)
 {
-  uint32_t x = 0, y = 0, color;
+  uint32_t x = 0, y = 0;
+  uint32_t start = DWT->CYCCNT;
   TS_StateTypeDef TS_State;
 
   /* Get Touch screen position */
   BSP_TS_GetState(&TS_State);
+  ts_fifo_add_cpu_cycles(DWT->CYCCNT - start);
 
   /* Read the coordinate */
   x = Calibration_GetX(TS_State.X);
-  y = Calibration_GetX(TS_State.Y);
+  y = Calibration_GetY(TS_State.Y);
+
+  if (TS_State.TouchDetected)
+  {
+    check_menu(x, y);
+    if (in_working_window(x, y))
+    {
+      brush_stamp(x, y, BSP_LCD_GetTextColor()); /*here its where you touched */
+      stroke_start(x, y, BSP_LCD_GetTextColor());
+    }
+  }
+}
+#else
+/* Drains the touch queue, strokes are drawn as segments between samples */
+static void check_touch(void)
+{
+  static uint8_t stroke = 0;
+  static uint32_t last_x, last_y;
+  ts_sample_t samples[TOUCH_BATCH];
+  uint32_t count, i, x, y;
+
+  count = ts_fifo_read(samples, TOUCH_BATCH);
+  for (i = 0; i < count; i++)
+  {
+    if (samples[i].flags & TS_SAMPLE_PEN_UP)
+    {
+#if MODEL_STROKE
+      if (stroke)
+        stroke_model_end();
+#endif
+      stroke = 0;
+      continue;
+    }
+
+    x = Calibration_GetX(samples[i].x);
+    y = Calibration_GetY(samples[i].y);
+
+    if (samples[i].flags & TS_SAMPLE_PEN_DOWN)
+    {
+      check_menu(x, y);
+    }
+
+    if (in_working_window(x, y))
+    {
+      if (stroke)
+      {
+        draw_segment(last_x, last_y, x, y);
+        stroke_continue(x, y);
+#if MODEL_STROKE
+        stroke_model_continue(x, y);
+#endif
+      }
+      else
+      {
+        brush_stamp(x, y, BSP_LCD_GetTextColor());
+        stroke_start(x, y, BSP_LCD_GetTextColor());
+#if MODEL_STROKE
+        stroke_model_start(x, y);
+#endif
+      }
+      stroke = 1;
+      last_x = x;
+      last_y = y;
+    }
+    else
+    {
+#if MODEL_STROKE
+      if (stroke)
+        stroke_model_end();
+#endif
+      stroke = 0; /* left the working window, restart when coming back */
+    }
+  }
+}
+#endif
+
+/* Pencil stamps along the segment, close enough to look continuous */
+static void draw_segment(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+{
+  int32_t dx = (int32_t)x1 - (int32_t)x0;
+  int32_t dy = (int32_t)y1 - (int32_t)y0;
+  int32_t length = (abs(dx) > abs(dy)) ? abs(dx) : abs(dy);
+  int32_t steps = (length + (CIRCLE_PENCIL / 2) - 1) / (CIRCLE_PENCIL / 2);
+  int32_t i;
+  uint32_t color = BSP_LCD_GetTextColor();
+
+  for (i = 1; i <= steps; i++)
+  {
+    brush_stamp(x0 + (dx * i) / steps, y0 + (dy * i) / steps, color);
+  }
+}
+
+static uint8_t in_working_window(uint32_t x, uint32_t y)
+{
+  return (x > (67 + CIRCLE_PENCIL)) && (y > (7 + CIRCLE_PENCIL)) &&
+		 (x < (BSP_LCD_GetXSize() - (7  + CIRCLE_PENCIL))) && (y < (BSP_LCD_GetYSize() - (155 + CIRCLE_PENCIL)));
+}
+
+static void check_menu(uint32_t x, uint32_t y)
+{
+  uint32_t color;
 
-  if ((TS_State.TouchDetected) && (x > 5) && (x < 55))
+  if ((x > 5) && (x < 55))
   {
+    /* the menu draws with the BSP, pending stamps go first */
+    brush_wait();
+
     /* User selects one of the color pens */
     if ((y > 45) && (y < 85))
     {
@@ -258,34 +1024,25 @@ static void check_touch(void)
       /* Clear the working window */
       BSP_LCD_FillRect(68, 8, 159, 159);
       BSP_LCD_SetTextColor(color);
+      stroke_clear();
+#if MODEL_STROKE
+      stroke_model_clear();
+#endif
     }
     else if ((y > (275)) && (y < (320)))
     {
     	BSP_LED_On(LED4);
     	_run_model = 1;
     }
-    else
-    {
-      x = 0;
-      y = 0;
-    }
     update_color();
   }
-  else if ((TS_State.TouchDetected) && (x > (67 + CIRCLE_PENCIL)) && (y > (7 + CIRCLE_PENCIL)) &&
-		  (x < (BSP_LCD_GetXSize() - (7  + CIRCLE_PENCIL))) && (y < (BSP_LCD_GetYSize() - (155 + CIRCLE_PENCIL))))
-  {
-    BSP_LCD_FillCircle(x, y, CIRCLE_PENCIL); /*here its where you touched */
-  }
 }
 
 void draw_menu(void)
 {
-	/* Set background Layer */
+	/* Set background Layer, display_init cleared it */
 	BSP_LCD_SelectLayer(0);
 
-	/* Clear the LCD */
-	BSP_LCD_Clear(LCD_COLOR_WHITE);
-
 	/* Draw clean image */
 	BSP_LCD_DrawBitmap(0, BSP_LCD_GetYSize()-100, (uint8_t *)clean_bmp);
 
@@ -341,6 +1098,7 @@ static void update_color(void)
   BSP_LCD_SetTextColor(color);
 }
 
+#if !MODEL_PREPROCESS
 /* rgb to gray scale using CIE formula */
 static void rgb2gray(void)
 {
@@ -400,54 +1158,20 @@ static void resize_bilnear(void)
 		}
 	}
 }
+#endif
 
-/* Save the working window where was drawn the number */
+/* Save the working window where was drawn the number: RGB888 in
+ * WORKING_FRAME_BUFFER, or in L8 the gray image in GRAY_WORKING_FRAME_BUFFER.
+ * LCD row 6 + r goes to working row r */
 static void prepare_working_window(void)
 {
-  static DMA2D_HandleTypeDef hdma2d_dk;
-  uint32_t address1 = WORKING_FRAME_BUFFER;
-  uint32_t address2 = LCD_FRAME_BUFFER_LAYER0;
-  uint32_t index = 0;
-
-  memset((void*)WORKING_FRAME_BUFFER, 0xff, (size_t)380*240*4);
-
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  hdma2d_dk.Init.Mode         = DMA2D_M2M_PFC;
-  hdma2d_dk.Init.ColorMode    = DMA2D_RGB888;
-  hdma2d_dk.Init.OutputOffset = 0;
-
-  /* Foreground Configuration */
-  hdma2d_dk.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hdma2d_dk.LayerCfg[1].InputAlpha = 0xFF;
-  hdma2d_dk.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
-  hdma2d_dk.LayerCfg[1].InputOffset = 60;
-
-  hdma2d_dk.Instance = DMA2D;
-
-  /* Bypass the bitmap header */
-  address2 += ((BSP_LCD_GetXSize() * (BSP_LCD_GetYSize()-154) + 67) * 4);
-
-  /* Addressing problem with image rotate */
-  address1 += 160*160*3;
-
-  /* Convert picture to RGB888 pixel format */
-  for(index=0; index < (BSP_LCD_GetYSize() - 160); index++)
+  if (display_format() == DISPLAY_L8)
   {
-    /* DMA2D Initialization */
-    if(HAL_DMA2D_Init(&hdma2d_dk) == HAL_OK)
-    {
-      if(HAL_DMA2D_ConfigLayer(&hdma2d_dk, 1) == HAL_OK)
-      {
-        if (HAL_DMA2D_Start(&hdma2d_dk, address2, address1, (BSP_LCD_GetXSize() - 80), 1) == HAL_OK)
-        {
-          /* Polling For DMA transfer */
-          HAL_DMA2D_PollForTransfer(&hdma2d_dk, 10);
-        }
-      }
-    }
-    /* Decrement the source and destination buffers */
-    address1 -= ((BSP_LCD_GetXSize() - 80)*3);
-    address2 -= BSP_LCD_GetXSize()*4;
+    display_read_gray(67, 6, WORKING_WIDTH, WORKING_HEIGHT, (uint8_t *)GRAY_WORKING_FRAME_BUFFER);
+  }
+  else
+  {
+    display_read_rgb888(67, 6, WORKING_WIDTH, WORKING_HEIGHT, (uint8_t *)WORKING_FRAME_BUFFER);
   }
 }
 
@@ -0,0 +1,145 @@
+/*
+ * model_source.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Where the model flatbuffer comes from.
+ *
+ *  The model is read in place from flash or SDRAM. The files are for the
+ *  host tools only: the tree has no FatFs middleware or disk driver.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "model_source.h"
+
+#if MODEL_SOURCE_HOST
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static const char * const model_source_names[MODEL_SOURCES] = { "array", "file", "mmap" };
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+uint8_t model_source_array (model_source_t * source, const uint8_t * data, uint32_t size)
+{
+	source->data = data;
+	source->size = size;
+	source->kind = MODEL_SOURCE_ARRAY;
+	return 1;
+}
+
+uint8_t model_source_file (model_source_t * source, const char * path, uint8_t * buffer, uint32_t capacity)
+{
+	uint32_t size = 0;
+
+	if ((uintptr_t)buffer % MODEL_SOURCE_ALIGNMENT)
+		return 0;
+
+#if MODEL_SOURCE_HOST
+	FILE * file = fopen(path, "rb");
+	long length;
+
+	if (file == NULL)
+		return 0;
+	if ((fseek(file, 0, SEEK_END) != 0) || ((length = ftell(file)) <= 0) ||
+		((unsigned long)length > capacity) || (fseek(file, 0, SEEK_SET) != 0) ||
+		(fread(buffer, 1, (size_t)length, file) != (size_t)length))
+	{
+		fclose(file);
+		return 0;
+	}
+	fclose(file);
+	size = (uint32_t)length;
+#else
+	(void)path;
+	(void)capacity;
+	return 0;
+#endif
+
+	source->data = buffer;
+	source->size = size;
+	source->kind = MODEL_SOURCE_FILE;
+	return 1;
+}
+
+uint8_t model_source_mmap (model_source_t * source, const char * path)
+{
+#if MODEL_SOURCE_HOST
+	struct stat status;
+	void * data;
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0)
+		return 0;
+	if ((fstat(fd, &status) != 0) || (status.st_size <= 0) || (status.st_size > UINT32_MAX))
+	{
+		close(fd);
+		return 0;
+	}
+	/* page aligned, the mapping outlives the descriptor */
+	data = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return 0;
+
+	source->data = (const uint8_t *)data;
+	source->size = (uint32_t)status.st_size;
+	source->kind = MODEL_SOURCE_MMAP;
+	return 1;
+#else
+	(void)source;
+	(void)path;
+	return 0;
+#endif
+}
+
+void model_source_close (model_source_t * source)
+{
+#if MODEL_SOURCE_HOST
+	if (source->kind == MODEL_SOURCE_MMAP)
+		munmap((void *)source->data, source->size);
+#endif
+	source->data = NULL;
+	source->size = 0;
+}
+
+const char * model_source_name (uint32_t kind)
+{
+	return (kind < MODEL_SOURCES) ? model_source_names[kind] : "?";
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
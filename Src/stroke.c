@@ -0,0 +1,260 @@
+/*
+ * stroke.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Vector stroke capture and analytic rasterization.
+ *
+ *  The pixel pipeline reads the working window back from the framebuffer,
+ *  converts 160x160 pixels to gray and samples them down to 28x28. Here the
+ *  strokes are kept as polylines of touch points and every input pixel is
+ *  computed from its distance to them: a pen of radius r drawn by the brush
+ *  covers the LCD pixels whose center is closer than r + 1/2, with a one
+ *  pixel anti-aliased edge, so the coverage at a sample point is
+ *  clamp(r + 1 - d, 0, 1). Only the input pixels near each segment are
+ *  visited. Points of one stroke are merged by taking the largest coverage
+ *  and the strokes are composited in drawing order, like the brush does.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+
+#include "stroke.h"
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+	uint8_t ink;		/* gray level of the pen color, as rgb2gray computes it */
+	uint8_t start;		/* first point of a stroke */
+} stroke_point_t;
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static stroke_point_t stroke_points[STROKE_MAX_POINTS];
+static uint32_t stroke_count;
+static uint8_t stroke_lost;
+static uint8_t stroke_ink;
+
+/* coverage reaches 0 at this distance from the pen center */
+static float stroke_reach;
+static float stroke_x;
+static float stroke_y;
+static uint32_t stroke_width;
+static uint32_t stroke_height;
+
+/* rasterization: current input size and sampling step */
+static uint32_t raster_width;
+static uint32_t raster_height;
+static float raster_step_x;
+static float raster_step_y;
+static float raster_image[STROKE_MAX_INPUT];
+static float raster_cover[STROKE_MAX_INPUT];
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+static uint8_t stroke_gray(uint32_t color);
+static void stroke_add(uint32_t x, uint32_t y, uint8_t start);
+static void raster_segment(const stroke_point_t * p0, const stroke_point_t * p1);
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+void stroke_init (uint32_t radius, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+	stroke_reach = (float)radius + 1.0f;
+	stroke_x = (float)x;
+	stroke_y = (float)y;
+	stroke_width = width;
+	stroke_height = height;
+	stroke_clear();
+}
+
+void stroke_clear (void)
+{
+	stroke_count = 0;
+	stroke_lost = 0;
+}
+
+void stroke_start (uint32_t x, uint32_t y, uint32_t color)
+{
+	stroke_ink = stroke_gray(color);
+	stroke_add(x, y, 1);
+}
+
+void stroke_continue (uint32_t x, uint32_t y)
+{
+	stroke_add(x, y, (stroke_count == 0) ? 1 : 0);
+}
+
+uint8_t stroke_overflow (void)
+{
+	return stroke_lost;
+}
+
+void stroke_rasterize (int8_t * input, uint32_t in_width, uint32_t in_height, int32_t zero_point)
+{
+	uint32_t pixels = in_width * in_height;
+	uint32_t first, last, i;
+	float ink;
+
+	if (pixels > STROKE_MAX_INPUT)
+		return;
+
+	raster_width = in_width;
+	raster_height = in_height;
+	raster_step_x = ((float)(stroke_width - 1)) / in_width;
+	raster_step_y = ((float)(stroke_height - 1)) / in_height;
+
+	memset(raster_image, 0, pixels * sizeof(float));
+
+	for (first = 0; first < stroke_count; first = last)
+	{
+		/* the stroke is [first, last) */
+		for (last = first + 1; (last < stroke_count) && !stroke_points[last].start; last++)
+		{
+		}
+
+		memset(raster_cover, 0, pixels * sizeof(float));
+		if (last - first == 1)
+		{
+			raster_segment(&stroke_points[first], &stroke_points[first]);
+		}
+		for (i = first + 1; i < last; i++)
+		{
+			raster_segment(&stroke_points[i - 1], &stroke_points[i]);
+		}
+
+		/* over the strokes drawn before, the pen color is opaque */
+		ink = (float)stroke_points[first].ink;
+		for (i = 0; i < pixels; i++)
+		{
+			raster_image[i] += (ink - raster_image[i]) * raster_cover[i];
+		}
+	}
+
+	/* truncated as resize_bilnear does, offset as update_tensor_input does */
+	for (i = 0; i < pixels; i++)
+	{
+		input[i] = (int8_t)((int32_t)raster_image[i] + zero_point);
+	}
+}
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+/* The gray level rgb2gray gives this color. The DMA2D stores RGB888 as
+ * B, G, R bytes, which rgb2gray reads as r, g, b: the red and blue
+ * weights apply to the other channel and are swapped here as well */
+static uint8_t stroke_gray(uint32_t color)
+{
+	float r = (float)((color >> 16) & 0xFF);
+	float g = (float)((color >> 8) & 0xFF);
+	float b = (float)(color & 0xFF);
+	float l = 255.0f - (0.2126f*b + 0.7152f*g + 0.0722f*r);
+
+	return (l > 0.0f) ? (uint8_t)l : 0;
+}
+
+static void stroke_add(uint32_t x, uint32_t y, uint8_t start)
+{
+	stroke_point_t * point;
+
+	/* the touch screen repeats points while the pen rests */
+	if (!start && (stroke_points[stroke_count - 1].x == (int16_t)x) &&
+		(stroke_points[stroke_count - 1].y == (int16_t)y))
+		return;
+
+	if (stroke_count == STROKE_MAX_POINTS)
+	{
+		stroke_lost = 1;
+		return;
+	}
+
+	point = &stroke_points[stroke_count++];
+	point->x = (int16_t)x;
+	point->y = (int16_t)y;
+	point->ink = stroke_ink;
+	point->start = start;
+}
+
+/* Pen coverage of the segment p0-p1 at the sample points around it */
+static void raster_segment(const stroke_point_t * p0, const stroke_point_t * p1)
+{
+	float x0 = p0->x, y0 = p0->y;
+	float dx = (float)(p1->x - p0->x);
+	float dy = (float)(p1->y - p0->y);
+	float length2 = dx * dx + dy * dy;
+	float reach2 = stroke_reach * stroke_reach;
+	float px, py, t, ex, ey, d2, cover;
+	int32_t i0, i1, j0, j1, i, j;
+
+	/* sample points inside the bounding box of the segment and the pen */
+	j0 = (int32_t)ceilf(((dx < 0 ? x0 + dx : x0) - stroke_reach - stroke_x) / raster_step_x);
+	j1 = (int32_t)floorf(((dx < 0 ? x0 : x0 + dx) + stroke_reach - stroke_x) / raster_step_x);
+	i0 = (int32_t)ceilf(((dy < 0 ? y0 + dy : y0) - stroke_reach - stroke_y) / raster_step_y);
+	i1 = (int32_t)floorf(((dy < 0 ? y0 : y0 + dy) + stroke_reach - stroke_y) / raster_step_y);
+	if (j0 < 0)
+		j0 = 0;
+	if (i0 < 0)
+		i0 = 0;
+	if (j1 >= (int32_t)raster_width)
+		j1 = (int32_t)raster_width - 1;
+	if (i1 >= (int32_t)raster_height)
+		i1 = (int32_t)raster_height - 1;
+
+	for (i = i0; i <= i1; i++)
+	{
+		py = stroke_y + raster_step_y * i - y0;
+		for (j = j0; j <= j1; j++)
+		{
+			px = stroke_x + raster_step_x * j - x0;
+
+			/* closest point of the segment */
+			t = 0.0f;
+			if (length2 > 0.0f)
+			{
+				t = (px * dx + py * dy) / length2;
+				if (t < 0.0f)
+					t = 0.0f;
+				else if (t > 1.0f)
+					t = 1.0f;
+			}
+			ex = px - t * dx;
+			ey = py - t * dy;
+			d2 = ex * ex + ey * ey;
+			if (d2 >= reach2)
+				continue;
+
+			cover = stroke_reach - sqrtf(d2);
+			if (cover > 1.0f)
+				cover = 1.0f;
+			if (cover > raster_cover[i * raster_width + j])
+				raster_cover[i * raster_width + j] = cover;
+		}
+	}
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
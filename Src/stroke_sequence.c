@@ -0,0 +1,152 @@
+/*
+ * stroke_sequence.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Touch points to sequence model timesteps.
+ *
+ *  The pen position of the last step is kept; a touch point far enough from
+ *  it becomes the move to it, cut in equal parts of at most
+ *  STROKE_SEQ_MAX_MOVE pixels at the same integer points draw_segment
+ *  stamps. Points closer than STROKE_SEQ_MIN_MOVE are only remembered, the
+ *  end of the stroke flushes the last one.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <stdlib.h>
+
+#include "stroke_sequence.h"
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static int32_t seq_origin_x;
+static int32_t seq_origin_y;
+
+/* pen position of the last step, and the last touch point */
+static int32_t seq_x;
+static int32_t seq_y;
+static int32_t seq_last_x;
+static int32_t seq_last_y;
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+static uint32_t seq_move(int32_t x, int32_t y, int8_t pen, int32_t max_count, int8_t * steps);
+static int8_t seq_clamp(int32_t value);
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+void stroke_seq_init (uint32_t x, uint32_t y)
+{
+	seq_origin_x = (int32_t)x;
+	seq_origin_y = (int32_t)y;
+	stroke_seq_clear();
+}
+
+void stroke_seq_clear (void)
+{
+	seq_x = seq_origin_x;
+	seq_y = seq_origin_y;
+	seq_last_x = seq_x;
+	seq_last_y = seq_y;
+}
+
+uint32_t stroke_seq_start (uint32_t x, uint32_t y, int8_t * steps)
+{
+	seq_last_x = (int32_t)x;
+	seq_last_y = (int32_t)y;
+	return seq_move(seq_last_x, seq_last_y, STROKE_SEQ_PEN_UP, STROKE_SEQ_MAX_STEPS, steps);
+}
+
+uint32_t stroke_seq_continue (uint32_t x, uint32_t y, int8_t * steps)
+{
+	seq_last_x = (int32_t)x;
+	seq_last_y = (int32_t)y;
+	if ((abs(seq_last_x - seq_x) < STROKE_SEQ_MIN_MOVE) && (abs(seq_last_y - seq_y) < STROKE_SEQ_MIN_MOVE))
+		return 0;
+	return seq_move(seq_last_x, seq_last_y, STROKE_SEQ_PEN_DOWN, STROKE_SEQ_MAX_STEPS, steps);
+}
+
+uint32_t stroke_seq_end (int8_t * steps)
+{
+	uint32_t count = 0;
+
+	/* one step is kept for the end step */
+	if ((seq_last_x != seq_x) || (seq_last_y != seq_y))
+		count = seq_move(seq_last_x, seq_last_y, STROKE_SEQ_PEN_DOWN, STROKE_SEQ_MAX_STEPS - 1, steps);
+
+	steps += count * STROKE_SEQ_FEATURES;
+	steps[0] = 0;
+	steps[1] = 0;
+	steps[2] = STROKE_SEQ_PEN_END;
+	return count + 1;
+}
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+/* The move from the pen position to x, y in equal parts, always one step
+ * and at most max_count */
+static uint32_t seq_move(int32_t x, int32_t y, int8_t pen, int32_t max_count, int8_t * steps)
+{
+	int32_t dx = x - seq_x;
+	int32_t dy = y - seq_y;
+	int32_t length = (abs(dx) > abs(dy)) ? abs(dx) : abs(dy);
+	int32_t count = (length + STROKE_SEQ_MAX_MOVE - 1) / STROKE_SEQ_MAX_MOVE;
+	int32_t px = seq_x, py = seq_y, nx, ny, i;
+
+	if (count < 1)
+		count = 1;
+	if (count > max_count)
+		count = max_count;
+
+	for (i = 1; i <= count; i++)
+	{
+		nx = seq_x + (dx * i) / count;
+		ny = seq_y + (dy * i) / count;
+		steps[0] = seq_clamp((nx - px) * STROKE_SEQ_UNIT);
+		steps[1] = seq_clamp((ny - py) * STROKE_SEQ_UNIT);
+		steps[2] = pen;
+		steps += STROKE_SEQ_FEATURES;
+		px = nx;
+		py = ny;
+	}
+
+	seq_x = x;
+	seq_y = y;
+	return (uint32_t)count;
+}
+
+/* Parts only exceed STROKE_SEQ_MAX_MOVE on a screen wider than 240 pixels */
+static int8_t seq_clamp(int32_t value)
+{
+	if (value > 127)
+		return 127;
+	if (value < -127)
+		return -127;
+	return (int8_t)value;
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
@@ -43,7 +43,10 @@
   ******************************************************************************
   */
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+
 #include "main.h"
+#include "display.h"
 
 /** @addtogroup STM32F4xx_HAL_Applications
   * @{
@@ -54,35 +57,64 @@
   */ 
 
 /* Private typedef -----------------------------------------------------------*/
+/* Calibration record, as stored in flash */
+typedef struct
+{
+  uint32_t Magic;
+  int32_t  A1, B1, A2, B2;   /* Q16: logical = (A * physical + B) >> 16 */
+  uint32_t Crc;              /* CRC-32 of the fields above */
+} TS_CalibrationTypeDef;
+
 /* Private define ------------------------------------------------------------*/
+#define CALIBRATION_MAGIC       0x31435354U   /* "TSC1" */
+#define CALIBRATION_SHIFT       16
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static TS_StateTypeDef  TS_State;
 static uint8_t Calibration_Done = 0;
-static int16_t  A1, A2, B1, B2;
+static int32_t  A1, A2, B1, B2;
 static int16_t aPhysX[2], aPhysY[2], aLogX[2], aLogY[2];
 
 /* Private function prototypes -----------------------------------------------*/
 static void TouchscreenCalibration_SetHint(void);
 static void GetPhysValues(int16_t LogX, int16_t LogY, int16_t * pPhysX, int16_t * pPhysY);
 static void WaitForPressedState(uint8_t Pressed);
+static uint8_t LoadCalibration(void);
+static uint8_t StoreCalibration(void);
+static uint32_t CalibrationCrc(const TS_CalibrationTypeDef * pCalibration);
 
 /* Private functions ---------------------------------------------------------*/
 
 /**
   * @brief  Performs the TS calibration
+  * @note   The calibration stored in flash is used when it is valid. The
+  *         touchscreen is calibrated again when it is missing, or when the
+  *         screen is touched while the board starts, and the new one stored.
   * @param  None
-  * @retval None
+  * @retval TS_CALIBRATION_LOADED, TS_CALIBRATION_STORED or
+  *         TS_CALIBRATION_NOT_STORED
   */
-void Touchscreen_Calibration(void)
+uint8_t Touchscreen_Calibration(void)
 { 
   uint8_t status = 0;
   uint8_t i = 0;
 
-  TouchscreenCalibration_SetHint();
-  
   status = BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
   
+  if (status == TS_OK)
+  {
+    /* Recalibration gesture: a finger on the screen at boot */
+    BSP_TS_GetState(&TS_State);
+    if (!TS_State.TouchDetected && LoadCalibration())
+    {
+      Calibration_Done = 1;
+      return TS_CALIBRATION_LOADED;
+    }
+  }
+
+  TouchscreenCalibration_SetHint();
+  
   if (status != TS_OK)
   {
     BSP_LCD_SetBackColor(LCD_COLOR_WHITE); 
@@ -95,6 +127,9 @@ void Touchscreen_Calibration(void)
   {
     if (status == TS_OK)
     {
+      /* The first press is the one of the circle, not the boot one */
+      WaitForPressedState(0);
+
       aLogX[0] = 15;
       aLogY[0] = 15;
       aLogX[1] = BSP_LCD_GetXSize() - 15;
@@ -104,14 +139,21 @@ void Touchscreen_Calibration(void)
       {
         GetPhysValues(aLogX[i], aLogY[i], &aPhysX[i], &aPhysY[i]);
       }
-      A1 = (1000 * ( aLogX[1] - aLogX[0]))/ ( aPhysX[1] - aPhysX[0]); 
-      B1 = (1000 * aLogX[0]) - A1 * aPhysX[0]; 
-      
-      A2 = (1000 * ( aLogY[1] - aLogY[0]))/ ( aPhysY[1] - aPhysY[0]); 
-      B2 = (1000 * aLogY[0]) - A2 * aPhysY[0]; 
-      
-      Calibration_Done = 1;
-      return;
+
+      /* Two presses at the same place give no scale: both circles again */
+      if ((aPhysX[1] != aPhysX[0]) && (aPhysY[1] != aPhysY[0]))
+      {
+        /* Q16, rounded: no division per sample */
+        A1 = ((int32_t)(aLogX[1] - aLogX[0]) << CALIBRATION_SHIFT) / (aPhysX[1] - aPhysX[0]);
+        B1 = ((int32_t)aLogX[0] << CALIBRATION_SHIFT) - A1 * aPhysX[0] + (1 << (CALIBRATION_SHIFT - 1));
+        
+        A2 = ((int32_t)(aLogY[1] - aLogY[0]) << CALIBRATION_SHIFT) / (aPhysY[1] - aPhysY[0]);
+        B2 = ((int32_t)aLogY[0] << CALIBRATION_SHIFT) - A2 * aPhysY[0] + (1 << (CALIBRATION_SHIFT - 1));
+        
+        Calibration_Done = 1;
+        return StoreCalibration() ? TS_CALIBRATION_STORED : TS_CALIBRATION_NOT_STORED;
+      }
+      continue;
     }
    
     HAL_Delay(5);
@@ -125,6 +167,9 @@ void Touchscreen_Calibration(void)
   */
 static void TouchscreenCalibration_SetHint(void)
 {
+  /* The boot clears of the layers first */
+  display_wait();
+
   /* Clear the LCD */ 
   BSP_LCD_Clear(LCD_COLOR_WHITE);
   
@@ -198,6 +243,93 @@ static void WaitForPressedState(uint8_t Pressed)
   } while (1);
 }
 
+/**
+  * @brief  Load the calibration from flash
+  * @param  None
+  * @retval 1 when the stored calibration is valid, 0 otherwise
+  */
+static uint8_t LoadCalibration(void)
+{
+  const TS_CalibrationTypeDef * stored = (const TS_CalibrationTypeDef *)TS_CALIBRATION_FLASH_ADDR;
+
+  /* An erased sector reads 0xFF */
+  if ((stored->Magic != CALIBRATION_MAGIC) || (stored->Crc != CalibrationCrc(stored)))
+  {
+    return 0;
+  }
+  A1 = stored->A1;
+  B1 = stored->B1;
+  A2 = stored->A2;
+  B2 = stored->B2;
+  return 1;
+}
+
+/**
+  * @brief  Store the calibration in flash
+  * @note   Erases the calibration sector and programs the record word by word.
+  * @param  None
+  * @retval 1 when stored, 0 on error
+  */
+static uint8_t StoreCalibration(void)
+{
+  FLASH_EraseInitTypeDef erase;
+  TS_CalibrationTypeDef calibration;
+  const uint32_t * words = (const uint32_t *)&calibration;
+  uint32_t sector_error = 0;
+  uint8_t ok = 1;
+  uint32_t i;
+
+  calibration.Magic = CALIBRATION_MAGIC;
+  calibration.A1 = A1;
+  calibration.B1 = B1;
+  calibration.A2 = A2;
+  calibration.B2 = B2;
+  calibration.Crc = CalibrationCrc(&calibration);
+
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Sector = TS_CALIBRATION_FLASH_SECTOR;
+  erase.NbSectors = 1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  HAL_FLASH_Unlock();
+  if (HAL_FLASHEx_Erase(&erase, &sector_error) != HAL_OK)
+  {
+    ok = 0;
+  }
+  for (i = 0; ok && (i < sizeof(calibration) / sizeof(uint32_t)); i++)
+  {
+    if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, TS_CALIBRATION_FLASH_ADDR + i * sizeof(uint32_t),
+                          words[i]) != HAL_OK)
+    {
+      ok = 0;
+    }
+  }
+  HAL_FLASH_Lock();
+  return ok;
+}
+
+/**
+  * @brief  CRC-32 (IEEE 802.3, reflected) of a calibration record
+  * @param  pCalibration: the record, its Crc field excluded
+  * @retval CRC
+  */
+static uint32_t CalibrationCrc(const TS_CalibrationTypeDef * pCalibration)
+{
+  const uint8_t * data = (const uint8_t *)pCalibration;
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i, bit;
+
+  for (i = 0; i < offsetof(TS_CalibrationTypeDef, Crc); i++)
+  {
+    crc ^= data[i];
+    for (bit = 0; bit < 8; bit++)
+    {
+      crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+  }
+  return ~crc;
+}
+
 /**
   * @brief  Calibrate X position
   * @param  x: X position
@@ -205,7 +337,7 @@ static void WaitForPressedState(uint8_t Pressed)
   */
 uint16_t Calibration_GetX(uint16_t x)
 {
-  return (((A1 * x) + B1)/1000);
+  return (uint16_t)((A1 * x + B1) >> CALIBRATION_SHIFT);
 }
 
 /**
@@ -215,7 +347,7 @@ uint16_t Calibration_GetX(uint16_t x)
   */
 uint16_t Calibration_GetY(uint16_t y)
 {
-  return (((A2 * y) + B2)/1000);
+  return (uint16_t)((A2 * y + B2) >> CALIBRATION_SHIFT);
 }
 
 /**
@@ -0,0 +1,392 @@
+/*
+ * ts_fifo.c
+ *
+ *  Created on: 19-Oct-2026
+ *      Author: reymor
+ *
+ *  Brief: Interrupt driven touch screen sampling.
+ *
+ *  BSP_TS_GetState does blocking I2C transactions and reads a single sample
+ *  per call, so a polled loop misses most of the points of a fast stroke.
+ *  Here the STMPE811 collects samples in its FIFO and raises its interrupt
+ *  when TS_FIFO_THRESHOLD are pending or the pen goes up/down. The interrupt
+ *  starts a chain of non-blocking I2C transfers:
+ *
+ *    READ_STATUS  registers 0x40..0x4C (touch status, FIFO size), DMA
+ *    READ_FIFO    up to TS_FIFO_BURST samples from TSC_DATA, DMA
+ *    CLEAR_INT    INT_STA write, IT
+ *
+ *  Samples are pushed into a single producer / single consumer queue. The
+ *  producer is only ever the interrupt chain (EXTI, I2C and DMA share one
+ *  priority, so they never preempt each other) and the consumer is the main
+ *  loop, so the queue needs no locks.
+ */
+
+
+/*---------------------------------------------------------------------*
+ *  include files                                                      *
+ *---------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "main.h"
+
+#include "ts_fifo.h"
+
+/*---------------------------------------------------------------------*
+ *  local definitions                                                  *
+ *---------------------------------------------------------------------*/
+#define TS_REG_FIRST				STMPE811_REG_TSC_CTRL
+#define TS_REG_COUNT				(STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL + 1U)
+#define TS_SAMPLE_BYTES				4U		/* XYZ acquisition: 12 bit X, 12 bit Y, 8 bit Z */
+#define TS_ENABLED_IT				(STMPE811_GIT_TOUCH | STMPE811_GIT_FTH | STMPE811_GIT_FOV)
+
+#define TS_I2C_DMA_CLK_ENABLE()		__HAL_RCC_DMA1_CLK_ENABLE()
+#define TS_I2C_DMA_STREAM_RX		DMA1_Stream2
+#define TS_I2C_DMA_CHANNEL			DMA_CHANNEL_3
+#define TS_I2C_DMA_RX_IRQn			DMA1_Stream2_IRQn
+#define TS_I2C_DMA_PREPRIO			0x0F
+
+typedef enum
+{
+	TS_STATE_IDLE = 0,
+	TS_STATE_READ_STATUS,
+	TS_STATE_READ_FIFO,
+	TS_STATE_CLEAR_INT
+} ts_state_t;
+
+/*---------------------------------------------------------------------*
+ *  external declarations                                              *
+ *---------------------------------------------------------------------*/
+extern I2C_HandleTypeDef I2cHandle;	/* stm32f429i_discovery.c */
+
+/*---------------------------------------------------------------------*
+ *  public data                                                        *
+ *---------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------*
+ *  private data                                                       *
+ *---------------------------------------------------------------------*/
+static DMA_HandleTypeDef ts_hdma_rx;
+
+static volatile ts_state_t ts_state = TS_STATE_IDLE;
+static uint8_t ts_regs[TS_REG_COUNT];
+static uint8_t ts_data[TS_FIFO_BURST * TS_SAMPLE_BYTES];
+static uint8_t ts_burst;
+static uint8_t ts_pending;
+static uint8_t ts_pen_down;
+static uint8_t ts_clear = 0xFF;
+
+static uint16_t ts_x_size;
+static uint16_t ts_y_size;
+
+/* Queue: head written by the interrupts only, tail by ts_fifo_read only */
+static ts_sample_t ts_queue[TS_FIFO_QUEUE_SIZE];
+static volatile uint32_t ts_head;
+static volatile uint32_t ts_tail;
+static volatile uint32_t ts_dropped;
+
+static volatile uint32_t ts_cycles;
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+static void ts_dma_init(void);
+static void ts_start(void);
+static void ts_read_fifo(void);
+static void ts_finish(void);
+static void ts_push(uint16_t x, uint16_t y, uint32_t tick, uint8_t flags);
+static void ts_raw_to_screen(uint16_t raw_x, uint16_t raw_y, uint16_t * x, uint16_t * y);
+
+/*---------------------------------------------------------------------*
+ *  public functions                                                   *
+ *---------------------------------------------------------------------*/
+
+void ts_fifo_init (void)
+{
+	ts_x_size = BSP_LCD_GetXSize();
+	ts_y_size = BSP_LCD_GetYSize();
+
+	/* DWT cycle counter for the timestamps and the CPU accounting */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	ts_dma_init();
+
+	/* Burst mode: interrupt every TS_FIFO_THRESHOLD samples instead of every one */
+	IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_FIFO_TH, TS_FIFO_THRESHOLD);
+	IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_FIFO_STA, 0x01);
+	IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_FIFO_STA, 0x00);
+
+	/* Pen up/down, FIFO threshold and overflow; not FIFO empty/full which would
+	 * fire on every burst */
+	IOE_ITConfig();
+	IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_INT_EN, TS_ENABLED_IT);
+	IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_INT_STA, 0xFF);
+	stmpe811_EnableGlobalIT(TS_I2C_ADDRESS);
+}
+
+uint32_t ts_fifo_read (ts_sample_t * samples, uint32_t max)
+{
+	uint32_t start = DWT->CYCCNT;
+	uint32_t tail = ts_tail;
+	uint32_t count = 0;
+
+	while ((count < max) && (tail != ts_head))
+	{
+		samples[count++] = ts_queue[tail & (TS_FIFO_QUEUE_SIZE - 1U)];
+		tail++;
+	}
+	/* the slots are read before they are handed back to the producer */
+	__DMB();
+	ts_tail = tail;
+
+	/* The controller keeps its line low until INT_STA is cleared, an edge
+	 * lost while a transfer failed would stall the chain forever */
+	if ((ts_state == TS_STATE_IDLE) &&
+		(HAL_GPIO_ReadPin(STMPE811_INT_GPIO_PORT, STMPE811_INT_PIN) == GPIO_PIN_RESET))
+	{
+		HAL_NVIC_SetPendingIRQ(STMPE811_INT_EXTI);
+	}
+
+	ts_cycles += DWT->CYCCNT - start;
+	return count;
+}
+
+uint32_t ts_fifo_dropped (void)
+{
+	return ts_dropped;
+}
+
+uint32_t ts_fifo_cpu_cycles (void)
+{
+	return ts_cycles;
+}
+
+void ts_fifo_add_cpu_cycles (uint32_t cycles)
+{
+	ts_cycles += cycles;
+}
+
+/*---------------------------------------------------------------------*
+ *  interrupts and HAL callbacks                                       *
+ *---------------------------------------------------------------------*/
+
+void STMPE811_INT_EXTIHandler (void)
+{
+	uint32_t start = DWT->CYCCNT;
+
+	__HAL_GPIO_EXTI_CLEAR_IT(STMPE811_INT_PIN);
+	if (ts_state == TS_STATE_IDLE)
+	{
+		ts_start();
+	}
+	else
+	{
+		ts_pending = 1; /* served when the current chain ends */
+	}
+
+	ts_cycles += DWT->CYCCNT - start;
+}
+
+void I2C3_EV_IRQHandler (void)
+{
+	uint32_t start = DWT->CYCCNT;
+	HAL_I2C_EV_IRQHandler(&I2cHandle);
+	ts_cycles += DWT->CYCCNT - start;
+}
+
+void I2C3_ER_IRQHandler (void)
+{
+	uint32_t start = DWT->CYCCNT;
+	HAL_I2C_ER_IRQHandler(&I2cHandle);
+	ts_cycles += DWT->CYCCNT - start;
+}
+
+void DMA1_Stream2_IRQHandler (void)
+{
+	uint32_t start = DWT->CYCCNT;
+	HAL_DMA_IRQHandler(I2cHandle.hdmarx);
+	ts_cycles += DWT->CYCCNT - start;
+}
+
+void HAL_I2C_MemRxCpltCallback (I2C_HandleTypeDef * hi2c)
+{
+	uint32_t tick = DWT->CYCCNT;
+	uint32_t i;
+	uint16_t raw_x, raw_y, x, y;
+	uint8_t * sample;
+
+	if (ts_state == TS_STATE_READ_STATUS)
+	{
+		if (ts_regs[STMPE811_REG_FIFO_SIZE - TS_REG_FIRST] > 0U)
+		{
+			ts_read_fifo();
+		}
+		else
+		{
+			ts_finish();
+		}
+	}
+	else if (ts_state == TS_STATE_READ_FIFO)
+	{
+		for (i = 0; i < ts_burst; i++)
+		{
+			sample = &ts_data[i * TS_SAMPLE_BYTES];
+			raw_x = ((uint16_t)sample[0] << 4) | (sample[1] >> 4);
+			raw_y = ((uint16_t)(sample[1] & 0x0F) << 8) | sample[2];
+			ts_raw_to_screen(raw_x, raw_y, &x, &y);
+			ts_push(x, y, tick, ts_pen_down ? 0U : TS_SAMPLE_PEN_DOWN);
+			ts_pen_down = 1;
+		}
+
+		/* more than one burst was pending */
+		if (ts_regs[STMPE811_REG_FIFO_SIZE - TS_REG_FIRST] > ts_burst)
+		{
+			ts_start();
+		}
+		else
+		{
+			ts_finish();
+		}
+	}
+}
+
+void HAL_I2C_MemTxCpltCallback (I2C_HandleTypeDef * hi2c)
+{
+	if (ts_state == TS_STATE_CLEAR_INT)
+	{
+		ts_state = TS_STATE_IDLE;
+		/* new samples or an edge that arrived meanwhile */
+		if (ts_pending ||
+			(HAL_GPIO_ReadPin(STMPE811_INT_GPIO_PORT, STMPE811_INT_PIN) == GPIO_PIN_RESET))
+		{
+			ts_start();
+		}
+	}
+}
+
+void HAL_I2C_ErrorCallback (I2C_HandleTypeDef * hi2c)
+{
+	/* drop this round, ts_fifo_read restarts the chain if the line is still low */
+	ts_state = TS_STATE_IDLE;
+}
+
+/*---------------------------------------------------------------------*
+ *  private functions                                                  *
+ *---------------------------------------------------------------------*/
+
+static void ts_dma_init(void)
+{
+	TS_I2C_DMA_CLK_ENABLE();
+
+	ts_hdma_rx.Instance                 = TS_I2C_DMA_STREAM_RX;
+	ts_hdma_rx.Init.Channel             = TS_I2C_DMA_CHANNEL;
+	ts_hdma_rx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+	ts_hdma_rx.Init.PeriphInc           = DMA_PINC_DISABLE;
+	ts_hdma_rx.Init.MemInc              = DMA_MINC_ENABLE;
+	ts_hdma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	ts_hdma_rx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+	ts_hdma_rx.Init.Mode                = DMA_NORMAL;
+	ts_hdma_rx.Init.Priority            = DMA_PRIORITY_HIGH;
+	ts_hdma_rx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+	ts_hdma_rx.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+	ts_hdma_rx.Init.MemBurst            = DMA_MBURST_SINGLE;
+	ts_hdma_rx.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+
+	__HAL_LINKDMA(&I2cHandle, hdmarx, ts_hdma_rx);
+	HAL_DMA_Init(&ts_hdma_rx);
+
+	/* same priority as the EXTI and I2C interrupts set by the BSP */
+	HAL_NVIC_SetPriority(TS_I2C_DMA_RX_IRQn, TS_I2C_DMA_PREPRIO, 0);
+	HAL_NVIC_EnableIRQ(TS_I2C_DMA_RX_IRQn);
+}
+
+/* Reads the touch status and FIFO size in one transfer */
+static void ts_start(void)
+{
+	ts_pending = 0;
+	ts_state = TS_STATE_READ_STATUS;
+	if (HAL_I2C_Mem_Read_DMA(&I2cHandle, TS_I2C_ADDRESS, TS_REG_FIRST, I2C_MEMADD_SIZE_8BIT,
+							 ts_regs, TS_REG_COUNT) != HAL_OK)
+	{
+		ts_state = TS_STATE_IDLE;
+	}
+}
+
+static void ts_read_fifo(void)
+{
+	uint8_t size = ts_regs[STMPE811_REG_FIFO_SIZE - TS_REG_FIRST];
+
+	ts_burst = (size > TS_FIFO_BURST) ? TS_FIFO_BURST : size;
+	ts_state = TS_STATE_READ_FIFO;
+	/* the non incrementing data register pops one FIFO entry per access */
+	if (HAL_I2C_Mem_Read_DMA(&I2cHandle, TS_I2C_ADDRESS, STMPE811_REG_TSC_DATA_NON_INC,
+							 I2C_MEMADD_SIZE_8BIT, ts_data, ts_burst * TS_SAMPLE_BYTES) != HAL_OK)
+	{
+		ts_state = TS_STATE_IDLE;
+	}
+}
+
+/* Ends the stroke if the pen is up and clears the controller interrupt */
+static void ts_finish(void)
+{
+	if (!(ts_regs[0] & STMPE811_TS_CTRL_STATUS) && ts_pen_down)
+	{
+		ts_push(0, 0, DWT->CYCCNT, TS_SAMPLE_PEN_UP);
+		ts_pen_down = 0;
+	}
+
+	ts_state = TS_STATE_CLEAR_INT;
+	if (HAL_I2C_Mem_Write_IT(&I2cHandle, TS_I2C_ADDRESS, STMPE811_REG_INT_STA, I2C_MEMADD_SIZE_8BIT,
+							 &ts_clear, 1) != HAL_OK)
+	{
+		ts_state = TS_STATE_IDLE;
+	}
+}
+
+static void ts_push(uint16_t x, uint16_t y, uint32_t tick, uint8_t flags)
+{
+	uint32_t head = ts_head;
+	ts_sample_t * slot;
+
+	if ((head - ts_tail) == TS_FIFO_QUEUE_SIZE)
+	{
+		ts_dropped++;
+		return;
+	}
+
+	slot = &ts_queue[head & (TS_FIFO_QUEUE_SIZE - 1U)];
+	slot->x = x;
+	slot->y = y;
+	slot->tick = tick;
+	slot->flags = flags;
+	/* the slot is written before it is published to the consumer */
+	__DMB();
+	ts_head = head + 1U;
+}
+
+/* The raw to screen mapping of BSP_TS_GetState, without its jitter filter */
+static void ts_raw_to_screen(uint16_t raw_x, uint16_t raw_y, uint16_t * x, uint16_t * y)
+{
+	int32_t xr, yr;
+
+	yr = ((int32_t)raw_y - 360) / 11;
+	if (yr < 0)
+		yr = 0;
+	else if (yr >= ts_y_size)
+		yr = ts_y_size - 1;
+
+	xr = (raw_x <= 3000) ? (3870 - (int32_t)raw_x) : (3800 - (int32_t)raw_x);
+	xr /= 15;
+	if (xr < 0)
+		xr = 0;
+	else if (xr >= ts_x_size)
+		xr = ts_x_size - 1;
+
+	*x = (uint16_t)xr;
+	*y = (uint16_t)yr;
+}
+
+/*---------------------------------------------------------------------*
+ *  eof                                                                *
+ *---------------------------------------------------------------------*/
@@ -72,6 +72,7 @@
 ------------------------------------------------------------------------------*/
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
 #include "stm32f429i_discovery_lcd.h"
 #include "Fonts/fonts.h"
 //#include "Fonts/font24.c"
@@ -136,8 +137,12 @@ LCD_DrvTypeDef  *LcdDrv;
   * @{
   */ 
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static void LayerInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat);
+static uint32_t GetBytesPerPixel(uint32_t LayerIndex);
+static uint32_t GetPixelAddress(uint16_t Xpos, uint16_t Ypos);
 static void FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 static void ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
+static void ConvertLineToL8(uint8_t *pSrc, uint8_t *pDst, uint32_t xSize, uint32_t BytesPerPixel);
 /**
   * @}
   */ 
@@ -253,6 +258,54 @@ uint32_t BSP_LCD_GetYSize(void)
   * @param  FB_Address: the layer frame buffer.
   */
 void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
+{     
+  LayerInit(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_ARGB8888);
+}
+
+/**
+  * @brief  Initializes a LCD layer in RGB565 format, 2 bytes per pixel.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  FB_Address: the layer frame buffer.
+  */
+void BSP_LCD_LayerRgb565Init(uint16_t LayerIndex, uint32_t FB_Address)
+{     
+  LayerInit(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_RGB565);
+}
+
+/**
+  * @brief  Initializes a LCD layer in L8 format, 1 byte per pixel.
+  *         The drawing functions store the luminance of the colors
+  *         (BSP_LCD_ColorToL8), the CLUT gives the displayed color of each.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  FB_Address: the layer frame buffer.
+  * @param  pCLUT: 256 colors in RGB888
+  */
+void BSP_LCD_LayerL8Init(uint16_t LayerIndex, uint32_t FB_Address, uint32_t *pCLUT)
+{     
+  LayerInit(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_L8);
+  HAL_LTDC_ConfigCLUT(&LtdcHandler, pCLUT, 256, LayerIndex);
+  HAL_LTDC_EnableCLUT(&LtdcHandler, LayerIndex);
+}
+
+/**
+  * @brief  Gets the L8 value of a color: its luminance, 
+  *         0.2126 R + 0.7152 G + 0.0722 B.
+  * @param  Color: the color in ARGB mode (8-8-8-8)
+  * @retval The luminance, 0 to 255
+  */
+uint8_t BSP_LCD_ColorToL8(uint32_t Color)
+{
+  return (uint8_t)((54 * ((Color >> 16) & 0xFF) + 183 * ((Color >> 8) & 0xFF) +
+                    19 * (Color & 0xFF) + 128) >> 8);
+}
+
+/**
+  * @brief  Initializes the LCD layers.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  FB_Address: the layer frame buffer.
+  * @param  PixelFormat: LTDC_PIXEL_FORMAT_ARGB8888, _RGB565 or _L8
+  */
+static void LayerInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat)
 {     
   LCD_LayerCfgTypeDef   Layercfg;
 
@@ -261,7 +314,7 @@ void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
   Layercfg.WindowX1 = BSP_LCD_GetXSize();
   Layercfg.WindowY0 = 0;
   Layercfg.WindowY1 = BSP_LCD_GetYSize(); 
-  Layercfg.PixelFormat = LTDC_PIXEL_FORMAT_ARGB8888;
+  Layercfg.PixelFormat = PixelFormat;
   Layercfg.FBStartAdress = FB_Address;
   Layercfg.Alpha = 255;
   Layercfg.Alpha0 = 0;
@@ -537,24 +590,24 @@ uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
   if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos)));
+    ret = *(__IO uint32_t*) (GetPixelAddress(Xpos, Ypos));
   }
   else if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
   {
     /* Read data value from SDRAM memory */
-    ret = (*(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) & 0x00FFFFFF);
+    ret = (*(__IO uint32_t*) (GetPixelAddress(Xpos, Ypos)) & 0x00FFFFFF);
   }
   else if((LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
           (LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
           (LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint16_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*BSP_LCD_GetXSize() + Xpos)));    
+    ret = *(__IO uint16_t*) (GetPixelAddress(Xpos, Ypos));    
   }
   else
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint8_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*BSP_LCD_GetXSize() + Xpos)));    
+    ret = *(__IO uint8_t*) (GetPixelAddress(Xpos, Ypos));    
   }
 
   return ret;
@@ -679,7 +732,7 @@ void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   uint32_t xaddress = 0;
   
   /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = GetPixelAddress(Xpos, Ypos);
 
   /* Write line */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
@@ -696,7 +749,7 @@ void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   uint32_t xaddress = 0;
   
   /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = GetPixelAddress(Xpos, Ypos);
   
   /* Write line */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, 1, Length, (BSP_LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
@@ -917,7 +970,7 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   bitpixel = pBmp[28] + (pBmp[29] << 8);   
  
   /* Set Address */
-  address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (((BSP_LCD_GetXSize()*Y) + X)*(4));
+  address = GetPixelAddress(X, Y);
 
   /* Get the Layer pixel format */    
   if ((bitpixel/8) == 4)
@@ -936,14 +989,21 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   /* bypass the bitmap header */
   pBmp += (index + (width * (height - 1) * (bitpixel/8)));
 
-  /* Convert picture to ARGB8888 pixel format */
+  /* Convert picture to the layer pixel format */
   for(index=0; index < height; index++)
   {
   /* Pixel format conversion */
-  ConvertLineToARGB8888((uint32_t *)pBmp, (uint32_t *)address, width, inputcolormode);
+  if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    ConvertLineToL8(pBmp, (uint8_t *)address, width, bitpixel/8);
+  }
+  else
+  {
+    ConvertLineToARGB8888((uint32_t *)pBmp, (uint32_t *)address, width, inputcolormode);
+  }
 
   /* Increment the source and destination buffers */
-  address+=  ((BSP_LCD_GetXSize() - width + width)*4);
+  address+=  (BSP_LCD_GetXSize()*GetBytesPerPixel(ActiveLayer));
   pBmp -= width*(bitpixel/8);
   }
 }
@@ -963,7 +1023,7 @@ void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
 
   /* Get the rectangle start address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = GetPixelAddress(Xpos, Ypos);
 
   /* Fill the rectangle */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, Width, Height, (BSP_LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
@@ -1308,7 +1368,56 @@ __weak void BSP_LCD_MspInit(void)
 void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
   /* Write data value to all SDRAM memory */
-  *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
+  if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    *(__IO uint16_t*) (GetPixelAddress(Xpos, Ypos)) = (uint16_t)(((RGB_Code & 0x00F80000) >> 8) |
+                                                                  ((RGB_Code & 0x0000FC00) >> 5) |
+                                                                  ((RGB_Code & 0x000000F8) >> 3));
+  }
+  else if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    *(__IO uint8_t*) (GetPixelAddress(Xpos, Ypos)) = BSP_LCD_ColorToL8(RGB_Code);
+  }
+  else
+  {
+    *(__IO uint32_t*) (GetPixelAddress(Xpos, Ypos)) = RGB_Code;
+  }
+}
+
+/**
+  * @brief  Gets the bytes per pixel of a layer.
+  * @param  LayerIndex: layer index
+  * @retval 4 for ARGB8888, 2 for RGB565, 1 for L8
+  */
+static uint32_t GetBytesPerPixel(uint32_t LayerIndex)
+{
+  switch(LtdcHandler.LayerCfg[LayerIndex].PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 3;
+  case LTDC_PIXEL_FORMAT_RGB565:
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+  case LTDC_PIXEL_FORMAT_AL88:
+    return 2;
+  case LTDC_PIXEL_FORMAT_L8:
+  case LTDC_PIXEL_FORMAT_AL44:
+    return 1;
+  default:
+    return 4;
+  }
+}
+
+/**
+  * @brief  Gets the address of a pixel of the active layer.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @retval The pixel address in the frame buffer
+  */
+static uint32_t GetPixelAddress(uint16_t Xpos, uint16_t Ypos)
+{
+  return LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress +
+         GetBytesPerPixel(ActiveLayer)*(Ypos*BSP_LCD_GetXSize() + Xpos);
 }
 
 /**
@@ -1376,10 +1485,30 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   */
 static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
 {
-  
-  /* Register to memory mode with ARGB8888 as color Mode */ 
+  uint8_t *pLine = (uint8_t *)pDst;
+  uint32_t y = 0;
+
+  /* The DMA2D has no L8 output */
+  if(LtdcHandler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    for(y = 0; y < ySize; y++)
+    {
+      memset(pLine, BSP_LCD_ColorToL8(ColorIndex), xSize);
+      pLine += xSize + OffLine;
+    }
+    return;
+  }
+
+  /* Register to memory mode with the layer color Mode */ 
   Dma2dHandler.Init.Mode         = DMA2D_R2M;
-  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
+  if(LtdcHandler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    Dma2dHandler.Init.ColorMode  = DMA2D_RGB565;
+  }
+  else
+  {
+    Dma2dHandler.Init.ColorMode  = DMA2D_ARGB8888;
+  }
   Dma2dHandler.Init.OutputOffset = OffLine;      
   
   Dma2dHandler.Instance = DMA2D; 
@@ -1399,7 +1528,8 @@ static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_
 }
 
 /**
-  * @brief  Converts Line to ARGB8888 pixel format.
+  * @brief  Converts Line to the pixel format of the active layer,
+  *         ARGB8888 or RGB565.
   * @param  pSrc: pointer to source buffer
   * @param  pDst: output color
   * @param  xSize: buffer width
@@ -1409,7 +1539,14 @@ static void ConvertLineToARGB8888(void * pSrc, void * pDst, uint32_t xSize, uint
 {    
   /* Configure the DMA2D Mode, Color Mode and output offset */
   Dma2dHandler.Init.Mode         = DMA2D_M2M_PFC;
-  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
+  if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    Dma2dHandler.Init.ColorMode  = DMA2D_RGB565;
+  }
+  else
+  {
+    Dma2dHandler.Init.ColorMode  = DMA2D_ARGB8888;
+  }
   Dma2dHandler.Init.OutputOffset = 0;     
   
   /* Foreground Configuration */
@@ -1434,6 +1571,36 @@ static void ConvertLineToARGB8888(void * pSrc, void * pDst, uint32_t xSize, uint
   } 
 }
 
+/**
+  * @brief  Converts a bitmap line to L8 with the CPU.
+  * @param  pSrc: pointer to source buffer, ARGB8888, RGB888 or RGB565
+  * @param  pDst: output luminance
+  * @param  xSize: buffer width
+  * @param  BytesPerPixel: 4, 3 or 2 for the source formats above
+  */
+static void ConvertLineToL8(uint8_t *pSrc, uint8_t *pDst, uint32_t xSize, uint32_t BytesPerPixel)
+{
+  uint32_t x = 0;
+  uint32_t color = 0;
+  uint32_t rgb565 = 0;
+
+  for(x = 0; x < xSize; x++)
+  {
+    if(BytesPerPixel == 2)
+    {
+      rgb565 = pSrc[0] | (pSrc[1] << 8);
+      color = ((rgb565 & 0xF800) << 8) | ((rgb565 & 0x07E0) << 5) | ((rgb565 & 0x001F) << 3);
+    }
+    else
+    {
+      /* stored as B, G, R (, A) */
+      color = (pSrc[2] << 16) | (pSrc[1] << 8) | pSrc[0];
+    }
+    pDst[x] = BSP_LCD_ColorToL8(color);
+    pSrc += BytesPerPixel;
+  }
+}
+
 /**
   * @}
   */ 
@@ -187,6 +187,9 @@ uint32_t BSP_LCD_GetYSize(void);
 
 /* functions using the LTDC controller */
 void     BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer);
+void     BSP_LCD_LayerRgb565Init(uint16_t LayerIndex, uint32_t FrameBuffer);
+void     BSP_LCD_LayerL8Init(uint16_t LayerIndex, uint32_t FrameBuffer, uint32_t *pCLUT);
+uint8_t  BSP_LCD_ColorToL8(uint32_t Color);
 void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
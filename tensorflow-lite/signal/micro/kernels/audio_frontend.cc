@@ -0,0 +1,233 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Fused Window -> Rfft (int16) -> Energy -> FilterBank.
+//
+// Produces the same output as the four separate signal ops, but keeps the
+// windowed frame and the spectrum in a scratch buffer that is only live during
+// this op, and computes the energy of each bin while accumulating the filter
+// bank channels instead of writing out an energy tensor.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "signal/src/complex.h"
+#include "signal/src/filter_bank.h"
+#include "signal/src/rfft.h"
+#include "signal/src/window.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kWindowWeightsTensor = 1;
+constexpr int kWeightTensor = 2;
+constexpr int kUnweightTensor = 3;
+constexpr int kChFreqStartsTensor = 4;
+constexpr int kChWeightStartsTensor = 5;
+constexpr int kChannelWidthsTensor = 6;
+constexpr int kOutputTensor = 0;
+
+// Indices into the init flexbuffer's vector.
+// The parameter's name is in the comment that follows.
+// Elements in the vectors are ordered alphabetically by parameter name.
+constexpr int kEndIndexIndex = 0;     // 'end_index'
+constexpr int kFftLengthIndex = 1;    // 'fft_length'
+constexpr int kNumChannelsIndex = 2;  // 'num_channels'
+constexpr int kShiftIndex = 3;        // 'shift'
+constexpr int kStartIndexIndex = 4;   // 'start_index'
+
+struct TFLMSignalAudioFrontendParams {
+  tflm_signal::FilterbankConfig config;
+  int32_t end_index;
+  int32_t fft_length;
+  int32_t shift;
+  int32_t start_index;
+  int32_t input_length;
+  int8_t* rfft_state;
+  // Scratch holding the zero padded, windowed frame followed by the spectrum.
+  int scratch_index;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+
+  auto* params = static_cast<TFLMSignalAudioFrontendParams*>(
+      context->AllocatePersistentBuffer(
+          context, sizeof(TFLMSignalAudioFrontendParams)));
+  if (params == nullptr) {
+    return nullptr;
+  }
+
+  tflite::FlexbufferWrapper fbw(reinterpret_cast<const uint8_t*>(buffer),
+                                length);
+  params->end_index = fbw.ElementAsInt32(kEndIndexIndex);
+  params->fft_length = fbw.ElementAsInt32(kFftLengthIndex);
+  params->config.num_channels = fbw.ElementAsInt32(kNumChannelsIndex);
+  params->shift = fbw.ElementAsInt32(kShiftIndex);
+  params->start_index = fbw.ElementAsInt32(kStartIndexIndex);
+
+  size_t state_size =
+      ::tflm_signal::RfftInt16GetNeededMemory(params->fft_length);
+  params->rfft_state = static_cast<int8_t*>(
+      context->AllocatePersistentBuffer(context, state_size * sizeof(int8_t)));
+  if (params->rfft_state == nullptr ||
+      ::tflm_signal::RfftInt16Init(params->fft_length, params->rfft_state,
+                                   state_size) == nullptr) {
+    return nullptr;
+  }
+  return params;
+}
+
+TfLiteStatus PrepareInt16Vector(TfLiteContext* context, TfLiteNode* node,
+                                int index) {
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, index);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 1);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt16);
+  micro_context->DeallocateTempTfLiteTensor(input);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 7);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  auto* params =
+      reinterpret_cast<TFLMSignalAudioFrontendParams*>(node->user_data);
+  TF_LITE_ENSURE(context, params != nullptr);
+
+  for (int index = kInputTensor; index <= kChannelWidthsTensor; ++index) {
+    TF_LITE_ENSURE_OK(context, PrepareInt16Vector(context, node, index));
+  }
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TfLiteTensor* window =
+      micro_context->AllocateTempInputTensor(node, kWindowWeightsTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TF_LITE_ENSURE(context, window != nullptr);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(output), 1);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteUInt64);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[0],
+                    params->config.num_channels);
+
+  params->input_length = input->dims->data[0];
+  TF_LITE_ENSURE_EQ(context, window->dims->data[0], params->input_length);
+  TF_LITE_ENSURE(context, params->input_length <= params->fft_length);
+  TF_LITE_ENSURE(context, params->start_index >= 0 &&
+                              params->end_index <= params->fft_length / 2 + 1);
+
+  // Energy is only defined for bins in [start_index, end_index), so every
+  // channel has to stay within that range for the fused op to match. The
+  // range can only be checked here if the channel tables are constant, so
+  // other tensors are rejected rather than left unchecked.
+  TfLiteTensor* freq_starts =
+      micro_context->AllocateTempInputTensor(node, kChFreqStartsTensor);
+  TfLiteTensor* widths =
+      micro_context->AllocateTempInputTensor(node, kChannelWidthsTensor);
+  TF_LITE_ENSURE(context, freq_starts != nullptr);
+  TF_LITE_ENSURE(context, widths != nullptr);
+  TF_LITE_ENSURE(context, IsConstantTensor(freq_starts));
+  TF_LITE_ENSURE(context, IsConstantTensor(widths));
+  const int16_t* freq_starts_data = GetTensorData<int16_t>(freq_starts);
+  const int16_t* widths_data = GetTensorData<int16_t>(widths);
+  for (int i = 0; i < params->config.num_channels + 1; ++i) {
+    if (widths_data[i] == 0) {
+      continue;
+    }
+    TF_LITE_ENSURE(context, freq_starts_data[i] >= params->start_index);
+    TF_LITE_ENSURE(context,
+                   freq_starts_data[i] + widths_data[i] <= params->end_index);
+  }
+
+  const size_t scratch_size =
+      params->fft_length * sizeof(int16_t) +
+      (params->fft_length / 2 + 1) * sizeof(Complex<int16_t>);
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, scratch_size, &params->scratch_index));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(window);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  micro_context->DeallocateTempTfLiteTensor(freq_starts);
+  micro_context->DeallocateTempTfLiteTensor(widths);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params =
+      reinterpret_cast<TFLMSignalAudioFrontendParams*>(node->user_data);
+
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kInputTensor);
+  const TfLiteEvalTensor* window =
+      tflite::micro::GetEvalInput(context, node, kWindowWeightsTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  params->config.weights = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kWeightTensor));
+  params->config.unweights = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kUnweightTensor));
+  params->config.channel_frequency_starts =
+      tflite::micro::GetTensorData<int16_t>(
+          tflite::micro::GetEvalInput(context, node, kChFreqStartsTensor));
+  params->config.channel_weight_starts = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kChWeightStartsTensor));
+  params->config.channel_widths = tflite::micro::GetTensorData<int16_t>(
+      tflite::micro::GetEvalInput(context, node, kChannelWidthsTensor));
+
+  int16_t* frame = static_cast<int16_t*>(
+      context->GetScratchBuffer(context, params->scratch_index));
+  Complex<int16_t>* spectrum =
+      reinterpret_cast<Complex<int16_t>*>(&frame[params->fft_length]);
+
+  ::tflm_signal::ApplyWindow(tflite::micro::GetTensorData<int16_t>(input),
+                             tflite::micro::GetTensorData<int16_t>(window),
+                             params->input_length, params->shift, frame);
+  // Zero pad input to FFT length
+  memset(&frame[params->input_length], 0,
+         sizeof(int16_t) * (params->fft_length - params->input_length));
+  ::tflm_signal::RfftInt16Apply(params->rfft_state, frame, spectrum);
+
+  tflm_signal::FilterbankAccumulateSpectrumEnergy(
+      &params->config, spectrum,
+      tflite::micro::GetTensorData<uint64_t>(output));
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+namespace tflm_signal {
+
+TFLMRegistration* Register_AUDIO_FRONTEND() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &r;
+}
+
+}  // namespace tflm_signal
+
+}  // namespace tflite
@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 
 #include <stdint.h>
+#include <string.h>
 
 #include "signal/src/circular_buffer.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -167,9 +168,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       if (tflite::tflm_signal::CircularBufferAvailable(
               params->circular_buffers[i]) >=
           static_cast<size_t>(params->frame_size)) {
-        tflite::tflm_signal::CircularBufferGet(params->circular_buffers[i],
-                                               params->frame_size,
-                                               &output_data[output_idx]);
+        // The frame is a contiguous view into the ring, even if it wraps.
+        const int16_t* frame = tflite::tflm_signal::CircularBufferView(
+            params->circular_buffers[i], params->frame_size);
+        memcpy(&output_data[output_idx], frame,
+               params->frame_size * sizeof(int16_t));
         tflite::tflm_signal::CircularBufferDiscard(params->circular_buffers[i],
                                                    params->frame_step);
       } else {
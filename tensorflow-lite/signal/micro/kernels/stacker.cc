@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 
 #include <stdint.h>
+#include <string.h>
 
 #include "signal/src/circular_buffer.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -146,8 +147,9 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   bool* output_valid_data = tflite::micro::GetTensorData<bool>(output_valid);
   if (tflm_signal::CircularBufferAvailable(params->circular_buffer) >=
       params->buffer_size) {
-    tflm_signal::CircularBufferGet(params->circular_buffer, params->buffer_size,
-                                   output_data);
+    const int16_t* stacked = tflm_signal::CircularBufferView(
+        params->circular_buffer, params->buffer_size);
+    memcpy(output_data, stacked, params->buffer_size * sizeof(int16_t));
     tflm_signal::CircularBufferDiscard(params->circular_buffer,
                                        params->step_size);
     *output_valid_data = true;
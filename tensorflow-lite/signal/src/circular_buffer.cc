@@ -257,6 +257,40 @@ void CircularBufferGet(tflm_signal::CircularBuffer* cb, size_t n,
   }
 }
 
+const int16_t* CircularBufferView(const tflm_signal::CircularBuffer* cb,
+                                  size_t n) {
+  ASSERT(CircularBufferAvailable(cb) >= n);
+  return cb->buffer + cb->read;
+}
+
+int16_t* CircularBufferWriteRegion(tflm_signal::CircularBuffer* cb,
+                                   size_t* n) {
+  *n = CircularBufferCanWrite(cb);
+  return cb->buffer + cb->write;
+}
+
+void CircularBufferCommitWrite(tflm_signal::CircularBuffer* cb, size_t n) {
+  if (n > 0) {
+    ASSERT(CircularBufferCanWrite(cb) >= n);
+    int16_t* buffer = cb->buffer;
+    const size_t capacity = cb->capacity;
+    const size_t write = cb->write;
+    const size_t end = write + n;
+    // Copy every value to its other half so views over the region stay
+    // contiguous. Those past the end were written to the mirrored half.
+    if (end < capacity) {
+      memcpy(buffer + capacity + write, buffer + write, n * sizeof(int16_t));
+      cb->write = end;
+    } else {
+      const size_t n1 = capacity - write;
+      memcpy(buffer + capacity + write, buffer + write, n1 * sizeof(int16_t));
+      memcpy(buffer, buffer + capacity, (end - capacity) * sizeof(int16_t));
+      cb->write = end - capacity;
+    }
+    cb->empty = 0;
+  }
+}
+
 void CircularBufferDiscard(tflm_signal::CircularBuffer* cb, size_t n) {
   ASSERT(n > 0);
   ASSERT(CircularBufferAvailable(cb) >= n);
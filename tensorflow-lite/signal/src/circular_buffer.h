@@ -104,6 +104,23 @@ const int16_t* CircularBufferPeekMax(const CircularBuffer* cb, size_t* n);
 // pointer and does not update the empty flag.
 void CircularBufferGet(CircularBuffer* cb, size_t n, int16_t* values);
 
+// Returns a pointer to the next `n` values in the buffer without copying them,
+// and does not advance the read pointer. Every element is mirrored `capacity`
+// positions further on, so the view is contiguous even when it wraps around
+// the end of the buffer. The view stays valid until its values are discarded.
+const int16_t* CircularBufferView(const CircularBuffer* cb, size_t n);
+
+// Returns a pointer at the current write position where values can be
+// produced in place (e.g. by a DMA or a file reader), setting `n` to the
+// number of values that can be written. The region is contiguous even when it
+// wraps: the values past the end land in the mirrored half. They become
+// readable once they are committed with CircularBufferCommitWrite.
+int16_t* CircularBufferWriteRegion(CircularBuffer* cb, size_t* n);
+
+// Commits `n` values written through CircularBufferWriteRegion and advances
+// the write pointer. `n` must not exceed the size returned for the region.
+void CircularBufferCommitWrite(CircularBuffer* cb, size_t n);
+
 // Discards the next `n` values by advancing the read index.
 // Valid for n > 0.
 void CircularBufferDiscard(CircularBuffer* cb, size_t n);
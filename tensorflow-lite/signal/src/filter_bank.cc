@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "signal/src/filter_bank.h"
 
+#include "signal/src/complex.h"
+
 namespace tflite {
 namespace tflm_signal {
 
@@ -49,5 +51,34 @@ void FilterbankAccumulateChannels(const FilterbankConfig* config,
   }
 }
 
+void FilterbankAccumulateSpectrumEnergy(const FilterbankConfig* config,
+                                        const Complex<int16_t>* spectrum,
+                                        uint64_t* output) {
+  // See FilterbankAccumulateChannels() for the weight/unweight scheme.
+  uint64_t weight_accumulator = 0;
+  uint64_t unweight_accumulator = 0;
+  for (int i = 0; i < config->num_channels + 1; i++) {
+    const int16_t freq_start = config->channel_frequency_starts[i];
+    const int16_t weight_start = config->channel_weight_starts[i];
+    for (int j = 0; j < config->channel_widths[i]; ++j) {
+      const int16_t real = spectrum[freq_start + j].real;
+      const int16_t imag = spectrum[freq_start + j].imag;
+      // Wraps exactly like SpectrumToEnergy() for a full scale bin.
+      const uint32_t energy =
+          static_cast<uint32_t>(static_cast<int32_t>(real) * real) +
+          static_cast<uint32_t>(static_cast<int32_t>(imag) * imag);
+      weight_accumulator +=
+          config->weights[weight_start + j] * static_cast<uint64_t>(energy);
+      unweight_accumulator +=
+          config->unweights[weight_start + j] * static_cast<uint64_t>(energy);
+    }
+    if (i > 0) {
+      output[i - 1] = weight_accumulator;
+    }
+    weight_accumulator = unweight_accumulator;
+    unweight_accumulator = 0;
+  }
+}
+
 }  // namespace tflm_signal
 }  // namespace tflite
\ No newline at end of file
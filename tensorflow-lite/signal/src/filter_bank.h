@@ -18,6 +18,8 @@ limitations under the License.
 
 #include <stdint.h>
 
+#include "signal/src/complex.h"
+
 namespace tflite {
 namespace tflm_signal {
 // TODO(b/286250473): remove namespace once de-duped libraries above
@@ -63,6 +65,16 @@ struct FilterbankConfig {
 void FilterbankAccumulateChannels(const FilterbankConfig* config,
                                   const uint32_t* input, uint64_t* output);
 
+// Same as SpectrumToEnergy() followed by FilterbankAccumulateChannels(), but
+// computes the energy of each bin of `spectrum` as it is accumulated instead
+// of materializing the energy array.
+// * `spectrum` - DFT output. Every bin spanned by a channel must be valid.
+// * `output` - of size `config.num_channels`. The scratch channel 0 of
+//              FilterbankAccumulateChannels() is not written.
+void FilterbankAccumulateSpectrumEnergy(const FilterbankConfig* config,
+                                        const Complex<int16_t>* spectrum,
+                                        uint64_t* output);
+
 }  // namespace tflm_signal
 }  // namespace tflite
 
@@ -19,24 +19,59 @@ limitations under the License.
 #include "signal/src/complex.h"
 #include "signal/src/kiss_fft_wrappers/kiss_fft_int16.h"
 #include "signal/src/rfft.h"
+#include "signal/src/rfft_int16_radix4.h"
 
 // TODO(b/286250473): remove namespace once de-duped libraries
 namespace tflm_signal {
+namespace {
+
+// Power of two lengths covered by the radix-4 twiddle tables use the radix-4
+// implementation, everything else falls back to kiss_fftr. Both produce the
+// same bits, so the choice is invisible to callers.
+struct RfftInt16State {
+  bool use_radix4;
+  void* impl_state;
+};
+
+}  // namespace
 
 size_t RfftInt16GetNeededMemory(int32_t fft_length) {
+  if (RfftInt16Radix4IsSupported(fft_length)) {
+    return sizeof(RfftInt16State) + RfftInt16Radix4GetNeededMemory(fft_length);
+  }
   size_t state_size = 0;
   kiss_fft_fixed16::kiss_fftr_alloc(fft_length, 0, nullptr, &state_size);
-  return state_size;
+  return sizeof(RfftInt16State) + state_size;
 }
 
 void* RfftInt16Init(int32_t fft_length, void* state, size_t state_size) {
-  return kiss_fft_fixed16::kiss_fftr_alloc(fft_length, 0, state, &state_size);
+  if (state == nullptr || state_size < sizeof(RfftInt16State)) {
+    return nullptr;
+  }
+  RfftInt16State* rfft_int16_state = static_cast<RfftInt16State*>(state);
+  void* impl_state = rfft_int16_state + 1;
+  size_t impl_state_size = state_size - sizeof(RfftInt16State);
+  rfft_int16_state->use_radix4 = RfftInt16Radix4IsSupported(fft_length);
+  if (rfft_int16_state->use_radix4) {
+    rfft_int16_state->impl_state =
+        RfftInt16Radix4Init(fft_length, impl_state, impl_state_size);
+  } else {
+    rfft_int16_state->impl_state = kiss_fft_fixed16::kiss_fftr_alloc(
+        fft_length, 0, impl_state, &impl_state_size);
+  }
+  return rfft_int16_state->impl_state != nullptr ? state : nullptr;
 }
 
 void RfftInt16Apply(void* state, const int16_t* input,
                     Complex<int16_t>* output) {
+  RfftInt16State* rfft_int16_state = static_cast<RfftInt16State*>(state);
+  if (rfft_int16_state->use_radix4) {
+    RfftInt16Radix4Apply(rfft_int16_state->impl_state, input, output);
+    return;
+  }
   kiss_fft_fixed16::kiss_fftr(
-      static_cast<kiss_fft_fixed16::kiss_fftr_cfg>(state),
+      static_cast<kiss_fft_fixed16::kiss_fftr_cfg>(
+          rfft_int16_state->impl_state),
       reinterpret_cast<const kiss_fft_scalar*>(input),
       reinterpret_cast<kiss_fft_fixed16::kiss_fft_cpx*>(output));
 }
@@ -0,0 +1,403 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "signal/src/rfft_int16_radix4.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "signal/src/complex.h"
+#include "signal/src/rfft_int16_radix4_twiddles.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define SIGNAL_RFFT_INT16_USE_DSP
+#include <arm_acle.h>
+#elif defined(__SSE2__)
+#define SIGNAL_RFFT_INT16_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflm_signal {
+namespace {
+
+constexpr int32_t kMaxComplexLength = kRfftInt16Radix4TwiddlesSize;
+
+// kiss_fft's C_FIXDIV(c, k) scales by SAMP_MAX / k in Q15.
+constexpr int16_t kFixDiv2 = INT16_MAX / 2;
+constexpr int16_t kFixDiv4 = INT16_MAX / 4;
+constexpr int32_t kQ15Round = 1 << 14;
+
+struct RfftInt16Radix4State {
+  // Length of the complex FFT, i.e. half of the RFFT length.
+  int32_t ncfft;
+  // Distance between consecutive twiddles of this FFT in the constant tables.
+  int32_t twiddle_stride;
+  // For each position of the first butterfly stage, the complex input sample
+  // it reads. Follows the struct in the state buffer.
+  uint16_t* input_index;
+};
+
+// kiss_fft's sround(): round a Q30 product to Q15, truncating to 16 bits.
+inline int16_t RoundQ15(int32_t x) {
+  return static_cast<int16_t>((x + kQ15Round) >> 15);
+}
+
+#if defined(SIGNAL_RFFT_INT16_USE_DSP)
+
+// A complex value packed into one register, real part in the low halfword.
+// Additions use the wrapping SADD16 family rather than QADD16 so that overflow
+// behaves like the 16-bit stores in kiss_fft.
+using Cpx = int32_t;
+
+inline Cpx Load(const Complex<int16_t>* p) {
+  Cpx v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline void Store(Complex<int16_t>* p, Cpx v) { memcpy(p, &v, sizeof(v)); }
+
+inline Cpx Pack(int32_t real, int32_t imag) {
+  return static_cast<Cpx>((static_cast<uint32_t>(real) & 0xFFFF) |
+                          (static_cast<uint32_t>(imag) << 16));
+}
+
+inline Cpx Add(Cpx a, Cpx b) { return __sadd16(a, b); }
+
+inline Cpx Sub(Cpx a, Cpx b) { return __ssub16(a, b); }
+
+inline Cpx FixDiv(Cpx c, int16_t scale) {
+  return Pack((__smulbb(c, scale) + kQ15Round) >> 15,
+              (__smultb(c, scale) + kQ15Round) >> 15);
+}
+
+inline Cpx Mul(Cpx a, Cpx b) {
+  return Pack((__smusd(a, b) + kQ15Round) >> 15,
+              (__smuadx(a, b) + kQ15Round) >> 15);
+}
+
+// a - j*b
+inline Cpx SubRotate(Cpx a, Cpx b) { return __ssax(a, b); }
+
+// a + j*b
+inline Cpx AddRotate(Cpx a, Cpx b) { return __sasx(a, b); }
+
+inline Cpx Conj(Cpx c) { return Pack(c, -(c >> 16)); }
+
+// (a + b) / 2
+inline Cpx HalfAdd(Cpx a, Cpx b) { return __shadd16(a, b); }
+
+// conj(a - b) / 2, halving before the conjugate as kiss_fftr does.
+inline Cpx HalfSubConj(Cpx a, Cpx b) {
+  return Pack(__shsub16(a, b), __shsub16(b, a) >> 16);
+}
+
+#else  // SIGNAL_RFFT_INT16_USE_DSP
+
+using Cpx = Complex<int16_t>;
+
+inline Cpx Load(const Complex<int16_t>* p) { return *p; }
+
+inline void Store(Complex<int16_t>* p, Cpx v) { *p = v; }
+
+inline Cpx Add(Cpx a, Cpx b) {
+  return {static_cast<int16_t>(a.real + b.real),
+          static_cast<int16_t>(a.imag + b.imag)};
+}
+
+inline Cpx Sub(Cpx a, Cpx b) {
+  return {static_cast<int16_t>(a.real - b.real),
+          static_cast<int16_t>(a.imag - b.imag)};
+}
+
+inline Cpx FixDiv(Cpx c, int16_t scale) {
+  return {RoundQ15(c.real * scale), RoundQ15(c.imag * scale)};
+}
+
+inline Cpx Mul(Cpx a, Cpx b) {
+  return {RoundQ15(a.real * b.real - a.imag * b.imag),
+          RoundQ15(a.real * b.imag + a.imag * b.real)};
+}
+
+// a - j*b
+inline Cpx SubRotate(Cpx a, Cpx b) {
+  return {static_cast<int16_t>(a.real + b.imag),
+          static_cast<int16_t>(a.imag - b.real)};
+}
+
+// a + j*b
+inline Cpx AddRotate(Cpx a, Cpx b) {
+  return {static_cast<int16_t>(a.real - b.imag),
+          static_cast<int16_t>(a.imag + b.real)};
+}
+
+inline Cpx Conj(Cpx c) { return {c.real, static_cast<int16_t>(-c.imag)}; }
+
+// (a + b) / 2
+inline Cpx HalfAdd(Cpx a, Cpx b) {
+  return {static_cast<int16_t>((a.real + b.real) >> 1),
+          static_cast<int16_t>((a.imag + b.imag) >> 1)};
+}
+
+// conj(a - b) / 2, halving before the conjugate as kiss_fftr does.
+inline Cpx HalfSubConj(Cpx a, Cpx b) {
+  return {static_cast<int16_t>((a.real - b.real) >> 1),
+          static_cast<int16_t>((b.imag - a.imag) >> 1)};
+}
+
+#endif  // SIGNAL_RFFT_INT16_USE_DSP
+
+#if defined(SIGNAL_RFFT_INT16_USE_SSE2)
+
+// Four packed complex values per register. Products are formed with
+// _mm_madd_epi16, which yields the same 32-bit sums as kiss_fft's SAMPPROD
+// arithmetic; results are truncated, not saturated, back to 16 bits.
+
+inline __m128i Load4(const Complex<int16_t>* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void Store4(Complex<int16_t>* p, __m128i v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+inline __m128i LoadTwiddles4(const Complex<int16_t>* p, int32_t stride) {
+  int32_t t[4];
+  for (int i = 0; i < 4; ++i) {
+    memcpy(&t[i], &p[i * stride], sizeof(t[i]));
+  }
+  return _mm_setr_epi32(t[0], t[1], t[2], t[3]);
+}
+
+inline __m128i ImagMask4() {
+  return _mm_set1_epi32(static_cast<int32_t>(0xFFFF0000));
+}
+
+// Negates the imaginary halves.
+inline __m128i Conj4(__m128i v) {
+  const __m128i mask = ImagMask4();
+  return _mm_sub_epi16(_mm_xor_si128(v, mask), mask);
+}
+
+inline __m128i Swap4(__m128i v) {
+  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)),
+                             _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+inline __m128i PackQ30(__m128i real, __m128i imag) {
+  const __m128i round = _mm_set1_epi32(kQ15Round);
+  real = _mm_srai_epi32(_mm_add_epi32(real, round), 15);
+  imag = _mm_srai_epi32(_mm_add_epi32(imag, round), 15);
+  return _mm_or_si128(_mm_andnot_si128(ImagMask4(), real),
+                      _mm_slli_epi32(imag, 16));
+}
+
+inline __m128i FixDiv4(__m128i c, int16_t scale) {
+  return PackQ30(_mm_madd_epi16(c, _mm_set1_epi32(scale)),
+                 _mm_madd_epi16(c, _mm_set1_epi32(scale << 16)));
+}
+
+inline __m128i Mul4(__m128i a, __m128i b) {
+  return PackQ30(_mm_madd_epi16(a, Conj4(b)), _mm_madd_epi16(a, Swap4(b)));
+}
+
+// Radix-4 butterflies for four consecutive k, see Bfly4() below.
+void Bfly4Sse2(Complex<int16_t>* fout, int32_t twiddle_stride, int32_t m) {
+  const Complex<int16_t>* tw = kRfftInt16Radix4Twiddles;
+  for (int32_t k = 0; k < m; k += 4) {
+    Complex<int16_t>* f = &fout[k];
+    const __m128i a0 = FixDiv4(Load4(&f[0]), kFixDiv4);
+    const __m128i a1 = FixDiv4(Load4(&f[m]), kFixDiv4);
+    const __m128i a2 = FixDiv4(Load4(&f[2 * m]), kFixDiv4);
+    const __m128i a3 = FixDiv4(Load4(&f[3 * m]), kFixDiv4);
+
+    const __m128i s0 =
+        Mul4(a1, LoadTwiddles4(&tw[k * twiddle_stride], twiddle_stride));
+    const __m128i s1 = Mul4(
+        a2, LoadTwiddles4(&tw[2 * k * twiddle_stride], 2 * twiddle_stride));
+    const __m128i s2 = Mul4(
+        a3, LoadTwiddles4(&tw[3 * k * twiddle_stride], 3 * twiddle_stride));
+
+    const __m128i s5 = _mm_sub_epi16(a0, s1);
+    const __m128i b0 = _mm_add_epi16(a0, s1);
+    const __m128i s3 = _mm_add_epi16(s0, s2);
+    // -j * (s0 - s2)
+    const __m128i s4 = Conj4(Swap4(_mm_sub_epi16(s0, s2)));
+
+    Store4(&f[2 * m], _mm_sub_epi16(b0, s3));
+    Store4(&f[0], _mm_add_epi16(b0, s3));
+    Store4(&f[m], _mm_add_epi16(s5, s4));
+    Store4(&f[3 * m], _mm_sub_epi16(s5, s4));
+  }
+}
+
+#endif  // SIGNAL_RFFT_INT16_USE_SSE2
+
+// Mirrors kf_bfly2() from kiss_fft.c for a forward transform.
+void Bfly2(Complex<int16_t>* fout, int32_t twiddle_stride, int32_t m) {
+  const Complex<int16_t>* tw = kRfftInt16Radix4Twiddles;
+  for (int32_t k = 0; k < m; ++k) {
+    const Cpx a = FixDiv(Load(&fout[k]), kFixDiv2);
+    const Cpx b = FixDiv(Load(&fout[k + m]), kFixDiv2);
+    const Cpx t = Mul(b, Load(&tw[k * twiddle_stride]));
+    Store(&fout[k + m], Sub(a, t));
+    Store(&fout[k], Add(a, t));
+  }
+}
+
+// Mirrors kf_bfly4() from kiss_fft.c for a forward transform.
+void Bfly4(Complex<int16_t>* fout, int32_t twiddle_stride, int32_t m) {
+#if defined(SIGNAL_RFFT_INT16_USE_SSE2)
+  if ((m & 3) == 0) {
+    Bfly4Sse2(fout, twiddle_stride, m);
+    return;
+  }
+#endif
+  const Complex<int16_t>* tw = kRfftInt16Radix4Twiddles;
+  for (int32_t k = 0; k < m; ++k) {
+    Complex<int16_t>* f = &fout[k];
+    Cpx a0 = FixDiv(Load(&f[0]), kFixDiv4);
+    const Cpx a1 = FixDiv(Load(&f[m]), kFixDiv4);
+    const Cpx a2 = FixDiv(Load(&f[2 * m]), kFixDiv4);
+    const Cpx a3 = FixDiv(Load(&f[3 * m]), kFixDiv4);
+
+    const Cpx s0 = Mul(a1, Load(&tw[k * twiddle_stride]));
+    const Cpx s1 = Mul(a2, Load(&tw[2 * k * twiddle_stride]));
+    const Cpx s2 = Mul(a3, Load(&tw[3 * k * twiddle_stride]));
+
+    const Cpx s5 = Sub(a0, s1);
+    a0 = Add(a0, s1);
+    const Cpx s3 = Add(s0, s2);
+    const Cpx s4 = Sub(s0, s2);
+
+    Store(&f[2 * m], Sub(a0, s3));
+    Store(&f[0], Add(a0, s3));
+    Store(&f[m], SubRotate(s5, s4));
+    Store(&f[3 * m], AddRotate(s5, s4));
+  }
+}
+
+// kf_factor() splits a power of two into radix-4 stages followed by a single
+// radix-2 stage when the exponent is odd. Returns the number of stages.
+int32_t Factor(int32_t n, int32_t* radices) {
+  int32_t num_stages = 0;
+  while (n > 1) {
+    radices[num_stages] = (n % 4 == 0) ? 4 : 2;
+    n /= radices[num_stages++];
+  }
+  return num_stages;
+}
+
+bool IsPowerOfTwo(int32_t n) { return n > 0 && (n & (n - 1)) == 0; }
+
+}  // namespace
+
+bool RfftInt16Radix4IsSupported(int32_t fft_length) {
+  return IsPowerOfTwo(fft_length) && fft_length >= 4 &&
+         fft_length <= kRfftInt16Radix4MaxLength;
+}
+
+size_t RfftInt16Radix4GetNeededMemory(int32_t fft_length) {
+  return sizeof(RfftInt16Radix4State) +
+         sizeof(uint16_t) * static_cast<size_t>(fft_length / 2);
+}
+
+void* RfftInt16Radix4Init(int32_t fft_length, void* state, size_t state_size) {
+  if (!RfftInt16Radix4IsSupported(fft_length) || state == nullptr ||
+      state_size < RfftInt16Radix4GetNeededMemory(fft_length)) {
+    return nullptr;
+  }
+  auto* st = static_cast<RfftInt16Radix4State*>(state);
+  st->ncfft = fft_length / 2;
+  st->twiddle_stride = kMaxComplexLength / st->ncfft;
+  st->input_index = reinterpret_cast<uint16_t*>(st + 1);
+
+  // kf_work() recurses from the first factor to the last; the leaf copies
+  // place input sample sum(q_s * fstride_s) at position sum(q_s * m_s).
+  int32_t radices[16];
+  const int32_t num_stages = Factor(st->ncfft, radices);
+  for (int32_t pos = 0; pos < st->ncfft; ++pos) {
+    int32_t remainder = pos;
+    int32_t m = st->ncfft;
+    int32_t fstride = 1;
+    int32_t index = 0;
+    for (int32_t s = 0; s < num_stages; ++s) {
+      m /= radices[s];
+      index += (remainder / m) * fstride;
+      remainder %= m;
+      fstride *= radices[s];
+    }
+    st->input_index[pos] = static_cast<uint16_t>(index);
+  }
+  return state;
+}
+
+void RfftInt16Radix4Apply(void* state, const int16_t* input,
+                          Complex<int16_t>* output) {
+  const auto* st = static_cast<const RfftInt16Radix4State*>(state);
+  const int32_t ncfft = st->ncfft;
+
+  // The real input is treated as ncfft complex samples, exactly as kiss_fftr
+  // does, and permuted straight into the output buffer.
+  for (int32_t pos = 0; pos < ncfft; ++pos) {
+    memcpy(&output[pos], &input[2 * st->input_index[pos]],
+           sizeof(Complex<int16_t>));
+  }
+
+  // Run the stages from the innermost (last factor) outwards.
+  int32_t radices[16];
+  const int32_t num_stages = Factor(ncfft, radices);
+  int32_t m = 1;
+  for (int32_t s = num_stages - 1; s >= 0; --s) {
+    const int32_t p = radices[s];
+    const int32_t block = p * m;
+    const int32_t fstride = ncfft / block;
+    const int32_t twiddle_stride = fstride * st->twiddle_stride;
+    for (int32_t b = 0; b < fstride; ++b) {
+      if (p == 4) {
+        Bfly4(&output[b * block], twiddle_stride, m);
+      } else {
+        Bfly2(&output[b * block], twiddle_stride, m);
+      }
+    }
+    m = block;
+  }
+
+  // Split the packed spectrum into the real spectrum, as in kiss_fftr(). Each
+  // iteration reads bins k and ncfft - k before writing them, so this can run
+  // in place.
+  const Complex<int16_t> tdc = {RoundQ15(output[0].real * kFixDiv2),
+                                RoundQ15(output[0].imag * kFixDiv2)};
+  output[0].real = static_cast<int16_t>(tdc.real + tdc.imag);
+  output[0].imag = 0;
+  output[ncfft].real = static_cast<int16_t>(tdc.real - tdc.imag);
+  output[ncfft].imag = 0;
+
+  const Complex<int16_t>* super_twiddles = kRfftInt16Radix4SuperTwiddles;
+  for (int32_t k = 1; k <= ncfft / 2; ++k) {
+    const Cpx fpk = FixDiv(Load(&output[k]), kFixDiv2);
+    const Cpx fpnk = FixDiv(Conj(Load(&output[ncfft - k])), kFixDiv2);
+    const Cpx f1k = Add(fpk, fpnk);
+    const Cpx f2k = Sub(fpk, fpnk);
+    const Cpx tw =
+        Mul(f2k, Load(&super_twiddles[k * st->twiddle_stride - 1]));
+    Store(&output[k], HalfAdd(f1k, tw));
+    Store(&output[ncfft - k], HalfSubConj(f1k, tw));
+  }
+}
+
+}  // namespace tflm_signal
@@ -0,0 +1,57 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef SIGNAL_SRC_RFFT_INT16_RADIX4_H_
+#define SIGNAL_SRC_RFFT_INT16_RADIX4_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "signal/src/complex.h"
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflm_signal {
+
+// Radix-4 16-bit integer RFFT for power of two lengths.
+//
+// Produces bit-identical results to kiss_fft_fixed16::kiss_fftr: the complex
+// FFT uses the same factorization (radix-4 stages, plus one radix-2 stage for
+// odd powers of two), the same per-stage scaling and the same rounding, but
+// runs the stages iteratively and in place in the output buffer, reads its
+// twiddles from constant tables instead of RAM, and uses packed 16-bit SIMD
+// arithmetic on Cortex-M cores with the DSP extension and on SSE2 hosts.
+
+// Largest `fft_length` covered by the constant twiddle tables.
+constexpr int32_t kRfftInt16Radix4MaxLength = 512;
+
+// Returns true if an RFFT of `fft_length` can use the radix-4 implementation.
+bool RfftInt16Radix4IsSupported(int32_t fft_length);
+
+// Returns the size of the memory that a radix-4 RFFT of `fft_length` needs
+size_t RfftInt16Radix4GetNeededMemory(int32_t fft_length);
+
+// Initialize the state of a radix-4 RFFT of `fft_length`
+// Return the value of `state` on success or nullptr on failure
+void* RfftInt16Radix4Init(int32_t fft_length, void* state, size_t state_size);
+
+// Applies RFFT to `input` and writes the result to `output`
+// * `input` must be of size `fft_length` elements
+// * `output` must be of size (`fft_length` / 2) + 1 elements
+void RfftInt16Radix4Apply(void* state, const int16_t* input,
+                          Complex<int16_t>* output);
+
+}  // namespace tflm_signal
+
+#endif  // SIGNAL_SRC_RFFT_INT16_RADIX4_H_
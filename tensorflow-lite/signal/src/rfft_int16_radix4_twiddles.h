@@ -0,0 +1,44 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef SIGNAL_SRC_RFFT_INT16_RADIX4_TWIDDLES_H_
+#define SIGNAL_SRC_RFFT_INT16_RADIX4_TWIDDLES_H_
+
+#include <stdint.h>
+
+#include "signal/src/complex.h"
+
+// TODO(b/286250473): remove namespace once de-duped libraries
+namespace tflm_signal {
+
+// Number of entries in kRfftInt16Radix4Twiddles. This is the length of the
+// complex FFT inside an RFFT of kRfftInt16Radix4MaxLength.
+constexpr int32_t kRfftInt16Radix4TwiddlesSize = 256;
+
+// Complex FFT twiddles exp(-2*pi*j*i/256), i = 0..255, as generated by
+// kiss_fft_alloc(256, 0, ...) with FIXED_POINT=16. Shorter power of two FFTs
+// use every (256/N)-th entry.
+extern const Complex<int16_t>
+    kRfftInt16Radix4Twiddles[kRfftInt16Radix4TwiddlesSize];
+
+// RFFT split twiddles exp(-j*pi*((i+1)/256 + 0.5)), i = 0..127, as generated
+// by kiss_fftr_alloc(512, 0, ...) with FIXED_POINT=16. An RFFT with a complex
+// length of N uses entry k*(256/N)-1 for its k-th split twiddle.
+extern const Complex<int16_t>
+    kRfftInt16Radix4SuperTwiddles[kRfftInt16Radix4TwiddlesSize / 2];
+
+}  // namespace tflm_signal
+
+#endif  // SIGNAL_SRC_RFFT_INT16_RADIX4_TWIDDLES_H_
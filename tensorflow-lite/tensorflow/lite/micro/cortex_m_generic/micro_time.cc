@@ -54,8 +54,8 @@ uint32_t GetCurrentTimeTicks() {
 #endif
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
 
-    // Reset and DWT cycle counter.
-    DWT->CYCCNT = 0;
+    // Enable the DWT cycle counter. It is not reset: the application may
+    // already be timing with it, and every user takes differences.
     DWT->CTRL |= 1UL;
 
 #endif
@@ -16,12 +16,14 @@ limitations under the License.
 
 #include <cstdint>
 
+#include "Include/arm_nnfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/internal/types.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -33,8 +35,15 @@ constexpr int kOutputTensor = 0;
 
 struct OpData {
   ConcatenationParams params;
+  // Byte copies with arm_concatenation_s8_*: the output viewed as
+  // [outer, axis, inner], with inner in bytes. Zero when a dimension does
+  // not fit the uint16 arguments, then the reference is used.
+  uint32_t outer;
+  uint32_t inner_bytes;
 };
 
+constexpr uint32_t kCmsisNnMaxDim = UINT16_MAX;
+
 // Handles negative axis index, coerces to positive index value.
 inline int CalculatePositiveAxis(int axis, const TfLiteTensor* output_tensor) {
   if (axis >= 0) {
@@ -103,6 +112,82 @@ void EvalUnquantized(TfLiteContext* context, TfLiteNode* node) {
                                tflite::micro::GetTensorData<data_type>(output));
 }
 
+// Concatenation never converts values, so any type is a byte copy. Each
+// input is [outer, axis_dim, inner]: with nothing outside the axis it is one
+// block (W), with single byte elements on the last axis it is a row per
+// outer index (X), otherwise a block of axis_dim * inner bytes per outer
+// index (Z).
+void EvalCmsisNn(TfLiteContext* context, TfLiteNode* node,
+                 const OpData& data) {
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+  int8_t* output_data = static_cast<int8_t*>(output->data.data);
+  const int axis = data.params.axis;
+  const uint16_t output_axis_dim = output->dims->data[axis];
+  const uint16_t outer = data.outer;
+  const uint16_t inner = data.inner_bytes;
+
+  uint32_t offset = 0;
+  for (int i = 0; i < node->inputs->size; ++i) {
+    const TfLiteEvalTensor* input =
+        tflite::micro::GetEvalInput(context, node, i);
+    const int8_t* input_data = static_cast<const int8_t*>(input->data.data);
+    const uint16_t axis_dim = input->dims->data[axis];
+    if (outer == 1) {
+      arm_concatenation_s8_w(input_data, inner, 1, 1, axis_dim, output_data,
+                             offset);
+    } else if (inner == 1) {
+      arm_concatenation_s8_x(input_data, axis_dim, outer, 1, 1, output_data,
+                             output_axis_dim, offset);
+    } else {
+      arm_concatenation_s8_z(input_data, inner, 1, axis_dim, outer,
+                             output_data, output_axis_dim, offset);
+    }
+    offset += axis_dim;
+  }
+}
+
+// Sets data->outer and data->inner_bytes, or leaves them zero if the shapes
+// don't fit arm_concatenation_s8_*.
+TfLiteStatus PrepareCmsisNn(TfLiteContext* context, TfLiteNode* node,
+                            const TfLiteTensor* output, OpData* data) {
+  MicroContext* micro_context = GetMicroContext(context);
+  const int axis = data->params.axis;
+  size_t element_size;
+  TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(output->type, &element_size));
+  uint32_t outer = 1;
+  for (int d = 0; d < axis; ++d) {
+    outer *= output->dims->data[d];
+  }
+  uint32_t inner = element_size;
+  for (int d = axis + 1; d < output->dims->size; ++d) {
+    inner *= output->dims->data[d];
+  }
+
+  data->outer = 0;
+  data->inner_bytes = 0;
+  if (outer > kCmsisNnMaxDim || inner > kCmsisNnMaxDim ||
+      static_cast<uint32_t>(output->dims->data[axis]) > kCmsisNnMaxDim) {
+    return kTfLiteOk;
+  }
+  for (int i = 0; i < node->inputs->size; ++i) {
+    TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, i);
+    TF_LITE_ENSURE(context, input != nullptr);
+    // The reference checks the other dimensions, so do it here too.
+    TF_LITE_ENSURE_EQ(context, NumDimensions(input), NumDimensions(output));
+    for (int d = 0; d < output->dims->size; ++d) {
+      if (d != axis) {
+        TF_LITE_ENSURE_EQ(context, input->dims->data[d],
+                          output->dims->data[d]);
+      }
+    }
+    micro_context->DeallocateTempTfLiteTensor(input);
+  }
+  data->outer = outer;
+  data->inner_bytes = inner;
+  return kTfLiteOk;
+}
+
 void* ConcatenationInit(TfLiteContext* context, const char* buffer,
                         size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
@@ -210,6 +295,8 @@ TfLiteStatus ConcatenationPrepare(TfLiteContext* context, TfLiteNode* node) {
       return kTfLiteError;
   }
 
+  TF_LITE_ENSURE_STATUS(PrepareCmsisNn(context, node, output, data));
+
   micro_context->DeallocateTempTfLiteTensor(output);
 
   return kTfLiteOk;
@@ -221,6 +308,13 @@ TfLiteStatus ConcatenationEval(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE(context, output_tensor != nullptr);
   TfLiteType output_type = output_tensor->type;
 
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *static_cast<const OpData*>(node->user_data);
+  if (data.inner_bytes != 0) {
+    EvalCmsisNn(context, node, data);
+    return kTfLiteOk;
+  }
+
   switch (output_type) {  // Already know in/outtypes are same.
     case kTfLiteFloat32:
       EvalUnquantized<float>(context, node);
@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/kernels/conv.h"
 
 #include "Include/arm_nnfunctions.h"
+#include "Include/arm_nnsupportfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
@@ -25,6 +26,8 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/kernel_threads.h"
+#include "tensorflow/lite/micro/kernels/kernel_tuning.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
@@ -34,10 +37,400 @@ namespace {
 struct OpData {
   OpDataConv reference_op_data;
 
-  // Index to buffer for optimizations if applicable.
+  // Index to buffer for optimizations if applicable, buffer_size bytes for
+  // each of the `threads` Prepare saw.
   int buffer_idx;
+  int32_t buffer_size;
+  int threads;
+
+  // int8 filters: the implementation Eval calls, kConvKernelAuto for the
+  // CMSIS-NN wrapper.
+  ConvKernel kernel;
 };
 
+// Limits of the small input depth path: the input channel count, and the
+// words the packed filter of one output channel takes (filter_h rows of
+// filter_w * input_ch values each, every row zero padded to whole words).
+constexpr int kSmallInputDepthMaxChannels = 4;
+constexpr int kSmallInputDepthMaxFilterWords = 10;
+
+int SmallInputDepthRowWords(const cmsis_nn_dims& filter_dims) {
+  return (filter_dims.w * filter_dims.c + 3) / 4;
+}
+
+bool SmallInputDepthLegal(const cmsis_nn_conv_params& conv_params,
+                          const cmsis_nn_dims& input_dims,
+                          const cmsis_nn_dims& filter_dims) {
+  return input_dims.c <= kSmallInputDepthMaxChannels &&
+         conv_params.dilation.h == 1 && conv_params.dilation.w == 1 &&
+         filter_dims.h * SmallInputDepthRowWords(filter_dims) <=
+             kSmallInputDepthMaxFilterWords;
+}
+
+// The small input depth path is not measured faster than the generic one
+// on the target yet, so the shape rules only take it when
+// TFLM_CMSIS_NN_SMALL_DEPTH_CONV is defined. The kernel tuner can still
+// select it for the layers where it measures faster.
+bool UseSmallInputDepth(const cmsis_nn_conv_params& conv_params,
+                        const cmsis_nn_dims& input_dims,
+                        const cmsis_nn_dims& filter_dims) {
+#if defined(TFLM_CMSIS_NN_SMALL_DEPTH_CONV)
+  // 1x1 filters already have their own kernels in the wrapper.
+  return (filter_dims.h > 1 || filter_dims.w > 1) &&
+         SmallInputDepthLegal(conv_params, input_dims, filter_dims);
+#else
+  return false;
+#endif
+}
+
+// The filter of one output channel. A filter row is filter_w * input_ch
+// contiguous values, in the filter and in every window of the input.
+struct SmallInputDepthFilter {
+#if defined(ARM_MATH_DSP)
+  // Each row zero padded to whole words; taps 0 and 2, and 1 and 3, of every
+  // word as int16 pairs, matching the SXTB16 of an input word and of the
+  // word rotated by 8 bits.
+  int32_t even[kSmallInputDepthMaxFilterWords];
+  int32_t odd[kSmallInputDepthMaxFilterWords];
+#else
+  int32_t taps[kSmallInputDepthMaxFilterWords * 4];
+#endif
+  int32_t sum;
+};
+
+void PackSmallInputDepthFilter(const int8_t* kernel, int filter_h,
+                               int row_length, int row_words,
+                               SmallInputDepthFilter* packed) {
+  packed->sum = 0;
+  for (int row = 0; row < filter_h; ++row) {
+    const int8_t* taps = kernel + row * row_length;
+    for (int i = 0; i < row_length; ++i) {
+      packed->sum += taps[i];
+#if !defined(ARM_MATH_DSP)
+      packed->taps[row * row_length + i] = taps[i];
+#endif
+    }
+#if defined(ARM_MATH_DSP)
+    for (int word = 0; word < row_words; ++word) {
+      int32_t tap[4];
+      for (int i = 0; i < 4; ++i) {
+        const int index = word * 4 + i;
+        tap[i] = index < row_length ? taps[index] : 0;
+      }
+      packed->even[row * row_words + word] = static_cast<int32_t>(
+          (static_cast<uint32_t>(tap[0]) & 0xFFFF) |
+          (static_cast<uint32_t>(tap[2]) << 16));
+      packed->odd[row * row_words + word] = static_cast<int32_t>(
+          (static_cast<uint32_t>(tap[1]) & 0xFFFF) |
+          (static_cast<uint32_t>(tap[3]) << 16));
+    }
+#endif
+  }
+}
+
+// Accumulates the windows of four neighbouring output pixels, window_step
+// apart, that are fully inside the input. kFilterH, kRowLength and
+// kWindowStep fix the filter height, row length and window step of the
+// common shapes at compile time, so that with a step of one the overlapping
+// reads of neighbouring windows are shared; 0 takes them from the arguments.
+template <int kFilterH, int kRowLength, int kWindowStep>
+void AccumulateSmallInputDepthX4(const SmallInputDepthFilter& filter,
+                                 const int8_t* window, int window_step,
+                                 int input_row, int filter_h, int row_length,
+                                 int32_t* acc) {
+  filter_h = kFilterH > 0 ? kFilterH : filter_h;
+  row_length = kRowLength > 0 ? kRowLength : row_length;
+  window_step = kWindowStep > 0 ? kWindowStep : window_step;
+  int32_t sum_0 = acc[0];
+  int32_t sum_1 = acc[1];
+  int32_t sum_2 = acc[2];
+  int32_t sum_3 = acc[3];
+#if defined(ARM_MATH_DSP)
+  const int row_words = (row_length + 3) / 4;
+  const int32_t* even = filter.even;
+  const int32_t* odd = filter.odd;
+  for (int row = 0; row < filter_h; ++row) {
+    for (int word = 0; word < row_words; ++word) {
+      const int8_t* values = window + word * 4;
+      const int32_t values_0 = arm_nn_read_s8x4(values);
+      const int32_t values_1 = arm_nn_read_s8x4(values + window_step);
+      const int32_t values_2 = arm_nn_read_s8x4(values + 2 * window_step);
+      const int32_t values_3 = arm_nn_read_s8x4(values + 3 * window_step);
+      sum_0 = SMLAD(SXTB16(values_0), *even, sum_0);
+      sum_1 = SMLAD(SXTB16(values_1), *even, sum_1);
+      sum_2 = SMLAD(SXTB16(values_2), *even, sum_2);
+      sum_3 = SMLAD(SXTB16(values_3), *even++, sum_3);
+      sum_0 = SMLAD(SXTB16(ROR(static_cast<uint32_t>(values_0), 8)), *odd,
+                    sum_0);
+      sum_1 = SMLAD(SXTB16(ROR(static_cast<uint32_t>(values_1), 8)), *odd,
+                    sum_1);
+      sum_2 = SMLAD(SXTB16(ROR(static_cast<uint32_t>(values_2), 8)), *odd,
+                    sum_2);
+      sum_3 = SMLAD(SXTB16(ROR(static_cast<uint32_t>(values_3), 8)), *odd++,
+                    sum_3);
+    }
+    window += input_row;
+  }
+#else
+  const int32_t* taps = filter.taps;
+  for (int row = 0; row < filter_h; ++row) {
+    for (int i = 0; i < row_length; ++i) {
+      const int32_t tap = *taps++;
+      const int8_t* values = window + i;
+      sum_0 += values[0] * tap;
+      sum_1 += values[window_step] * tap;
+      sum_2 += values[2 * window_step] * tap;
+      sum_3 += values[3 * window_step] * tap;
+    }
+    window += input_row;
+  }
+#endif
+  acc[0] = sum_0;
+  acc[1] = sum_1;
+  acc[2] = sum_2;
+  acc[3] = sum_3;
+}
+
+// The same for a single window.
+int32_t AccumulateSmallInputDepth(const SmallInputDepthFilter& filter,
+                                  const int8_t* window, int input_row,
+                                  int filter_h, int row_length, int32_t acc) {
+#if defined(ARM_MATH_DSP)
+  const int row_words = (row_length + 3) / 4;
+  const int32_t* even = filter.even;
+  const int32_t* odd = filter.odd;
+  for (int row = 0; row < filter_h; ++row) {
+    for (int word = 0; word < row_words; ++word) {
+      const int32_t values = arm_nn_read_s8x4(window + word * 4);
+      acc = SMLAD(SXTB16(values), *even++, acc);
+      acc = SMLAD(SXTB16(ROR(static_cast<uint32_t>(values), 8)), *odd++, acc);
+    }
+    window += input_row;
+  }
+#else
+  const int32_t* taps = filter.taps;
+  for (int row = 0; row < filter_h; ++row) {
+    for (int i = 0; i < row_length; ++i) {
+      acc += window[i] * *taps++;
+    }
+    window += input_row;
+  }
+#endif
+  return acc;
+}
+
+// Convolution of an input with few channels, such as the image fed to the
+// first layer of a CNN. arm_convolve_s8 copies an im2col column of
+// filter_h * filter_w * input_ch values per output pixel, one input_ch run at
+// a time, and widens it to int16 before the matrix multiplication. Here one
+// output channel is computed at a time: its filter is packed once and the
+// windows are read straight from the tensor, four values per word, for four
+// neighbouring output pixels at a time. The input offset times the filter sum
+// is folded into the bias for windows fully inside the input; windows that
+// touch the padding take a scalar path. The accumulators are the same
+// integers as arm_convolve_s8's, so the output is bit-exact.
+template <int kFilterH, int kRowLength, int kWindowStep>
+arm_cmsis_nn_status ConvolveSmallInputDepthS8(
+    const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int8_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const int32_t* bias, const cmsis_nn_dims* output_dims, int8_t* output) {
+  const int input_h = input_dims->h;
+  const int input_w = input_dims->w;
+  const int input_ch = input_dims->c;
+  const int filter_h = filter_dims->h;
+  const int filter_w = filter_dims->w;
+  const int output_w = output_dims->w;
+  const int output_ch = output_dims->c;
+  const int stride_w = conv_params->stride.w;
+  const int pad_w = conv_params->padding.w;
+  const int row_length = filter_w * input_ch;
+  const int row_words = SmallInputDepthRowWords(*filter_dims);
+  const int input_row = input_w * input_ch;
+  const int window_step = stride_w * input_ch;
+  const int32_t input_offset = conv_params->input_offset;
+#if defined(ARM_MATH_DSP)
+  // Word reads of a window row run up to three values past it, into the
+  // next row, against zero weights. Only the end of the tensor is off
+  // limits.
+  const int8_t* input_end =
+      input + input_dims->n * input_h * input_row - row_words * 4;
+#endif
+
+  // Output columns whose windows are inside the input horizontally.
+  const int inner_x0 = (pad_w + stride_w - 1) / stride_w;
+  const int inner_x1 =
+      MIN(output_w, input_w - filter_w + pad_w < 0
+                        ? 0
+                        : (input_w - filter_w + pad_w) / stride_w + 1);
+
+  for (int batch = 0; batch < input_dims->n; ++batch) {
+    for (int channel = 0; channel < output_ch; ++channel) {
+      const int8_t* kernel = filter + channel * filter_h * row_length;
+      SmallInputDepthFilter packed;
+      PackSmallInputDepthFilter(kernel, filter_h, row_length, row_words,
+                                &packed);
+      const int32_t bias_value = bias != nullptr ? bias[channel] : 0;
+      const int32_t inner_bias = bias_value + input_offset * packed.sum;
+      const int32_t multiplier = quant_params->multiplier[channel];
+      const int32_t shift = quant_params->shift[channel];
+
+      int8_t* out = output + channel;
+      for (int out_y = 0; out_y < output_dims->h; ++out_y) {
+        const int in_y = out_y * conv_params->stride.h - conv_params->padding.h;
+        int x0 = inner_x0;
+        int x1 = inner_x1;
+        if (in_y < 0 || in_y + filter_h > input_h) {
+          x1 = x0;
+        }
+#if defined(ARM_MATH_DSP)
+        while (x1 > x0 &&
+               input + ((in_y + filter_h - 1) * input_w +
+                        (x1 - 1) * stride_w - pad_w) *
+                           input_ch >
+                   input_end) {
+          --x1;
+        }
+#endif
+        const int row_offset = in_y * input_row - pad_w * input_ch;
+
+        int out_x = 0;
+        while (out_x < output_w) {
+          int32_t acc[4];
+          int pixels = 1;
+          if (out_x >= x0 && out_x + 4 <= x1) {
+            pixels = 4;
+            acc[0] = acc[1] = acc[2] = acc[3] = inner_bias;
+            AccumulateSmallInputDepthX4<kFilterH, kRowLength, kWindowStep>(
+                packed, input + row_offset + out_x * window_step, window_step,
+                input_row, filter_h, row_length, acc);
+          } else if (out_x >= x0 && out_x < x1) {
+            acc[0] = AccumulateSmallInputDepth(
+                packed, input + row_offset + out_x * window_step, input_row,
+                filter_h, row_length, inner_bias);
+          } else {
+            const int in_x = out_x * stride_w - pad_w;
+            acc[0] = bias_value;
+            for (int row = 0; row < filter_h; ++row) {
+              const int y = in_y + row;
+              if (y < 0 || y >= input_h) {
+                continue;
+              }
+              for (int column = 0; column < filter_w; ++column) {
+                const int x = in_x + column;
+                if (x < 0 || x >= input_w) {
+                  continue;
+                }
+                const int8_t* values = input + (y * input_w + x) * input_ch;
+                const int8_t* weights =
+                    kernel + row * row_length + column * input_ch;
+                for (int c = 0; c < input_ch; ++c) {
+                  acc[0] += (values[c] + input_offset) * weights[c];
+                }
+              }
+            }
+          }
+          for (int pixel = 0; pixel < pixels; ++pixel) {
+            int32_t result = arm_nn_requantize(acc[pixel], multiplier, shift);
+            result += conv_params->output_offset;
+            result = MAX(result, conv_params->activation.min);
+            result = MIN(result, conv_params->activation.max);
+            *out = static_cast<int8_t>(result);
+            out += output_ch;
+          }
+          out_x += pixels;
+        }
+      }
+    }
+    input += input_h * input_row;
+    output += output_dims->h * output_w * output_ch;
+  }
+  return ARM_CMSIS_NN_SUCCESS;
+}
+
+arm_cmsis_nn_status ConvolveSmallInputDepthS8(
+    const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int8_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const int32_t* bias, const cmsis_nn_dims* output_dims, int8_t* output) {
+  // The first layer of an image model: one channel, stride 1, 3x3 or 5x5.
+  const bool unit_step = conv_params->stride.w * input_dims->c == 1;
+  if (unit_step && filter_dims->h == 3 && filter_dims->w == 3) {
+    return ConvolveSmallInputDepthS8<3, 3, 1>(
+        conv_params, quant_params, input_dims, input, filter_dims, filter,
+        bias, output_dims, output);
+  }
+  if (unit_step && filter_dims->h == 5 && filter_dims->w == 5) {
+    return ConvolveSmallInputDepthS8<5, 5, 1>(
+        conv_params, quant_params, input_dims, input, filter_dims, filter,
+        bias, output_dims, output);
+  }
+  return ConvolveSmallInputDepthS8<0, 0, 0>(conv_params, quant_params,
+                                            input_dims, input, filter_dims,
+                                            filter, bias, output_dims, output);
+}
+
+// Shapes and parameters that the choice of an int8 implementation can depend
+// on, hashed. Layers with the same key are interchangeable for the tuner.
+uint32_t ConvLayerKey(const cmsis_nn_conv_params& conv_params,
+                      const cmsis_nn_dims& input_dims,
+                      const cmsis_nn_dims& filter_dims,
+                      const cmsis_nn_dims& output_dims) {
+  const int32_t values[] = {
+      input_dims.n,          input_dims.h,          input_dims.w,
+      input_dims.c,          filter_dims.h,         filter_dims.w,
+      output_dims.h,         output_dims.w,         output_dims.c,
+      conv_params.stride.h,  conv_params.stride.w,  conv_params.padding.h,
+      conv_params.padding.w, conv_params.dilation.h, conv_params.dilation.w};
+  return KernelTuningHash(values, sizeof(values));
+}
+
+// The int8 implementations that accept these shapes, as arm_convolve_*
+// check their arguments.
+uint32_t LegalConvKernels(const cmsis_nn_conv_params& conv_params,
+                          const cmsis_nn_dims& input_dims,
+                          const cmsis_nn_dims& filter_dims) {
+  uint32_t legal = (1U << kConvKernelAuto) | (1U << kConvKernelGeneric);
+  if (filter_dims.h == 1 && filter_dims.w == 1 &&
+      conv_params.padding.h == 0 && conv_params.padding.w == 0) {
+    legal |= 1U << kConvKernel1x1;
+    if (conv_params.stride.h == 1 && conv_params.stride.w == 1) {
+      legal |= 1U << kConvKernel1x1Fast;
+    }
+  }
+  if (input_dims.h == 1 && filter_dims.h == 1 && conv_params.dilation.w == 1 &&
+      (conv_params.stride.w * input_dims.c) % 4 == 0) {
+    legal |= 1U << kConvKernel1xN;
+  }
+  if (SmallInputDepthLegal(conv_params, input_dims, filter_dims)) {
+    legal |= 1U << kConvKernelSmallInputDepth;
+  }
+  return legal;
+}
+
+int32_t ConvKernelBufferSize(ConvKernel kernel,
+                             const cmsis_nn_conv_params& conv_params,
+                             const cmsis_nn_dims& input_dims,
+                             const cmsis_nn_dims& filter_dims,
+                             const cmsis_nn_dims& output_dims) {
+  switch (kernel) {
+    case kConvKernelGeneric:
+      return arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    case kConvKernel1x1Fast:
+      return arm_convolve_1x1_s8_fast_get_buffer_size(&input_dims);
+    case kConvKernel1xN:
+      return arm_convolve_1_x_n_s8_get_buffer_size(&input_dims, &filter_dims);
+    case kConvKernel1x1:
+    case kConvKernelSmallInputDepth:
+      return 0;
+    default:
+      return arm_convolve_wrapper_s8_get_buffer_size(
+          &conv_params, &input_dims, &filter_dims, &output_dims);
+  }
+}
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   return context->AllocatePersistentBuffer(context, sizeof(OpData));
@@ -51,6 +444,9 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   const auto& params =
       *(static_cast<const TfLiteConvParams*>(node->builtin_data));
   OpData* data = static_cast<OpData*>(node->user_data);
+  data->kernel = kConvKernelAuto;
+  data->buffer_size = 0;
+  data->threads = KernelThreadCount();
 
   MicroContext* micro_context = GetMicroContext(context);
 
@@ -131,7 +527,17 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     conv_params.activation.min = data->reference_op_data.output_activation_min;
     conv_params.activation.max = data->reference_op_data.output_activation_max;
 
-    if (input->type == kTfLiteInt8) {
+    if (input->type == kTfLiteInt8 && filter->type == kTfLiteInt8) {
+      data->kernel = SelectConvKernel(
+          ConvLayerKey(conv_params, input_dims, filter_dims, output_dims),
+          LegalConvKernels(conv_params, input_dims, filter_dims));
+      if (data->kernel == kConvKernelAuto &&
+          UseSmallInputDepth(conv_params, input_dims, filter_dims)) {
+        data->kernel = kConvKernelSmallInputDepth;
+      }
+      buf_size = ConvKernelBufferSize(data->kernel, conv_params, input_dims,
+                                      filter_dims, output_dims);
+    } else if (input->type == kTfLiteInt8) {
       buf_size = arm_convolve_wrapper_s8_get_buffer_size(
           &conv_params, &input_dims, &filter_dims, &output_dims);
     } else if (input->type == kTfLiteInt16) {
@@ -141,9 +547,12 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
           &conv_params, &input_dims, &filter_dims, &output_dims);
     }
 
+    // The buffer sizes of the CMSIS-NN kernels do not depend on the rows,
+    // so each thread's slice of rows fits in buf_size.
+    data->buffer_size = buf_size;
     if (buf_size > 0) {
       TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
-          context, buf_size, &data->buffer_idx));
+          context, buf_size * data->threads, &data->buffer_idx));
     } else {
       data->buffer_idx = -1;
     }
@@ -204,6 +613,124 @@ arm_cmsis_nn_status convolve_wrapper(
                                   output_dims, output);
 }
 
+template <class ActType, class BiasType>
+arm_cmsis_nn_status convolve_selected(
+    ConvKernel kernel, const cmsis_nn_context* ctx,
+    const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const ActType* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const BiasType* bias,
+    const cmsis_nn_dims* output_dims, ActType* output) {
+  return ARM_CMSIS_NN_ARG_ERROR;
+}
+
+template <>
+arm_cmsis_nn_status convolve_selected(
+    ConvKernel kernel, const cmsis_nn_context* ctx,
+    const cmsis_nn_conv_params* conv_params,
+    const cmsis_nn_per_channel_quant_params* quant_params,
+    const cmsis_nn_dims* input_dims, const int8_t* input,
+    const cmsis_nn_dims* filter_dims, const int8_t* filter,
+    const cmsis_nn_dims* bias_dims, const int32_t* bias,
+    const cmsis_nn_dims* output_dims, int8_t* output) {
+  switch (kernel) {
+    case kConvKernelGeneric:
+      return arm_convolve_s8(ctx, conv_params, quant_params, input_dims, input,
+                             filter_dims, filter, bias_dims, bias, output_dims,
+                             output);
+    case kConvKernel1x1:
+      return arm_convolve_1x1_s8(ctx, conv_params, quant_params, input_dims,
+                                 input, filter_dims, filter, bias_dims, bias,
+                                 output_dims, output);
+    case kConvKernel1x1Fast:
+      return arm_convolve_1x1_s8_fast(ctx, conv_params, quant_params,
+                                      input_dims, input, filter_dims, filter,
+                                      bias_dims, bias, output_dims, output);
+    case kConvKernel1xN:
+      return arm_convolve_1_x_n_s8(ctx, conv_params, quant_params, input_dims,
+                                   input, filter_dims, filter, bias_dims, bias,
+                                   output_dims, output);
+    case kConvKernelSmallInputDepth:
+      return ConvolveSmallInputDepthS8(conv_params, quant_params, input_dims,
+                                       input, filter_dims, filter, bias,
+                                       output_dims, output);
+    default:
+      return ARM_CMSIS_NN_ARG_ERROR;
+  }
+}
+
+// An int8 or int16 convolution, split by ConvolveRows.
+template <typename ActType, typename BiasType>
+struct ConvRows {
+  ConvKernel kernel;
+  cmsis_nn_conv_params conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+  const ActType* input;
+  const int8_t* filter;
+  const BiasType* bias;
+  ActType* output;
+  int8_t* buffer;
+  int32_t buffer_size;
+};
+
+// Output rows [begin, end) of every batch, with the scratch slice of
+// `thread`. The input starts at the first row the windows of `begin` read,
+// or at the top with the part of the padding that is left; below, the input
+// ends where it ends for the whole op. The windows, and so the sums, are
+// those of the whole op.
+template <typename ActType, typename BiasType, TfLiteType type>
+void ConvolveRows(void* arg, int thread, int begin, int end) {
+  const auto& rows = *static_cast<const ConvRows<ActType, BiasType>*>(arg);
+  cmsis_nn_context ctx;
+  ctx.buf = rows.buffer != nullptr ? rows.buffer + thread * rows.buffer_size
+                                   : nullptr;
+  ctx.size = rows.buffer_size;
+
+  cmsis_nn_conv_params conv_params = rows.conv_params;
+  const int first_row = begin * conv_params.stride.h - conv_params.padding.h;
+  const int skipped_rows = first_row > 0 ? first_row : 0;
+  conv_params.padding.h = skipped_rows - first_row;
+
+  cmsis_nn_dims input_dims = rows.input_dims;
+  input_dims.n = 1;
+  input_dims.h = rows.input_dims.h - skipped_rows;
+  cmsis_nn_dims output_dims = rows.output_dims;
+  output_dims.n = 1;
+  output_dims.h = end - begin;
+
+  const int input_row = rows.input_dims.w * rows.input_dims.c;
+  const int output_row = rows.output_dims.w * rows.output_dims.c;
+  for (int batch = 0; batch < rows.input_dims.n; ++batch) {
+    const ActType* input =
+        rows.input + (batch * rows.input_dims.h + skipped_rows) * input_row;
+    ActType* output =
+        rows.output + (batch * rows.output_dims.h + begin) * output_row;
+    // An int8 implementation picked in Prepare, otherwise
+    // arm_convolve_wrapper_[type] dispatches the optimized kernel accordingly
+    // with the parameters passed
+    if (type == kTfLiteInt8 && rows.kernel != kConvKernelAuto) {
+      TFLITE_DCHECK_EQ(
+          convolve_selected(rows.kernel, &ctx, &conv_params,
+                            &rows.quant_params, &input_dims, input,
+                            &rows.filter_dims, rows.filter, &rows.bias_dims,
+                            rows.bias, &output_dims, output),
+          ARM_CMSIS_NN_SUCCESS);
+    } else {
+      TFLITE_DCHECK_EQ(
+          convolve_wrapper(&ctx, &conv_params, &rows.quant_params,
+                           &input_dims, input, &rows.filter_dims, rows.filter,
+                           &rows.bias_dims, rows.bias, &output_dims, output,
+                           type),
+          ARM_CMSIS_NN_SUCCESS);
+    }
+  }
+}
+
 template <typename ActType, typename BiasType, TfLiteType type>
 TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
                                      const TfLiteConvParams& params,
@@ -279,28 +806,36 @@ TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
   output_dims.w = output_shape.Dims(2);
   output_dims.c = output_depth;
 
-  // Initialize cmsis_nn context
-  cmsis_nn_context ctx;
-  ctx.buf = nullptr;
-  ctx.size = 0;
+  ConvRows<ActType, BiasType> rows;
+  rows.kernel = data.kernel;
+  rows.conv_params = conv_params;
+  rows.quant_params = quant_params;
+  rows.input_dims = input_dims;
+  rows.filter_dims = filter_dims;
+  rows.bias_dims = bias_dims;
+  rows.output_dims = output_dims;
+  rows.input = tflite::micro::GetTensorData<ActType>(input);
+  rows.filter = tflite::micro::GetTensorData<int8_t>(filter);
+  rows.bias = tflite::micro::GetOptionalTensorData<BiasType>(bias);
+  rows.output = tflite::micro::GetTensorData<ActType>(output);
+  rows.buffer = nullptr;
+  rows.buffer_size = data.buffer_size;
 
   if (data.buffer_idx > -1) {
-    ctx.buf = context->GetScratchBuffer(context, data.buffer_idx);
+    rows.buffer = static_cast<int8_t*>(
+        context->GetScratchBuffer(context, data.buffer_idx));
     // Note: ctx.size is currently not used in cmsis_nn.
     // The buffer should be allocated in the prepare function through
     // the corresponding arm_convolve_wrapper_[type]_get_buffer_size
   }
 
-  // arm_convolve_wrapper_[type] dispatches the optimized kernel accordingly
-  // with the parameters passed
-  TFLITE_DCHECK_EQ(
-      convolve_wrapper(
-          &ctx, &conv_params, &quant_params, &input_dims,
-          tflite::micro::GetTensorData<ActType>(input), &filter_dims,
-          tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
-          tflite::micro::GetOptionalTensorData<BiasType>(bias), &output_dims,
-          tflite::micro::GetTensorData<ActType>(output), type),
-      ARM_CMSIS_NN_SUCCESS);
+  // The output rows are split between the threads set before
+  // AllocateTensors, one range on the target.
+  const int64_t row_work = static_cast<int64_t>(batch_size) * output_dims.w *
+                           output_depth * filter_dims.h * filter_dims.w *
+                           input_depth;
+  ParallelForKernel(data.threads, output_dims.h, KernelMinItems(row_work),
+                    ConvolveRows<ActType, BiasType, type>, &rows);
 
   return kTfLiteOk;
 }
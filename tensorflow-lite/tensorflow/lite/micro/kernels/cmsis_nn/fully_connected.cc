@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/kernels/fully_connected.h"
 
 #include "Include/arm_nnfunctions.h"
+#include "Include/arm_nnsupportfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
@@ -25,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_threads.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_arena_constants.h"
 #include "tensorflow/lite/micro/micro_log.h"
@@ -32,6 +34,26 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+// Costs of the int8 paths, in instructions per 16 operations on the M4. The
+// dense DSP loop takes 13 instructions per 2 rows x 4 columns, the sparse
+// loop 11 per 4 rows x 1 input, and compacting the input about 5 per input.
+// These are instruction counts, not cycles measured on the target, so the
+// sparse path is only used when TFLM_CMSIS_NN_SPARSE_FC is defined.
+constexpr int32_t kDenseCostPerMac = 26;
+constexpr int32_t kSparseCostPerMac = 44;
+constexpr int32_t kCompactCostPerInput = 80;
+
+// Rows of the filter taken at a time by the sparse loop.
+constexpr int kSparseRows = 4;
+
+// The number of inputs off the zero point is averaged over the calls with a
+// weight of 1/2^kSparseAverageShift for the last one, in 1/2^8 units. While
+// the average is above the break-even count the input is only measured every
+// kSparseProbeInterval calls.
+constexpr int kSparseAverageShift = 3;
+constexpr int kSparseAverageFractionBits = 8;
+constexpr uint32_t kSparseProbeInterval = 16;
+
 struct OpData {
   OpDataFullyConnected reference_op_data;
 
@@ -43,11 +65,26 @@ struct OpData {
   // Index to buffer for optimizations if applicable.
   int buffer_idx;
 
+  // nullptr unless the kernel needs them (MVE).
   int32_t* kernel_sums;
 
+  // Inputs at the zero point contribute nothing, so when few enough inputs
+  // are off it, only the filter columns of those are read, see
+  // EvalSparseInt8. sparse_buffer_idx is -1 if that never pays off, or
+  // without TFLM_CMSIS_NN_SPARSE_FC.
+  int sparse_buffer_idx;
+  int32_t sparse_max_nonzero;
+  // Measured sparsity of the inputs, see kSparseAverageShift. Updated by
+  // Eval, so a layer whose inputs are mostly dense skips the compaction.
+  int32_t sparse_nonzero_average;
+  uint32_t sparse_inputs;
+
   int32_t batches;
   int32_t accum_depth;
   int32_t output_depth;
+
+  // Threads the int8 output neurons are split between.
+  int threads;
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
@@ -94,6 +131,11 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   // Set buffer index to a reset value
   data->buffer_idx = -1;
+  data->sparse_buffer_idx = -1;
+  data->sparse_nonzero_average = 0;
+  data->sparse_inputs = 0;
+  data->kernel_sums = nullptr;
+  data->threads = KernelThreadCount();
   TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
       context, params->activation, input->type, input, filter, bias, output,
       &(data->reference_op_data)));
@@ -141,6 +183,20 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
         // Do not request a scratch buffer since using persistent memory
         buf_size = 0;
       }
+
+#if defined(TFLM_CMSIS_NN_SPARSE_FC)
+      // Break-even number of inputs off the zero point, from the costs of
+      // the dense and sparse loops over every row plus the compaction.
+      data->sparse_max_nonzero =
+          data->accum_depth *
+          (kDenseCostPerMac * data->output_depth - kCompactCostPerInput) /
+          (kSparseCostPerMac * data->output_depth);
+      if (data->sparse_max_nonzero > 0 && data->accum_depth <= UINT16_MAX) {
+        TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+            context, data->sparse_max_nonzero * sizeof(uint32_t),
+            &data->sparse_buffer_idx));
+      }
+#endif
     }
   }
 
@@ -239,6 +295,152 @@ TfLiteStatus EvalQuantizedInt4(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+// Writes the inputs that are off the zero point to `entries`, as their index
+// in the high half and their value plus `input_offset` in the low half.
+// Returns their count, or -1 as soon as there are more than `max_count`.
+// Runs of four zero points are skipped with one compare. `nonzero` is set to
+// the count, estimated from the inputs seen when it gives up.
+int CompactInput(const int8_t* input, int depth, int32_t input_offset,
+                 int max_count, uint32_t* entries, int* nonzero) {
+  const int8_t zero_point = static_cast<int8_t>(-input_offset);
+  const int32_t zero_points = static_cast<int32_t>(
+      static_cast<uint8_t>(zero_point) * 0x01010101u);
+  int count = 0;
+  int i = 0;
+  for (; i + 4 <= depth; i += 4) {
+    if (arm_nn_read_s8x4(&input[i]) == zero_points) {
+      continue;
+    }
+    for (int j = i; j < i + 4; ++j) {
+      if (input[j] != zero_point) {
+        if (count == max_count) {
+          *nonzero = (count + 1) * depth / (j + 1);
+          return -1;
+        }
+        entries[count++] = (static_cast<uint32_t>(j) << 16) |
+                           static_cast<uint16_t>(input[j] + input_offset);
+      }
+    }
+  }
+  for (; i < depth; ++i) {
+    if (input[i] != zero_point) {
+      if (count == max_count) {
+        *nonzero = (count + 1) * depth / (i + 1);
+        return -1;
+      }
+      entries[count++] = (static_cast<uint32_t>(i) << 16) |
+                         static_cast<uint16_t>(input[i] + input_offset);
+    }
+  }
+  *nonzero = count;
+  return count;
+}
+
+inline int8_t RequantizeInt8(const OpDataFullyConnected& op_data,
+                             int32_t acc) {
+  acc = arm_nn_requantize(acc, op_data.output_multiplier,
+                          op_data.output_shift);
+  acc += op_data.output_zero_point;
+  acc = MAX(acc, op_data.output_activation_min);
+  acc = MIN(acc, op_data.output_activation_max);
+  return static_cast<int8_t>(acc);
+}
+
+// Output neurons [begin, end) of one batch of the int8 FC over the `count`
+// compacted inputs: only their filter columns are read, kSparseRows rows at
+// a time. The sums are the same as those of the dense kernel, which adds
+// zeros for the other columns.
+void EvalSparseInt8(const OpData& data, const uint32_t* entries, int count,
+                    const int8_t* filter, const int32_t* bias, int8_t* output,
+                    int begin, int end) {
+  const OpDataFullyConnected& op_data = data.reference_op_data;
+  const int depth = data.accum_depth;
+  int row = begin;
+  for (; row + kSparseRows <= end; row += kSparseRows) {
+    const int8_t* filter_0 = &filter[row * depth];
+    const int8_t* filter_1 = filter_0 + depth;
+    const int8_t* filter_2 = filter_1 + depth;
+    const int8_t* filter_3 = filter_2 + depth;
+    int32_t acc_0 = 0;
+    int32_t acc_1 = 0;
+    int32_t acc_2 = 0;
+    int32_t acc_3 = 0;
+    if (bias != nullptr) {
+      acc_0 = bias[row];
+      acc_1 = bias[row + 1];
+      acc_2 = bias[row + 2];
+      acc_3 = bias[row + 3];
+    }
+    for (int k = 0; k < count; ++k) {
+      const uint32_t index = entries[k] >> 16;
+      const int32_t value = static_cast<int16_t>(entries[k]);
+      acc_0 += filter_0[index] * value;
+      acc_1 += filter_1[index] * value;
+      acc_2 += filter_2[index] * value;
+      acc_3 += filter_3[index] * value;
+    }
+    output[row] = RequantizeInt8(op_data, acc_0);
+    output[row + 1] = RequantizeInt8(op_data, acc_1);
+    output[row + 2] = RequantizeInt8(op_data, acc_2);
+    output[row + 3] = RequantizeInt8(op_data, acc_3);
+  }
+  for (; row < end; ++row) {
+    const int8_t* filter_row = &filter[row * depth];
+    int32_t acc = bias != nullptr ? bias[row] : 0;
+    for (int k = 0; k < count; ++k) {
+      acc += filter_row[entries[k] >> 16] * static_cast<int16_t>(entries[k]);
+    }
+    output[row] = RequantizeInt8(op_data, acc);
+  }
+}
+
+// The int8 FC of `batches` batches, split by FullyConnectedRows.
+struct FullyConnectedRowsArgs {
+  const OpData* data;
+  cmsis_nn_fc_params fc_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  const int8_t* input;
+  const int8_t* filter;
+  const int32_t* bias;
+  int8_t* output;
+  int batches;
+  // The compacted input of the single batch, or a count of -1 for the dense
+  // kernel.
+  const uint32_t* entries;
+  int count;
+};
+
+// Output neurons [begin, end) of every batch: the filter rows, bias and
+// output of those neurons only. No scratch buffer is used.
+void FullyConnectedRows(void* arg, int /*thread*/, int begin, int end) {
+  const auto& rows = *static_cast<const FullyConnectedRowsArgs*>(arg);
+  const OpData& data = *rows.data;
+  if (rows.count >= 0) {
+    EvalSparseInt8(data, rows.entries, rows.count, rows.filter, rows.bias,
+                   rows.output, begin, end);
+    return;
+  }
+
+  const int32_t* bias = rows.bias != nullptr ? rows.bias + begin : nullptr;
+
+  cmsis_nn_context ctx;
+  ctx.buf = data.kernel_sums != nullptr ? data.kernel_sums + begin : nullptr;
+  ctx.size = 0;
+  const cmsis_nn_dims input_dims = {1, 1, 1, data.accum_depth};
+  const cmsis_nn_dims filter_dims = {data.accum_depth, 1, 1, end - begin};
+  const cmsis_nn_dims bias_dims = {1, 1, 1, end - begin};
+  const cmsis_nn_dims output_dims = {1, 1, 1, end - begin};
+  for (int batch = 0; batch < rows.batches; ++batch) {
+    TFLITE_DCHECK_EQ(
+        arm_fully_connected_s8(
+            &ctx, &rows.fc_params, &rows.quant_params, &input_dims,
+            rows.input + batch * data.accum_depth, &filter_dims,
+            rows.filter + begin * data.accum_depth, &bias_dims, bias,
+            &output_dims, rows.output + batch * data.output_depth + begin),
+        ARM_CMSIS_NN_SUCCESS);
+  }
+}
+
 TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
                                const OpData& data,
                                const TfLiteEvalTensor* input,
@@ -303,15 +505,61 @@ TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
     fc_params.activation.min = data.reference_op_data.output_activation_min;
     fc_params.activation.max = data.reference_op_data.output_activation_max;
 
-    ctx.buf = data.kernel_sums;
-    TF_LITE_ENSURE_EQ(
-        context,
-        arm_fully_connected_s8(
-            &ctx, &fc_params, &quant_params, &input_dims,
-            tflite::micro::GetTensorData<int8_t>(input), &filter_dims,
-            tflite::micro::GetTensorData<int8_t>(filter), &bias_dims, bias_data,
-            &output_dims, tflite::micro::GetTensorData<int8_t>(output)),
-        ARM_CMSIS_NN_SUCCESS);
+    // The output neurons are split between the threads set before
+    // AllocateTensors, one range on the target.
+    FullyConnectedRowsArgs rows;
+    rows.data = &data;
+    rows.fc_params = fc_params;
+    rows.quant_params = quant_params;
+    rows.input = tflite::micro::GetTensorData<int8_t>(input);
+    rows.filter = tflite::micro::GetTensorData<int8_t>(filter);
+    rows.bias = bias_data;
+    rows.output = tflite::micro::GetTensorData<int8_t>(output);
+    rows.batches = data.batches;
+    rows.entries = nullptr;
+    rows.count = -1;
+    if (data.sparse_buffer_idx == -1) {
+      ParallelForKernel(
+          data.threads, data.output_depth,
+          KernelMinItems(static_cast<int64_t>(data.batches) * data.accum_depth),
+          FullyConnectedRows, &rows);
+      return kTfLiteOk;
+    }
+
+    // Compaction is tried while the average sparsity of the inputs so far
+    // makes the sparse loop the faster one, and gives up as soon as this
+    // input has too many entries. A dense layer takes the plain path and
+    // only pays for a scan every kSparseProbeInterval inputs, to follow a
+    // change in its inputs. It is done once, before the split.
+    OpData* state = static_cast<OpData*>(node->user_data);
+    const int32_t max_average = data.sparse_max_nonzero
+                                << kSparseAverageFractionBits;
+    uint32_t* entries = static_cast<uint32_t*>(
+        context->GetScratchBuffer(context, data.sparse_buffer_idx));
+    rows.batches = 1;
+    rows.entries = entries;
+    for (int batch = 0; batch < data.batches; ++batch) {
+      rows.input = tflite::micro::GetTensorData<int8_t>(input) +
+                   batch * data.accum_depth;
+      rows.output = tflite::micro::GetTensorData<int8_t>(output) +
+                    batch * data.output_depth;
+      rows.count = -1;
+      if (state->sparse_nonzero_average <= max_average ||
+          ++state->sparse_inputs % kSparseProbeInterval == 0) {
+        int nonzero;
+        rows.count =
+            CompactInput(rows.input, data.accum_depth, fc_params.input_offset,
+                         data.sparse_max_nonzero, entries, &nonzero);
+        state->sparse_nonzero_average +=
+            ((nonzero << kSparseAverageFractionBits) -
+             state->sparse_nonzero_average) >>
+            kSparseAverageShift;
+      }
+      ParallelForKernel(data.threads, data.output_depth,
+                        KernelMinItems(rows.count >= 0 ? rows.count
+                                                       : data.accum_depth),
+                        FullyConnectedRows, &rows);
+    }
   }
   return kTfLiteOk;
 }
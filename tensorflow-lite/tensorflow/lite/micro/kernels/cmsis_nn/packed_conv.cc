@@ -0,0 +1,283 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "Include/arm_nnsupportfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/packed_weights.h"
+#include "tensorflow/lite/micro/kernels/palettized.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+// Indices into the init flexbuffer's vector.
+// The parameter's name is in the comment that follows.
+// Elements in the vectors are ordered alphabetically by parameter name.
+constexpr int kDilationHFactorIndex = 0;          // 'dilation_h_factor'
+constexpr int kDilationWFactorIndex = 1;          // 'dilation_w_factor'
+constexpr int kFilterHeightIndex = 2;             // 'filter_height'
+constexpr int kFilterWidthIndex = 3;              // 'filter_width'
+constexpr int kFusedActivationFunctionIndex = 4;  // 'fused_activation_function'
+constexpr int kPaddingIndex = 5;                  // 'padding'
+constexpr int kStrideHIndex = 6;                  // 'stride_h'
+constexpr int kStrideWIndex = 7;                  // 'stride_w'
+
+struct OpData {
+  OpDataConv reference_op_data;
+  TfLiteConvParams params;
+  int filter_height;
+  int filter_width;
+
+  // One im2col row in int8, followed by two widened columns.
+  int im2col_buffer_index;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  auto* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+
+  tflite::FlexbufferWrapper fbw(reinterpret_cast<const uint8_t*>(buffer),
+                                length);
+  data->params.dilation_height_factor =
+      fbw.ElementAsInt32(kDilationHFactorIndex);
+  data->params.dilation_width_factor = fbw.ElementAsInt32(kDilationWFactorIndex);
+  data->filter_height = fbw.ElementAsInt32(kFilterHeightIndex);
+  data->filter_width = fbw.ElementAsInt32(kFilterWidthIndex);
+  data->params.activation =
+      PalettizedActivation(fbw.ElementAsInt32(kFusedActivationFunctionIndex));
+  data->params.padding = PalettizedPadding(fbw.ElementAsInt32(kPaddingIndex));
+  data->params.stride_height = fbw.ElementAsInt32(kStrideHIndex);
+  data->params.stride_width = fbw.ElementAsInt32(kStrideWIndex);
+  return data;
+}
+
+// Depth of one im2col row, before packing.
+int Im2colDepth(const OpData& data, int input_depth) {
+  return data.filter_height * data.filter_width * input_depth;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+
+  TF_LITE_ENSURE(context, NumInputs(node) == 2 || NumInputs(node) == 3);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kPackedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, kPackedFilterTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, kPackedBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kPackedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE(context,
+                 filter->type == kTfLiteInt8 || filter->type == kTfLiteInt16);
+  TF_LITE_ENSURE(context, IsConstantTensor(filter));
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(filter), 2);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(output), 4);
+
+  const RuntimeShape input_shape = GetTensorShape(input);
+  const RuntimeShape output_shape = GetTensorShape(output);
+  const int num_channels = output_shape.Dims(3);
+  const int depth = Im2colDepth(*data, input_shape.Dims(3));
+  TF_LITE_ENSURE_EQ(context, filter->dims->data[0], num_channels);
+  TF_LITE_ENSURE_EQ(context, filter->dims->data[1], PackedDepth(depth));
+
+  int out_height;
+  int out_width;
+  data->reference_op_data.padding = ComputePaddingHeightWidth(
+      data->params.stride_height, data->params.stride_width,
+      data->params.dilation_height_factor, data->params.dilation_width_factor,
+      input_shape.Dims(1), input_shape.Dims(2), data->filter_height,
+      data->filter_width, data->params.padding, &out_height, &out_width);
+  TF_LITE_ENSURE_EQ(context, out_height, output_shape.Dims(1));
+  TF_LITE_ENSURE_EQ(context, out_width, output_shape.Dims(2));
+
+  data->reference_op_data.per_channel_output_multiplier =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, num_channels * sizeof(int32_t)));
+  data->reference_op_data.per_channel_output_shift =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, num_channels * sizeof(int32_t)));
+
+  // The packed filter carries the quantization parameters of the original
+  // int8 filter, which is the type they are checked against.
+  filter->type = kTfLiteInt8;
+  TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
+      context, input, filter, bias, output, data->params.activation,
+      &data->reference_op_data.output_multiplier,
+      &data->reference_op_data.output_shift,
+      &data->reference_op_data.output_activation_min,
+      &data->reference_op_data.output_activation_max,
+      data->reference_op_data.per_channel_output_multiplier,
+      data->reference_op_data.per_channel_output_shift, num_channels));
+  data->reference_op_data.input_zero_point = input->params.zero_point;
+  data->reference_op_data.filter_zero_point = filter->params.zero_point;
+  data->reference_op_data.output_zero_point = output->params.zero_point;
+
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, PackedDepth(depth) + 2 * PackedDepth(depth) * sizeof(int16_t),
+      &data->im2col_buffer_index));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  return kTfLiteOk;
+}
+
+template <typename T>
+void EvalPacked(const OpData& data, const RuntimeShape& input_shape,
+                const int8_t* input_data, const T* filter_data,
+                const int32_t* bias_data, const RuntimeShape& output_shape,
+                int8_t* output_data, void* buffer) {
+  const OpDataConv& op_data = data.reference_op_data;
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int depth = Im2colDepth(data, input_depth);
+  const int packed_depth = PackedDepth(depth);
+  const int16_t input_offset = static_cast<int16_t>(-op_data.input_zero_point);
+
+  PackedMatMulParams params;
+  params.rows = output_shape.Dims(3);
+  params.depth = packed_depth;
+  params.bias = bias_data;
+  params.output_multiplier = op_data.per_channel_output_multiplier;
+  params.output_shift = op_data.per_channel_output_shift;
+  params.per_channel = true;
+  params.output_offset = op_data.output_zero_point;
+  params.output_activation_min = op_data.output_activation_min;
+  params.output_activation_max = op_data.output_activation_max;
+
+  // The int16 columns come first, so they stay aligned.
+  int16_t* columns = static_cast<int16_t*>(buffer);
+  int8_t* im2col = reinterpret_cast<int8_t*>(columns + 2 * packed_depth);
+
+  for (int batch = 0; batch < input_shape.Dims(0); ++batch) {
+    const int8_t* batch_input =
+        input_data + batch * input_height * input_width * input_depth;
+    int8_t* out = output_data + batch * output_height * output_width *
+                                    params.rows;
+    int pending = 0;
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int base_y =
+            out_y * data.params.stride_height - op_data.padding.height;
+        const int base_x =
+            out_x * data.params.stride_width - op_data.padding.width;
+        int8_t* row = im2col;
+        for (int filter_y = 0; filter_y < data.filter_height; ++filter_y) {
+          const int in_y =
+              base_y + filter_y * data.params.dilation_height_factor;
+          for (int filter_x = 0; filter_x < data.filter_width; ++filter_x) {
+            const int in_x =
+                base_x + filter_x * data.params.dilation_width_factor;
+            if (in_y < 0 || in_y >= input_height || in_x < 0 ||
+                in_x >= input_width) {
+              arm_memset_s8(row, static_cast<int8_t>(-input_offset),
+                            input_depth);
+            } else {
+              arm_memcpy_s8(row,
+                            batch_input +
+                                (in_y * input_width + in_x) * input_depth,
+                            input_depth);
+            }
+            row += input_depth;
+          }
+        }
+        PackedWidenInput(im2col, depth, input_offset,
+                         columns + pending * packed_depth);
+
+        // Output pixels are taken two at a time, so every filter row pair is
+        // read once per two pixels.
+        if (++pending == 2) {
+          PackedMatMul(params, filter_data, columns, columns + packed_depth,
+                       out);
+          out += 2 * params.rows;
+          pending = 0;
+        }
+      }
+    }
+    if (pending != 0) {
+      PackedMatMul(params, filter_data, columns, nullptr, out);
+    }
+  }
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kPackedInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, kPackedFilterTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, kPackedBiasTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kPackedOutputTensor);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+  void* buffer = context->GetScratchBuffer(context, data.im2col_buffer_index);
+
+  if (filter->type == kTfLiteInt16) {
+    EvalPacked(data, tflite::micro::GetTensorShape(input),
+               tflite::micro::GetTensorData<int8_t>(input),
+               tflite::micro::GetTensorData<int16_t>(filter),
+               tflite::micro::GetOptionalTensorData<int32_t>(bias),
+               tflite::micro::GetTensorShape(output),
+               tflite::micro::GetTensorData<int8_t>(output), buffer);
+  } else {
+    EvalPacked(data, tflite::micro::GetTensorShape(input),
+               tflite::micro::GetTensorData<int8_t>(input),
+               tflite::micro::GetTensorData<int8_t>(filter),
+               tflite::micro::GetOptionalTensorData<int32_t>(bias),
+               tflite::micro::GetTensorShape(output),
+               tflite::micro::GetTensorData<int8_t>(output), buffer);
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration* Register_PACKED_CONV_2D() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &r;
+}
+
+}  // namespace tflite
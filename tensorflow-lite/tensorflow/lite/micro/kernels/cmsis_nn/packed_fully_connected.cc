@@ -0,0 +1,184 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/packed_weights.h"
+#include "tensorflow/lite/micro/kernels/palettized.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+// Indices into the init flexbuffer's vector.
+// The parameter's name is in the comment that follows.
+// Elements in the vectors are ordered alphabetically by parameter name.
+constexpr int kFusedActivationFunctionIndex = 0;  // 'fused_activation_function'
+
+struct OpData {
+  OpDataFullyConnected reference_op_data;
+  TfLiteFusedActivation activation;
+
+  // Two widened input rows, so batches are taken two at a time.
+  int columns_buffer_index;
+
+  int32_t batches;
+  int32_t accum_depth;
+  int32_t packed_depth;
+  int32_t output_depth;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  auto* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+
+  tflite::FlexbufferWrapper fbw(reinterpret_cast<const uint8_t*>(buffer),
+                                length);
+  data->activation =
+      PalettizedActivation(fbw.ElementAsInt32(kFusedActivationFunctionIndex));
+  return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+
+  TF_LITE_ENSURE(context, NumInputs(node) == 2 || NumInputs(node) == 3);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kPackedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, kPackedFilterTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, kPackedBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kPackedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE(context,
+                 filter->type == kTfLiteInt8 || filter->type == kTfLiteInt16);
+  TF_LITE_ENSURE(context, IsConstantTensor(filter));
+  TF_LITE_ENSURE_EQ(context, NumDimensions(filter), 2);
+
+  const RuntimeShape output_shape = GetTensorShape(output);
+  const int output_dim_count = output_shape.DimensionsCount();
+  data->output_depth = output_shape.Dims(output_dim_count - 1);
+  data->batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  data->accum_depth = NumElements(input) / data->batches;
+  data->packed_depth = filter->dims->data[1];
+  TF_LITE_ENSURE_EQ(context, filter->dims->data[0], data->output_depth);
+  TF_LITE_ENSURE_EQ(context, NumElements(input),
+                    data->batches * data->accum_depth);
+  TF_LITE_ENSURE_EQ(context, PackedDepth(data->accum_depth),
+                    data->packed_depth);
+
+  // The packed filter carries the quantization parameters of the original.
+  TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
+      context, data->activation, input->type, input, filter, bias, output,
+      &data->reference_op_data));
+  TF_LITE_ENSURE_EQ(context, data->reference_op_data.filter_zero_point, 0);
+
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, 2 * data->packed_depth * sizeof(int16_t),
+      &data->columns_buffer_index));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kPackedInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, kPackedFilterTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, kPackedBiasTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kPackedOutputTensor);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+  const OpDataFullyConnected& op_data = data.reference_op_data;
+
+  // OpDataFullyConnected keeps the shift as an int.
+  const int32_t output_shift = op_data.output_shift;
+  PackedMatMulParams params;
+  params.rows = data.output_depth;
+  params.depth = data.packed_depth;
+  params.bias = tflite::micro::GetOptionalTensorData<int32_t>(bias);
+  params.output_multiplier = &op_data.output_multiplier;
+  params.output_shift = &output_shift;
+  params.per_channel = false;
+  params.output_offset = op_data.output_zero_point;
+  params.output_activation_min = op_data.output_activation_min;
+  params.output_activation_max = op_data.output_activation_max;
+
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+  int16_t* columns = static_cast<int16_t*>(
+      context->GetScratchBuffer(context, data.columns_buffer_index));
+  const int16_t input_offset =
+      static_cast<int16_t>(-op_data.input_zero_point);
+
+  // Each input row is widened once and then used for every filter row.
+  for (int batch = 0; batch < data.batches; batch += 2) {
+    int16_t* column_1 = nullptr;
+    PackedWidenInput(&input_data[batch * data.accum_depth], data.accum_depth,
+                     input_offset, columns);
+    if (batch + 1 < data.batches) {
+      column_1 = columns + data.packed_depth;
+      PackedWidenInput(&input_data[(batch + 1) * data.accum_depth],
+                       data.accum_depth, input_offset, column_1);
+    }
+    int8_t* batch_output = &output_data[batch * data.output_depth];
+    if (filter->type == kTfLiteInt16) {
+      PackedMatMul(params, tflite::micro::GetTensorData<int16_t>(filter),
+                   columns, column_1, batch_output);
+    } else {
+      PackedMatMul(params, tflite::micro::GetTensorData<int8_t>(filter),
+                   columns, column_1, batch_output);
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration* Register_PACKED_FULLY_CONNECTED() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &r;
+}
+
+}  // namespace tflite
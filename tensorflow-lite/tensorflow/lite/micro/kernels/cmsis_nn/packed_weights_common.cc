@@ -0,0 +1,211 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "Include/arm_nnsupportfunctions.h"
+#include "tensorflow/lite/micro/kernels/packed_weights.h"
+
+namespace tflite {
+
+const int kPackedInputTensor = 0;
+const int kPackedFilterTensor = 1;
+const int kPackedBiasTensor = 2;
+const int kPackedOutputTensor = 0;
+
+namespace {
+
+#if defined(ARM_MATH_DSP)
+// Loads the next group of one row as the SMLAD operands (w0, w2) and
+// (w1, w3). Only the int8 filter still needs the two SXTB16.
+inline void LoadGroup(const int8_t** filter, int32_t* even, int32_t* odd) {
+  const int32_t weights = arm_nn_read_s8x4_ia(filter);
+  *even = SXTB16(weights);
+  *odd = SXTB16_RORn(static_cast<uint32_t>(weights), 8);
+}
+
+inline void LoadGroup(const int16_t** filter, int32_t* even, int32_t* odd) {
+  *even = arm_nn_read_q15x2_ia(filter);
+  *odd = arm_nn_read_q15x2_ia(filter);
+}
+#else
+// Dot product of one group of weights with one group of a widened column,
+// which is in the order [x0, x2, x1, x3].
+inline int32_t GroupDot(const int8_t* weights, const int16_t* column) {
+  return weights[0] * column[0] + weights[2] * column[1] +
+         weights[1] * column[2] + weights[3] * column[3];
+}
+
+inline int32_t GroupDot(const int16_t* weights, const int16_t* column) {
+  return weights[0] * column[0] + weights[1] * column[1] +
+         weights[2] * column[2] + weights[3] * column[3];
+}
+#endif
+
+inline int8_t Requantize(const PackedMatMulParams& params, int32_t acc,
+                         int row) {
+  const int q = params.per_channel ? row : 0;
+  acc = arm_nn_requantize(acc, params.output_multiplier[q],
+                          params.output_shift[q]);
+  acc += params.output_offset;
+  acc = MAX(acc, params.output_activation_min);
+  acc = MIN(acc, params.output_activation_max);
+  return static_cast<int8_t>(acc);
+}
+
+template <typename T>
+void MatMul(const PackedMatMulParams& params, const T* filter,
+            const int16_t* column_0, const int16_t* column_1, int8_t* output) {
+  const int groups = params.depth / kPackedGroupSize;
+  int8_t* output_1 = output + params.rows;
+
+  int row = 0;
+  for (; row + 1 < params.rows; row += 2) {
+    int32_t acc_00 = params.bias != nullptr ? params.bias[row] : 0;
+    int32_t acc_10 = params.bias != nullptr ? params.bias[row + 1] : 0;
+    int32_t acc_01 = acc_00;
+    int32_t acc_11 = acc_10;
+    const int16_t* b_0 = column_0;
+    const int16_t* b_1 = column_1;
+
+    if (column_1 != nullptr) {
+      for (int group = 0; group < groups; ++group) {
+#if defined(ARM_MATH_DSP)
+        int32_t a_0_even, a_0_odd, a_1_even, a_1_odd;
+        LoadGroup(&filter, &a_0_even, &a_0_odd);
+        LoadGroup(&filter, &a_1_even, &a_1_odd);
+
+        int32_t b_even = arm_nn_read_q15x2_ia(&b_0);
+        int32_t b_odd = arm_nn_read_q15x2_ia(&b_0);
+        acc_00 = SMLAD(a_0_even, b_even, acc_00);
+        acc_00 = SMLAD(a_0_odd, b_odd, acc_00);
+        acc_10 = SMLAD(a_1_even, b_even, acc_10);
+        acc_10 = SMLAD(a_1_odd, b_odd, acc_10);
+
+        b_even = arm_nn_read_q15x2_ia(&b_1);
+        b_odd = arm_nn_read_q15x2_ia(&b_1);
+        acc_01 = SMLAD(a_0_even, b_even, acc_01);
+        acc_01 = SMLAD(a_0_odd, b_odd, acc_01);
+        acc_11 = SMLAD(a_1_even, b_even, acc_11);
+        acc_11 = SMLAD(a_1_odd, b_odd, acc_11);
+#else
+        acc_00 += GroupDot(filter, b_0);
+        acc_01 += GroupDot(filter, b_1);
+        acc_10 += GroupDot(filter + kPackedGroupSize, b_0);
+        acc_11 += GroupDot(filter + kPackedGroupSize, b_1);
+        filter += 2 * kPackedGroupSize;
+        b_0 += kPackedGroupSize;
+        b_1 += kPackedGroupSize;
+#endif
+      }
+      output_1[row] = Requantize(params, acc_01, row);
+      output_1[row + 1] = Requantize(params, acc_11, row + 1);
+    } else {
+      for (int group = 0; group < groups; ++group) {
+#if defined(ARM_MATH_DSP)
+        int32_t a_0_even, a_0_odd, a_1_even, a_1_odd;
+        LoadGroup(&filter, &a_0_even, &a_0_odd);
+        LoadGroup(&filter, &a_1_even, &a_1_odd);
+
+        const int32_t b_even = arm_nn_read_q15x2_ia(&b_0);
+        const int32_t b_odd = arm_nn_read_q15x2_ia(&b_0);
+        acc_00 = SMLAD(a_0_even, b_even, acc_00);
+        acc_00 = SMLAD(a_0_odd, b_odd, acc_00);
+        acc_10 = SMLAD(a_1_even, b_even, acc_10);
+        acc_10 = SMLAD(a_1_odd, b_odd, acc_10);
+#else
+        acc_00 += GroupDot(filter, b_0);
+        acc_10 += GroupDot(filter + kPackedGroupSize, b_0);
+        filter += 2 * kPackedGroupSize;
+        b_0 += kPackedGroupSize;
+#endif
+      }
+    }
+    output[row] = Requantize(params, acc_00, row);
+    output[row + 1] = Requantize(params, acc_10, row + 1);
+  }
+
+  // The odd last row is not interleaved.
+  if (row < params.rows) {
+    int32_t acc_0 = params.bias != nullptr ? params.bias[row] : 0;
+    int32_t acc_1 = acc_0;
+    const int16_t* b_0 = column_0;
+    const int16_t* b_1 = column_1;
+    for (int group = 0; group < groups; ++group) {
+#if defined(ARM_MATH_DSP)
+      int32_t a_even, a_odd;
+      LoadGroup(&filter, &a_even, &a_odd);
+      acc_0 = SMLAD(a_even, arm_nn_read_q15x2_ia(&b_0), acc_0);
+      acc_0 = SMLAD(a_odd, arm_nn_read_q15x2_ia(&b_0), acc_0);
+      if (b_1 != nullptr) {
+        acc_1 = SMLAD(a_even, arm_nn_read_q15x2_ia(&b_1), acc_1);
+        acc_1 = SMLAD(a_odd, arm_nn_read_q15x2_ia(&b_1), acc_1);
+      }
+#else
+      acc_0 += GroupDot(filter, b_0);
+      b_0 += kPackedGroupSize;
+      if (b_1 != nullptr) {
+        acc_1 += GroupDot(filter, b_1);
+        b_1 += kPackedGroupSize;
+      }
+      filter += kPackedGroupSize;
+#endif
+    }
+    output[row] = Requantize(params, acc_0, row);
+    if (column_1 != nullptr) {
+      output_1[row] = Requantize(params, acc_1, row);
+    }
+  }
+}
+
+}  // namespace
+
+void PackedWidenInput(const int8_t* input, int count, int16_t offset,
+                      int16_t* column) {
+  int i = 0;
+#if defined(ARM_MATH_DSP)
+  // SXTAB16 gives the packed order directly.
+  const int32_t offset_s16x2 = PKHBT(offset, offset, 16);
+  for (; i + kPackedGroupSize <= count; i += kPackedGroupSize) {
+    const int32_t values = arm_nn_read_s8x4_ia(&input);
+    arm_nn_write_q15x2_ia(&column, SXTAB16(offset_s16x2, values));
+    arm_nn_write_q15x2_ia(
+        &column, SXTAB16_RORn(offset_s16x2, static_cast<uint32_t>(values), 8));
+  }
+#endif
+  for (; i < count; i += kPackedGroupSize) {
+    int16_t group[kPackedGroupSize];
+    for (int j = 0; j < kPackedGroupSize; ++j) {
+      group[j] = i + j < count ? static_cast<int16_t>(input[j] + offset) : 0;
+    }
+    input += kPackedGroupSize;
+    *column++ = group[0];
+    *column++ = group[2];
+    *column++ = group[1];
+    *column++ = group[3];
+  }
+}
+
+void PackedMatMul(const PackedMatMulParams& params, const int8_t* filter,
+                  const int16_t* column_0, const int16_t* column_1,
+                  int8_t* output) {
+  MatMul(params, filter, column_0, column_1, output);
+}
+
+void PackedMatMul(const PackedMatMulParams& params, const int16_t* filter,
+                  const int16_t* column_0, const int16_t* column_1,
+                  int8_t* output) {
+  MatMul(params, filter, column_0, column_1, output);
+}
+
+}  // namespace tflite
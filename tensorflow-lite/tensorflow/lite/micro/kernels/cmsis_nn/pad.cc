@@ -16,6 +16,7 @@ limitations under the License.
 
 #include <string.h>
 
+#include "Include/arm_nnsupportfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/types.h"
@@ -32,6 +33,76 @@ struct OpData {
   int32_t output_zero_point;
 };
 
+// int8 pad as block copies. Every output row of width * depth values is
+// either all padding or the left padding, the input row and the right
+// padding; without channel padding the input row is a single block.
+void PadS8(const PadParams& params, const RuntimeShape& input_shape,
+           const int8_t* input, int8_t pad_value,
+           const RuntimeShape& output_shape, int8_t* output) {
+  constexpr int kDims = reference_ops::PadKernelMaxDimensionCount();
+  const RuntimeShape ext_input = RuntimeShape::ExtendedShape(kDims, input_shape);
+  const RuntimeShape ext_output =
+      RuntimeShape::ExtendedShape(kDims, output_shape);
+  // Leading dimensions added by the extension are not padded.
+  int left[kDims] = {};
+  int right[kDims] = {};
+  for (int i = 0; i < params.left_padding_count; ++i) {
+    left[kDims - params.left_padding_count + i] = params.left_padding[i];
+  }
+  for (int i = 0; i < params.right_padding_count; ++i) {
+    right[kDims - params.right_padding_count + i] = params.right_padding[i];
+  }
+
+  // Rows are indexed by the first kDims - 2 dimensions.
+  constexpr int kRowDims = kDims - 2;
+  int rows = 1;
+  for (int d = 0; d < kRowDims; ++d) {
+    rows *= ext_output.Dims(d);
+  }
+  const int output_depth = ext_output.Dims(kDims - 1);
+  const int input_width = ext_input.Dims(kDims - 2);
+  const int input_depth = ext_input.Dims(kDims - 1);
+  const int output_row = ext_output.Dims(kDims - 2) * output_depth;
+  const int input_row = input_width * input_depth;
+  const int left_row = left[kDims - 2] * output_depth;
+  const int right_row = right[kDims - 2] * output_depth;
+  const int left_depth = left[kDims - 1];
+  const int right_depth = right[kDims - 1];
+
+  for (int row = 0; row < rows; ++row) {
+    bool padded = false;
+    for (int d = kRowDims - 1, index = row; d >= 0; --d) {
+      const int i = index % ext_output.Dims(d);
+      index /= ext_output.Dims(d);
+      padded |= i < left[d] || i >= ext_output.Dims(d) - right[d];
+    }
+    if (padded) {
+      arm_memset_s8(output, pad_value, output_row);
+      output += output_row;
+      continue;
+    }
+    arm_memset_s8(output, pad_value, left_row);
+    output += left_row;
+    if (left_depth == 0 && right_depth == 0) {
+      arm_memcpy_s8(output, input, input_row);
+      output += input_row;
+      input += input_row;
+    } else {
+      for (int x = 0; x < input_width; ++x) {
+        arm_memset_s8(output, pad_value, left_depth);
+        output += left_depth;
+        arm_memcpy_s8(output, input, input_depth);
+        output += input_depth;
+        input += input_depth;
+        arm_memset_s8(output, pad_value, right_depth);
+        output += right_depth;
+      }
+    }
+    arm_memset_s8(output, pad_value, right_row);
+    output += right_row;
+  }
+}
+
 void* PadInit(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   return context->AllocatePersistentBuffer(context, sizeof(OpData));
@@ -76,18 +147,10 @@ TfLiteStatus PadEval(TfLiteContext* context, TfLiteNode* node) {
       } else {
         pad_value = *tflite::micro::GetTensorData<int8_t>(constant_values);
       }
-      if (data->params.resizing_category == ResizingCategory::kImageStyle) {
-        reference_ops::PadImageStyle(
-            data->params, tflite::micro::GetTensorShape(input),
-            tflite::micro::GetTensorData<int8_t>(input), &pad_value,
+      PadS8(data->params, tflite::micro::GetTensorShape(input),
+            tflite::micro::GetTensorData<int8_t>(input), pad_value,
             tflite::micro::GetTensorShape(output),
             tflite::micro::GetTensorData<int8_t>(output));
-      } else {
-        reference_ops::Pad(data->params, tflite::micro::GetTensorShape(input),
-                           tflite::micro::GetTensorData<int8_t>(input),
-                           &pad_value, tflite::micro::GetTensorShape(output),
-                           tflite::micro::GetTensorData<int8_t>(output));
-      }
     } break;
     case kTfLiteInt16: {
       int16_t pad_value =
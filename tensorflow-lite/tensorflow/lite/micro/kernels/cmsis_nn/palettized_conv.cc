@@ -0,0 +1,282 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "Include/arm_nnfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/palettized.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+// Indices into the init flexbuffer's vector.
+// The parameter's name is in the comment that follows.
+// Elements in the vectors are ordered alphabetically by parameter name.
+constexpr int kDilationHFactorIndex = 0;          // 'dilation_h_factor'
+constexpr int kDilationWFactorIndex = 1;          // 'dilation_w_factor'
+constexpr int kFusedActivationFunctionIndex = 2;  // 'fused_activation_function'
+constexpr int kPaddingIndex = 3;                  // 'padding'
+constexpr int kStrideHIndex = 4;                  // 'stride_h'
+constexpr int kStrideWIndex = 5;                  // 'stride_w'
+
+struct OpData {
+  OpDataConv reference_op_data;
+  TfLiteConvParams params;
+
+  // Index to buffer for optimizations if applicable.
+  int buffer_idx;
+  // Index to the buffer the filter is decoded into before each Eval.
+  int filter_buffer_idx;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  auto* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+
+  tflite::FlexbufferWrapper fbw(reinterpret_cast<const uint8_t*>(buffer),
+                                length);
+  data->params.dilation_height_factor =
+      fbw.ElementAsInt32(kDilationHFactorIndex);
+  data->params.dilation_width_factor = fbw.ElementAsInt32(kDilationWFactorIndex);
+  data->params.activation =
+      PalettizedActivation(fbw.ElementAsInt32(kFusedActivationFunctionIndex));
+  data->params.padding = PalettizedPadding(fbw.ElementAsInt32(kPaddingIndex));
+  data->params.stride_height = fbw.ElementAsInt32(kStrideHIndex);
+  data->params.stride_width = fbw.ElementAsInt32(kStrideWIndex);
+  return data;
+}
+
+void PopulateConvParams(const OpData& data, cmsis_nn_conv_params* conv_params) {
+  conv_params->input_offset = -data.reference_op_data.input_zero_point;
+  conv_params->output_offset = data.reference_op_data.output_zero_point;
+  conv_params->stride.h = data.params.stride_height;
+  conv_params->stride.w = data.params.stride_width;
+  conv_params->dilation.h = data.params.dilation_height_factor;
+  conv_params->dilation.w = data.params.dilation_width_factor;
+  conv_params->padding.h = data.reference_op_data.padding.height;
+  conv_params->padding.w = data.reference_op_data.padding.width;
+  conv_params->activation.min = data.reference_op_data.output_activation_min;
+  conv_params->activation.max = data.reference_op_data.output_activation_max;
+}
+
+void PopulateDims(const RuntimeShape& input_shape,
+                  const RuntimeShape& indices_shape,
+                  const RuntimeShape& output_shape, cmsis_nn_dims* input_dims,
+                  cmsis_nn_dims* filter_dims, cmsis_nn_dims* bias_dims,
+                  cmsis_nn_dims* output_dims) {
+  input_dims->n = input_shape.Dims(0);
+  input_dims->h = input_shape.Dims(1);
+  input_dims->w = input_shape.Dims(2);
+  input_dims->c = input_shape.Dims(3);
+
+  filter_dims->n = indices_shape.Dims(0);
+  filter_dims->h = indices_shape.Dims(1);
+  filter_dims->w = indices_shape.Dims(2);
+  filter_dims->c = indices_shape.Dims(3);
+
+  bias_dims->n = 1;
+  bias_dims->h = 1;
+  bias_dims->w = 1;
+  bias_dims->c = output_shape.Dims(3);
+
+  output_dims->n = output_shape.Dims(0);
+  output_dims->h = output_shape.Dims(1);
+  output_dims->w = output_shape.Dims(2);
+  output_dims->c = output_shape.Dims(3);
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+
+  TF_LITE_ENSURE(context, NumInputs(node) == 3 || NumInputs(node) == 4);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kPalettizedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* palette =
+      micro_context->AllocateTempInputTensor(node, kPalettizedPaletteTensor);
+  TF_LITE_ENSURE(context, palette != nullptr);
+  TfLiteTensor* indices =
+      micro_context->AllocateTempInputTensor(node, kPalettizedIndicesTensor);
+  TF_LITE_ENSURE(context, indices != nullptr);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, kPalettizedBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kPalettizedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, palette->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, indices->type, kTfLiteInt4);
+  TF_LITE_ENSURE(context, IsConstantTensor(palette));
+  TF_LITE_ENSURE(context, IsConstantTensor(indices));
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(indices), 4);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(output), 4);
+
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+  PopulateDims(GetTensorShape(input), GetTensorShape(indices),
+               GetTensorShape(output), &input_dims, &filter_dims, &bias_dims,
+               &output_dims);
+  TF_LITE_ENSURE_EQ(context, filter_dims.c, input_dims.c);
+  TF_LITE_ENSURE_EQ(context, filter_dims.n, output_dims.c);
+  TF_LITE_ENSURE_EQ(context, palette->dims->data[0], output_dims.c);
+  TF_LITE_ENSURE_EQ(context, palette->dims->data[1], kPalettizedPaletteSize);
+
+  int out_height;
+  int out_width;
+  data->reference_op_data.padding = ComputePaddingHeightWidth(
+      data->params.stride_height, data->params.stride_width,
+      data->params.dilation_height_factor, data->params.dilation_width_factor,
+      input_dims.h, input_dims.w, filter_dims.h, filter_dims.w,
+      data->params.padding, &out_height, &out_width);
+
+  const int num_channels = output_dims.c;
+  data->reference_op_data.per_channel_output_multiplier =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, num_channels * sizeof(int32_t)));
+  data->reference_op_data.per_channel_output_shift =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, num_channels * sizeof(int32_t)));
+
+  // The palette carries the quantization parameters of the original filter.
+  TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
+      context, input, palette, bias, output, data->params.activation,
+      &data->reference_op_data.output_multiplier,
+      &data->reference_op_data.output_shift,
+      &data->reference_op_data.output_activation_min,
+      &data->reference_op_data.output_activation_max,
+      data->reference_op_data.per_channel_output_multiplier,
+      data->reference_op_data.per_channel_output_shift, num_channels));
+  data->reference_op_data.input_zero_point = input->params.zero_point;
+  data->reference_op_data.filter_zero_point = palette->params.zero_point;
+  data->reference_op_data.output_zero_point = output->params.zero_point;
+
+  cmsis_nn_conv_params conv_params;
+  PopulateConvParams(*data, &conv_params);
+  const int32_t buf_size = arm_convolve_wrapper_s8_get_buffer_size(
+      &conv_params, &input_dims, &filter_dims, &output_dims);
+  if (buf_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, buf_size, &data->buffer_idx));
+  } else {
+    data->buffer_idx = -1;
+  }
+
+  // arm_convolve_wrapper_s8 walks the filter once per output pixel, so it is
+  // decoded into a scratch buffer, the same way int4 filters are unpacked.
+  // The whole filter is decoded once per Eval and the conv runs once: decoding
+  // a block of channels at a time would rebuild the im2col buffer for every
+  // block.
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, NumElements(indices), &data->filter_buffer_idx));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(palette);
+  micro_context->DeallocateTempTfLiteTensor(indices);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kPalettizedInputTensor);
+  const TfLiteEvalTensor* palette =
+      tflite::micro::GetEvalInput(context, node, kPalettizedPaletteTensor);
+  const TfLiteEvalTensor* indices =
+      tflite::micro::GetEvalInput(context, node, kPalettizedIndicesTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, kPalettizedBiasTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kPalettizedOutputTensor);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+
+  cmsis_nn_conv_params conv_params;
+  PopulateConvParams(data, &conv_params);
+
+  cmsis_nn_per_channel_quant_params quant_params;
+  quant_params.multiplier = const_cast<int32_t*>(
+      data.reference_op_data.per_channel_output_multiplier);
+  quant_params.shift =
+      const_cast<int32_t*>(data.reference_op_data.per_channel_output_shift);
+
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+  PopulateDims(tflite::micro::GetTensorShape(input),
+               tflite::micro::GetTensorShape(indices),
+               tflite::micro::GetTensorShape(output), &input_dims,
+               &filter_dims, &bias_dims, &output_dims);
+
+  int8_t* filter = static_cast<int8_t*>(
+      context->GetScratchBuffer(context, data.filter_buffer_idx));
+  const int channel_size = filter_dims.h * filter_dims.w * filter_dims.c;
+  for (int channel = 0; channel < filter_dims.n; ++channel) {
+    PalettizedDecode(tflite::micro::GetTensorData<uint8_t>(indices),
+                     tflite::micro::GetTensorData<int8_t>(palette), channel,
+                     channel_size, 0, channel_size,
+                     &filter[channel * channel_size]);
+  }
+
+  cmsis_nn_context ctx;
+  ctx.buf = nullptr;
+  ctx.size = 0;
+  if (data.buffer_idx > -1) {
+    ctx.buf = context->GetScratchBuffer(context, data.buffer_idx);
+  }
+
+  TF_LITE_ENSURE_EQ(
+      context,
+      arm_convolve_wrapper_s8(
+          &ctx, &conv_params, &quant_params, &input_dims,
+          tflite::micro::GetTensorData<int8_t>(input), &filter_dims, filter,
+          &bias_dims, tflite::micro::GetOptionalTensorData<int32_t>(bias),
+          &output_dims, tflite::micro::GetTensorData<int8_t>(output)),
+      ARM_CMSIS_NN_SUCCESS);
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration* Register_PALETTIZED_CONV_2D() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &r;
+}
+
+}  // namespace tflite
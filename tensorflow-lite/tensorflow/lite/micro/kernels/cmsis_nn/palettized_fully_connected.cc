@@ -0,0 +1,207 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "Include/arm_nnfunctions.h"
+#include "Include/arm_nnsupportfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/palettized.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+// Indices into the init flexbuffer's vector.
+// The parameter's name is in the comment that follows.
+// Elements in the vectors are ordered alphabetically by parameter name.
+constexpr int kFusedActivationFunctionIndex = 0;  // 'fused_activation_function'
+
+// Number of filter rows decoded at a time. The decoded rows live in a scratch
+// buffer, so the full int8 filter never has to be materialized.
+constexpr int kRowBlock = 4;
+
+struct OpData {
+  OpDataFullyConnected reference_op_data;
+  TfLiteFusedActivation activation;
+
+  // Only needed by the MVE kernels, nullptr otherwise.
+  int32_t* kernel_sums;
+  int rows_buffer_index;
+
+  int32_t batches;
+  int32_t accum_depth;
+  int32_t output_depth;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  auto* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+
+  tflite::FlexbufferWrapper fbw(reinterpret_cast<const uint8_t*>(buffer),
+                                length);
+  data->activation =
+      PalettizedActivation(fbw.ElementAsInt32(kFusedActivationFunctionIndex));
+  return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+
+  TF_LITE_ENSURE(context, NumInputs(node) == 3 || NumInputs(node) == 4);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kPalettizedInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* palette =
+      micro_context->AllocateTempInputTensor(node, kPalettizedPaletteTensor);
+  TF_LITE_ENSURE(context, palette != nullptr);
+  TfLiteTensor* indices =
+      micro_context->AllocateTempInputTensor(node, kPalettizedIndicesTensor);
+  TF_LITE_ENSURE(context, indices != nullptr);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, kPalettizedBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kPalettizedOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, palette->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, indices->type, kTfLiteInt4);
+  TF_LITE_ENSURE(context, IsConstantTensor(palette));
+  TF_LITE_ENSURE(context, IsConstantTensor(indices));
+
+  const RuntimeShape indices_shape = GetTensorShape(indices);
+  const RuntimeShape output_shape = GetTensorShape(output);
+  const int output_dim_count = output_shape.DimensionsCount();
+  TF_LITE_ENSURE_EQ(context, indices_shape.DimensionsCount(), 2);
+  data->output_depth = output_shape.Dims(output_dim_count - 1);
+  data->accum_depth = indices_shape.Dims(1);
+  data->batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  TF_LITE_ENSURE_EQ(context, indices_shape.Dims(0), data->output_depth);
+  TF_LITE_ENSURE_EQ(context, palette->dims->data[0], data->output_depth);
+  TF_LITE_ENSURE_EQ(context, palette->dims->data[1], kPalettizedPaletteSize);
+  TF_LITE_ENSURE_EQ(context, NumElements(input),
+                    data->batches * data->accum_depth);
+
+  // The palette carries the quantization parameters of the original filter.
+  TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
+      context, data->activation, input->type, input, palette, bias, output,
+      &data->reference_op_data));
+  TF_LITE_ENSURE_EQ(context, data->reference_op_data.filter_zero_point, 0);
+
+  cmsis_nn_dims filter_dims;
+  filter_dims.n = data->accum_depth;
+  filter_dims.h = 1;
+  filter_dims.w = 1;
+  filter_dims.c = data->output_depth;
+
+  data->kernel_sums = nullptr;
+  if (arm_fully_connected_s8_get_buffer_size(&filter_dims) > 0) {
+    data->kernel_sums = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+        context, data->output_depth * sizeof(int32_t)));
+    TF_LITE_ENSURE(context, data->kernel_sums != nullptr);
+    PalettizedChannelSums(GetTensorData<uint8_t>(indices),
+                          GetTensorData<int8_t>(palette), data->output_depth,
+                          data->accum_depth, data->kernel_sums);
+  }
+
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, kRowBlock * data->accum_depth, &data->rows_buffer_index));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(palette);
+  micro_context->DeallocateTempTfLiteTensor(indices);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  if (bias != nullptr) {
+    micro_context->DeallocateTempTfLiteTensor(bias);
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kPalettizedInputTensor);
+  const TfLiteEvalTensor* palette =
+      tflite::micro::GetEvalInput(context, node, kPalettizedPaletteTensor);
+  const TfLiteEvalTensor* indices =
+      tflite::micro::GetEvalInput(context, node, kPalettizedIndicesTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, kPalettizedBiasTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kPalettizedOutputTensor);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+  const OpDataFullyConnected& op_data = data.reference_op_data;
+
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* palette_data = tflite::micro::GetTensorData<int8_t>(palette);
+  const uint8_t* indices_data = tflite::micro::GetTensorData<uint8_t>(indices);
+  const int32_t* bias_data =
+      tflite::micro::GetOptionalTensorData<int32_t>(bias);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+  int8_t* rows = static_cast<int8_t*>(
+      context->GetScratchBuffer(context, data.rows_buffer_index));
+
+  // Each block of filter rows is decoded once from flash and then applied to
+  // every batch, so the compressed stream is read exactly once per Eval.
+  for (int row = 0; row < data.output_depth; row += kRowBlock) {
+    const int block_rows = (data.output_depth - row < kRowBlock)
+                               ? data.output_depth - row
+                               : kRowBlock;
+    for (int i = 0; i < block_rows; ++i) {
+      PalettizedDecode(indices_data, palette_data, row + i, data.accum_depth,
+                       0, data.accum_depth, &rows[i * data.accum_depth]);
+    }
+
+    for (int batch = 0; batch < data.batches; ++batch) {
+      TF_LITE_ENSURE_EQ(
+          context,
+          arm_nn_vec_mat_mult_t_s8(
+              &input_data[batch * data.accum_depth], rows,
+              data.kernel_sums != nullptr ? &data.kernel_sums[row] : nullptr,
+              bias_data != nullptr ? &bias_data[row] : nullptr,
+              &output_data[batch * data.output_depth + row],
+              -op_data.input_zero_point, op_data.output_zero_point,
+              op_data.output_multiplier, op_data.output_shift,
+              data.accum_depth, block_rows, op_data.output_activation_min,
+              op_data.output_activation_max, 1L),
+          ARM_CMSIS_NN_SUCCESS);
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration* Register_PALETTIZED_FULLY_CONNECTED() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &r;
+}
+
+}  // namespace tflite
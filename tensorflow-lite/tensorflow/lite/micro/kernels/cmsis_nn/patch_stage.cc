@@ -0,0 +1,537 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstring>
+#include <limits>
+
+#include "Include/arm_nnfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/patch_stage.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+// Indices into the init flexbuffer's vector.
+// The parameter's name is in the comment that follows.
+// Elements in the vectors are ordered alphabetically by parameter name.
+constexpr int kLayersIndex = 0;      // 'layers'
+constexpr int kScalesIndex = 1;      // 'scales'
+constexpr int kTilesHIndex = 2;      // 'tiles_h'
+constexpr int kTilesWIndex = 3;      // 'tiles_w'
+constexpr int kZeroPointsIndex = 4;  // 'zero_points'
+
+constexpr int kInputTensor = 0;
+constexpr int kOutputTensor = 0;
+
+struct LayerData {
+  int kind;
+  TfLitePadding padding;
+  TfLiteFusedActivation activation;
+  // Quantization of the layer output, from the options for all but the last.
+  float output_scale;
+  int32_t output_zero_point;
+
+  // Set in Prepare.
+  int filter_input;  // Node input of the filter, -1 for pooling.
+  int bias_input;    // Node input of the bias, -1 if none.
+  int input_channels;
+  int output_channels;
+  int32_t input_zero_point;
+  int32_t output_activation_min;
+  int32_t output_activation_max;
+  int32_t* per_channel_output_multiplier;
+  int32_t* per_channel_output_shift;
+};
+
+struct OpData {
+  PatchStageGeometry geometry;
+  LayerData layers[kPatchStageMaxLayers];
+
+  // Scratch buffers: two tiles of layer outputs used in turn, the padded
+  // input window of a layer and the CMSIS-NN convolution buffer.
+  int tile_buffer_idx[2];
+  int window_buffer_idx;
+  int conv_buffer_idx;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  auto* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+
+  tflite::FlexbufferWrapper fbw(reinterpret_cast<const uint8_t*>(buffer),
+                                length);
+  const auto layers = fbw[kLayersIndex].AsTypedVector();
+  const auto scales = fbw[kScalesIndex].AsTypedVector();
+  const auto zero_points = fbw[kZeroPointsIndex].AsTypedVector();
+  PatchStageGeometry& geometry = data->geometry;
+  geometry.layer_count = layers.size() / kPatchStageLayerFields;
+  if (geometry.layer_count > kPatchStageMaxLayers) {
+    geometry.layer_count = 0;
+  }
+  geometry.tiles_h = fbw.ElementAsInt32(kTilesHIndex);
+  geometry.tiles_w = fbw.ElementAsInt32(kTilesWIndex);
+  for (int l = 0; l < geometry.layer_count; ++l) {
+    const int field = l * kPatchStageLayerFields;
+    LayerData& layer = data->layers[l];
+    layer.kind = layers[field].AsInt32();
+    geometry.filter_h[l] = layers[field + 1].AsInt32();
+    geometry.filter_w[l] = layers[field + 2].AsInt32();
+    geometry.stride_h[l] = layers[field + 3].AsInt32();
+    geometry.stride_w[l] = layers[field + 4].AsInt32();
+    layer.padding = PatchStagePadding(layers[field + 5].AsInt32());
+    layer.activation = PatchStageActivation(layers[field + 6].AsInt32());
+    if (l + 1 < geometry.layer_count && l < static_cast<int>(scales.size()) &&
+        l < static_cast<int>(zero_points.size())) {
+      layer.output_scale = scales[l].AsFloat();
+      layer.output_zero_point = zero_points[l].AsInt32();
+    }
+  }
+  return data;
+}
+
+// Whether the input window of a layer can be read in place from the
+// `available` region of its input: it must be inside it and span its full
+// width, so that its rows are contiguous.
+bool WindowInPlace(const PatchRegion& window, const PatchRegion& available) {
+  return window.y0 >= available.y0 && window.y1 <= available.y1 &&
+         window.x0 == available.x0 && window.x1 == available.x1;
+}
+
+int RegionSize(const PatchRegion& region, int channels) {
+  return (region.y1 - region.y0) * (region.x1 - region.x0) * channels;
+}
+
+// Copies `window` out of `source`, which holds the `available` region, into
+// `destination`, with `fill` for the padding around the data.
+void CopyWindow(const int8_t* source, const PatchRegion& available,
+                const PatchRegion& window, int channels, int8_t fill,
+                int8_t* destination) {
+  const int source_row = (available.x1 - available.x0) * channels;
+  const int x0 = window.x0 < available.x0 ? available.x0 : window.x0;
+  const int x1 = window.x1 > available.x1 ? available.x1 : window.x1;
+  const int before = (x0 - window.x0) * channels;
+  const int count = x1 > x0 ? (x1 - x0) * channels : 0;
+  const int after = (window.x1 - window.x0) * channels - before - count;
+  for (int y = window.y0; y < window.y1; ++y) {
+    if (y < available.y0 || y >= available.y1 || count == 0) {
+      memset(destination, fill, (window.x1 - window.x0) * channels);
+    } else {
+      memset(destination, fill, before);
+      memcpy(destination + before,
+             source + (y - available.y0) * source_row +
+                 (x0 - available.x0) * channels,
+             count);
+      memset(destination + before + count, fill, after);
+    }
+    destination += (window.x1 - window.x0) * channels;
+  }
+}
+
+void PopulateLayerDims(const PatchRegion& window, const PatchRegion& output,
+                       const LayerData& layer, const PatchStageGeometry& geometry,
+                       int l, cmsis_nn_dims* input_dims,
+                       cmsis_nn_dims* filter_dims, cmsis_nn_dims* output_dims) {
+  input_dims->n = 1;
+  input_dims->h = window.y1 - window.y0;
+  input_dims->w = window.x1 - window.x0;
+  input_dims->c = layer.input_channels;
+
+  filter_dims->n = layer.kind == kPatchStageConv2D ? layer.output_channels : 1;
+  filter_dims->h = geometry.filter_h[l];
+  filter_dims->w = geometry.filter_w[l];
+  filter_dims->c = layer.kind == kPatchStageConv2D ? layer.input_channels : 1;
+
+  output_dims->n = 1;
+  output_dims->h = output.y1 - output.y0;
+  output_dims->w = output.x1 - output.x0;
+  output_dims->c = layer.output_channels;
+}
+
+void PopulateConvParams(const LayerData& layer,
+                        const PatchStageGeometry& geometry, int l,
+                        cmsis_nn_conv_params* conv_params) {
+  // Padding is materialized in the input window.
+  conv_params->input_offset = -layer.input_zero_point;
+  conv_params->output_offset = layer.output_zero_point;
+  conv_params->stride.h = geometry.stride_h[l];
+  conv_params->stride.w = geometry.stride_w[l];
+  conv_params->dilation.h = 1;
+  conv_params->dilation.w = 1;
+  conv_params->padding.h = 0;
+  conv_params->padding.w = 0;
+  conv_params->activation.min = layer.output_activation_min;
+  conv_params->activation.max = layer.output_activation_max;
+}
+
+TfLiteStatus PrepareLayer(TfLiteContext* context, TfLiteNode* node,
+                          OpData* data, int l, TfLiteTensor* input,
+                          TfLiteTensor* output, int* next_input, int* height,
+                          int* width, int* channels, float* scale,
+                          int32_t* zero_point) {
+  MicroContext* micro_context = GetMicroContext(context);
+  PatchStageGeometry& geometry = data->geometry;
+  LayerData& layer = data->layers[l];
+  const bool last = l + 1 == geometry.layer_count;
+
+  // The quantization of the layer input and output, on copies of the stage
+  // tensors for the intermediate ones.
+  TfLiteTensor layer_input = *input;
+  layer_input.params.scale = *scale;
+  layer_input.params.zero_point = *zero_point;
+  TfLiteTensor layer_output = *output;
+  if (!last) {
+    layer_output.params.scale = layer.output_scale;
+    layer_output.params.zero_point = layer.output_zero_point;
+  }
+  layer.input_channels = *channels;
+  layer.input_zero_point = *zero_point;
+  layer.output_zero_point = layer_output.params.zero_point;
+  layer.output_scale = layer_output.params.scale;
+
+  int out_height;
+  int out_width;
+  const TfLitePaddingValues padding = ComputePaddingHeightWidth(
+      geometry.stride_h[l], geometry.stride_w[l], 1, 1, *height, *width,
+      geometry.filter_h[l], geometry.filter_w[l], layer.padding, &out_height,
+      &out_width);
+  geometry.pad_h[l] = padding.height;
+  geometry.pad_w[l] = padding.width;
+  geometry.output_h[l] = out_height;
+  geometry.output_w[l] = out_width;
+
+  if (layer.kind == kPatchStageConv2D) {
+    layer.filter_input = (*next_input)++;
+    layer.bias_input = (*next_input)++;
+    TfLiteTensor* filter =
+        micro_context->AllocateTempInputTensor(node, layer.filter_input);
+    TF_LITE_ENSURE(context, filter != nullptr);
+    TfLiteTensor* bias =
+        micro_context->AllocateTempInputTensor(node, layer.bias_input);
+    TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+    TF_LITE_ENSURE(context, IsConstantTensor(filter));
+    TF_LITE_ENSURE_EQ(context, NumDimensions(filter), 4);
+    TF_LITE_ENSURE_EQ(context, filter->dims->data[1], geometry.filter_h[l]);
+    TF_LITE_ENSURE_EQ(context, filter->dims->data[2], geometry.filter_w[l]);
+    TF_LITE_ENSURE_EQ(context, filter->dims->data[3], *channels);
+    layer.output_channels = filter->dims->data[0];
+
+    layer.per_channel_output_multiplier =
+        static_cast<int32_t*>(context->AllocatePersistentBuffer(
+            context, layer.output_channels * sizeof(int32_t)));
+    layer.per_channel_output_shift =
+        static_cast<int32_t*>(context->AllocatePersistentBuffer(
+            context, layer.output_channels * sizeof(int32_t)));
+    int32_t output_multiplier;
+    int output_shift;
+    TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
+        context, &layer_input, filter, bias, &layer_output, layer.activation,
+        &output_multiplier, &output_shift, &layer.output_activation_min,
+        &layer.output_activation_max, layer.per_channel_output_multiplier,
+        layer.per_channel_output_shift, layer.output_channels));
+
+    micro_context->DeallocateTempTfLiteTensor(filter);
+    if (bias != nullptr) {
+      micro_context->DeallocateTempTfLiteTensor(bias);
+    }
+  } else {
+    TF_LITE_ENSURE_EQ(context, layer.kind, kPatchStageMaxPool2D);
+    layer.filter_input = -1;
+    layer.bias_input = -1;
+    layer.output_channels = *channels;
+    // Max pooling doesn't requantize.
+    TF_LITE_ENSURE_EQ(context, layer.output_zero_point, *zero_point);
+    TF_LITE_ENSURE(context, layer.output_scale == *scale);
+    TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
+        context, layer.activation, &layer_output, &layer.output_activation_min,
+        &layer.output_activation_max));
+  }
+
+  *height = out_height;
+  *width = out_width;
+  *channels = layer.output_channels;
+  *scale = layer.output_scale;
+  *zero_point = layer.output_zero_point;
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+  PatchStageGeometry& geometry = data->geometry;
+
+  TF_LITE_ENSURE(context, geometry.layer_count > 0);
+  TF_LITE_ENSURE(context, geometry.tiles_h > 0 && geometry.tiles_w > 0);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(output), 4);
+  TF_LITE_ENSURE_EQ(context, input->dims->data[0], 1);
+
+  geometry.input_h = input->dims->data[1];
+  geometry.input_w = input->dims->data[2];
+  int height = geometry.input_h;
+  int width = geometry.input_w;
+  int channels = input->dims->data[3];
+  float scale = input->params.scale;
+  int32_t zero_point = input->params.zero_point;
+  int next_input = kInputTensor + 1;
+  for (int l = 0; l < geometry.layer_count; ++l) {
+    TF_LITE_ENSURE_STATUS(PrepareLayer(context, node, data, l, input, output,
+                                       &next_input, &height, &width, &channels,
+                                       &scale, &zero_point));
+  }
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), next_input);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[1], height);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[2], width);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[3], channels);
+  TF_LITE_ENSURE(context, geometry.tiles_h <= height);
+  TF_LITE_ENSURE(context, geometry.tiles_w <= width);
+
+  // Walk the tiles for the largest buffers any of them needs.
+  int tile_size = 0;
+  int window_size = 0;
+  int conv_size = 0;
+  const PatchRegion whole_input = {0, geometry.input_h, 0, geometry.input_w};
+  const int last = geometry.layer_count - 1;
+  for (int tile_y = 0; tile_y < geometry.tiles_h; ++tile_y) {
+    for (int tile_x = 0; tile_x < geometry.tiles_w; ++tile_x) {
+      PatchRegion outputs[kPatchStageMaxLayers];
+      PatchRegion windows[kPatchStageMaxLayers];
+      PatchStageTile(geometry, tile_y, tile_x, outputs, windows);
+      for (int l = 0; l <= last; ++l) {
+        const LayerData& layer = data->layers[l];
+        if (l < last || outputs[l].x1 - outputs[l].x0 != geometry.output_w[l]) {
+          const int size = RegionSize(outputs[l], layer.output_channels);
+          tile_size = size > tile_size ? size : tile_size;
+        }
+        if (!WindowInPlace(windows[l], l == 0 ? whole_input : outputs[l - 1])) {
+          const int size = RegionSize(windows[l], layer.input_channels);
+          window_size = size > window_size ? size : window_size;
+        }
+        if (layer.kind == kPatchStageConv2D) {
+          cmsis_nn_conv_params conv_params;
+          cmsis_nn_dims input_dims;
+          cmsis_nn_dims filter_dims;
+          cmsis_nn_dims output_dims;
+          PopulateConvParams(layer, geometry, l, &conv_params);
+          PopulateLayerDims(windows[l], outputs[l], layer, geometry, l,
+                            &input_dims, &filter_dims, &output_dims);
+          const int size = arm_convolve_wrapper_s8_get_buffer_size(
+              &conv_params, &input_dims, &filter_dims, &output_dims);
+          conv_size = size > conv_size ? size : conv_size;
+        }
+      }
+    }
+  }
+
+  data->tile_buffer_idx[0] = -1;
+  data->tile_buffer_idx[1] = -1;
+  data->window_buffer_idx = -1;
+  data->conv_buffer_idx = -1;
+  if (tile_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, tile_size, &data->tile_buffer_idx[0]));
+    if (geometry.layer_count > 1) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+          context, tile_size, &data->tile_buffer_idx[1]));
+    }
+  }
+  if (window_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, window_size, &data->window_buffer_idx));
+  }
+  if (conv_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, conv_size, &data->conv_buffer_idx));
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus EvalLayer(TfLiteContext* context, TfLiteNode* node,
+                       const OpData& data, int l, const PatchRegion& window,
+                       const PatchRegion& output_region, const int8_t* input,
+                       int8_t* output) {
+  const LayerData& layer = data.layers[l];
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims output_dims;
+  PopulateLayerDims(window, output_region, layer, data.geometry, l,
+                    &input_dims, &filter_dims, &output_dims);
+
+  cmsis_nn_context ctx;
+  ctx.buf = nullptr;
+  ctx.size = 0;
+
+  if (layer.kind == kPatchStageMaxPool2D) {
+    cmsis_nn_pool_params pool_params;
+    pool_params.stride.h = data.geometry.stride_h[l];
+    pool_params.stride.w = data.geometry.stride_w[l];
+    pool_params.padding.h = 0;
+    pool_params.padding.w = 0;
+    pool_params.activation.min = layer.output_activation_min;
+    pool_params.activation.max = layer.output_activation_max;
+    TF_LITE_ENSURE_EQ(context,
+                      arm_max_pool_s8(&ctx, &pool_params, &input_dims, input,
+                                      &filter_dims, &output_dims, output),
+                      ARM_CMSIS_NN_SUCCESS);
+    return kTfLiteOk;
+  }
+
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, layer.filter_input);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, layer.bias_input);
+
+  cmsis_nn_conv_params conv_params;
+  PopulateConvParams(layer, data.geometry, l, &conv_params);
+
+  cmsis_nn_per_channel_quant_params quant_params;
+  quant_params.multiplier = layer.per_channel_output_multiplier;
+  quant_params.shift = layer.per_channel_output_shift;
+
+  cmsis_nn_dims bias_dims;
+  bias_dims.n = 1;
+  bias_dims.h = 1;
+  bias_dims.w = 1;
+  bias_dims.c = layer.output_channels;
+
+  if (data.conv_buffer_idx > -1) {
+    ctx.buf = context->GetScratchBuffer(context, data.conv_buffer_idx);
+  }
+
+  TF_LITE_ENSURE_EQ(
+      context,
+      arm_convolve_wrapper_s8(
+          &ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims,
+          tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
+          tflite::micro::GetOptionalTensorData<int32_t>(bias), &output_dims,
+          output),
+      ARM_CMSIS_NN_SUCCESS);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kInputTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+  const PatchStageGeometry& geometry = data.geometry;
+  const int last = geometry.layer_count - 1;
+
+  int8_t* tiles[2] = {nullptr, nullptr};
+  for (int i = 0; i < 2; ++i) {
+    if (data.tile_buffer_idx[i] > -1) {
+      tiles[i] = static_cast<int8_t*>(
+          context->GetScratchBuffer(context, data.tile_buffer_idx[i]));
+    }
+  }
+  int8_t* window_buffer = nullptr;
+  if (data.window_buffer_idx > -1) {
+    window_buffer = static_cast<int8_t*>(
+        context->GetScratchBuffer(context, data.window_buffer_idx));
+  }
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+  const int output_row = geometry.output_w[last] * data.layers[last].output_channels;
+  const PatchRegion whole_input = {0, geometry.input_h, 0, geometry.input_w};
+
+  for (int tile_y = 0; tile_y < geometry.tiles_h; ++tile_y) {
+    for (int tile_x = 0; tile_x < geometry.tiles_w; ++tile_x) {
+      PatchRegion outputs[kPatchStageMaxLayers];
+      PatchRegion windows[kPatchStageMaxLayers];
+      PatchStageTile(geometry, tile_y, tile_x, outputs, windows);
+
+      const int8_t* source = tflite::micro::GetTensorData<int8_t>(input);
+      PatchRegion available = whole_input;
+      for (int l = 0; l <= last; ++l) {
+        const LayerData& layer = data.layers[l];
+        const int channels = layer.input_channels;
+
+        // The window in place when possible, otherwise copied with its
+        // padding: the zero point adds nothing to a convolution and the
+        // smallest value never wins a max.
+        const int8_t* layer_input;
+        if (WindowInPlace(windows[l], available)) {
+          layer_input = source + (windows[l].y0 - available.y0) *
+                                     (available.x1 - available.x0) * channels;
+        } else {
+          const int8_t fill =
+              layer.kind == kPatchStageConv2D
+                  ? static_cast<int8_t>(layer.input_zero_point)
+                  : std::numeric_limits<int8_t>::min();
+          CopyWindow(source, available, windows[l], channels, fill,
+                     window_buffer);
+          layer_input = window_buffer;
+        }
+
+        // Full width tiles of the last layer go straight to the output.
+        const bool direct = l == last && outputs[l].x1 - outputs[l].x0 ==
+                                             geometry.output_w[l];
+        int8_t* layer_output =
+            direct ? output_data + outputs[l].y0 * output_row : tiles[l & 1];
+        TF_LITE_ENSURE_STATUS(EvalLayer(context, node, data, l, windows[l],
+                                        outputs[l], layer_input,
+                                        layer_output));
+        source = layer_output;
+        available = outputs[l];
+      }
+
+      const PatchRegion& region = outputs[last];
+      if (region.x1 - region.x0 != geometry.output_w[last]) {
+        const int channels = data.layers[last].output_channels;
+        const int row = (region.x1 - region.x0) * channels;
+        for (int y = region.y0; y < region.y1; ++y) {
+          memcpy(output_data + y * output_row + region.x0 * channels,
+                 source + (y - region.y0) * row, row);
+        }
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration* Register_PATCH_STAGE() {
+  static TFLMRegistration r = tflite::micro::RegisterOp(Init, Prepare, Eval);
+  return &r;
+}
+
+}  // namespace tflite
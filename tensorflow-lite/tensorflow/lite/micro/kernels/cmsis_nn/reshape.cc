@@ -15,8 +15,7 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/kernels/reshape.h"
 
-#include <cstring>
-
+#include "Include/arm_nnfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -29,7 +28,7 @@ limitations under the License.
 namespace tflite {
 namespace {
 
-TfLiteStatus EvalReshapeReference(TfLiteContext* context, TfLiteNode* node) {
+TfLiteStatus EvalReshape(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kReshapeInputTensor);
   TfLiteEvalTensor* output =
@@ -43,8 +42,9 @@ TfLiteStatus EvalReshapeReference(TfLiteContext* context, TfLiteNode* node) {
 
   // Do nothing for in-place reshape.
   if (input->data.raw != output->data.raw) {
-    // Otherwise perform reshape with copy.
-    memcpy(output->data.raw, input->data.raw, input_bytes);
+    // Otherwise perform reshape with copy, a byte copy whatever the type.
+    arm_reshape_s8(reinterpret_cast<const int8_t*>(input->data.raw),
+                   reinterpret_cast<int8_t*>(output->data.raw), input_bytes);
   }
   return kTfLiteOk;
 }
@@ -53,7 +53,7 @@ TfLiteStatus EvalReshapeReference(TfLiteContext* context, TfLiteNode* node) {
 
 TFLMRegistration Register_RESHAPE() {
   return tflite::micro::RegisterOp(nullptr, PrepareReshapeReference,
-                                   EvalReshapeReference);
+                                   EvalReshape);
 }
 
 }  // namespace tflite
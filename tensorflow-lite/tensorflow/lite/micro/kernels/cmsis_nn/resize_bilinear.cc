@@ -0,0 +1,290 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/kernels/internal/reference/resize_bilinear.h"
+
+#include "Include/arm_nnsupportfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/op_macros.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kSizeTensor = 1;
+constexpr int kOutputTensor = 0;
+
+// Interpolation weights are Q10, as in reference_ops::ResizeBilinearInteger.
+constexpr int kWeightBits = 10;
+constexpr int32_t kWeightOne = 1 << kWeightBits;
+
+// int8 resize, computed as a horizontal pass over the input rows an output
+// row needs followed by a vertical pass between two of them. Bilinear
+// interpolation is separable, and with Q10 weights and int8 values both
+// passes are exact in int32, so the result is bit-exact with the reference
+// four-tap form. The source columns and rows and their weights only depend
+// on the shapes and are tabulated in Prepare.
+struct OpData {
+  int output_height;
+  int output_width;
+  // Per output column: offsets of the two source pixels in an input row,
+  // and the weights of the left and right one packed as int16 halves.
+  int32_t* column_offsets;
+  int32_t* column_weights;
+  // Per output row: the two source rows and the weight of the lower one.
+  int32_t* row_indices;
+  int32_t* row_fractions;
+  // Two horizontally interpolated rows, int32.
+  int buffer_idx;
+};
+
+// Horizontal pass of one input row into `out`, Q10.
+void InterpolateRow(const OpData& data, const int8_t* row, int depth,
+                    int32_t* out) {
+  const int32_t* offsets = data.column_offsets;
+  const int32_t* weights = data.column_weights;
+  for (int x = 0; x < data.output_width; ++x) {
+    const int8_t* left = row + offsets[2 * x];
+    const int8_t* right = row + offsets[2 * x + 1];
+    const int32_t weight = weights[x];
+#if defined(ARM_MATH_DSP)
+    // left * left_weight + right * right_weight in one dual multiply.
+    for (int c = 0; c < depth; ++c) {
+      const int32_t pair = PKHBT(static_cast<int32_t>(left[c]),
+                                 static_cast<int32_t>(right[c]), 16);
+      *out++ = SMLAD(pair, weight, 0);
+    }
+#else
+    const int32_t left_weight = static_cast<int16_t>(weight & 0xFFFF);
+    const int32_t right_weight = weight >> 16;
+    for (int c = 0; c < depth; ++c) {
+      *out++ = left[c] * left_weight + right[c] * right_weight;
+    }
+#endif
+  }
+}
+
+inline int8_t RoundQ20(int32_t value) {
+#if TFLITE_SINGLE_ROUNDING
+  return static_cast<int8_t>((value + (1 << 19)) >> 20);
+#else
+  const int32_t round = value > 0 ? (1 << 19) : -(1 << 19);
+  return static_cast<int8_t>((value + round) / (1 << 20));
+#endif  // TFLITE_SINGLE_ROUNDING
+}
+
+void ResizeBilinearS8(const OpData& data, const RuntimeShape& input_shape,
+                      const int8_t* input, int32_t* buffer, int8_t* output) {
+  const int batches = input_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int depth = input_shape.Dims(3);
+  const int row_size = input_shape.Dims(2) * depth;
+  const int out_row_size = data.output_width * depth;
+
+  for (int b = 0; b < batches; ++b) {
+    const int8_t* batch_input = input + b * input_height * row_size;
+    // The input rows held by the two halves of `buffer`, -1 for none.
+    int32_t* rows[2] = {buffer, buffer + out_row_size};
+    int row_held[2] = {-1, -1};
+    for (int y = 0; y < data.output_height; ++y) {
+      const int y0 = data.row_indices[2 * y];
+      const int y1 = data.row_indices[2 * y + 1];
+      // Keep whichever held row is still needed, going down the image
+      // that is the lower one of the previous output row.
+      if (row_held[0] != y0) {
+        if (row_held[1] == y0) {
+          int32_t* swap = rows[0];
+          rows[0] = rows[1];
+          rows[1] = swap;
+          row_held[1] = row_held[0];
+        } else {
+          InterpolateRow(data, batch_input + y0 * row_size, depth, rows[0]);
+        }
+        row_held[0] = y0;
+      }
+      if (y1 != y0 && row_held[1] != y1) {
+        InterpolateRow(data, batch_input + y1 * row_size, depth, rows[1]);
+        row_held[1] = y1;
+      }
+      const int32_t* top = rows[0];
+      const int32_t* bottom = y1 != y0 ? rows[1] : rows[0];
+      const int32_t fraction = data.row_fractions[y];
+      for (int i = 0; i < out_row_size; ++i) {
+        // top * (1 - f) + bottom * f, Q20.
+        output[i] =
+            RoundQ20(top[i] * kWeightOne + (bottom[i] - top[i]) * fraction);
+      }
+      output += out_row_size;
+    }
+  }
+}
+
+void* ResizeBilinearInit(TfLiteContext* context, const char* buffer,
+                         size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+// Source pixels and weights of output coordinates [0, output_size), the same
+// as ComputeInterpolationValuesInteger gives them.
+void ComputeTable(int output_size, int input_size, bool align_corners,
+                  bool half_pixel_centers, int32_t* indices,
+                  int32_t* fractions) {
+  int32_t scale_10 = (kWeightOne * input_size + output_size / 2) / output_size;
+  if (align_corners && output_size > 1) {
+    scale_10 = (kWeightOne * (input_size - 1) + (output_size - 1) / 2) /
+               (output_size - 1);
+  }
+  for (int i = 0; i < output_size; ++i) {
+    int32_t scaled, lower, upper;
+    reference_ops::ComputeInterpolationValuesInteger(
+        i, scale_10, half_pixel_centers, input_size, &scaled, &lower, &upper);
+    indices[2 * i] = lower;
+    indices[2 * i + 1] = upper;
+    fractions[i] = scaled - kWeightOne * lower;
+  }
+}
+
+TfLiteStatus ResizeBilinearPrepare(TfLiteContext* context, TfLiteNode* node) {
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TfLiteTensor* size =
+      micro_context->AllocateTempInputTensor(node, kSizeTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(size), 1);
+
+  TF_LITE_ENSURE_EQ(context, size->type, kTfLiteInt32);
+  output->type = input->type;
+
+  TF_LITE_ENSURE_MSG(context, IsConstantTensor(size),
+                     "Non constant size tensor not supported");
+
+  // Ensure params are valid.
+  auto* params =
+      reinterpret_cast<TfLiteResizeBilinearParams*>(node->builtin_data);
+  if (params->half_pixel_centers && params->align_corners) {
+    MicroPrintf("If half_pixel_centers is True, align_corners must be False.");
+    return kTfLiteError;
+  }
+
+  if (input->type == kTfLiteInt8) {
+    OpData* data = static_cast<OpData*>(node->user_data);
+    const int input_height = SizeOfDimension(input, 1);
+    const int input_width = SizeOfDimension(input, 2);
+    const int depth = SizeOfDimension(input, 3);
+    data->output_height = GetTensorData<int32_t>(size)[0];
+    data->output_width = GetTensorData<int32_t>(size)[1];
+    TF_LITE_ENSURE(context,
+                   data->output_height > 0 && data->output_width > 0);
+
+    const int width = data->output_width;
+    const int height = data->output_height;
+    data->column_offsets = static_cast<int32_t*>(
+        context->AllocatePersistentBuffer(context, 2 * width * sizeof(int32_t)));
+    data->column_weights = static_cast<int32_t*>(
+        context->AllocatePersistentBuffer(context, width * sizeof(int32_t)));
+    data->row_indices = static_cast<int32_t*>(
+        context->AllocatePersistentBuffer(context, 2 * height * sizeof(int32_t)));
+    data->row_fractions = static_cast<int32_t*>(
+        context->AllocatePersistentBuffer(context, height * sizeof(int32_t)));
+    TF_LITE_ENSURE(context, data->column_offsets != nullptr &&
+                                data->column_weights != nullptr &&
+                                data->row_indices != nullptr &&
+                                data->row_fractions != nullptr);
+
+    ComputeTable(height, input_height, params->align_corners,
+                 params->half_pixel_centers, data->row_indices,
+                 data->row_fractions);
+    // The column fractions go to column_weights, then are packed in place.
+    ComputeTable(width, input_width, params->align_corners,
+                 params->half_pixel_centers, data->column_offsets,
+                 data->column_weights);
+    for (int x = 0; x < width; ++x) {
+      const int32_t fraction = data->column_weights[x];
+      data->column_weights[x] = static_cast<int32_t>(
+          (static_cast<uint32_t>(fraction) << 16) |
+          static_cast<uint32_t>(kWeightOne - fraction));
+      data->column_offsets[2 * x] *= depth;
+      data->column_offsets[2 * x + 1] *= depth;
+    }
+
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, 2 * width * depth * sizeof(int32_t), &data->buffer_idx));
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(size);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus ResizeBilinearEval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params =
+      reinterpret_cast<TfLiteResizeBilinearParams*>(node->builtin_data);
+
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kInputTensor);
+  const TfLiteEvalTensor* size =
+      tflite::micro::GetEvalInput(context, node, kSizeTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  if (output->type == kTfLiteFloat32) {
+    tflite::ResizeBilinearParams op_params;
+    op_params.align_corners = params->align_corners;
+    op_params.half_pixel_centers = params->half_pixel_centers;
+    reference_ops::ResizeBilinear(op_params,
+                                  tflite::micro::GetTensorShape(input),
+                                  tflite::micro::GetTensorData<float>(input),
+                                  tflite::micro::GetTensorShape(size),
+                                  tflite::micro::GetTensorData<int32_t>(size),
+                                  tflite::micro::GetTensorShape(output),
+                                  tflite::micro::GetTensorData<float>(output));
+  } else if (output->type == kTfLiteInt8) {
+    const OpData& data = *static_cast<const OpData*>(node->user_data);
+    ResizeBilinearS8(data, tflite::micro::GetTensorShape(input),
+                     tflite::micro::GetTensorData<int8_t>(input),
+                     static_cast<int32_t*>(
+                         context->GetScratchBuffer(context, data.buffer_idx)),
+                     tflite::micro::GetTensorData<int8_t>(output));
+  } else {
+    MicroPrintf("Output type is %d, requires float or int8.", output->type);
+    return kTfLiteError;
+  }
+
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration Register_RESIZE_BILINEAR() {
+  return tflite::micro::RegisterOp(ResizeBilinearInit, ResizeBilinearPrepare,
+                                   ResizeBilinearEval);
+}
+
+}  // namespace tflite
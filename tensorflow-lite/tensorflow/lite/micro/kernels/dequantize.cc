@@ -25,9 +25,28 @@ limitations under the License.
 #include "tensorflow/lite/micro/kernels/dequantize.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_utils.h"
 
 namespace tflite {
 
+namespace {
+
+// reference_ops::Dequantize in float instead of double, which Cortex-M4
+// emulates in software. The product of the scale and an integer of up to 17
+// bits is exact in double, so rounding it to float once gives what the
+// float multiply gives.
+template <typename T>
+void DequantizeToFloat(const DequantizationParams& op_params, const T* input,
+                       int size, float* output) {
+  const float scale = static_cast<float>(op_params.scale);
+  const int32_t zero_point = op_params.zero_point;
+  for (int i = 0; i < size; ++i) {
+    output[i] = scale * static_cast<float>(input[i] - zero_point);
+  }
+}
+
+}  // namespace
+
 void* DequantizeInit(TfLiteContext* context, const char* buffer,
                      size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
@@ -46,25 +65,22 @@ TfLiteStatus DequantizeEval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (input->type) {
     case kTfLiteInt8:
-      reference_ops::Dequantize(data->quantization_params,
-                                tflite::micro::GetTensorShape(input),
-                                tflite::micro::GetTensorData<int8_t>(input),
-                                tflite::micro::GetTensorShape(output),
-                                tflite::micro::GetTensorData<float>(output));
+      DequantizeToFloat(data->quantization_params,
+                        tflite::micro::GetTensorData<int8_t>(input),
+                        ElementCount(*input->dims),
+                        tflite::micro::GetTensorData<float>(output));
       break;
     case kTfLiteInt16:
-      reference_ops::Dequantize(data->quantization_params,
-                                tflite::micro::GetTensorShape(input),
-                                tflite::micro::GetTensorData<int16_t>(input),
-                                tflite::micro::GetTensorShape(output),
-                                tflite::micro::GetTensorData<float>(output));
+      DequantizeToFloat(data->quantization_params,
+                        tflite::micro::GetTensorData<int16_t>(input),
+                        ElementCount(*input->dims),
+                        tflite::micro::GetTensorData<float>(output));
       break;
     case kTfLiteUInt8:
-      reference_ops::Dequantize(data->quantization_params,
-                                tflite::micro::GetTensorShape(input),
-                                tflite::micro::GetTensorData<uint8_t>(input),
-                                tflite::micro::GetTensorShape(output),
-                                tflite::micro::GetTensorData<float>(output));
+      DequantizeToFloat(data->quantization_params,
+                        tflite::micro::GetTensorData<uint8_t>(input),
+                        ElementCount(*input->dims),
+                        tflite::micro::GetTensorData<float>(output));
       break;
     default:
       MicroPrintf("Input %s, output %s not supported.",
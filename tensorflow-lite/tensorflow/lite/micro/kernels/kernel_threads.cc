@@ -0,0 +1,160 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/kernel_threads.h"
+
+#if defined(TF_LITE_MICRO_KERNEL_THREADS)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace tflite {
+
+namespace {
+
+#if defined(TF_LITE_MICRO_KERNEL_THREADS)
+
+// Threads 1 to count - 1 of the kernels; thread 0 is the caller. They wait
+// for a new generation of work, run their range if it has one and report
+// back.
+class KernelThreadPool {
+ public:
+  ~KernelThreadPool() { Resize(1); }
+
+  int count() const { return count_; }
+
+  void Resize(int count) {
+    if (count == count_) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (int i = 1; i < count_; ++i) {
+      threads_[i].join();
+    }
+    stop_ = false;
+    count_ = count;
+    for (int i = 1; i < count_; ++i) {
+      threads_[i] = std::thread(&KernelThreadPool::Work, this, i, generation_);
+    }
+  }
+
+  void Run(KernelTask task, void* arg, int item_count, int ranges) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_ = task;
+      arg_ = arg;
+      item_count_ = item_count;
+      ranges_ = ranges;
+      pending_ = ranges - 1;
+      ++generation_;
+    }
+    start_.notify_all();
+    RunRange(0);
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0; });
+  }
+
+ private:
+  void RunRange(int range) {
+    task_(arg_, range, static_cast<int>(int64_t{item_count_} * range / ranges_),
+          static_cast<int>(int64_t{item_count_} * (range + 1) / ranges_));
+  }
+
+  // `seen` is the generation when the thread was started, so that work
+  // posted before it first takes the lock is not missed.
+  void Work(int thread, uint32_t seen) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+      if (stop_) {
+        return;
+      }
+      seen = generation_;
+      if (thread >= ranges_) {
+        continue;
+      }
+      lock.unlock();
+      RunRange(thread);
+      lock.lock();
+      if (--pending_ == 0) {
+        done_.notify_one();
+      }
+    }
+  }
+
+  std::thread threads_[kKernelMaxThreads];
+  int count_ = 1;
+
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  bool stop_ = false;
+  uint32_t generation_ = 0;
+  int pending_ = 0;
+
+  KernelTask task_ = nullptr;
+  void* arg_ = nullptr;
+  int item_count_ = 0;
+  int ranges_ = 1;
+};
+
+KernelThreadPool thread_pool;
+
+#endif  // defined(TF_LITE_MICRO_KERNEL_THREADS)
+
+}  // namespace
+
+void SetKernelThreadCount(int count) {
+#if defined(TF_LITE_MICRO_KERNEL_THREADS)
+  thread_pool.Resize(count < 1                   ? 1
+                     : count > kKernelMaxThreads ? kKernelMaxThreads
+                                                 : count);
+#else
+  (void)count;
+#endif
+}
+
+int KernelThreadCount() {
+#if defined(TF_LITE_MICRO_KERNEL_THREADS)
+  return thread_pool.count();
+#else
+  return 1;
+#endif
+}
+
+void ParallelForKernel(int threads, int item_count, int min_items,
+                       KernelTask task, void* arg) {
+  int ranges = KernelThreadCount() < threads ? KernelThreadCount() : threads;
+  if (min_items > 1 && item_count / min_items < ranges) {
+    ranges = item_count / min_items;
+  }
+  if (ranges > item_count) {
+    ranges = item_count;
+  }
+  if (ranges <= 1) {
+    task(arg, 0, 0, item_count);
+    return;
+  }
+#if defined(TF_LITE_MICRO_KERNEL_THREADS)
+  thread_pool.Run(task, arg, item_count, ranges);
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,67 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_KERNEL_THREADS_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_KERNEL_THREADS_H_
+
+#include <cstdint>
+
+namespace tflite {
+
+// Intra-operator threads, for host builds of larger models. The int8
+// CONV_2D kernel splits its output rows, and the int8 FULLY_CONNECTED kernel
+// its output neurons (or batches), into contiguous ranges that run on a pool
+// of threads. Every range computes the same integers as the whole op, so the
+// output is bit-exact whatever the thread count.
+//
+// The threads exist only when built with TF_LITE_MICRO_KERNEL_THREADS
+// (std::thread, so -pthread); otherwise the count is always 1 and everything
+// runs on the calling thread, as on the target.
+//
+// The count is global, like the kernel tuning table, and has to be set
+// before AllocateTensors: Prepare requests a slice of scratch buffer per
+// thread. Only one interpreter may Invoke at a time.
+
+constexpr int kKernelMaxThreads = 16;
+
+// Work below which a range is not worth a thread, in multiply-accumulates.
+constexpr int64_t kKernelMinWorkPerThread = 64 * 1024;
+
+// Threads the kernels split over, the calling thread included. Clamped to
+// [1, kKernelMaxThreads]; always 1 without TF_LITE_MICRO_KERNEL_THREADS.
+void SetKernelThreadCount(int count);
+int KernelThreadCount();
+
+// The work of one range: items [begin, end), with the scratch slice of
+// `thread`.
+typedef void (*KernelTask)(void* arg, int thread, int begin, int end);
+
+// Runs `task` over items [0, item_count) split into at most `threads`
+// ranges (the count Prepare sized the scratch buffer for) of at least
+// `min_items` each, range 0 on the calling thread. Returns when all are done.
+void ParallelForKernel(int threads, int item_count, int min_items,
+                       KernelTask task, void* arg);
+
+// The `min_items` for items of `work_per_item` multiply-accumulates each.
+inline int KernelMinItems(int64_t work_per_item) {
+  return work_per_item >= kKernelMinWorkPerThread
+             ? 1
+             : static_cast<int>((kKernelMinWorkPerThread + work_per_item - 1) /
+                                (work_per_item > 0 ? work_per_item : 1));
+}
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_KERNEL_THREADS_H_
@@ -0,0 +1,104 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/kernel_tuning.h"
+
+namespace tflite {
+
+namespace {
+
+const KernelTuningTable* tuning_table = nullptr;
+KernelTuningProbe* tuning_probe = nullptr;
+
+}  // namespace
+
+const char* ConvKernelName(ConvKernel kernel) {
+  switch (kernel) {
+    case kConvKernelAuto:
+      return "auto";
+    case kConvKernelGeneric:
+      return "convolve_s8";
+    case kConvKernel1x1:
+      return "convolve_1x1_s8";
+    case kConvKernel1x1Fast:
+      return "convolve_1x1_s8_fast";
+    case kConvKernel1xN:
+      return "convolve_1_x_n_s8";
+    case kConvKernelSmallInputDepth:
+      return "small_input_depth";
+    case kConvKernelCount:
+      break;
+  }
+  return "unknown";
+}
+
+uint32_t KernelTuningHash(const void* data, size_t size, uint32_t hash) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 16777619U;
+  }
+  return hash;
+}
+
+bool KernelTuningTableValid(const KernelTuningTable& table,
+                            uint32_t model_hash) {
+  if (table.magic != kKernelTuningMagic || table.model_hash != model_hash ||
+      table.entry_count > kKernelTuningMaxEntries) {
+    return false;
+  }
+  for (uint32_t i = 0; i < table.entry_count; ++i) {
+    if (table.entries[i].kernel >= kConvKernelCount) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SetKernelTuningTable(const KernelTuningTable* table) {
+  tuning_table = table;
+}
+
+void SetKernelTuningProbe(KernelTuningProbe* probe) {
+  tuning_probe = probe;
+  if (probe != nullptr) {
+    probe->layer_count = 0;
+  }
+}
+
+ConvKernel SelectConvKernel(uint32_t layer_key, uint32_t legal_kernels) {
+  if (tuning_probe != nullptr) {
+    if (tuning_probe->layer_count < kKernelTuningMaxEntries) {
+      KernelTuningLayer& layer =
+          tuning_probe->layers[tuning_probe->layer_count++];
+      layer.layer_key = layer_key;
+      layer.legal_kernels = legal_kernels;
+    }
+    return (legal_kernels & (1U << tuning_probe->kernel)) != 0
+               ? tuning_probe->kernel
+               : kConvKernelAuto;
+  }
+  if (tuning_table != nullptr) {
+    for (uint32_t i = 0; i < tuning_table->entry_count; ++i) {
+      const KernelTuningEntry& entry = tuning_table->entries[i];
+      if (entry.layer_key == layer_key &&
+          (legal_kernels & (1U << entry.kernel)) != 0) {
+        return static_cast<ConvKernel>(entry.kernel);
+      }
+    }
+  }
+  return kConvKernelAuto;
+}
+
+}  // namespace tflite
@@ -0,0 +1,97 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_KERNEL_TUNING_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_KERNEL_TUNING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// Kernel selection from measurements. An op with several implementations
+// computes, in Prepare, a key for its layer (a hash of its shapes and
+// parameters) and the set of implementations that are legal for it, and asks
+// SelectConvKernel which one to use. Without a table that is kConvKernelAuto,
+// the op's own shape rules. A table, built by TuneKernels
+// (micro_kernel_tuner.h) for one model, names the fastest implementation of
+// each layer it timed.
+//
+// The selection state is global, like the table it reads, and has to be set
+// before AllocateTensors.
+
+// int8 CONV_2D implementations of the CMSIS-NN kernel.
+enum ConvKernel : uint32_t {
+  kConvKernelAuto = 0,         // arm_convolve_wrapper_s8 rules
+  kConvKernelGeneric,          // arm_convolve_s8
+  kConvKernel1x1,              // arm_convolve_1x1_s8
+  kConvKernel1x1Fast,          // arm_convolve_1x1_s8_fast
+  kConvKernel1xN,              // arm_convolve_1_x_n_s8
+  kConvKernelSmallInputDepth,  // few input channels, no im2col
+  kConvKernelCount,
+};
+
+const char* ConvKernelName(ConvKernel kernel);
+
+constexpr uint32_t kKernelTuningMagic = 0x4B54424CU;  // "KTBL"
+constexpr int kKernelTuningMaxEntries = 16;
+
+struct KernelTuningEntry {
+  uint32_t layer_key;
+  uint32_t kernel;
+};
+
+// Plain words only, so that it can be stored and read back as is, e.g. from
+// a flash sector.
+struct KernelTuningTable {
+  uint32_t magic;
+  uint32_t model_hash;
+  uint32_t entry_count;
+  KernelTuningEntry entries[kKernelTuningMaxEntries];
+};
+
+// FNV-1a over `size` bytes, continuing from `hash`.
+uint32_t KernelTuningHash(const void* data, size_t size,
+                          uint32_t hash = 2166136261U);
+
+// True if `table` was built for the model with this hash.
+bool KernelTuningTableValid(const KernelTuningTable& table,
+                            uint32_t model_hash);
+
+// The table Prepare selects from, nullptr for the shape rules.
+void SetKernelTuningTable(const KernelTuningTable* table);
+
+// A layer seen by Prepare while a probe is set.
+struct KernelTuningLayer {
+  uint32_t layer_key;
+  uint32_t legal_kernels;  // bit (1 << kernel)
+};
+
+// Used by the tuner: while set, every layer takes `kernel` where it is legal
+// (kConvKernelAuto elsewhere), and the layers are recorded in Prepare order.
+struct KernelTuningProbe {
+  ConvKernel kernel;
+  int layer_count;
+  KernelTuningLayer layers[kKernelTuningMaxEntries];
+};
+
+void SetKernelTuningProbe(KernelTuningProbe* probe);
+
+// Called from Prepare. legal_kernels always includes kConvKernelAuto.
+ConvKernel SelectConvKernel(uint32_t layer_key, uint32_t legal_kernels);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_KERNEL_TUNING_H_
@@ -96,6 +96,11 @@ TFLMRegistration Register_NOT_EQUAL();
 TFLMRegistration Register_PACK();
 TFLMRegistration Register_PAD();
 TFLMRegistration Register_PADV2();
+TFLMRegistration* Register_PACKED_CONV_2D();
+TFLMRegistration* Register_PACKED_FULLY_CONNECTED();
+TFLMRegistration* Register_PALETTIZED_CONV_2D();
+TFLMRegistration* Register_PALETTIZED_FULLY_CONNECTED();
+TFLMRegistration* Register_PATCH_STAGE();
 TFLMRegistration Register_PRELU();
 TFLMRegistration Register_QUANTIZE();
 TFLMRegistration Register_READ_VARIABLE();
@@ -139,6 +144,7 @@ TFLMInferenceRegistration RegisterInference_FULLY_CONNECTED();
 
 // TODO(b/160234179): Change custom OPs to also return by value.
 namespace tflm_signal {
+TFLMRegistration* Register_AUDIO_FRONTEND();
 TFLMRegistration* Register_DELAY();
 TFLMRegistration* Register_FFT_AUTO_SCALE();
 TFLMRegistration* Register_FILTER_BANK();
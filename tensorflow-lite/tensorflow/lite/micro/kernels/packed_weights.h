@@ -0,0 +1,84 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_PACKED_WEIGHTS_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_PACKED_WEIGHTS_H_
+
+#include <cstdint>
+
+namespace tflite {
+
+// Packed weights store the int8 filter of a FULLY_CONNECTED or CONV_2D op in
+// the order the DSP inner loop consumes it, so no filter reordering is left
+// for run time.
+//
+// The filter becomes a 2-D tensor [output_channels, depth], with depth the
+// original per channel size rounded up to kPackedGroupSize and the padding
+// weights zero. The tensor keeps the quantization parameters of the original
+// filter. Columns are taken in groups of kPackedGroupSize, and rows in pairs:
+// the group of row 2r is followed by the same group of row 2r + 1, so one
+// pointer walks both rows of a pair. An odd last row is stored on its own.
+//
+// The filter is either
+//  * int8: each group is stored in its original order [w0, w1, w2, w3], or
+//  * int16, pre-widened: each group is stored as [w0, w2, w1, w3], the order
+//    SXTB16 would give, so the weights are read straight into SMLAD.
+//
+// The input side is widened once per column into the same order by
+// PackedWidenInput. The ops using packed weights are custom ops with inputs
+// {input, filter, bias (optional)} and the builtin options in a flexbuffer
+// map. PackedConv2D adds the filter height and width.
+extern const int kPackedInputTensor;
+extern const int kPackedFilterTensor;
+extern const int kPackedBiasTensor;
+extern const int kPackedOutputTensor;
+
+constexpr int kPackedGroupSize = 4;
+
+inline int PackedDepth(int depth) {
+  return (depth + kPackedGroupSize - 1) / kPackedGroupSize * kPackedGroupSize;
+}
+
+struct PackedMatMulParams {
+  int32_t rows;
+  int32_t depth;  // Packed depth, a multiple of kPackedGroupSize.
+  const int32_t* bias;
+  // Per row if `per_channel`, otherwise a single value.
+  const int32_t* output_multiplier;
+  const int32_t* output_shift;
+  bool per_channel;
+  int32_t output_offset;
+  int32_t output_activation_min;
+  int32_t output_activation_max;
+};
+
+// Widens `count` int8 values plus `offset` into `column`, in the packed group
+// order, and zero fills it up to PackedDepth(count).
+void PackedWidenInput(const int8_t* input, int count, int16_t offset,
+                      int16_t* column);
+
+// Multiplies every row of the packed filter with one or two widened columns,
+// and writes the requantized results to `output` and, for `column_1`, to
+// `output + params.rows`. `column_1` may be nullptr.
+void PackedMatMul(const PackedMatMulParams& params, const int8_t* filter,
+                  const int16_t* column_0, const int16_t* column_1,
+                  int8_t* output);
+void PackedMatMul(const PackedMatMulParams& params, const int16_t* filter,
+                  const int16_t* column_0, const int16_t* column_1,
+                  int8_t* output);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_PACKED_WEIGHTS_H_
@@ -0,0 +1,65 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_PALETTIZED_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_PALETTIZED_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+
+namespace tflite {
+
+// Palettized weights replace the int8 filter of a FULLY_CONNECTED or CONV_2D
+// op with two tensors:
+//
+//  * palette: int8 [output_channels, kPalettizedPaletteSize]. Each output
+//    channel has its own palette of int8 weight values. The tensor carries the
+//    quantization parameters of the original filter.
+//  * indices: int4 with the shape of the original filter. Every element is an
+//    unsigned index into the palette of its output channel. Elements are packed
+//    two per byte over the flattened tensor, low nibble first.
+//
+// The ops using them are custom ops with inputs
+// {input, palette, indices, bias (optional)} and the original builtin options
+// in a flexbuffer map.
+extern const int kPalettizedInputTensor;
+extern const int kPalettizedPaletteTensor;
+extern const int kPalettizedIndicesTensor;
+extern const int kPalettizedBiasTensor;
+extern const int kPalettizedOutputTensor;
+
+constexpr int kPalettizedPaletteSize = 16;
+
+// Decodes `count` weights of output channel `channel`, starting at its
+// `offset`-th weight, into `weights`. Each output channel has
+// `channel_size` weights.
+void PalettizedDecode(const uint8_t* indices, const int8_t* palette,
+                      int channel, int channel_size, int offset, int count,
+                      int8_t* weights);
+
+// Returns the sum of the decoded weights of every output channel in `sums`.
+void PalettizedChannelSums(const uint8_t* indices, const int8_t* palette,
+                           int channels, int channel_size, int32_t* sums);
+
+// Converts the flexbuffer encoded values of the schema's Padding and
+// ActivationFunctionType enums.
+TfLitePadding PalettizedPadding(int padding);
+TfLiteFusedActivation PalettizedActivation(int activation);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_PALETTIZED_H_
@@ -0,0 +1,91 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/palettized.h"
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+const int kPalettizedInputTensor = 0;
+const int kPalettizedPaletteTensor = 1;
+const int kPalettizedIndicesTensor = 2;
+const int kPalettizedBiasTensor = 3;
+const int kPalettizedOutputTensor = 0;
+
+void PalettizedDecode(const uint8_t* indices, const int8_t* palette,
+                      int channel, int channel_size, int offset, int count,
+                      int8_t* weights) {
+  const int8_t* channel_palette = palette + channel * kPalettizedPaletteSize;
+  int element = channel * channel_size + offset;
+  const uint8_t* packed = indices + (element >> 1);
+
+  // Leading high nibble, if the run starts in the middle of a byte.
+  if ((element & 1) && count > 0) {
+    *weights++ = channel_palette[*packed++ >> 4];
+    --count;
+  }
+  for (; count >= 2; count -= 2) {
+    const uint8_t pair = *packed++;
+    *weights++ = channel_palette[pair & 0x0f];
+    *weights++ = channel_palette[pair >> 4];
+  }
+  if (count > 0) {
+    *weights = channel_palette[*packed & 0x0f];
+  }
+}
+
+void PalettizedChannelSums(const uint8_t* indices, const int8_t* palette,
+                           int channels, int channel_size, int32_t* sums) {
+  for (int channel = 0; channel < channels; ++channel) {
+    const int8_t* channel_palette = palette + channel * kPalettizedPaletteSize;
+    int32_t sum = 0;
+    for (int i = channel * channel_size; i < (channel + 1) * channel_size;
+         ++i) {
+      sum += channel_palette[(indices[i >> 1] >> ((i & 1) * 4)) & 0x0f];
+    }
+    sums[channel] = sum;
+  }
+}
+
+TfLitePadding PalettizedPadding(int padding) {
+  switch (padding) {
+    case Padding_SAME:
+      return kTfLitePaddingSame;
+    case Padding_VALID:
+      return kTfLitePaddingValid;
+  }
+  return kTfLitePaddingUnknown;
+}
+
+TfLiteFusedActivation PalettizedActivation(int activation) {
+  switch (activation) {
+    case ActivationFunctionType_NONE:
+      return kTfLiteActNone;
+    case ActivationFunctionType_RELU:
+      return kTfLiteActRelu;
+    case ActivationFunctionType_RELU_N1_TO_1:
+      return kTfLiteActReluN1To1;
+    case ActivationFunctionType_RELU6:
+      return kTfLiteActRelu6;
+    case ActivationFunctionType_TANH:
+      return kTfLiteActTanh;
+    case ActivationFunctionType_SIGN_BIT:
+      return kTfLiteActSignBit;
+  }
+  return kTfLiteActNone;
+}
+
+}  // namespace tflite
@@ -0,0 +1,99 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_PATCH_STAGE_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_PATCH_STAGE_H_
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+
+namespace tflite {
+
+// A patch stage replaces the first layers of a CNN, a chain of CONV_2D and
+// MAX_POOL_2D ops, with one custom op that computes the output of the chain
+// tile by tile. For each tile of the stage output, the region of every
+// intermediate feature map it depends on (its receptive field, overlapping
+// the neighbouring tiles by the "halo") is computed from the stage input, so
+// only one tile of each intermediate map is ever live. The intermediate
+// tensors are removed from the model and the arena peak they set goes with
+// them, at the cost of recomputing the halos.
+//
+// The op, "PatchStage", has inputs {input, filter and bias of each CONV_2D
+// layer in order} (a bias may be -1) and one output, the output of the last
+// layer. Its options are a flexbuffer map:
+//
+//  * layers: int vector, kPatchStageLayerFields values per layer: kind,
+//    filter_h, filter_w, stride_h, stride_w, padding, activation. Padding and
+//    activation are the schema's enum values.
+//  * scales, zero_points: quantization of the output of every layer but the
+//    last, whose output is the op output.
+//  * tiles_h, tiles_w: the grid the stage output is split into.
+//
+// tools/patch_model.cc rewrites a model this way.
+//
+// The op only has a CMSIS-NN kernel (kernels/cmsis_nn/patch_stage.cc), like
+// the palettized and packed weight ops: it is a memory plan for the firmware,
+// which is always built with CMSIS_NN, and each tile runs through
+// arm_convolve_wrapper_s8 and arm_max_pool_s8 with one scratch buffer sized
+// for the largest tile. A build without CMSIS_NN has no Register_PATCH_STAGE
+// and uses the model before patch_model.cc rewrote it.
+constexpr int kPatchStageMaxLayers = 8;
+constexpr int kPatchStageLayerFields = 7;
+
+enum PatchStageLayerKind {
+  kPatchStageConv2D = 0,
+  kPatchStageMaxPool2D = 1,
+};
+
+// Rows [y0, y1) and columns [x0, x1) of a feature map.
+struct PatchRegion {
+  int y0;
+  int y1;
+  int x0;
+  int x1;
+};
+
+// Shape of a stage. Layer l reads the output of layer l - 1, layer 0 the
+// stage input (input_h x input_w). pad_h and pad_w are the top and left
+// padding of each layer.
+struct PatchStageGeometry {
+  int layer_count;
+  int input_h;
+  int input_w;
+  int filter_h[kPatchStageMaxLayers];
+  int filter_w[kPatchStageMaxLayers];
+  int stride_h[kPatchStageMaxLayers];
+  int stride_w[kPatchStageMaxLayers];
+  int pad_h[kPatchStageMaxLayers];
+  int pad_w[kPatchStageMaxLayers];
+  int output_h[kPatchStageMaxLayers];
+  int output_w[kPatchStageMaxLayers];
+  int tiles_h;
+  int tiles_w;
+};
+
+// Regions computed for one tile. outputs[l] is the part of the output of
+// layer l that is computed, inputs[l] the input window it needs, in input
+// coordinates: rows or columns outside of the input are padding.
+void PatchStageTile(const PatchStageGeometry& geometry, int tile_y, int tile_x,
+                    PatchRegion* outputs, PatchRegion* inputs);
+
+// Converts the flexbuffer encoded values of the schema's Padding and
+// ActivationFunctionType enums.
+TfLitePadding PatchStagePadding(int padding);
+TfLiteFusedActivation PatchStageActivation(int activation);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_PATCH_STAGE_H_
@@ -0,0 +1,95 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/patch_stage.h"
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+namespace {
+
+// Splits [0, size) into `count` parts whose sizes differ by at most one.
+void SplitRange(int size, int count, int index, int* first, int* last) {
+  *first = (size * index) / count;
+  *last = (size * (index + 1)) / count;
+}
+
+int Clamp(int value, int low, int high) {
+  return value < low ? low : (value > high ? high : value);
+}
+
+}  // namespace
+
+void PatchStageTile(const PatchStageGeometry& geometry, int tile_y, int tile_x,
+                    PatchRegion* outputs, PatchRegion* inputs) {
+  const int last = geometry.layer_count - 1;
+  PatchRegion* region = &outputs[last];
+  SplitRange(geometry.output_h[last], geometry.tiles_h, tile_y, &region->y0,
+             &region->y1);
+  SplitRange(geometry.output_w[last], geometry.tiles_w, tile_x, &region->x0,
+             &region->x1);
+
+  // Back through the layers: the window each output region reads, and the
+  // part of it that is real data, which the layer below has to produce.
+  for (int l = last; l >= 0; --l) {
+    const PatchRegion& out = outputs[l];
+    PatchRegion* in = &inputs[l];
+    in->y0 = out.y0 * geometry.stride_h[l] - geometry.pad_h[l];
+    in->y1 = (out.y1 - 1) * geometry.stride_h[l] + geometry.filter_h[l] -
+             geometry.pad_h[l];
+    in->x0 = out.x0 * geometry.stride_w[l] - geometry.pad_w[l];
+    in->x1 = (out.x1 - 1) * geometry.stride_w[l] + geometry.filter_w[l] -
+             geometry.pad_w[l];
+    if (l > 0) {
+      const int height = geometry.output_h[l - 1];
+      const int width = geometry.output_w[l - 1];
+      outputs[l - 1].y0 = Clamp(in->y0, 0, height);
+      outputs[l - 1].y1 = Clamp(in->y1, 0, height);
+      outputs[l - 1].x0 = Clamp(in->x0, 0, width);
+      outputs[l - 1].x1 = Clamp(in->x1, 0, width);
+    }
+  }
+}
+
+TfLitePadding PatchStagePadding(int padding) {
+  switch (padding) {
+    case Padding_SAME:
+      return kTfLitePaddingSame;
+    case Padding_VALID:
+      return kTfLitePaddingValid;
+  }
+  return kTfLitePaddingUnknown;
+}
+
+TfLiteFusedActivation PatchStageActivation(int activation) {
+  switch (activation) {
+    case ActivationFunctionType_NONE:
+      return kTfLiteActNone;
+    case ActivationFunctionType_RELU:
+      return kTfLiteActRelu;
+    case ActivationFunctionType_RELU_N1_TO_1:
+      return kTfLiteActReluN1To1;
+    case ActivationFunctionType_RELU6:
+      return kTfLiteActRelu6;
+    case ActivationFunctionType_TANH:
+      return kTfLiteActTanh;
+    case ActivationFunctionType_SIGN_BIT:
+      return kTfLiteActSignBit;
+  }
+  return kTfLiteActNone;
+}
+
+}  // namespace tflite
@@ -13,6 +13,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
 #include <limits>
 
 #include "tensorflow/lite/c/common.h"
@@ -28,6 +29,39 @@ limitations under the License.
 
 namespace tflite {
 
+namespace {
+
+// reference_ops::AffineQuantize from float without its round() call, a
+// library function on cores without a rounding instruction (Cortex-M4). The
+// value is truncated and the exact remainder rounds it half away from zero,
+// the same result for every input.
+template <typename T>
+void AffineQuantizeFloat(const QuantizationParams& op_params,
+                         const float* input, int size, T* output) {
+  // Beyond this the clamped result doesn't change, and below it the float to
+  // int conversion and the remainder are exact.
+  constexpr float kLimit = 1 << 20;
+  const float scale = static_cast<float>(op_params.scale);
+  const int32_t zero_point = op_params.zero_point;
+  constexpr int32_t min_val = std::numeric_limits<T>::min();
+  constexpr int32_t max_val = std::numeric_limits<T>::max();
+
+  for (int i = 0; i < size; ++i) {
+    const float value = std::min(std::max(input[i] / scale, -kLimit), kLimit);
+    int32_t rounded = static_cast<int32_t>(value);
+    const float remainder = value - static_cast<float>(rounded);
+    if (remainder >= 0.5f) {
+      ++rounded;
+    } else if (remainder <= -0.5f) {
+      --rounded;
+    }
+    output[i] = static_cast<T>(
+        std::min(std::max(rounded + zero_point, min_val), max_val));
+  }
+}
+
+}  // namespace
+
 TfLiteStatus PrepareQuantizeReference(TfLiteContext* context,
                                       TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
@@ -99,18 +133,16 @@ TfLiteStatus EvalQuantizeReference(TfLiteContext* context, TfLiteNode* node) {
   if (input->type == kTfLiteFloat32) {
     switch (output->type) {
       case kTfLiteInt8:
-        reference_ops::AffineQuantize(
-            data->quantization_params, tflite::micro::GetTensorShape(input),
-            tflite::micro::GetTensorData<float>(input),
-            tflite::micro::GetTensorShape(output),
-            tflite::micro::GetTensorData<int8_t>(output));
+        AffineQuantizeFloat(data->quantization_params,
+                            tflite::micro::GetTensorData<float>(input),
+                            ElementCount(*input->dims),
+                            tflite::micro::GetTensorData<int8_t>(output));
         break;
       case kTfLiteInt16:
-        reference_ops::AffineQuantize(
-            data->quantization_params, tflite::micro::GetTensorShape(input),
-            tflite::micro::GetTensorData<float>(input),
-            tflite::micro::GetTensorShape(output),
-            tflite::micro::GetTensorData<int16_t>(output));
+        AffineQuantizeFloat(data->quantization_params,
+                            tflite::micro::GetTensorData<float>(input),
+                            ElementCount(*input->dims),
+                            tflite::micro::GetTensorData<int16_t>(output));
         return kTfLiteOk;
       default:
         MicroPrintf("Input %s, output %s not supported.",
@@ -71,6 +71,19 @@ class MicroMemoryPlanner {
   // Calculated layout offset for the N-th buffer added to the planner.
   virtual TfLiteStatus GetOffsetForBuffer(int buffer_index, int* offset) = 0;
 
+  // Address of the N-th buffer, given the start of the arena area the plan is
+  // committed to. Planners that place buffers outside of the arena override
+  // this; by default every buffer lives at its offset in the arena.
+  virtual TfLiteStatus GetAddressForBuffer(int buffer_index, uint8_t* arena,
+                                           uint8_t** address) {
+    int offset = -1;
+    TfLiteStatus status = GetOffsetForBuffer(buffer_index, &offset);
+    if (status == kTfLiteOk) {
+      *address = arena + offset;
+    }
+    return status;
+  }
+
   // Provides the scratch buffer in case that the memory planner needs it.
   // The lifetime of scratch buffers lifetime lasts until the static memory plan
   // is committed.
@@ -0,0 +1,333 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/memory_planner/tiered_memory_planner.h"
+
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+
+TieredMemoryPlanner::TieredMemoryPlanner()
+    : tier_count_(1),
+      arena_limit_(0),
+      operator_costs_(nullptr),
+      operator_cost_count_(0),
+      requirements_(nullptr),
+      order_(nullptr),
+      max_buffer_count_(0),
+      buffer_count_(0),
+      need_to_calculate_plan_(true),
+      plan_status_(kTfLiteOk) {
+  for (int i = 0; i < kMaxTiers; ++i) {
+    tier_regions_[i] = nullptr;
+    tier_sizes_[i] = 0;
+    tier_used_[i] = 0;
+  }
+  for (int op = 0; op < kMaxOperators; ++op) {
+    for (int i = 0; i < kMaxTiers; ++i) {
+      operator_bytes_[op][i] = 0;
+    }
+  }
+}
+
+TieredMemoryPlanner::~TieredMemoryPlanner() {
+  // We don't own the scratch buffer or the regions.
+}
+
+TfLiteStatus TieredMemoryPlanner::AddTier(uint8_t* region, size_t size) {
+  if (tier_count_ >= kMaxTiers) {
+    MicroPrintf("Too many memory tiers (max is %d)", kMaxTiers);
+    return kTfLiteError;
+  }
+  uint8_t* aligned = AlignPointerUp(region, MicroArenaBufferAlignment());
+  if (region == nullptr || static_cast<size_t>(aligned - region) >= size) {
+    MicroPrintf("Memory tier %d is empty", tier_count_);
+    return kTfLiteError;
+  }
+  tier_regions_[tier_count_] = aligned;
+  tier_sizes_[tier_count_] = size - (aligned - region);
+  ++tier_count_;
+  need_to_calculate_plan_ = true;
+  return kTfLiteOk;
+}
+
+void TieredMemoryPlanner::SetArenaLimit(size_t bytes) {
+  arena_limit_ = bytes;
+  need_to_calculate_plan_ = true;
+}
+
+void TieredMemoryPlanner::SetOperatorCosts(const uint32_t* costs, int count) {
+  operator_costs_ = costs;
+  operator_cost_count_ = count;
+  need_to_calculate_plan_ = true;
+}
+
+TfLiteStatus TieredMemoryPlanner::Init(unsigned char* scratch_buffer,
+                                       int scratch_buffer_size) {
+  // Reset internal states
+  buffer_count_ = 0;
+  need_to_calculate_plan_ = true;
+
+  // The arena tier is whatever the allocator has left for the plan.
+  tier_sizes_[0] = static_cast<size_t>(scratch_buffer_size);
+  if (arena_limit_ != 0 && arena_limit_ < tier_sizes_[0]) {
+    tier_sizes_[0] = arena_limit_;
+  }
+
+  // Allocate the arrays we need within the scratch buffer arena.
+  max_buffer_count_ = scratch_buffer_size / per_buffer_size();
+
+  unsigned char* next_free = scratch_buffer;
+  requirements_ = reinterpret_cast<BufferRequirements*>(next_free);
+  next_free += sizeof(BufferRequirements) * max_buffer_count_;
+
+  order_ = reinterpret_cast<int*>(next_free);
+  return kTfLiteOk;
+}
+
+TfLiteStatus TieredMemoryPlanner::AddBuffer(int size, int first_time_used,
+                                            int last_time_used) {
+  if (buffer_count_ >= max_buffer_count_) {
+    MicroPrintf("Too many buffers (max is %d)", max_buffer_count_);
+    return kTfLiteError;
+  }
+  BufferRequirements* current = &requirements_[buffer_count_];
+  current->size = size;
+  current->first_time_used = first_time_used;
+  current->last_time_used = last_time_used;
+  current->offset = 0;
+  current->tier = 0;
+  current->intensity = 0.0f;
+  ++buffer_count_;
+  need_to_calculate_plan_ = true;
+  return kTfLiteOk;
+}
+
+float TieredMemoryPlanner::TimeCost(int time) const {
+  // Time 0 is the subgraph inputs, filled by the application, and operator i
+  // runs at time i + 1.
+  if (time <= 0) {
+    return 0.0f;
+  }
+  if (operator_costs_ == nullptr) {
+    return 1.0f;
+  }
+  if (time > operator_cost_count_) {
+    return 0.0f;
+  }
+  return static_cast<float>(operator_costs_[time - 1]);
+}
+
+size_t TieredMemoryPlanner::PlaceTier(int tier) {
+  // Largest buffers first, as the greedy planner does.
+  int count = 0;
+  for (int i = 0; i < buffer_count_; ++i) {
+    if (requirements_[i].tier != tier) {
+      continue;
+    }
+    int j = count++;
+    while (j > 0 && requirements_[order_[j - 1]].size < requirements_[i].size) {
+      order_[j] = order_[j - 1];
+      --j;
+    }
+    order_[j] = i;
+  }
+
+  size_t used = 0;
+  for (int i = 0; i < count; ++i) {
+    BufferRequirements* current = &requirements_[order_[i]];
+    // Lowest offset where no buffer placed so far, active at the same time,
+    // is in the way. Each conflict moves the candidate past that buffer.
+    int offset = 0;
+    bool moved = true;
+    while (moved) {
+      moved = false;
+      for (int j = 0; j < i; ++j) {
+        const BufferRequirements* placed = &requirements_[order_[j]];
+        if (placed->first_time_used > current->last_time_used ||
+            current->first_time_used > placed->last_time_used) {
+          continue;
+        }
+        if (placed->offset >= offset + current->size ||
+            offset >= placed->offset + placed->size) {
+          continue;
+        }
+        offset = placed->offset + placed->size;
+        moved = true;
+      }
+    }
+    current->offset = offset;
+    if (static_cast<size_t>(offset + current->size) > used) {
+      used = offset + current->size;
+    }
+  }
+  return used;
+}
+
+TfLiteStatus TieredMemoryPlanner::CalculatePlanIfNeeded() {
+  if (!need_to_calculate_plan_) {
+    return plan_status_;
+  }
+  need_to_calculate_plan_ = false;
+  plan_status_ = kTfLiteOk;
+
+  for (int i = 0; i < buffer_count_; ++i) {
+    BufferRequirements* current = &requirements_[i];
+    const int lifetime = current->last_time_used - current->first_time_used + 1;
+    current->tier = 0;
+    current->intensity =
+        (TimeCost(current->first_time_used) +
+         TimeCost(current->last_time_used)) /
+        (static_cast<float>(current->size) * static_cast<float>(lifetime));
+  }
+
+  for (int tier = 0; tier < tier_count_; ++tier) {
+    tier_used_[tier] = PlaceTier(tier);
+    while (tier_used_[tier] > tier_sizes_[tier]) {
+      if (tier + 1 == tier_count_) {
+        MicroPrintf("Memory tier %d needs %d bytes, only %d available", tier,
+                    static_cast<int>(tier_used_[tier]),
+                    static_cast<int>(tier_sizes_[tier]));
+        plan_status_ = kTfLiteError;
+        return plan_status_;
+      }
+
+      // A buffer that ends past the capacity, then the coldest buffer live
+      // at the same time: moving any of those lowers the peak there.
+      int overflow = -1;
+      for (int i = 0; i < buffer_count_ && overflow < 0; ++i) {
+        const BufferRequirements* current = &requirements_[i];
+        if (current->tier == tier &&
+            static_cast<size_t>(current->offset + current->size) >
+                tier_sizes_[tier]) {
+          overflow = i;
+        }
+      }
+      const BufferRequirements* peak = &requirements_[overflow];
+      int victim = overflow;
+      for (int i = 0; i < buffer_count_; ++i) {
+        const BufferRequirements* current = &requirements_[i];
+        if (current->tier != tier ||
+            current->first_time_used > peak->last_time_used ||
+            peak->first_time_used > current->last_time_used) {
+          continue;
+        }
+        if (current->intensity < requirements_[victim].intensity) {
+          victim = i;
+        }
+      }
+      requirements_[victim].tier = tier + 1;
+      tier_used_[tier] = PlaceTier(tier);
+    }
+  }
+  CountOperatorBytes();
+  return plan_status_;
+}
+
+void TieredMemoryPlanner::CountOperatorBytes() {
+  for (int op = 0; op < kMaxOperators; ++op) {
+    for (int tier = 0; tier < kMaxTiers; ++tier) {
+      operator_bytes_[op][tier] = 0;
+    }
+  }
+  // Operator i runs at time i + 1, see TimeCost.
+  for (int i = 0; i < buffer_count_; ++i) {
+    const BufferRequirements* current = &requirements_[i];
+    const int first = current->first_time_used - 1;
+    const int last = current->last_time_used - 1;
+    if (first >= 0 && first < kMaxOperators) {
+      operator_bytes_[first][current->tier] += current->size;
+    }
+    if (last != first && last >= 0 && last < kMaxOperators) {
+      operator_bytes_[last][current->tier] += current->size;
+    }
+  }
+}
+
+size_t TieredMemoryPlanner::GetMaximumMemorySize() {
+  if (CalculatePlanIfNeeded() != kTfLiteOk) {
+    return 0;
+  }
+  return tier_used_[0];
+}
+
+int TieredMemoryPlanner::GetBufferCount() { return buffer_count_; }
+
+TfLiteStatus TieredMemoryPlanner::GetOffsetForBuffer(int buffer_index,
+                                                     int* offset) {
+  TF_LITE_ENSURE_STATUS(CalculatePlanIfNeeded());
+  if ((buffer_index < 0) || (buffer_index >= buffer_count_)) {
+    MicroPrintf("buffer index %d is outside range 0 to %d", buffer_index,
+                buffer_count_);
+    return kTfLiteError;
+  }
+  *offset = requirements_[buffer_index].offset;
+  return kTfLiteOk;
+}
+
+TfLiteStatus TieredMemoryPlanner::GetAddressForBuffer(int buffer_index,
+                                                      uint8_t* arena,
+                                                      uint8_t** address) {
+  int offset = -1;
+  TF_LITE_ENSURE_STATUS(GetOffsetForBuffer(buffer_index, &offset));
+  const int tier = requirements_[buffer_index].tier;
+  *address = ((tier == 0) ? arena : tier_regions_[tier]) + offset;
+  return kTfLiteOk;
+}
+
+int TieredMemoryPlanner::GetTierForBuffer(int buffer_index) {
+  if (CalculatePlanIfNeeded() != kTfLiteOk || buffer_index < 0 ||
+      buffer_index >= buffer_count_) {
+    return -1;
+  }
+  return requirements_[buffer_index].tier;
+}
+
+size_t TieredMemoryPlanner::GetTierUsedBytes(int tier) {
+  if (CalculatePlanIfNeeded() != kTfLiteOk || tier < 0 ||
+      tier >= tier_count_) {
+    return 0;
+  }
+  return tier_used_[tier];
+}
+
+size_t TieredMemoryPlanner::GetOperatorBytes(int operator_index, int tier) {
+  if (CalculatePlanIfNeeded() != kTfLiteOk || operator_index < 0 ||
+      operator_index >= kMaxOperators || tier < 0 || tier >= tier_count_) {
+    return 0;
+  }
+  return operator_bytes_[operator_index][tier];
+}
+
+void TieredMemoryPlanner::PrintMemoryPlan() {
+  if (CalculatePlanIfNeeded() != kTfLiteOk) {
+    return;
+  }
+  for (int i = 0; i < buffer_count_; ++i) {
+    const BufferRequirements* current = &requirements_[i];
+    MicroPrintf("%d: size=%d, tier=%d, offset=%d, first_used=%d last_used=%d",
+                i, current->size, current->tier, current->offset,
+                current->first_time_used, current->last_time_used);
+  }
+  for (int tier = 0; tier < tier_count_; ++tier) {
+    MicroPrintf("tier %d: %d of %d bytes", tier,
+                static_cast<int>(tier_used_[tier]),
+                static_cast<int>(tier_sizes_[tier]));
+  }
+}
+
+}  // namespace tflite
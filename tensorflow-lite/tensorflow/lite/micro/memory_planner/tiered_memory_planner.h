@@ -0,0 +1,163 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TIERED_MEMORY_PLANNER_H_
+#define TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TIERED_MEMORY_PLANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+
+namespace tflite {
+
+// A memory planner that places the activation tensors and scratch buffers in
+// several memory regions ("tiers") instead of the arena alone. Tier 0 is the
+// arena; the regions added with AddTier() follow in order of preference, e.g.
+// on-chip CCM, then external SDRAM. This lets a model whose activations don't
+// fit in internal SRAM run with its hot buffers still on-chip.
+//
+// The plan starts with every buffer in tier 0. Each tier is laid out the way
+// GreedyMemoryPlanner does it (largest first, first gap that fits among the
+// simultaneously active buffers). While a tier overflows its capacity, one
+// buffer active at its high-water mark is moved down to the next tier: the
+// one with the lowest access intensity, that is the cost of the operators
+// that create and last use it divided by the bytes and the time it occupies.
+// Operator costs come from profiling (SetOperatorCosts), otherwise every
+// operator counts as 1 and large, long-lived buffers spill first.
+//
+// Usage example:
+//
+// TieredMemoryPlanner planner;
+// planner.AddTier(ccm, ccm_size);
+// planner.AddTier(sdram, sdram_size);
+// MicroAllocator* allocator =
+//     MicroAllocator::Create(arena, arena_size, &planner);
+// MicroInterpreter interpreter(model, op_resolver, allocator);
+//
+// Planning is O(N^3) in the number of buffers, meant for the tens of buffers
+// of a small model. Offline planned buffers are not supported.
+class TieredMemoryPlanner : public MicroMemoryPlanner {
+ public:
+  // The arena and up to three regions.
+  static constexpr int kMaxTiers = 4;
+  // Operators GetOperatorBytes keeps figures for.
+  static constexpr int kMaxOperators = 16;
+
+  TieredMemoryPlanner();
+  ~TieredMemoryPlanner() override;
+
+  // Adds a region buffers can be moved to when the previous tiers are full.
+  // The region is not owned by the planner and must outlive the interpreter.
+  TfLiteStatus AddTier(uint8_t* region, size_t size);
+
+  // Caps the bytes of the arena used for buffers. By default the whole
+  // arena left after the persistent allocations is used.
+  void SetArenaLimit(size_t bytes);
+
+  // Cost (e.g. ticks measured on an earlier run) of each operator of the
+  // model, in execution order. The array must stay valid while planning.
+  void SetOperatorCosts(const uint32_t* costs, int count);
+
+  TfLiteStatus Init(unsigned char* scratch_buffer,
+                    int scratch_buffer_size) override;
+
+  TfLiteStatus AddBuffer(int size, int first_time_used,
+                         int last_time_used) override;
+
+  // Returns the high-water mark of tier 0, the part of the arena needed.
+  size_t GetMaximumMemorySize() override;
+
+  int GetBufferCount() override;
+
+  // Offset of the buffer within its tier.
+  TfLiteStatus GetOffsetForBuffer(int buffer_index, int* offset) override;
+
+  TfLiteStatus GetAddressForBuffer(int buffer_index, uint8_t* arena,
+                                   uint8_t** address) override;
+
+  bool preserves_all_tensors() const override { return false; }
+
+  // Prints the tier and offset of every buffer and the use of each tier.
+  void PrintMemoryPlan() override;
+
+  // The plan is stored in the scratch memory given to Init(), like the
+  // GreedyMemoryPlanner one, so this is only valid until the allocator
+  // commits the plan and frees that memory. Returns -1 for an invalid index.
+  int GetTierForBuffer(int buffer_index);
+
+  // The figures below are copied out of the plan when it is calculated,
+  // which the allocator does while committing it, so they stay valid after
+  // AllocateTensors.
+
+  // High-water mark of a tier.
+  size_t GetTierUsedBytes(int tier);
+
+  // Bytes of the buffers in a tier that are created or last used by an
+  // operator, i.e. that it writes or reads. 0 from kMaxOperators on.
+  size_t GetOperatorBytes(int operator_index, int tier);
+
+  int tier_count() const { return tier_count_; }
+
+ private:
+  struct BufferRequirements {
+    int size;
+    int first_time_used;
+    int last_time_used;
+    int offset;
+    int tier;
+    float intensity;
+  };
+
+  static size_t per_buffer_size() {
+    return sizeof(BufferRequirements) + sizeof(int);  // requirements_, order_
+  }
+
+  // Cost of the operator that runs at a given allocation time.
+  float TimeCost(int time) const;
+
+  // Lays out the buffers of a tier, returns its high-water mark.
+  size_t PlaceTier(int tier);
+
+  // Moves buffers down the tiers until each fits, if needed.
+  TfLiteStatus CalculatePlanIfNeeded();
+
+  // Fills operator_bytes_ from the plan.
+  void CountOperatorBytes();
+
+  uint8_t* tier_regions_[kMaxTiers];
+  size_t tier_sizes_[kMaxTiers];
+  size_t tier_used_[kMaxTiers];
+  size_t operator_bytes_[kMaxOperators][kMaxTiers];
+  int tier_count_;
+  size_t arena_limit_;
+
+  const uint32_t* operator_costs_;
+  int operator_cost_count_;
+
+  BufferRequirements* requirements_;
+  int* order_;
+  int max_buffer_count_;
+  int buffer_count_;
+  bool need_to_calculate_plan_;
+  TfLiteStatus plan_status_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TIERED_MEMORY_PLANNER_H_
@@ -125,10 +125,10 @@ TfLiteStatus CommitPlan(MicroMemoryPlanner* planner, uint8_t* starting_point,
   for (size_t i = 0; i < allocation_info_size; ++i) {
     const AllocationInfo* current = &allocation_info[i];
     if (current->needs_allocating) {
-      int offset = -1;
-      TF_LITE_ENSURE_STATUS(
-          planner->GetOffsetForBuffer(planner_index, &offset));
-      *current->output_ptr = reinterpret_cast<void*>(starting_point + offset);
+      uint8_t* address = nullptr;
+      TF_LITE_ENSURE_STATUS(planner->GetAddressForBuffer(
+          planner_index, starting_point, &address));
+      *current->output_ptr = reinterpret_cast<void*>(address);
       ++planner_index;
     }
   }
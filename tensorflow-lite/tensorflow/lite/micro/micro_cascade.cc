@@ -0,0 +1,152 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_cascade.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+
+namespace {
+
+bool SameQuantization(const TfLiteTensor& a, const TfLiteTensor& b) {
+  return a.params.scale == b.params.scale &&
+         a.params.zero_point == b.params.zero_point;
+}
+
+// Gap between the two highest values of an int8 output, in real units.
+float TopMargin(const TfLiteTensor& output) {
+  const int8_t* values = output.data.int8;
+  int first = -128;
+  int second = -128;
+  for (size_t i = 0; i < output.bytes; ++i) {
+    if (values[i] > first) {
+      second = first;
+      first = values[i];
+    } else if (values[i] > second) {
+      second = values[i];
+    }
+  }
+  return static_cast<float>(first - second) * output.params.scale;
+}
+
+}  // namespace
+
+MicroCascade::MicroCascade(const Model* small_model, const Model* full_model,
+                           const MicroOpResolver& op_resolver,
+                           uint8_t* tensor_arena, size_t tensor_arena_size,
+                           MicroProfilerInterface* profiler)
+    : allocator_(MicroAllocator::Create(tensor_arena, tensor_arena_size)),
+      small_(small_model, op_resolver, allocator_, nullptr, profiler),
+      full_(full_model, op_resolver, allocator_, nullptr, profiler) {}
+
+TfLiteStatus MicroCascade::AllocateTensors() {
+  TF_LITE_ENSURE_STATUS(small_.AllocateTensors());
+  TF_LITE_ENSURE_STATUS(full_.AllocateTensors());
+
+  const TfLiteTensor* small_input = small_.input(0);
+  const TfLiteTensor* full_input = full_.input(0);
+  const TfLiteTensor* small_output = small_.output(0);
+  const TfLiteTensor* full_output = full_.output(0);
+  if (small_input->type != kTfLiteInt8 || full_input->type != kTfLiteInt8 ||
+      small_input->bytes != full_input->bytes ||
+      !SameQuantization(*small_input, *full_input) ||
+      small_output->type != kTfLiteInt8 || full_output->type != kTfLiteInt8 ||
+      small_output->bytes != full_output->bytes) {
+    MicroPrintf("Cascade models need the same int8 input and output sizes");
+    return kTfLiteError;
+  }
+
+  // The input is overlaid by activations of the small model by the time the
+  // full model needs it.
+  input_bytes_ = small_input->bytes;
+  saved_input_ =
+      static_cast<int8_t*>(allocator_->AllocatePersistentBuffer(input_bytes_));
+  if (saved_input_ == nullptr) {
+    return kTfLiteError;
+  }
+  stage_ = kIdle;
+  return kTfLiteOk;
+}
+
+void MicroCascade::StartRun() {
+  memcpy(saved_input_, small_.input(0)->data.raw, input_bytes_);
+  escalated_ = false;
+  stage_ = kSmall;
+}
+
+bool MicroCascade::Escalate() {
+  margin_ = TopMargin(*small_.output(0));
+  if (margin_ >= threshold_) {
+    return false;
+  }
+  memcpy(full_.input(0)->data.raw, saved_input_, input_bytes_);
+  escalated_ = true;
+  return true;
+}
+
+TfLiteStatus MicroCascade::Invoke() {
+  if (saved_input_ == nullptr) {
+    TF_LITE_ENSURE_STATUS(AllocateTensors());
+  }
+  StartRun();
+  stage_ = kIdle;
+  TF_LITE_ENSURE_STATUS(small_.Invoke());
+  if (Escalate()) {
+    TF_LITE_ENSURE_STATUS(full_.Invoke());
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroCascade::InvokeStep(uint32_t budget_ticks, bool* done) {
+  *done = false;
+  if (saved_input_ == nullptr) {
+    TF_LITE_ENSURE_STATUS(AllocateTensors());
+  }
+  const uint32_t start = GetCurrentTimeTicks();
+  if (stage_ == kIdle) {
+    StartRun();
+  }
+  if (stage_ == kSmall) {
+    bool small_done = false;
+    TF_LITE_ENSURE_STATUS(small_.InvokeStep(budget_ticks, &small_done));
+    if (!small_done) {
+      return kTfLiteOk;
+    }
+    if (!Escalate()) {
+      stage_ = kIdle;
+      *done = true;
+      return kTfLiteOk;
+    }
+    stage_ = kFull;
+    const uint32_t elapsed = GetCurrentTimeTicks() - start;
+    if (elapsed >= budget_ticks) {
+      return kTfLiteOk;
+    }
+    budget_ticks -= elapsed;
+  }
+  bool full_done = false;
+  TF_LITE_ENSURE_STATUS(full_.InvokeStep(budget_ticks, &full_done));
+  if (full_done) {
+    stage_ = kIdle;
+    *done = true;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
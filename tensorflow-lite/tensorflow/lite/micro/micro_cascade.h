@@ -0,0 +1,108 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_CASCADE_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_CASCADE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// MicroCascade runs two classifiers of the same input and classes as one: a
+// small model first, and the full model only when the small one is unsure,
+// i.e. when the gap between its two highest outputs (in real units) is below
+// the margin threshold. Easy inputs then cost only the small model.
+//
+// Both interpreters share one MicroAllocator in `tensor_arena`: their
+// persistent data is stacked and their activations overlay each other, so the
+// arena needs little more than the larger of the two models. The input is
+// written once, to input(0) (the small model's), and kept aside for the full
+// model. The models must have one int8 input with the same shape and
+// quantization, and one int8 output of the same size.
+//
+// Usage example:
+//
+// MicroCascade cascade(small_model, full_model, resolver, arena, arena_size);
+// cascade.AllocateTensors();
+// cascade.SetMarginThreshold(2.0f);
+// ... fill cascade.input(0) ...
+// cascade.Invoke();
+// ... read cascade.output(0), the output of the model that decided ...
+class MicroCascade {
+ public:
+  MicroCascade(const Model* small_model, const Model* full_model,
+               const MicroOpResolver& op_resolver, uint8_t* tensor_arena,
+               size_t tensor_arena_size,
+               MicroProfilerInterface* profiler = nullptr);
+
+  TfLiteStatus AllocateTensors();
+
+  // Inputs with a small model margin below `threshold` go to the full model.
+  // 0 never escalates, a threshold above the output range always does.
+  void SetMarginThreshold(float threshold) { threshold_ = threshold; }
+  float margin_threshold() const { return threshold_; }
+
+  TfLiteStatus Invoke();
+
+  // Same as MicroInterpreter::InvokeStep, over the small and, if needed, the
+  // full model. The full model starts in the step that completes the small
+  // one when budget is left.
+  TfLiteStatus InvokeStep(uint32_t budget_ticks, bool* done);
+
+  TfLiteTensor* input(size_t index) { return small_.input(index); }
+  // The output of the model that classified the last input.
+  TfLiteTensor* output(size_t index) {
+    return escalated_ ? full_.output(index) : small_.output(index);
+  }
+
+  // Whether the last input went to the full model, and the small model
+  // margin that decided it.
+  bool escalated() const { return escalated_; }
+  float margin() const { return margin_; }
+
+  MicroInterpreter& small_interpreter() { return small_; }
+  MicroInterpreter& full_interpreter() { return full_; }
+
+  size_t arena_used_bytes() const { return allocator_->used_bytes(); }
+
+ private:
+  enum Stage { kIdle, kSmall, kFull };
+
+  void StartRun();
+  // Decides after the small model, returns true if the full model runs.
+  bool Escalate();
+
+  MicroAllocator* allocator_;
+  MicroInterpreter small_;
+  MicroInterpreter full_;
+  int8_t* saved_input_ = nullptr;
+  size_t input_bytes_ = 0;
+  float threshold_ = 0.0f;
+  float margin_ = 0.0f;
+  bool escalated_ = false;
+  Stage stage_ = kIdle;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_CASCADE_H_
@@ -291,9 +291,23 @@ TfLiteStatus MicroInterpreter::Invoke() {
   if (!tensors_allocated_) {
     TF_LITE_ENSURE_OK(&context_, AllocateTensors());
   }
+  graph_.ResetSubgraphStep();
   return graph_.InvokeSubgraph(0);
 }
 
+TfLiteStatus MicroInterpreter::InvokeStep(uint32_t budget_ticks, bool* done) {
+  *done = false;
+  if (initialization_status_ != kTfLiteOk) {
+    MicroPrintf("InvokeStep() called after initialization failed\n");
+    return kTfLiteError;
+  }
+
+  if (!tensors_allocated_) {
+    TF_LITE_ENSURE_OK(&context_, AllocateTensors());
+  }
+  return graph_.InvokeSubgraphStep(0, budget_ticks, done);
+}
+
 TfLiteTensor* MicroInterpreter::input(size_t index) {
   const size_t length = inputs_size();
   if (index >= length) {
@@ -313,6 +327,7 @@ TfLiteTensor* MicroInterpreter::output(size_t index) {
 }
 
 TfLiteStatus MicroInterpreter::Reset() {
+  graph_.ResetSubgraphStep();
   TfLiteStatus status = graph_.ResetSubgraphs();
   if (status != kTfLiteOk) {
     return status;
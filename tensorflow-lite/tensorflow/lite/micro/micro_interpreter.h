@@ -74,6 +74,14 @@ class MicroInterpreter {
   // TODO(b/149795762): Add this to the TfLiteStatus enum.
   TfLiteStatus Invoke();
 
+  // Runs the model in slices, so that an application can do other work
+  // between them: whole operators are invoked until budget_ticks
+  // (GetCurrentTimeTicks) have elapsed, at least one per call. *done is set
+  // by the call that completes the model, the next call starts a new run.
+  // While a run is in progress the inputs must not be changed and the outputs
+  // are not valid. Invoke() and Reset() abandon a run in progress.
+  TfLiteStatus InvokeStep(uint32_t budget_ticks, bool* done);
+
   // This is the recommended API for an application to pass an external payload
   // pointer as an external context to kernels. The life time of the payload
   // pointer should be at least as long as this interpreter. TFLM supports only
@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
@@ -175,40 +176,94 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
   }
   uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
   for (size_t i = 0; i < operators_size; ++i) {
-    TfLiteNode* node =
-        &(subgraph_allocations_[subgraph_idx].node_and_registrations[i].node);
-    const TFLMRegistration* registration = subgraph_allocations_[subgraph_idx]
-                                               .node_and_registrations[i]
-                                               .registration;
+    TfLiteStatus invoke_status = InvokeOperator(subgraph_idx, i);
+    if (invoke_status != kTfLiteOk) {
+      return invoke_status;
+    }
+  }
+  current_subgraph_index_ = previous_subgraph_idx;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreterGraph::InvokeSubgraphStep(int subgraph_idx,
+                                                       uint32_t budget_ticks,
+                                                       bool* done) {
+  *done = false;
+  if (static_cast<size_t>(subgraph_idx) >= subgraphs_->size()) {
+    MicroPrintf("Accessing subgraph %d but only %d subgraphs found",
+                subgraph_idx, subgraphs_->size());
+    return kTfLiteError;
+  }
+  if (step_subgraph_index_ != subgraph_idx) {
+    step_subgraph_index_ = subgraph_idx;
+    step_operator_index_ = 0;
+  }
+
+  int previous_subgraph_idx = current_subgraph_index_;
+  current_subgraph_index_ = subgraph_idx;
+
+  const uint32_t start_ticks = GetCurrentTimeTicks();
+  uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+  while (step_operator_index_ < operators_size) {
+    TfLiteStatus invoke_status =
+        InvokeOperator(subgraph_idx, step_operator_index_);
+    if (invoke_status != kTfLiteOk) {
+      ResetSubgraphStep();
+      return invoke_status;
+    }
+    ++step_operator_index_;
+    // Unsigned difference, correct across a wrap of the tick counter.
+    if (GetCurrentTimeTicks() - start_ticks >= budget_ticks) {
+      break;
+    }
+  }
+  current_subgraph_index_ = previous_subgraph_idx;
+
+  if (step_operator_index_ == operators_size) {
+    ResetSubgraphStep();
+    *done = true;
+  }
+  return kTfLiteOk;
+}
+
+void MicroInterpreterGraph::ResetSubgraphStep() {
+  step_subgraph_index_ = -1;
+  step_operator_index_ = 0;
+}
+
+TfLiteStatus MicroInterpreterGraph::InvokeOperator(int subgraph_idx,
+                                                   size_t operator_idx) {
+  TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
+                           .node_and_registrations[operator_idx]
+                           .node);
+  const TFLMRegistration* registration = subgraph_allocations_[subgraph_idx]
+                                             .node_and_registrations[operator_idx]
+                                             .registration;
 
 // This ifdef is needed (even though ScopedMicroProfiler itself is a no-op with
 // -DTF_LITE_STRIP_ERROR_STRINGS) because the function OpNameFromRegistration is
 // only defined for builds with the error strings.
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
-    ScopedMicroProfiler scoped_profiler(
-        OpNameFromRegistration(registration),
-        reinterpret_cast<MicroProfilerInterface*>(context_->profiler));
+  ScopedMicroProfiler scoped_profiler(
+      OpNameFromRegistration(registration),
+      reinterpret_cast<MicroProfilerInterface*>(context_->profiler));
 #endif
 
-    TFLITE_DCHECK(registration->invoke);
-    TfLiteStatus invoke_status = registration->invoke(context_, node);
+  TFLITE_DCHECK(registration->invoke);
+  TfLiteStatus invoke_status = registration->invoke(context_, node);
 
-    // All TfLiteTensor structs used in the kernel are allocated from temp
-    // memory in the allocator. This creates a chain of allocations in the
-    // temp section. The call below resets the chain of allocations to
-    // prepare for the next call.
-    allocator_->ResetTempAllocations();
+  // All TfLiteTensor structs used in the kernel are allocated from temp
+  // memory in the allocator. This creates a chain of allocations in the
+  // temp section. The call below resets the chain of allocations to
+  // prepare for the next call.
+  allocator_->ResetTempAllocations();
 
-    if (invoke_status == kTfLiteError) {
-      MicroPrintf("Node %s (number %d) failed to invoke with status %d",
-                  OpNameFromRegistration(registration), i, invoke_status);
-      return kTfLiteError;
-    } else if (invoke_status != kTfLiteOk) {
-      return invoke_status;
-    }
+  if (invoke_status == kTfLiteError) {
+    MicroPrintf("Node %s (number %d) failed to invoke with status %d",
+                OpNameFromRegistration(registration), operator_idx,
+                invoke_status);
   }
-  current_subgraph_index_ = previous_subgraph_idx;
-  return kTfLiteOk;
+  return invoke_status;
 }
 
 TfLiteStatus MicroInterpreterGraph::ResetVariableTensors() {
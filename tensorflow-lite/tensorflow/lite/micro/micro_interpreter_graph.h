@@ -59,6 +59,17 @@ class MicroInterpreterGraph : public MicroGraph {
   // in the model.
   virtual TfLiteStatus InvokeSubgraph(int subgraph_idx);
 
+  // Calls TFLMRegistration->Invoke for the operators of a single subgraph,
+  // resuming after the last operator run by the previous call, until
+  // budget_ticks (GetCurrentTimeTicks) have elapsed. At least one operator is
+  // run per call. Sets *done once the last operator of the subgraph has run;
+  // the next call then starts the subgraph over.
+  virtual TfLiteStatus InvokeSubgraphStep(int subgraph_idx,
+                                          uint32_t budget_ticks, bool* done);
+
+  // Abandons a run in progress with InvokeSubgraphStep, if any.
+  void ResetSubgraphStep();
+
   // Zeros out all variable tensors in all subgraphs in the model.
   virtual TfLiteStatus ResetVariableTensors();
 
@@ -94,6 +105,9 @@ class MicroInterpreterGraph : public MicroGraph {
   MicroResourceVariables* GetResourceVariables() { return resource_variables_; }
 
  private:
+  // Calls TFLMRegistration->Invoke for one operator of a subgraph.
+  TfLiteStatus InvokeOperator(int subgraph_idx, size_t operator_idx);
+
   TfLiteContext* context_;
   const Model* model_;
   MicroAllocator* allocator_;
@@ -101,6 +115,10 @@ class MicroInterpreterGraph : public MicroGraph {
   int current_subgraph_index_;
   MicroResourceVariables* resource_variables_;
   const flatbuffers::Vector<flatbuffers::Offset<SubGraph>>* subgraphs_;
+  // Subgraph run in progress with InvokeSubgraphStep (-1 if none) and the
+  // next of its operators to invoke.
+  int step_subgraph_index_ = -1;
+  size_t step_operator_index_ = 0;
 
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
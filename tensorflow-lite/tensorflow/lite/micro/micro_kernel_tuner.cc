@@ -0,0 +1,181 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_kernel_tuner.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace tflite {
+
+namespace {
+
+// Operator indices of the CONV_2D ops of the main subgraph with int8 input
+// and filter, the ones that select a kernel, in the order Prepare visits them.
+int FindConvOperators(const Model* model, int* operators) {
+  const SubGraph* subgraph = model->subgraphs()->Get(0);
+  int count = 0;
+  for (uint32_t i = 0; i < subgraph->operators()->size(); ++i) {
+    const Operator* op = subgraph->operators()->Get(i);
+    const OperatorCode* opcode =
+        model->operator_codes()->Get(op->opcode_index());
+    if (GetBuiltinCode(opcode) == BuiltinOperator_CONV_2D &&
+        subgraph->tensors()->Get(op->inputs()->Get(0))->type() ==
+            TensorType_INT8 &&
+        subgraph->tensors()->Get(op->inputs()->Get(1))->type() ==
+            TensorType_INT8) {
+      if (count == kKernelTuningMaxEntries) {
+        return -1;
+      }
+      operators[count++] = i;
+    }
+  }
+  return count;
+}
+
+// Runs the model `runs` times one operator at a time and keeps, for each of
+// the `count` operators in `operators`, its fastest run in `ticks`.
+TfLiteStatus TimeOperators(MicroInterpreter& interpreter, int runs,
+                           const int* operators, int count,
+                           uint32_t* ticks) {
+  for (int i = 0; i < count; ++i) {
+    ticks[i] = UINT32_MAX;
+  }
+  for (int run = 0; run < runs; ++run) {
+    bool done = false;
+    int op = 0;
+    int layer = 0;
+    while (!done) {
+      const uint32_t start = GetCurrentTimeTicks();
+      TF_LITE_ENSURE_STATUS(interpreter.InvokeStep(0, &done));
+      const uint32_t elapsed = GetCurrentTimeTicks() - start;
+      if (layer < count && operators[layer] == op) {
+        if (elapsed < ticks[layer]) {
+          ticks[layer] = elapsed;
+        }
+        ++layer;
+      }
+      ++op;
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteStatus TuneKernels(const Model* model, uint32_t model_hash,
+                         const MicroOpResolver& op_resolver,
+                         uint8_t* tensor_arena, size_t tensor_arena_size,
+                         int runs, KernelTuningTable* table,
+                         KernelTuningReport* report) {
+  KernelTuningReport local_report;
+  if (report == nullptr) {
+    report = &local_report;
+  }
+  memset(report, 0, sizeof(*report));
+  memset(table, 0, sizeof(*table));
+
+  int operators[kKernelTuningMaxEntries];
+  const int count = FindConvOperators(model, operators);
+  if (count < 0) {
+    MicroPrintf("Kernel tuning supports up to %d CONV_2D layers",
+                kKernelTuningMaxEntries);
+    return kTfLiteError;
+  }
+
+  SetKernelTuningTable(nullptr);
+  KernelTuningProbe probe;
+  TfLiteStatus status = kTfLiteOk;
+  for (uint32_t k = 0; k < kConvKernelCount && status == kTfLiteOk; ++k) {
+    probe.kernel = static_cast<ConvKernel>(k);
+    SetKernelTuningProbe(&probe);
+    MicroInterpreter interpreter(model, op_resolver, tensor_arena,
+                                 tensor_arena_size);
+    status = interpreter.AllocateTensors();
+    if (status != kTfLiteOk) {
+      break;
+    }
+    if (probe.layer_count != count) {
+      MicroPrintf("Kernel tuning found %d CONV_2D layers, Prepare %d", count,
+                  probe.layer_count);
+      status = kTfLiteError;
+      break;
+    }
+    if (k == kConvKernelAuto) {
+      report->layer_count = count;
+      memcpy(report->layers, probe.layers, sizeof(report->layers));
+    }
+    // No run when the kernel is not legal for any layer.
+    bool legal_anywhere = false;
+    for (int i = 0; i < count; ++i) {
+      legal_anywhere |= (probe.layers[i].legal_kernels & (1U << k)) != 0;
+    }
+    if (!legal_anywhere) {
+      continue;
+    }
+    uint32_t ticks[kKernelTuningMaxEntries];
+    status = TimeOperators(interpreter, runs, operators, count, ticks);
+    for (int i = 0; i < count; ++i) {
+      if ((probe.layers[i].legal_kernels & (1U << k)) != 0) {
+        report->ticks[i][k] = ticks[i];
+      }
+    }
+  }
+  SetKernelTuningProbe(nullptr);
+  TF_LITE_ENSURE_STATUS(status);
+
+  // One entry per key, picked by the time summed over the layers with it.
+  table->magic = kKernelTuningMagic;
+  table->model_hash = model_hash;
+  for (int i = 0; i < count; ++i) {
+    const uint32_t key = report->layers[i].layer_key;
+    int first = 0;
+    while (report->layers[first].layer_key != key) {
+      ++first;
+    }
+    if (first < i) {
+      report->selected[i] = report->selected[first];
+      continue;
+    }
+    ConvKernel best = kConvKernelAuto;
+    uint64_t best_ticks = UINT64_MAX;
+    for (uint32_t k = 0; k < kConvKernelCount; ++k) {
+      if ((report->layers[i].legal_kernels & (1U << k)) == 0) {
+        continue;
+      }
+      uint64_t total = 0;
+      for (int j = i; j < count; ++j) {
+        if (report->layers[j].layer_key == key) {
+          total += report->ticks[j][k];
+        }
+      }
+      if (total < best_ticks) {
+        best_ticks = total;
+        best = static_cast<ConvKernel>(k);
+      }
+    }
+    report->selected[i] = best;
+    KernelTuningEntry& entry = table->entries[table->entry_count++];
+    entry.layer_key = key;
+    entry.kernel = best;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
@@ -0,0 +1,55 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_KERNEL_TUNER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_KERNEL_TUNER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/kernel_tuning.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Per-layer measurements of a TuneKernels run. ticks[i][k] is the fastest of
+// the runs of layer i with kernel k, 0 where k is not legal for the layer.
+struct KernelTuningReport {
+  int layer_count;
+  KernelTuningLayer layers[kKernelTuningMaxEntries];
+  uint32_t ticks[kKernelTuningMaxEntries][kConvKernelCount];
+  ConvKernel selected[kKernelTuningMaxEntries];
+};
+
+// Times every int8 CONV_2D layer of `model` with each of the implementations
+// legal for it and fills `table` with the fastest one per layer. Layers that
+// share a key are timed together. The model is invoked `runs` times per
+// implementation, in a MicroInterpreter built in `tensor_arena` each time, so
+// the arena can be the application's own as long as no interpreter is using
+// it. Timing uses GetCurrentTimeTicks.
+//
+// `model_hash` identifies the model in the table, see KernelTuningTableValid.
+// The global selection state is left cleared.
+TfLiteStatus TuneKernels(const Model* model, uint32_t model_hash,
+                         const MicroOpResolver& op_resolver,
+                         uint8_t* tensor_arena, size_t tensor_arena_size,
+                         int runs, KernelTuningTable* table,
+                         KernelTuningReport* report = nullptr);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_KERNEL_TUNER_H_
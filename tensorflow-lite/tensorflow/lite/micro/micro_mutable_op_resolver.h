@@ -140,6 +140,13 @@ class MicroMutableOpResolver : public MicroOpResolver {
                       tflite::Register_ASSIGN_VARIABLE(), ParseAssignVariable);
   }
 
+  TfLiteStatus AddAudioFrontend() {
+    // TODO(b/286250473): change back name to "AudioFrontend" and remove
+    // namespace
+    return AddCustom("SignalAudioFrontend",
+                     tflite::tflm_signal::Register_AUDIO_FRONTEND());
+  }
+
   TfLiteStatus AddAveragePool2D(
       const TFLMRegistration& registration = Register_AVERAGE_POOL_2D()) {
     return AddBuiltin(BuiltinOperator_AVERAGE_POOL_2D, registration, ParsePool);
@@ -469,6 +476,29 @@ class MicroMutableOpResolver : public MicroOpResolver {
     return AddBuiltin(BuiltinOperator_PADV2, Register_PADV2(), ParsePadV2);
   }
 
+  TfLiteStatus AddPackedConv2D() {
+    return AddCustom("PackedConv2D", tflite::Register_PACKED_CONV_2D());
+  }
+
+  TfLiteStatus AddPackedFullyConnected() {
+    return AddCustom("PackedFullyConnected",
+                     tflite::Register_PACKED_FULLY_CONNECTED());
+  }
+
+  TfLiteStatus AddPalettizedConv2D() {
+    return AddCustom("PalettizedConv2D",
+                     tflite::Register_PALETTIZED_CONV_2D());
+  }
+
+  TfLiteStatus AddPalettizedFullyConnected() {
+    return AddCustom("PalettizedFullyConnected",
+                     tflite::Register_PALETTIZED_FULLY_CONNECTED());
+  }
+
+  TfLiteStatus AddPatchStage() {
+    return AddCustom("PatchStage", tflite::Register_PATCH_STAGE());
+  }
+
   TfLiteStatus AddPCAN() {
     // TODO(b/286250473): change back name to "PCAN" and remove namespace
     return AddCustom("SignalPCAN", tflite::tflm_signal::Register_PCAN());
@@ -0,0 +1,277 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_STREAMING_MICRO_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_STREAMING_MICRO_PROFILER_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+
+// StreamingMicroProfiler aggregates events per tag as they end instead of
+// storing every event, so its memory use is constant and it can be left
+// running for the lifetime of the application. MicroProfiler, by contrast,
+// keeps every event of a run in tables of kMaxEvents entries.
+//
+// For each of up to kMaxTags distinct tags it keeps the event count, the total
+// and self (total minus nested events) ticks, the min and max ticks and a
+// histogram of power-of-two buckets. Optionally the last kRingSize raw events
+// are kept as well. Events may nest up to kMaxDepth deep; an event still open
+// when an enclosing event ends is ended with it.
+//
+// Events that don't fit, because the tag table is full or the nesting is too
+// deep, are counted in dropped_events() and otherwise ignored. Every event
+// gets its own handle, so a stale one, from an event that already ended,
+// never ends a later event: it is counted in unmatched_end_events().
+//
+// Usage example:
+//
+// StreamingMicroProfiler<> profiler;
+// MicroInterpreter interpreter(model, resolver, arena, arena_size, nullptr,
+//                              &profiler);
+// ...
+// interpreter.Invoke();
+// profiler.Log();
+template <int kMaxTags = 8, int kRingSize = 0, int kMaxDepth = 4>
+class StreamingMicroProfiler : public MicroProfilerInterface {
+ public:
+  static constexpr int kHistogramBuckets = 8;
+
+  struct TagStats {
+    const char* tag;
+    uint32_t count;
+    uint64_t total_ticks;
+    uint64_t self_ticks;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    // Bucket 0 counts events shorter than 2^histogram_shift ticks, bucket i
+    // those in [2^(histogram_shift + i - 1), 2^(histogram_shift + i)) and the
+    // last bucket everything longer. Counts saturate.
+    uint16_t histogram[kHistogramBuckets];
+  };
+
+  struct Event {
+    const char* tag;
+    uint32_t start_ticks;
+    uint32_t ticks;
+    int depth;
+  };
+
+  // `histogram_shift` sets the lower edge of the histogram, see TagStats.
+  explicit StreamingMicroProfiler(int histogram_shift = 10)
+      : histogram_shift_(histogram_shift) {
+    Clear();
+  }
+  virtual ~StreamingMicroProfiler() = default;
+
+  // Marks the start of a new event and returns an event handle that can be used
+  // to mark the end of the event via EndEvent. The lifetime of the tag
+  // parameter must exceed that of the StreamingMicroProfiler.
+  virtual uint32_t BeginEvent(const char* tag) override {
+    const int tag_index = FindOrAddTag(tag);
+    if (tag_index < 0 || depth_ == kMaxDepth) {
+      ++dropped_events_;
+      return kInvalidHandle;
+    }
+    Scope& scope = scopes_[depth_++];
+    scope.tag_index = tag_index;
+    scope.handle = next_handle_;
+    next_handle_ = next_handle_ + 1 == kInvalidHandle ? 0 : next_handle_ + 1;
+    scope.child_ticks = 0;
+    scope.start_ticks = GetCurrentTimeTicks();
+    return scope.handle;
+  }
+
+  // Marks the end of an event associated with event_handle, and of any event
+  // nested in it that is still open. Ending an event that is not open, because
+  // it already ended, has no effect beyond counting it in
+  // unmatched_end_events().
+  virtual void EndEvent(uint32_t event_handle) override {
+    const uint32_t end_ticks = GetCurrentTimeTicks();
+    if (event_handle == kInvalidHandle) {
+      return;  // The event was dropped and counted in BeginEvent.
+    }
+    int index = depth_ - 1;
+    while (index >= 0 && scopes_[index].handle != event_handle) {
+      --index;
+    }
+    if (index < 0) {
+      ++unmatched_end_events_;
+      return;
+    }
+    while (depth_ > index) {
+      EndScope(end_ticks);
+    }
+  }
+
+  // Clears the statistics, the raw events and any open event.
+  void Clear() {
+    memset(tags_, 0, sizeof(tags_));
+    num_tags_ = 0;
+    depth_ = 0;
+    num_events_ = 0;
+    next_event_ = 0;
+    dropped_events_ = 0;
+    unmatched_end_events_ = 0;
+    next_handle_ = 0;
+  }
+
+  int num_tags() const { return num_tags_; }
+  const TagStats& tag_stats(int index) const { return tags_[index]; }
+
+  // Raw events, oldest first. Only the last kRingSize events are kept.
+  int num_events() const { return num_events_; }
+  const Event& event(int index) const {
+    const int oldest = num_events_ < kRingSize ? 0 : next_event_;
+    return ring_[(oldest + index) % kRingCapacity];
+  }
+
+  uint32_t dropped_events() const { return dropped_events_; }
+
+  // EndEvent calls with the handle of an event that is not open.
+  uint32_t unmatched_end_events() const { return unmatched_end_events_; }
+
+  // Prints the statistics of each tag in human readable form.
+  void Log() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+    for (int i = 0; i < num_tags_; ++i) {
+      const TagStats& stats = tags_[i];
+      if (stats.count == 0) continue;
+      MicroPrintf(
+          "%s: %u events, avg %u ticks (self %u), min %u, max %u, "
+          "histogram %u %u %u %u %u %u %u %u",
+          stats.tag, static_cast<unsigned>(stats.count),
+          static_cast<unsigned>(stats.total_ticks / stats.count),
+          static_cast<unsigned>(stats.self_ticks / stats.count),
+          static_cast<unsigned>(stats.min_ticks),
+          static_cast<unsigned>(stats.max_ticks), stats.histogram[0],
+          stats.histogram[1], stats.histogram[2], stats.histogram[3],
+          stats.histogram[4], stats.histogram[5], stats.histogram[6],
+          stats.histogram[7]);
+    }
+    if (dropped_events_ > 0) {
+      MicroPrintf("%u events dropped", static_cast<unsigned>(dropped_events_));
+    }
+    if (unmatched_end_events_ > 0) {
+      MicroPrintf("%u unmatched event ends",
+                  static_cast<unsigned>(unmatched_end_events_));
+    }
+#endif
+  }
+
+  // Prints the raw events in CSV (Comma Separated Value) form.
+  void LogEventsCsv() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+    MicroPrintf("\"Tag\",\"Depth\",\"Start\",\"Ticks\"");
+    for (int i = 0; i < num_events(); ++i) {
+      const Event& e = event(i);
+      MicroPrintf("%s,%d,%u,%u", e.tag, e.depth,
+                  static_cast<unsigned>(e.start_ticks),
+                  static_cast<unsigned>(e.ticks));
+    }
+#endif
+  }
+
+ private:
+  static constexpr uint32_t kInvalidHandle = 0xffffffff;
+  static constexpr int kRingCapacity = kRingSize > 0 ? kRingSize : 1;
+
+  struct Scope {
+    int tag_index;
+    uint32_t handle;
+    uint32_t start_ticks;
+    uint32_t child_ticks;
+  };
+
+  // Tags are usually string literals or op names, so they are compared by
+  // pointer before falling back to the string.
+  int FindOrAddTag(const char* tag) {
+    for (int i = 0; i < num_tags_; ++i) {
+      if (tags_[i].tag == tag) return i;
+    }
+    for (int i = 0; i < num_tags_; ++i) {
+      if (strcmp(tags_[i].tag, tag) == 0) return i;
+    }
+    if (num_tags_ == kMaxTags) {
+      return -1;
+    }
+    TagStats& stats = tags_[num_tags_];
+    stats.tag = tag;
+    stats.min_ticks = 0xffffffff;
+    return num_tags_++;
+  }
+
+  void EndScope(uint32_t end_ticks) {
+    const Scope& scope = scopes_[--depth_];
+    const uint32_t ticks = end_ticks - scope.start_ticks;
+    if (depth_ > 0) {
+      scopes_[depth_ - 1].child_ticks += ticks;
+    }
+
+    TagStats& stats = tags_[scope.tag_index];
+    ++stats.count;
+    stats.total_ticks += ticks;
+    stats.self_ticks +=
+        ticks > scope.child_ticks ? ticks - scope.child_ticks : 0;
+    if (ticks < stats.min_ticks) stats.min_ticks = ticks;
+    if (ticks > stats.max_ticks) stats.max_ticks = ticks;
+    uint16_t& bucket = stats.histogram[HistogramBucket(ticks)];
+    if (bucket != 0xffff) ++bucket;
+
+    if (kRingSize > 0) {
+      Event& e = ring_[next_event_];
+      e.tag = stats.tag;
+      e.start_ticks = scope.start_ticks;
+      e.ticks = ticks;
+      e.depth = depth_;
+      next_event_ = (next_event_ + 1) % kRingCapacity;
+      if (num_events_ < kRingSize) ++num_events_;
+    }
+  }
+
+  int HistogramBucket(uint32_t ticks) const {
+    uint32_t scaled = ticks >> histogram_shift_;
+    int bucket = 0;
+    while (scaled != 0 && bucket < kHistogramBuckets - 1) {
+      scaled >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  const int histogram_shift_;
+  TagStats tags_[kMaxTags];
+  int num_tags_;
+  Scope scopes_[kMaxDepth];
+  int depth_;
+  Event ring_[kRingCapacity];
+  int num_events_;
+  int next_event_;
+  uint32_t dropped_events_;
+  uint32_t unmatched_end_events_;
+  uint32_t next_handle_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_STREAMING_MICRO_PROFILER_H_
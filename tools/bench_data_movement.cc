@@ -0,0 +1,383 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: per-op benchmark of the data movement kernels (CONCATENATION,
+// RESHAPE, PAD, QUANTIZE, DEQUANTIZE) against reference_ops. Each case is a
+// one-op model with the shapes of a branch merge or a layer boundary of an
+// Inception-style classifier. It runs through MicroInterpreter, so with the
+// kernels of this tree, and the reference_ops function runs on the same
+// input; the tool checks that the outputs are bit-exact and prints the time
+// per call of both. The kernel time includes Invoke().
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./bench_data_movement [--runs 2000]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/reference/concatenation.h"
+#include "tensorflow/lite/kernels/internal/reference/dequantize.h"
+#include "tensorflow/lite/kernels/internal/reference/pad.h"
+#include "tensorflow/lite/kernels/internal/reference/quantize.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 512 * 1024;
+constexpr float kScale = 0.05f;
+constexpr int kZeroPoint = -3;
+
+std::unique_ptr<tflite::QuantizationParametersT> Quantization(
+    float scale, int64_t zero_point) {
+  auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+  quantization->scale = {scale};
+  quantization->zero_point = {zero_point};
+  return quantization;
+}
+
+// A model of a single op, built as in make_small_model.
+class ModelWriter {
+ public:
+  ModelWriter() : model_(std::make_unique<tflite::ModelT>()) {
+    model_->version = 3;
+    model_->description = "tools/bench_data_movement.cc";
+    model_->buffers.push_back(std::make_unique<tflite::BufferT>());
+    model_->subgraphs.push_back(std::make_unique<tflite::SubGraphT>());
+  }
+
+  // int8 tensors get kScale and kZeroPoint.
+  int AddTensor(tflite::TensorType type, const std::vector<int32_t>& shape,
+                const void* data = nullptr, size_t bytes = 0) {
+    auto tensor = std::make_unique<tflite::TensorT>();
+    tensor->type = type;
+    tensor->shape = shape;
+    if (type == tflite::TensorType_INT8) {
+      tensor->quantization = Quantization(kScale, kZeroPoint);
+    }
+    if (data != nullptr) {
+      auto buffer = std::make_unique<tflite::BufferT>();
+      const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+      buffer->data.assign(bytes_data, bytes_data + bytes);
+      tensor->buffer = model_->buffers.size();
+      model_->buffers.push_back(std::move(buffer));
+    }
+    subgraph()->tensors.push_back(std::move(tensor));
+    return subgraph()->tensors.size() - 1;
+  }
+
+  tflite::OperatorT* SetOperator(tflite::BuiltinOperator code, int version,
+                                 const std::vector<int32_t>& inputs,
+                                 int output) {
+    auto opcode = std::make_unique<tflite::OperatorCodeT>();
+    opcode->builtin_code = code;
+    opcode->deprecated_builtin_code = static_cast<int8_t>(code);
+    opcode->version = version;
+    model_->operator_codes.push_back(std::move(opcode));
+    auto op = std::make_unique<tflite::OperatorT>();
+    op->opcode_index = 0;
+    op->inputs = inputs;
+    op->outputs = {output};
+    subgraph()->operators.push_back(std::move(op));
+    return subgraph()->operators.back().get();
+  }
+
+  // Model inputs are the op inputs without a buffer.
+  std::vector<uint8_t> Finish() {
+    const tflite::OperatorT& op = *subgraph()->operators[0];
+    for (int32_t input : op.inputs) {
+      if (input >= 0 && subgraph()->tensors[input]->buffer == 0) {
+        subgraph()->inputs.push_back(input);
+      }
+    }
+    subgraph()->outputs = op.outputs;
+    subgraph()->name = "main";
+    // The vendored flatbuffers has no implicit default allocator.
+    flatbuffers::DefaultAllocator allocator;
+    flatbuffers::FlatBufferBuilder builder(1024, &allocator);
+    tflite::FinishModelBuffer(builder,
+                              tflite::Model::Pack(builder, model_.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(),
+                                builder.GetBufferPointer() + builder.GetSize());
+  }
+
+ private:
+  tflite::SubGraphT* subgraph() { return model_->subgraphs[0].get(); }
+
+  std::unique_ptr<tflite::ModelT> model_;
+};
+
+tflite::RuntimeShape Shape(const std::vector<int32_t>& dims) {
+  return tflite::RuntimeShape(dims.size(), dims.data());
+}
+
+// One benchmark case: the model, and the reference on the interpreter's
+// input tensors, writing into `output`.
+struct Case {
+  const char* name;
+  std::vector<uint8_t> model;
+  std::function<void(tflite::MicroInterpreter*, void* output)> reference;
+};
+
+Case Concatenation(const char* name, tflite::TensorType type,
+                   const std::vector<std::vector<int32_t>>& input_shapes,
+                   int axis) {
+  ModelWriter writer;
+  std::vector<int32_t> inputs;
+  std::vector<int32_t> output_shape = input_shapes[0];
+  output_shape[axis] = 0;
+  for (const auto& shape : input_shapes) {
+    inputs.push_back(writer.AddTensor(type, shape));
+    output_shape[axis] += shape[axis];
+  }
+  const int output = writer.AddTensor(type, output_shape);
+  tflite::ConcatenationOptionsT options;
+  options.axis = axis;
+  writer.SetOperator(tflite::BuiltinOperator_CONCATENATION, 2, inputs, output)
+      ->builtin_options.Set(options);
+
+  Case c{name, writer.Finish(), nullptr};
+  const size_t element = type == tflite::TensorType_INT8 ? 1 : 4;
+  c.reference = [=](tflite::MicroInterpreter* interpreter, void* out) {
+    tflite::ConcatenationParams params;
+    params.axis = axis;
+    params.inputs_count = input_shapes.size();
+    std::vector<tflite::RuntimeShape> shapes;
+    std::vector<const tflite::RuntimeShape*> shape_pointers;
+    std::vector<const int8_t*> data;
+    for (size_t i = 0; i < input_shapes.size(); ++i) {
+      shapes.push_back(Shape(input_shapes[i]));
+    }
+    for (size_t i = 0; i < input_shapes.size(); ++i) {
+      shape_pointers.push_back(&shapes[i]);
+      data.push_back(interpreter->input(i)->data.int8);
+    }
+    if (element == 1) {
+      tflite::reference_ops::Concatenation(params, shape_pointers.data(),
+                                           data.data(), Shape(output_shape),
+                                           static_cast<int8_t*>(out));
+    } else {
+      std::vector<const float*> float_data;
+      for (const int8_t* p : data) {
+        float_data.push_back(reinterpret_cast<const float*>(p));
+      }
+      tflite::reference_ops::Concatenation(
+          params, shape_pointers.data(), float_data.data(),
+          Shape(output_shape), static_cast<float*>(out));
+    }
+  };
+  return c;
+}
+
+Case Reshape(const char* name, const std::vector<int32_t>& input_shape,
+             const std::vector<int32_t>& output_shape) {
+  ModelWriter writer;
+  const int input = writer.AddTensor(tflite::TensorType_INT8, input_shape);
+  const int shape = writer.AddTensor(
+      tflite::TensorType_INT32, {static_cast<int32_t>(output_shape.size())},
+      output_shape.data(), output_shape.size() * sizeof(int32_t));
+  const int output = writer.AddTensor(tflite::TensorType_INT8, output_shape);
+  tflite::ReshapeOptionsT options;
+  options.new_shape = output_shape;
+  writer.SetOperator(tflite::BuiltinOperator_RESHAPE, 1, {input, shape}, output)
+      ->builtin_options.Set(options);
+
+  Case c{name, writer.Finish(), nullptr};
+  c.reference = [](tflite::MicroInterpreter* interpreter, void* out) {
+    memcpy(out, interpreter->input(0)->data.raw, interpreter->input(0)->bytes);
+  };
+  return c;
+}
+
+Case Pad(const char* name, const std::vector<int32_t>& input_shape,
+         const std::vector<int32_t>& paddings) {
+  ModelWriter writer;
+  std::vector<int32_t> output_shape = input_shape;
+  for (size_t d = 0; d < input_shape.size(); ++d) {
+    output_shape[d] += paddings[2 * d] + paddings[2 * d + 1];
+  }
+  const int input = writer.AddTensor(tflite::TensorType_INT8, input_shape);
+  const int padding = writer.AddTensor(
+      tflite::TensorType_INT32, {static_cast<int32_t>(input_shape.size()), 2},
+      paddings.data(), paddings.size() * sizeof(int32_t));
+  const int output = writer.AddTensor(tflite::TensorType_INT8, output_shape);
+  writer.SetOperator(tflite::BuiltinOperator_PAD, 2, {input, padding}, output)
+      ->builtin_options.Set(tflite::PadOptionsT());
+
+  Case c{name, writer.Finish(), nullptr};
+  c.reference = [=](tflite::MicroInterpreter* interpreter, void* out) {
+    tflite::PadParams params;
+    params.left_padding_count = input_shape.size();
+    params.right_padding_count = input_shape.size();
+    for (size_t d = 0; d < input_shape.size(); ++d) {
+      params.left_padding[d] = paddings[2 * d];
+      params.right_padding[d] = paddings[2 * d + 1];
+    }
+    const int8_t pad_value = kZeroPoint;
+    tflite::reference_ops::Pad(params, Shape(input_shape),
+                               interpreter->input(0)->data.int8, &pad_value,
+                               Shape(output_shape), static_cast<int8_t*>(out));
+  };
+  return c;
+}
+
+Case Quantize(const char* name, const std::vector<int32_t>& shape) {
+  ModelWriter writer;
+  const int input = writer.AddTensor(tflite::TensorType_FLOAT32, shape);
+  const int output = writer.AddTensor(tflite::TensorType_INT8, shape);
+  writer.SetOperator(tflite::BuiltinOperator_QUANTIZE, 2, {input}, output);
+
+  Case c{name, writer.Finish(), nullptr};
+  c.reference = [=](tflite::MicroInterpreter* interpreter, void* out) {
+    tflite::QuantizationParams params;
+    params.zero_point = kZeroPoint;
+    params.scale = kScale;
+    tflite::reference_ops::AffineQuantize(
+        params, Shape(shape), interpreter->input(0)->data.f, Shape(shape),
+        static_cast<int8_t*>(out));
+  };
+  return c;
+}
+
+Case Dequantize(const char* name, const std::vector<int32_t>& shape) {
+  ModelWriter writer;
+  const int input = writer.AddTensor(tflite::TensorType_INT8, shape);
+  const int output = writer.AddTensor(tflite::TensorType_FLOAT32, shape);
+  writer.SetOperator(tflite::BuiltinOperator_DEQUANTIZE, 2, {input}, output);
+
+  Case c{name, writer.Finish(), nullptr};
+  c.reference = [=](tflite::MicroInterpreter* interpreter, void* out) {
+    tflite::DequantizationParams params;
+    params.zero_point = kZeroPoint;
+    params.scale = kScale;
+    tflite::reference_ops::Dequantize(params, Shape(shape),
+                                      interpreter->input(0)->data.int8,
+                                      Shape(shape), static_cast<float*>(out));
+  };
+  return c;
+}
+
+// Random bytes, or for float inputs values around the quantization steps,
+// half steps (the rounding ties) included.
+void FillInput(std::mt19937* rng, TfLiteTensor* input) {
+  if (input->type == kTfLiteFloat32) {
+    const int count = input->bytes / sizeof(float);
+    for (int i = 0; i < count; ++i) {
+      const int half_steps = static_cast<int>((*rng)() % 600) - 300;
+      const float jitter = (*rng)() % 4 == 0 ? 0.0f : ((*rng)() % 1000) * 1e-5f;
+      input->data.f[i] = (half_steps * 0.5f + jitter) * kScale;
+    }
+  } else {
+    for (size_t i = 0; i < input->bytes; ++i) {
+      input->data.int8[i] = static_cast<int8_t>((*rng)());
+    }
+  }
+}
+
+double Microseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int runs = 2000;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+      runs = atoi(argv[++i]);
+    }
+  }
+  if (runs < 1) {
+    fprintf(stderr, "Usage: %s [--runs 2000]\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Case> cases;
+  cases.push_back(Concatenation("concat int8 channels", tflite::TensorType_INT8,
+                                {{1, 14, 14, 16}, {1, 14, 14, 24},
+                                 {1, 14, 14, 8}, {1, 14, 14, 16}},
+                                3));
+  cases.push_back(Concatenation("concat int8 rows", tflite::TensorType_INT8,
+                                {{1, 7, 14, 32}, {1, 7, 14, 32}}, 1));
+  cases.push_back(Concatenation("concat float batch",
+                                tflite::TensorType_FLOAT32,
+                                {{2, 256}, {3, 256}}, 0));
+  cases.push_back(Reshape("reshape int8", {1, 7, 7, 64}, {1, 3136}));
+  cases.push_back(Pad("pad int8 height/width", {1, 28, 28, 16},
+                      {0, 0, 1, 1, 1, 1, 0, 0}));
+  cases.push_back(Pad("pad int8 channels", {1, 14, 14, 8},
+                      {0, 0, 0, 0, 0, 0, 4, 4}));
+  cases.push_back(Quantize("quantize float->int8", {1, 28, 28, 1}));
+  cases.push_back(Dequantize("dequantize int8->float", {1, 1024}));
+
+  tflite::MicroMutableOpResolver<5> resolver;
+  resolver.AddConcatenation();
+  resolver.AddReshape();
+  resolver.AddPad();
+  resolver.AddQuantize();
+  resolver.AddDequantize();
+  std::vector<uint8_t> arena(kArenaSize);
+
+  printf("%-26s %12s %12s %8s %6s\n", "", "kernel us", "reference us",
+         "speedup", "exact");
+  bool all_exact = true;
+  for (const Case& c : cases) {
+    tflite::MicroInterpreter interpreter(tflite::GetModel(c.model.data()),
+                                         resolver, arena.data(), arena.size());
+    if (interpreter.AllocateTensors() != kTfLiteOk) {
+      fprintf(stderr, "%s: AllocateTensors() failed\n", c.name);
+      return 1;
+    }
+    std::mt19937 rng(1);
+    for (size_t i = 0; i < interpreter.inputs_size(); ++i) {
+      FillInput(&rng, interpreter.input(i));
+    }
+    const TfLiteTensor* output = interpreter.output(0);
+    std::vector<uint8_t> expected(output->bytes);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < runs; ++run) {
+      if (interpreter.Invoke() != kTfLiteOk) {
+        fprintf(stderr, "%s: Invoke() failed\n", c.name);
+        return 1;
+      }
+    }
+    const double kernel = Microseconds(std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+    for (int run = 0; run < runs; ++run) {
+      c.reference(&interpreter, expected.data());
+    }
+    const double reference =
+        Microseconds(std::chrono::steady_clock::now() - start);
+
+    const bool exact =
+        memcmp(expected.data(), output->data.raw, output->bytes) == 0;
+    all_exact &= exact;
+    printf("%-26s %12.3f %12.3f %7.2fx %6s\n", c.name, kernel / runs,
+           reference / runs, reference / kernel, exact ? "yes" : "NO");
+  }
+  return all_exact ? 0 : 1;
+}
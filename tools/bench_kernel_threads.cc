@@ -0,0 +1,361 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: scaling of the intra-operator threads
+// (tensorflow/lite/micro/kernels/kernel_threads.h) from 1 to --threads. Each
+// case is a one-op int8 CONV_2D or FULLY_CONNECTED model with the shapes of
+// a high resolution variant of the classifier, or a model file given on the
+// command line. For every thread count the interpreter is rebuilt (the count
+// is read in Prepare), and the output must be bit-exact with the output of
+// one thread. The tool prints the time per Invoke(), the speedup over one
+// thread and the parallel efficiency.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN -DTF_LITE_MICRO_KERNEL_THREADS and
+// linked with -pthread, and run:
+//   ./bench_kernel_threads [model.tflite ...] [--threads 8] [--runs 20]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tensorflow/lite/micro/kernels/kernel_threads.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 8 * 1024 * 1024;
+constexpr float kInputScale = 0.02f;
+constexpr int kInputZeroPoint = -3;
+constexpr float kFilterScale = 0.01f;
+
+std::unique_ptr<tflite::QuantizationParametersT> Quantization(
+    const std::vector<float>& scale, int64_t zero_point, int dimension = 0) {
+  auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+  quantization->scale = scale;
+  quantization->zero_point.assign(scale.size(), zero_point);
+  quantization->quantized_dimension = dimension;
+  return quantization;
+}
+
+// A model of a single op, built as in make_small_model.
+class ModelWriter {
+ public:
+  ModelWriter() : model_(std::make_unique<tflite::ModelT>()) {
+    model_->version = 3;
+    model_->description = "tools/bench_kernel_threads.cc";
+    model_->buffers.push_back(std::make_unique<tflite::BufferT>());
+    model_->subgraphs.push_back(std::make_unique<tflite::SubGraphT>());
+  }
+
+  int AddTensor(tflite::TensorType type, const std::vector<int32_t>& shape,
+                std::unique_ptr<tflite::QuantizationParametersT> quantization,
+                const void* data = nullptr, size_t bytes = 0) {
+    auto tensor = std::make_unique<tflite::TensorT>();
+    tensor->type = type;
+    tensor->shape = shape;
+    tensor->quantization = std::move(quantization);
+    if (data != nullptr) {
+      auto buffer = std::make_unique<tflite::BufferT>();
+      const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+      buffer->data.assign(bytes_data, bytes_data + bytes);
+      tensor->buffer = model_->buffers.size();
+      model_->buffers.push_back(std::move(buffer));
+    }
+    subgraph()->tensors.push_back(std::move(tensor));
+    return subgraph()->tensors.size() - 1;
+  }
+
+  tflite::OperatorT* SetOperator(tflite::BuiltinOperator code, int version,
+                                 const std::vector<int32_t>& inputs,
+                                 int output) {
+    auto opcode = std::make_unique<tflite::OperatorCodeT>();
+    opcode->builtin_code = code;
+    opcode->deprecated_builtin_code = static_cast<int8_t>(code);
+    opcode->version = version;
+    model_->operator_codes.push_back(std::move(opcode));
+    auto op = std::make_unique<tflite::OperatorT>();
+    op->opcode_index = 0;
+    op->inputs = inputs;
+    op->outputs = {output};
+    subgraph()->operators.push_back(std::move(op));
+    subgraph()->inputs = {inputs[0]};
+    subgraph()->outputs = {output};
+    return subgraph()->operators.back().get();
+  }
+
+  std::vector<uint8_t> Finish() {
+    subgraph()->name = "main";
+    // The vendored flatbuffers has no implicit default allocator.
+    flatbuffers::DefaultAllocator allocator;
+    flatbuffers::FlatBufferBuilder builder(1024, &allocator);
+    tflite::FinishModelBuffer(builder,
+                              tflite::Model::Pack(builder, model_.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(),
+                                builder.GetBufferPointer() + builder.GetSize());
+  }
+
+ private:
+  tflite::SubGraphT* subgraph() { return model_->subgraphs[0].get(); }
+
+  std::unique_ptr<tflite::ModelT> model_;
+};
+
+// Random weights, and an output scale that spreads the sums of `depth`
+// random products over the int8 range without saturating most of them.
+struct Weights {
+  std::vector<int8_t> filter;
+  std::vector<int32_t> bias;
+  float output_scale;
+};
+
+Weights RandomWeights(std::mt19937* rng, int outputs, int depth) {
+  Weights weights;
+  weights.filter.resize(static_cast<size_t>(outputs) * depth);
+  for (int8_t& value : weights.filter) {
+    value = static_cast<int8_t>((*rng)() % 255 - 127);
+  }
+  weights.bias.resize(outputs);
+  for (int32_t& value : weights.bias) {
+    value = static_cast<int32_t>((*rng)() % 20001) - 10000;
+  }
+  weights.output_scale =
+      kInputScale * kFilterScale * 74.0f * 74.0f * std::sqrt(depth) / 40.0f;
+  return weights;
+}
+
+struct Case {
+  std::string name;
+  std::vector<uint8_t> model;
+  // Fraction of the inputs at the zero point.
+  float zero_fraction;
+};
+
+Case Conv(const char* name, int side, int input_depth, int filter_side,
+          int stride, int output_depth, std::mt19937* rng) {
+  const tflite::Padding padding = tflite::Padding_SAME;
+  const int output_side = (side + stride - 1) / stride;
+  const int depth = filter_side * filter_side * input_depth;
+  const Weights weights = RandomWeights(rng, output_depth, depth);
+
+  ModelWriter writer;
+  const int input = writer.AddTensor(
+      tflite::TensorType_INT8, {1, side, side, input_depth},
+      Quantization({kInputScale}, kInputZeroPoint));
+  const int filter = writer.AddTensor(
+      tflite::TensorType_INT8,
+      {output_depth, filter_side, filter_side, input_depth},
+      Quantization(std::vector<float>(output_depth, kFilterScale), 0),
+      weights.filter.data(), weights.filter.size());
+  const int bias = writer.AddTensor(
+      tflite::TensorType_INT32, {output_depth},
+      Quantization(
+          std::vector<float>(output_depth, kInputScale * kFilterScale), 0),
+      weights.bias.data(), weights.bias.size() * sizeof(int32_t));
+  const int output = writer.AddTensor(
+      tflite::TensorType_INT8, {1, output_side, output_side, output_depth},
+      Quantization({weights.output_scale}, 5));
+  tflite::Conv2DOptionsT options;
+  options.padding = padding;
+  options.stride_w = stride;
+  options.stride_h = stride;
+  options.fused_activation_function = tflite::ActivationFunctionType_RELU;
+  writer.SetOperator(tflite::BuiltinOperator_CONV_2D, 3,
+                     {input, filter, bias}, output)
+      ->builtin_options.Set(options);
+  return {name, writer.Finish(), 0.0f};
+}
+
+Case FullyConnected(const char* name, int batches, int depth, int outputs,
+                    float zero_fraction, std::mt19937* rng) {
+  const Weights weights = RandomWeights(rng, outputs, depth);
+
+  ModelWriter writer;
+  const int input =
+      writer.AddTensor(tflite::TensorType_INT8, {batches, depth},
+                       Quantization({kInputScale}, kInputZeroPoint));
+  const int filter = writer.AddTensor(
+      tflite::TensorType_INT8, {outputs, depth},
+      Quantization({kFilterScale}, 0), weights.filter.data(),
+      weights.filter.size());
+  const int bias = writer.AddTensor(
+      tflite::TensorType_INT32, {outputs},
+      Quantization({kInputScale * kFilterScale}, 0), weights.bias.data(),
+      weights.bias.size() * sizeof(int32_t));
+  const int output =
+      writer.AddTensor(tflite::TensorType_INT8, {batches, outputs},
+                       Quantization({weights.output_scale}, 5));
+  writer.SetOperator(tflite::BuiltinOperator_FULLY_CONNECTED, 9,
+                     {input, filter, bias}, output)
+      ->builtin_options.Set(tflite::FullyConnectedOptionsT());
+  return {name, writer.Finish(), zero_fraction};
+}
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+void FillInput(float zero_fraction, TfLiteTensor* input) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  for (size_t i = 0; i < input->bytes; ++i) {
+    input->data.int8[i] = uniform(rng) < zero_fraction
+                              ? static_cast<int8_t>(input->params.zero_point)
+                              : static_cast<int8_t>(rng());
+  }
+}
+
+// The operators of the cases and of every model variant the firmware can be
+// built with.
+using Resolver = tflite::MicroMutableOpResolver<10>;
+
+void RegisterOps(Resolver* resolver) {
+  resolver->AddConv2D();
+  resolver->AddFullyConnected();
+  resolver->AddMaxPool2D();
+  resolver->AddAveragePool2D();
+  resolver->AddReshape();
+  resolver->AddPatchStage();
+  resolver->AddResizeBilinear();
+  resolver->AddPackedConv2D();
+  resolver->AddPackedFullyConnected();
+}
+
+// Microseconds per Invoke() with `threads`, and the output of the first.
+bool Run(const Case& c, const Resolver& resolver, uint8_t* arena, int threads,
+         int runs, double* microseconds, std::vector<int8_t>* output) {
+  tflite::SetKernelThreadCount(threads);
+  tflite::MicroInterpreter interpreter(tflite::GetModel(c.model.data()),
+                                       resolver, arena, kArenaSize);
+  if (interpreter.AllocateTensors() != kTfLiteOk) return false;
+  FillInput(c.zero_fraction, interpreter.input(0));
+  if (interpreter.Invoke() != kTfLiteOk) return false;
+  const TfLiteTensor* result = interpreter.output(0);
+  output->assign(result->data.int8, result->data.int8 + result->bytes);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int run = 0; run < runs; ++run) {
+    interpreter.Invoke();
+  }
+  *microseconds = std::chrono::duration<double, std::micro>(
+                      std::chrono::steady_clock::now() - start)
+                      .count() /
+                  runs;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int max_threads = std::min<int>(
+      std::max(1U, std::thread::hardware_concurrency()),
+      tflite::kKernelMaxThreads);
+  int runs = 20;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      max_threads = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+      runs = atoi(argv[++i]);
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (max_threads < 1 || max_threads > tflite::kKernelMaxThreads ||
+      runs < 1) {
+    fprintf(stderr,
+            "Usage: %s [model.tflite ...] [--threads 1..%d] [--runs 20]\n",
+            argv[0], tflite::kKernelMaxThreads);
+    return 1;
+  }
+
+  std::vector<Case> cases;
+  std::mt19937 rng(7);
+  cases.push_back(Conv("conv 3x3 224x224x1 -> 16", 224, 1, 3, 1, 16, &rng));
+  cases.push_back(Conv("conv 3x3 112x112x16 -> 32", 112, 16, 3, 1, 32, &rng));
+  cases.push_back(Conv("conv 3x3/2 112x112x32 -> 64", 112, 32, 3, 2, 64, &rng));
+  cases.push_back(Conv("conv 1x1 56x56x64 -> 64", 56, 64, 1, 1, 64, &rng));
+  cases.push_back(FullyConnected("fc 12544 -> 512", 1, 12544, 512, 0.0f, &rng));
+  cases.push_back(FullyConnected("fc 4x2048 -> 1024", 4, 2048, 1024, 0.0f, &rng));
+  cases.push_back(
+      FullyConnected("fc sparse 12544 -> 512", 1, 12544, 512, 0.9f, &rng));
+  for (const char* path : paths) {
+    Case c{path, LoadFile(path), 0.0f};
+    if (c.model.empty()) {
+      fprintf(stderr, "Couldn't read %s\n", path);
+      return 1;
+    }
+    cases.push_back(std::move(c));
+  }
+
+  tflite::SetKernelThreadCount(max_threads);
+  if (tflite::KernelThreadCount() != max_threads) {
+    fprintf(stderr,
+            "Built without TF_LITE_MICRO_KERNEL_THREADS, only 1 thread\n");
+    max_threads = 1;
+  }
+
+  Resolver resolver;
+  RegisterOps(&resolver);
+  std::vector<uint8_t> arena_memory(kArenaSize + 16);
+  uint8_t* arena = reinterpret_cast<uint8_t*>(
+      (reinterpret_cast<uintptr_t>(arena_memory.data()) + 15) & ~uintptr_t{15});
+
+  printf("%d hardware threads, %d runs\n",
+         static_cast<int>(std::thread::hardware_concurrency()), runs);
+  printf("%-30s %7s %12s %8s %10s %6s\n", "", "threads", "us", "speedup",
+         "efficiency", "exact");
+  bool all_exact = true;
+  for (const Case& c : cases) {
+    double single = 0;
+    std::vector<int8_t> reference;
+    for (int threads = 1; threads <= max_threads; ++threads) {
+      double microseconds;
+      std::vector<int8_t> output;
+      if (!Run(c, resolver, arena, threads, runs, &microseconds, &output)) {
+        fprintf(stderr, "%s: AllocateTensors() or Invoke() failed\n",
+                c.name.c_str());
+        return 1;
+      }
+      if (threads == 1) {
+        single = microseconds;
+        reference = output;
+      }
+      const bool exact = output == reference;
+      all_exact &= exact;
+      printf("%-30s %7d %12.1f %7.2fx %9.0f%% %6s\n",
+             threads == 1 ? c.name.c_str() : "", threads, microseconds,
+             single / microseconds, 100.0 * single / microseconds / threads,
+             exact ? "yes" : "NO");
+    }
+  }
+  tflite::SetKernelThreadCount(1);
+  return all_exact ? 0 : 1;
+}
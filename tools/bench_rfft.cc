@@ -0,0 +1,162 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: benchmark of the int16 RFFT of the signal library against
+// kiss_fft_fixed16::kiss_fftr, the implementation it replaced and still
+// falls back to for lengths the radix-4 tables do not cover.
+//
+// For every length, RfftInt16Apply and kiss_fftr run on the same random,
+// full-scale and small inputs; the tool checks that the outputs are
+// bit-exact and prints the state size and the time per RFFT of both. The
+// radix-4 path is the SSE2 one on x86 hosts; compile rfft_int16_radix4.cc
+// with -U__SSE2__ for the portable one. The DSP path only runs on the target.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./bench_rfft [--runs 20000]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "signal/src/complex.h"
+#include "signal/src/kiss_fft_wrappers/kiss_fft_int16.h"
+#include "signal/src/rfft.h"
+#include "signal/src/rfft_int16_radix4.h"
+
+namespace {
+
+// Times are the best of this many runs.
+constexpr int kTimedPasses = 9;
+constexpr int kInputs = 8;
+
+double Microseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+// `kInputs` inputs of `length` samples: random over the full range, square
+// waves at full scale, and random within +-64.
+std::vector<std::vector<int16_t>> Inputs(int length) {
+  std::mt19937 rng(length);
+  std::uniform_int_distribution<int> full(-32768, 32767);
+  std::uniform_int_distribution<int> small(-64, 64);
+  std::vector<std::vector<int16_t>> inputs(kInputs,
+                                           std::vector<int16_t>(length));
+  for (int n = 0; n < kInputs; ++n) {
+    for (int i = 0; i < length; ++i) {
+      int16_t value;
+      if (n % 3 == 0) {
+        value = static_cast<int16_t>(full(rng));
+      } else if (n % 3 == 1) {
+        value = (i / (n + 1)) % 2 == 0 ? 32767 : -32768;
+      } else {
+        value = static_cast<int16_t>(small(rng));
+      }
+      inputs[n][i] = value;
+    }
+  }
+  return inputs;
+}
+
+// Runs `fft` over the inputs `runs` times in all and returns the time per
+// RFFT.
+template <typename Fft>
+double Time(const std::vector<std::vector<int16_t>>& inputs, int runs,
+            Fft fft) {
+  auto start = std::chrono::steady_clock::now();
+  for (int run = 0; run < runs; ++run) {
+    fft(inputs[run % kInputs].data());
+  }
+  return Microseconds(std::chrono::steady_clock::now() - start) / runs;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int runs = 20000;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+      runs = atoi(argv[++i]);
+    }
+  }
+  if (runs < 1) {
+    fprintf(stderr, "Usage: %s [--runs 20000]\n", argv[0]);
+    return 1;
+  }
+
+  printf("%6s %-10s %12s %12s %10s %10s %8s %6s\n", "length", "path",
+         "state bytes", "kiss bytes", "rfft us", "kiss us", "speedup",
+         "exact");
+  bool all_exact = true;
+  for (const int length : {4, 8, 16, 32, 64, 128, 256, 480, 512, 1024}) {
+    size_t state_size = tflm_signal::RfftInt16GetNeededMemory(length);
+    std::vector<uint8_t> state(state_size);
+    void* rfft = tflm_signal::RfftInt16Init(length, state.data(), state_size);
+
+    size_t kiss_size = 0;
+    kiss_fft_fixed16::kiss_fftr_alloc(length, 0, nullptr, &kiss_size);
+    std::vector<uint8_t> kiss_state(kiss_size);
+    kiss_fft_fixed16::kiss_fftr_cfg kiss = kiss_fft_fixed16::kiss_fftr_alloc(
+        length, 0, kiss_state.data(), &kiss_size);
+    if (rfft == nullptr || kiss == nullptr) {
+      fprintf(stderr, "length %d: init failed\n", length);
+      return 1;
+    }
+
+    const std::vector<std::vector<int16_t>> inputs = Inputs(length);
+    std::vector<Complex<int16_t>> output(length / 2 + 1);
+    std::vector<Complex<int16_t>> expected(length / 2 + 1);
+    auto run_rfft = [&](const int16_t* input) {
+      tflm_signal::RfftInt16Apply(rfft, input, output.data());
+    };
+    auto run_kiss = [&](const int16_t* input) {
+      kiss_fft_fixed16::kiss_fftr(
+          kiss, input,
+          reinterpret_cast<kiss_fft_fixed16::kiss_fft_cpx*>(expected.data()));
+    };
+
+    bool exact = true;
+    for (const std::vector<int16_t>& input : inputs) {
+      run_rfft(input.data());
+      run_kiss(input.data());
+      exact &= memcmp(output.data(), expected.data(),
+                      output.size() * sizeof(output[0])) == 0;
+    }
+    all_exact &= exact;
+
+    // Longer lengths take proportionally fewer runs.
+    const int length_runs = std::max(kInputs, runs * 64 / length);
+    // The passes alternate, so that a slow spell of the host hits both.
+    double rfft_us = 0;
+    double kiss_us = 0;
+    for (int pass = 0; pass < kTimedPasses; ++pass) {
+      const double pass_rfft_us = Time(inputs, length_runs, run_rfft);
+      const double pass_kiss_us = Time(inputs, length_runs, run_kiss);
+      if (pass == 0 || pass_rfft_us < rfft_us) rfft_us = pass_rfft_us;
+      if (pass == 0 || pass_kiss_us < kiss_us) kiss_us = pass_kiss_us;
+    }
+    printf("%6d %-10s %12zu %12zu %10.3f %10.3f %7.2fx %6s\n", length,
+           tflm_signal::RfftInt16Radix4IsSupported(length) ? "radix-4"
+                                                           : "kiss_fftr",
+           state_size, kiss_size, rfft_us, kiss_us, kiss_us / rfft_us,
+           exact ? "yes" : "NO");
+  }
+  return all_exact ? 0 : 1;
+}
@@ -0,0 +1,432 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: benchmark of the streaming input path of the signal library, a
+// 16 kHz sample stream cut in 400 sample frames every 160 samples.
+//
+// The ring part feeds the stream to a signal circular buffer the way a DMA
+// or a file reader would, and hands every frame to a consumer. The copying
+// path reads each step into a staging buffer, writes it to the ring with
+// CircularBufferWrite and copies the frame out with CircularBufferGet. The
+// in-place path reads each step straight into CircularBufferWriteRegion and
+// passes CircularBufferView to the consumer. Both are checked frame by frame
+// against the stream.
+//
+// The kernel part runs models of SignalFramer and SignalStacker followed by
+// SignalWindow through MicroInterpreter, and one of SignalFramer alone. The
+// kernels copy each step into the ring and each frame into their output
+// tensor, so this is the cost the in-place path above would save them. The
+// outputs are checked against the framing and ApplyWindow done here. Build
+// the tool against the tree before and after a kernel change to compare the
+// two.
+//
+// Times are per frame, i.e. per step of input, and in samples per second,
+// the best of kTimedPasses runs. The kernel times include reading the step
+// into the input tensor and Invoke().
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./bench_signal_ring [--frames 200000]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "signal/src/circular_buffer.h"
+#include "signal/src/window.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 64 * 1024;
+constexpr int kSampleRate = 16000;
+constexpr int kFrameSize = 400;
+constexpr int kFrameStep = 160;
+// As in the framer: the frame size rounded up to a multiple of the step.
+constexpr int kRingCapacity =
+    (kFrameSize + kFrameStep - 1) / kFrameStep * kFrameStep;
+constexpr int kStackerChannels = 40;
+constexpr int kStackerLeftContext = 3;
+constexpr int kStackerSize = kStackerChannels * (kStackerLeftContext + 1);
+constexpr int kWindowShift = 12;
+// Times are the best of this many runs.
+constexpr int kTimedPasses = 5;
+
+double Microseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+// A minute of int16 samples, read in a loop.
+class SampleStream {
+ public:
+  SampleStream() : samples_(kSampleRate * 60) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> value(-32768, 32767);
+    for (int16_t& sample : samples_) {
+      sample = static_cast<int16_t>(value(rng));
+    }
+  }
+
+  // The `n` samples from `position` on.
+  void Read(size_t position, int16_t* out, size_t n) const {
+    for (size_t done = 0; done < n;) {
+      const size_t at = (position + done) % samples_.size();
+      const size_t count = std::min(n - done, samples_.size() - at);
+      memcpy(out + done, &samples_[at], count * sizeof(int16_t));
+      done += count;
+    }
+  }
+
+ private:
+  std::vector<int16_t> samples_;
+};
+
+// The frame given at step `step`, once the ring holds kRingCapacity samples:
+// the oldest kFrameSize of them.
+bool ExpectedFrame(const SampleStream& stream, int step, int16_t* frame) {
+  if ((step + 1) * kFrameStep < kRingCapacity) return false;
+  stream.Read(static_cast<size_t>(step + 1) * kFrameStep - kRingCapacity,
+              frame, kFrameSize);
+  return true;
+}
+
+struct Ring {
+  Ring() {
+    const size_t state_size =
+        tflite::tflm_signal::CircularBufferGetNeededMemory(kRingCapacity);
+    state.resize(state_size);
+    cb = tflite::tflm_signal::CircularBufferInit(kRingCapacity, state.data(),
+                                                 state_size);
+  }
+  std::vector<uint8_t> state;
+  tflite::tflm_signal::CircularBuffer* cb;
+};
+
+// Runs `frames` steps through the ring and returns the time per step. With
+// `check`, compares every frame with the stream and sets `*exact`.
+double RunRing(const SampleStream& stream, bool in_place, int frames,
+               bool check, bool* exact) {
+  Ring ring;
+  std::vector<int16_t> staging(kFrameStep);
+  std::vector<int16_t> copy(kFrameSize);
+  std::vector<int16_t> expected(kFrameSize);
+  uint32_t sink = 0;
+  *exact = true;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int step = 0; step < frames; ++step) {
+    const size_t position = static_cast<size_t>(step) * kFrameStep;
+    const int16_t* frame = nullptr;
+    if (in_place) {
+      size_t region_size;
+      int16_t* region =
+          tflite::tflm_signal::CircularBufferWriteRegion(ring.cb, &region_size);
+      stream.Read(position, region, kFrameStep);
+      tflite::tflm_signal::CircularBufferCommitWrite(ring.cb, kFrameStep);
+      if (tflite::tflm_signal::CircularBufferAvailable(ring.cb) >= kFrameSize) {
+        frame = tflite::tflm_signal::CircularBufferView(ring.cb, kFrameSize);
+      }
+    } else {
+      stream.Read(position, staging.data(), kFrameStep);
+      tflite::tflm_signal::CircularBufferWrite(ring.cb, staging.data(),
+                                               kFrameStep);
+      if (tflite::tflm_signal::CircularBufferAvailable(ring.cb) >= kFrameSize) {
+        tflite::tflm_signal::CircularBufferGet(ring.cb, kFrameSize,
+                                               copy.data());
+        frame = copy.data();
+      }
+    }
+    if (check) {
+      const bool valid = ExpectedFrame(stream, step, expected.data());
+      *exact &= valid == (frame != nullptr) &&
+                (!valid || memcmp(frame, expected.data(),
+                                  kFrameSize * sizeof(int16_t)) == 0);
+    }
+    if (frame != nullptr) {
+      // The consumer: a window or an FFT would read the whole frame.
+      sink += static_cast<uint16_t>(frame[0]) + frame[kFrameSize - 1];
+      tflite::tflm_signal::CircularBufferDiscard(ring.cb, kFrameStep);
+    }
+  }
+  const double us = Microseconds(std::chrono::steady_clock::now() - start);
+  if (sink == 1) printf(" ");  // Keeps the consumer.
+  return us / frames;
+}
+
+std::vector<uint8_t> FlexbufferMap(
+    const std::vector<std::pair<const char*, int>>& params) {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    for (const auto& param : params) {
+      fbb.Int(param.first, param.second);
+    }
+  });
+  fbb.Finish();
+  return fbb.GetBuffer();
+}
+
+// A chain of signal ops, each reading the first output of the one before.
+class ModelWriter {
+ public:
+  ModelWriter() : model_(std::make_unique<tflite::ModelT>()) {
+    model_->version = 3;
+    model_->description = "tools/bench_signal_ring.cc";
+    model_->buffers.push_back(std::make_unique<tflite::BufferT>());
+    model_->subgraphs.push_back(std::make_unique<tflite::SubGraphT>());
+  }
+
+  int AddTensor(tflite::TensorType type, const std::vector<int32_t>& shape,
+                const void* data = nullptr, size_t bytes = 0) {
+    auto tensor = std::make_unique<tflite::TensorT>();
+    tensor->type = type;
+    tensor->shape = shape;
+    if (data != nullptr) {
+      auto buffer = std::make_unique<tflite::BufferT>();
+      const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+      buffer->data.assign(bytes_data, bytes_data + bytes);
+      tensor->buffer = model_->buffers.size();
+      model_->buffers.push_back(std::move(buffer));
+    }
+    subgraph()->tensors.push_back(std::move(tensor));
+    return subgraph()->tensors.size() - 1;
+  }
+
+  void AddOperator(const char* name, const std::vector<int32_t>& inputs,
+                   const std::vector<int32_t>& outputs,
+                   const std::vector<uint8_t>& options) {
+    auto opcode = std::make_unique<tflite::OperatorCodeT>();
+    opcode->builtin_code = tflite::BuiltinOperator_CUSTOM;
+    opcode->deprecated_builtin_code = tflite::BuiltinOperator_CUSTOM;
+    opcode->custom_code = name;
+    opcode->version = 1;
+    model_->operator_codes.push_back(std::move(opcode));
+    auto op = std::make_unique<tflite::OperatorT>();
+    op->opcode_index = model_->operator_codes.size() - 1;
+    op->inputs = inputs;
+    op->outputs = outputs;
+    op->custom_options = options;
+    op->custom_options_format = tflite::CustomOptionsFormat_FLEXBUFFERS;
+    subgraph()->operators.push_back(std::move(op));
+  }
+
+  std::vector<uint8_t> Finish(int input, int output) {
+    subgraph()->inputs = {input};
+    subgraph()->outputs = {output};
+    subgraph()->name = "main";
+    // The vendored flatbuffers has no implicit default allocator.
+    flatbuffers::DefaultAllocator allocator;
+    flatbuffers::FlatBufferBuilder builder(1024, &allocator);
+    tflite::FinishModelBuffer(builder,
+                              tflite::Model::Pack(builder, model_.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(),
+                                builder.GetBufferPointer() + builder.GetSize());
+  }
+
+ private:
+  tflite::SubGraphT* subgraph() { return model_->subgraphs[0].get(); }
+
+  std::unique_ptr<tflite::ModelT> model_;
+};
+
+std::vector<int16_t> Weights(int size) {
+  std::vector<int16_t> weights(size);
+  for (int i = 0; i < size; ++i) {
+    weights[i] = static_cast<int16_t>(4096 - 8 * (i % 512));
+  }
+  return weights;
+}
+
+// SignalFramer, with SignalWindow after it when `window`.
+std::vector<uint8_t> FramerModel(bool window) {
+  ModelWriter writer;
+  const int input = writer.AddTensor(tflite::TensorType_INT16, {kFrameStep});
+  const int frame =
+      writer.AddTensor(tflite::TensorType_INT16, {1, kFrameSize});
+  const int valid = writer.AddTensor(tflite::TensorType_BOOL, {});
+  writer.AddOperator("SignalFramer", {input}, {frame, valid},
+                     FlexbufferMap({{"frame_size", kFrameSize},
+                                    {"frame_step", kFrameStep},
+                                    {"prefill", 0}}));
+  if (!window) {
+    return writer.Finish(input, frame);
+  }
+  const std::vector<int16_t> weights = Weights(kFrameSize);
+  const int weights_tensor =
+      writer.AddTensor(tflite::TensorType_INT16, {kFrameSize}, weights.data(),
+                       weights.size() * sizeof(int16_t));
+  const int output =
+      writer.AddTensor(tflite::TensorType_INT16, {1, kFrameSize});
+  writer.AddOperator("SignalWindow", {frame, weights_tensor}, {output},
+                     FlexbufferMap({{"shift", kWindowShift}}));
+  return writer.Finish(input, output);
+}
+
+// SignalStacker of kStackerLeftContext frames before, then SignalWindow.
+std::vector<uint8_t> StackerModel() {
+  ModelWriter writer;
+  const int input =
+      writer.AddTensor(tflite::TensorType_INT16, {kStackerChannels});
+  const int stacked = writer.AddTensor(tflite::TensorType_INT16, {kStackerSize});
+  const int valid = writer.AddTensor(tflite::TensorType_BOOL, {});
+  writer.AddOperator("SignalStacker", {input}, {stacked, valid},
+                     FlexbufferMap({{"num_channels", kStackerChannels},
+                                    {"stacker_left_context",
+                                     kStackerLeftContext},
+                                    {"stacker_right_context", 0},
+                                    {"stacker_step", 1}}));
+  const std::vector<int16_t> weights = Weights(kStackerSize);
+  const int weights_tensor =
+      writer.AddTensor(tflite::TensorType_INT16, {kStackerSize},
+                       weights.data(), weights.size() * sizeof(int16_t));
+  const int output = writer.AddTensor(tflite::TensorType_INT16, {kStackerSize});
+  writer.AddOperator("SignalWindow", {stacked, weights_tensor}, {output},
+                     FlexbufferMap({{"shift", kWindowShift}}));
+  return writer.Finish(input, output);
+}
+
+struct Case {
+  const char* name;
+  std::vector<uint8_t> model;
+  // Input samples per call.
+  int step;
+  // Fills `expected` with the output of call `n`; false while it is not
+  // valid yet.
+  bool (*expected)(const SampleStream& stream, int n, int16_t* expected);
+};
+
+void Window(const int16_t* input, int size, int16_t* output) {
+  const std::vector<int16_t> weights = Weights(size);
+  ::tflm_signal::ApplyWindow(input, weights.data(), size, kWindowShift,
+                             output);
+}
+
+bool ExpectedFramerWindow(const SampleStream& stream, int n,
+                          int16_t* expected) {
+  int16_t frame[kFrameSize];
+  if (!ExpectedFrame(stream, n, frame)) return false;
+  Window(frame, kFrameSize, expected);
+  return true;
+}
+
+// The first frame is repeated as the left context of the first calls.
+bool ExpectedStackerWindow(const SampleStream& stream, int n,
+                           int16_t* expected) {
+  int16_t stacked[kStackerSize];
+  for (int i = 0; i <= kStackerLeftContext; ++i) {
+    const int frame = std::max(0, n - kStackerLeftContext + i);
+    stream.Read(static_cast<size_t>(frame) * kStackerChannels,
+                &stacked[i * kStackerChannels], kStackerChannels);
+  }
+  Window(stacked, kStackerSize, expected);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int frames = 200000;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = atoi(argv[++i]);
+    }
+  }
+  if (frames < 3) {
+    fprintf(stderr, "Usage: %s [--frames 200000]\n", argv[0]);
+    return 1;
+  }
+  const SampleStream stream;
+  bool all_exact = true;
+
+  printf("ring, %d-sample frames every %d samples\n", kFrameSize, kFrameStep);
+  printf("%-26s %10s %14s %6s\n", "", "us/frame", "Msamples/s", "exact");
+  for (const bool in_place : {false, true}) {
+    bool exact, unchecked;
+    RunRing(stream, in_place, frames, true, &exact);
+    double us = RunRing(stream, in_place, frames, false, &unchecked);
+    for (int pass = 1; pass < kTimedPasses; ++pass) {
+      us = std::min(us, RunRing(stream, in_place, frames, false, &unchecked));
+    }
+    all_exact &= exact;
+    printf("%-26s %10.4f %14.1f %6s\n",
+           in_place ? "write region + view" : "staging + write + get", us,
+           kFrameStep / us, exact ? "yes" : "NO");
+  }
+
+  std::vector<Case> cases;
+  cases.push_back({"framer -> window", FramerModel(true), kFrameStep,
+                   ExpectedFramerWindow});
+  cases.push_back({"stacker -> window", StackerModel(), kStackerChannels,
+                   ExpectedStackerWindow});
+  cases.push_back(
+      {"framer (model output)", FramerModel(false), kFrameStep, ExpectedFrame});
+
+  tflite::MicroMutableOpResolver<3> resolver;
+  resolver.AddFramer();
+  resolver.AddStacker();
+  resolver.AddWindow();
+  std::vector<uint8_t> arena(kArenaSize);
+
+  printf("\nkernels through MicroInterpreter\n");
+  printf("%-26s %10s %14s %12s %6s\n", "", "us/frame", "Msamples/s",
+         "arena bytes", "exact");
+  for (const Case& c : cases) {
+    tflite::MicroInterpreter interpreter(tflite::GetModel(c.model.data()),
+                                         resolver, arena.data(), arena.size());
+    if (interpreter.AllocateTensors() != kTfLiteOk) {
+      fprintf(stderr, "%s: AllocateTensors() failed\n", c.name);
+      return 1;
+    }
+    TfLiteTensor* input = interpreter.input(0);
+    const TfLiteTensor* output = interpreter.output(0);
+    std::vector<int16_t> expected(output->bytes / sizeof(int16_t));
+
+    // A checked pass, then timed passes over fresh state.
+    bool exact = true;
+    double us = 0;
+    for (int pass = 0; pass <= kTimedPasses; ++pass) {
+      interpreter.Reset();
+      auto start = std::chrono::steady_clock::now();
+      for (int n = 0; n < frames; ++n) {
+        stream.Read(static_cast<size_t>(n) * c.step, input->data.i16, c.step);
+        if (interpreter.Invoke() != kTfLiteOk) {
+          fprintf(stderr, "%s: Invoke() failed\n", c.name);
+          return 1;
+        }
+        if (pass == 0 && c.expected(stream, n, expected.data())) {
+          exact &=
+              memcmp(output->data.i16, expected.data(), output->bytes) == 0;
+        }
+      }
+      const double pass_us =
+          Microseconds(std::chrono::steady_clock::now() - start);
+      if (pass == 1 || (pass > 1 && pass_us < us)) us = pass_us;
+    }
+    all_exact &= exact;
+    us /= frames;
+    printf("%-26s %10.4f %14.1f %12zu %6s\n", c.name, us, c.step / us,
+           interpreter.arena_used_bytes(), exact ? "yes" : "NO");
+  }
+  return all_exact ? 0 : 1;
+}
@@ -0,0 +1,338 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: runs the classifier cascade (micro_cascade.h) of a small and a
+// full model over a dataset at several margin thresholds and reports, for
+// each, the share of inputs escalated to the full model, the mean host
+// latency and the top-1 accuracy, next to the full model alone. The
+// thresholds are the small model margins at escalation rates of 0 to 100% in
+// steps of 10%, or the ones given with --thresholds.
+//
+// Latencies are the best of --passes passes over the dataset. Each pass runs
+// the full model and then every threshold, so that a slow spell of the host
+// hits them all rather than one row.
+//
+// Inputs are the MNIST idx files when given, otherwise random pen strokes
+// (not the ones make_small_model trains on), for which the accuracy is the
+// agreement with the full model.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./cascade_eval model_small.tflite model_int8.tflite
+//       [--images t10k-images-idx3-ubyte --labels t10k-labels-idx1-ubyte]
+//       [--count 2000] [--thresholds 0.5,1,2] [--passes 5]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/micro/micro_cascade.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kImageSide = 28;
+constexpr int kImageSize = kImageSide * kImageSide;
+constexpr int kNumberOfOutputs = 10;
+constexpr size_t kArenaSize = 256 * 1024;
+constexpr int kEscalationSteps = 10;
+constexpr int kDefaultPasses = 5;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+uint32_t ReadBigEndian(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) |
+         (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+// A batch of 28x28 grayscale images, 0 = background, with optional labels.
+struct Dataset {
+  std::vector<uint8_t> pixels;
+  std::vector<int> labels;
+  int count = 0;
+};
+
+bool LoadMnist(const char* images_path, const char* labels_path, int limit,
+               Dataset* dataset) {
+  const std::vector<uint8_t> images = LoadFile(images_path);
+  const std::vector<uint8_t> labels = LoadFile(labels_path);
+  if (images.size() < 16 || labels.size() < 8 ||
+      ReadBigEndian(&images[0]) != 0x803 || ReadBigEndian(&labels[0]) != 0x801 ||
+      ReadBigEndian(&images[8]) != kImageSide ||
+      ReadBigEndian(&images[12]) != kImageSide) {
+    return false;
+  }
+  const int count = std::min<int>(
+      std::min(ReadBigEndian(&images[4]), ReadBigEndian(&labels[4])), limit);
+  if (images.size() < 16 + static_cast<size_t>(count) * kImageSize ||
+      labels.size() < 8 + static_cast<size_t>(count)) {
+    return false;
+  }
+  dataset->count = count;
+  dataset->pixels.assign(images.begin() + 16,
+                         images.begin() + 16 + count * kImageSize);
+  dataset->labels.assign(labels.begin() + 8, labels.begin() + 8 + count);
+  return true;
+}
+
+// Random thick pen strokes, roughly what the touch screen produces.
+void MakeStrokes(int count, Dataset* dataset) {
+  std::mt19937 rng(3);
+  dataset->count = count;
+  dataset->pixels.assign(static_cast<size_t>(count) * kImageSize, 0);
+  for (int n = 0; n < count; ++n) {
+    uint8_t* image = &dataset->pixels[static_cast<size_t>(n) * kImageSize];
+    int x = 6 + rng() % 16;
+    int y = 6 + rng() % 16;
+    for (int step = 0; step < 80; ++step) {
+      x = std::min(std::max(x + static_cast<int>(rng() % 3) - 1, 1), 26);
+      y = std::min(std::max(y + static_cast<int>(rng() % 3) - 1, 1), 26);
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+          image[(y + dy) * kImageSide + x + dx] = 255;
+        }
+      }
+    }
+  }
+}
+
+void SetInput(const uint8_t* image, TfLiteTensor* input) {
+  for (int i = 0; i < kImageSize; ++i) {
+    const int q = static_cast<int>(
+                      std::round(image[i] / 255.0f / input->params.scale)) +
+                  input->params.zero_point;
+    input->data.int8[i] = static_cast<int8_t>(std::min(std::max(q, -128), 127));
+  }
+}
+
+int TopClass(const TfLiteTensor* output) {
+  return static_cast<int>(
+      std::max_element(output->data.int8,
+                       output->data.int8 + kNumberOfOutputs) -
+      output->data.int8);
+}
+
+double Seconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double>(duration).count();
+}
+
+struct Result {
+  int escalated = 0;
+  int correct = 0;
+  double seconds = 0;
+};
+
+// Keeps the best time of the passes in `result`.
+void KeepBest(int pass, double seconds, Result* result) {
+  if (pass == 0 || seconds < result->seconds) result->seconds = seconds;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* paths[2] = {nullptr, nullptr};
+  int path_count = 0;
+  const char* images_path = nullptr;
+  const char* labels_path = nullptr;
+  int count = 2000;
+  int passes = kDefaultPasses;
+  std::vector<float> thresholds;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--images") == 0 && i + 1 < argc) {
+      images_path = argv[++i];
+    } else if (strcmp(argv[i], "--labels") == 0 && i + 1 < argc) {
+      labels_path = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--passes") == 0 && i + 1 < argc) {
+      passes = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--thresholds") == 0 && i + 1 < argc) {
+      for (char* token = strtok(argv[++i], ","); token != nullptr;
+           token = strtok(nullptr, ",")) {
+        thresholds.push_back(strtof(token, nullptr));
+      }
+    } else if (path_count < 2) {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (path_count != 2 || count < 1 || passes < 1) {
+    fprintf(stderr,
+            "Usage: %s model_small.tflite model_int8.tflite\n"
+            "  [--images idx3 --labels idx1] [--count 2000]\n"
+            "  [--thresholds 0.5,1,2] [--passes 5]\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::vector<uint8_t> flatbuffers[2];
+  const tflite::Model* models[2];
+  for (int m = 0; m < 2; ++m) {
+    flatbuffers[m] = LoadFile(paths[m]);
+    flatbuffers::Verifier verifier(flatbuffers[m].data(),
+                                   flatbuffers[m].size());
+    if (!tflite::VerifyModelBuffer(verifier)) {
+      fprintf(stderr, "%s is not a valid model\n", paths[m]);
+      return 1;
+    }
+    models[m] = tflite::GetModel(flatbuffers[m].data());
+  }
+
+  Dataset dataset;
+  if (images_path != nullptr && labels_path != nullptr) {
+    if (!LoadMnist(images_path, labels_path, count, &dataset)) {
+      fprintf(stderr, "Couldn't read the MNIST idx files\n");
+      return 1;
+    }
+  } else {
+    MakeStrokes(count, &dataset);
+  }
+
+  tflite::MicroMutableOpResolver<6> resolver;
+  resolver.AddAveragePool2D();
+  resolver.AddConv2D();
+  resolver.AddMaxPool2D();
+  resolver.AddReshape();
+  resolver.AddFullyConnected();
+  resolver.AddPatchStage();
+  // The passes alternate between the two, so each has its own arena.
+  std::vector<uint8_t> full_arena_data(kArenaSize);
+  std::vector<uint8_t> arena(kArenaSize);
+
+  // The full model alone: reference classes, accuracy and latency.
+  tflite::MicroInterpreter interpreter(models[1], resolver,
+                                       full_arena_data.data(),
+                                       full_arena_data.size());
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "%s: AllocateTensors() failed\n", paths[1]);
+    return 1;
+  }
+  const size_t full_arena = interpreter.arena_used_bytes();
+  std::vector<int> full_classes(dataset.count);
+  Result full;
+  // Runs the full model over the dataset and returns the time it took.
+  auto run_full = [&]() {
+    double seconds = 0;
+    for (int n = 0; n < dataset.count; ++n) {
+      SetInput(&dataset.pixels[static_cast<size_t>(n) * kImageSize],
+               interpreter.input(0));
+      const auto start = std::chrono::steady_clock::now();
+      if (interpreter.Invoke() != kTfLiteOk) {
+        fprintf(stderr, "%s: Invoke() failed\n", paths[1]);
+        exit(1);
+      }
+      seconds += Seconds(std::chrono::steady_clock::now() - start);
+      full_classes[n] = TopClass(interpreter.output(0));
+    }
+    return seconds;
+  };
+  full.seconds = run_full();
+  const bool labelled = !dataset.labels.empty();
+  const std::vector<int>& labels = labelled ? dataset.labels : full_classes;
+  for (int n = 0; n < dataset.count; ++n) {
+    full.correct += full_classes[n] == labels[n];
+  }
+  full.escalated = dataset.count;
+
+  tflite::MicroCascade cascade(models[0], models[1], resolver, arena.data(),
+                               arena.size());
+  if (cascade.AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "The models can't form a cascade\n");
+    return 1;
+  }
+
+  // Small model margins, for the default thresholds.
+  if (thresholds.empty()) {
+    std::vector<float> margins(dataset.count);
+    cascade.SetMarginThreshold(0.0f);
+    for (int n = 0; n < dataset.count; ++n) {
+      SetInput(&dataset.pixels[static_cast<size_t>(n) * kImageSize],
+               cascade.input(0));
+      if (cascade.Invoke() != kTfLiteOk) {
+        fprintf(stderr, "Cascade Invoke() failed\n");
+        return 1;
+      }
+      margins[n] = cascade.margin();
+    }
+    std::sort(margins.begin(), margins.end());
+    thresholds.push_back(0.0f);
+    for (int step = 1; step < kEscalationSteps; ++step) {
+      thresholds.push_back(margins[dataset.count * step / kEscalationSteps]);
+    }
+    thresholds.push_back(margins.back() + 1.0f);
+  }
+
+  // Runs the cascade over the dataset at `threshold` into `result` and
+  // returns the time it took.
+  auto run_cascade = [&](float threshold, Result* result) {
+    cascade.SetMarginThreshold(threshold);
+    result->escalated = 0;
+    result->correct = 0;
+    double seconds = 0;
+    for (int n = 0; n < dataset.count; ++n) {
+      SetInput(&dataset.pixels[static_cast<size_t>(n) * kImageSize],
+               cascade.input(0));
+      const auto start = std::chrono::steady_clock::now();
+      if (cascade.Invoke() != kTfLiteOk) {
+        fprintf(stderr, "Cascade Invoke() failed\n");
+        exit(1);
+      }
+      seconds += Seconds(std::chrono::steady_clock::now() - start);
+      result->escalated += cascade.escalated();
+      result->correct += TopClass(cascade.output(0)) == labels[n];
+    }
+    return seconds;
+  };
+  std::vector<Result> results(thresholds.size());
+  for (int pass = 0; pass < passes; ++pass) {
+    if (pass > 0) KeepBest(pass, run_full(), &full);
+    for (size_t t = 0; t < thresholds.size(); ++t) {
+      KeepBest(pass, run_cascade(thresholds[t], &results[t]), &results[t]);
+    }
+  }
+
+  printf("%d %s images, best of %d passes, arena %zu bytes for the full "
+         "model, %zu for the cascade\n",
+         dataset.count, labelled ? "MNIST" : "stroke", passes, full_arena,
+         cascade.arena_used_bytes());
+  printf("%-12s %10s %12s %10s\n", "threshold", "escalated", "latency us",
+         labelled ? "accuracy" : "agreement");
+  for (size_t t = 0; t < thresholds.size(); ++t) {
+    const float threshold = thresholds[t];
+    const Result& result = results[t];
+    printf("%-12.3f %9.1f%% %12.1f %9.2f%%\n", threshold,
+           100.0 * result.escalated / dataset.count,
+           1e6 * result.seconds / dataset.count,
+           100.0 * result.correct / dataset.count);
+  }
+  printf("%-12s %9.1f%% %12.1f %9.2f%%\n", "full only", 100.0,
+         1e6 * full.seconds / dataset.count,
+         100.0 * full.correct / dataset.count);
+  return 0;
+}
@@ -0,0 +1,291 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: runs variants of the digit classifier (int8, int4, palettized,
+// packed) side by side on the same inputs and reports, per model, the flash
+// taken by the model and its weights, the arena used, the host latency, the
+// top-1 accuracy and the agreement with the first model.
+//
+// Inputs are the MNIST idx files when given, otherwise random pen strokes,
+// for which only the agreement is meaningful.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./compare_models model_int8.tflite model_int4.tflite
+//       [--images t10k-images-idx3-ubyte --labels t10k-labels-idx1-ubyte]
+//       [--count 1000]
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kImageSide = 28;
+constexpr int kImageSize = kImageSide * kImageSide;
+constexpr int kNumberOfOutputs = 10;
+constexpr size_t kArenaSize = 256 * 1024;
+constexpr int kLatencyRuns = 200;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+uint32_t ReadBigEndian(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) |
+         (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+// A batch of 28x28 grayscale images, 0 = background, with optional labels.
+struct Dataset {
+  std::vector<uint8_t> pixels;
+  std::vector<int> labels;
+  int count = 0;
+};
+
+bool LoadMnist(const char* images_path, const char* labels_path, int limit,
+               Dataset* dataset) {
+  const std::vector<uint8_t> images = LoadFile(images_path);
+  const std::vector<uint8_t> labels = LoadFile(labels_path);
+  if (images.size() < 16 || labels.size() < 8 ||
+      ReadBigEndian(&images[0]) != 0x803 || ReadBigEndian(&labels[0]) != 0x801 ||
+      ReadBigEndian(&images[8]) != kImageSide ||
+      ReadBigEndian(&images[12]) != kImageSide) {
+    return false;
+  }
+  const int count = std::min<int>(
+      std::min(ReadBigEndian(&images[4]), ReadBigEndian(&labels[4])), limit);
+  if (images.size() < 16 + static_cast<size_t>(count) * kImageSize ||
+      labels.size() < 8 + static_cast<size_t>(count)) {
+    return false;
+  }
+  dataset->count = count;
+  dataset->pixels.assign(images.begin() + 16,
+                         images.begin() + 16 + count * kImageSize);
+  dataset->labels.assign(labels.begin() + 8, labels.begin() + 8 + count);
+  return true;
+}
+
+// Random thick pen strokes, roughly what the touch screen produces.
+void MakeStrokes(int count, Dataset* dataset) {
+  std::mt19937 rng(1);
+  dataset->count = count;
+  dataset->pixels.assign(static_cast<size_t>(count) * kImageSize, 0);
+  for (int n = 0; n < count; ++n) {
+    uint8_t* image = &dataset->pixels[static_cast<size_t>(n) * kImageSize];
+    int x = 6 + rng() % 16;
+    int y = 6 + rng() % 16;
+    for (int step = 0; step < 80; ++step) {
+      x = std::min(std::max(x + static_cast<int>(rng() % 3) - 1, 1), 26);
+      y = std::min(std::max(y + static_cast<int>(rng() % 3) - 1, 1), 26);
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+          image[(y + dy) * kImageSide + x + dx] = 255;
+        }
+      }
+    }
+  }
+}
+
+long ConstantBytes(const tflite::Model* model) {
+  long bytes = 0;
+  for (const auto* buffer : *model->buffers()) {
+    if (buffer->data() != nullptr) bytes += buffer->data()->size();
+  }
+  return bytes;
+}
+
+struct Variant {
+  std::string path;
+  std::vector<uint8_t> flatbuffer;
+  tflite::MicroMutableOpResolver<9> resolver;
+  std::unique_ptr<uint8_t[]> arena;
+  std::unique_ptr<tflite::MicroInterpreter> interpreter;
+  std::vector<int8_t> outputs;
+  int correct = 0;
+  int agree = 0;
+  double output_error = 0;
+};
+
+bool Setup(Variant* variant) {
+  variant->flatbuffer = LoadFile(variant->path.c_str());
+  flatbuffers::Verifier verifier(variant->flatbuffer.data(),
+                                 variant->flatbuffer.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", variant->path.c_str());
+    return false;
+  }
+  // The same registrations as the firmware; the int8 and int4 filters of
+  // CONV_2D and FULLY_CONNECTED both go through the CMSIS-NN kernels.
+  variant->resolver.AddConv2D();
+  variant->resolver.AddMaxPool2D();
+  variant->resolver.AddFullyConnected();
+  variant->resolver.AddReshape();
+  variant->resolver.AddPackedConv2D();
+  variant->resolver.AddPackedFullyConnected();
+  variant->resolver.AddPalettizedConv2D();
+  variant->resolver.AddPalettizedFullyConnected();
+  variant->resolver.AddPatchStage();
+  // Aligned the way the firmware's static arena is.
+  variant->arena.reset(new uint8_t[kArenaSize + 16]);
+  uint8_t* arena = variant->arena.get();
+  arena += (16 - reinterpret_cast<uintptr_t>(arena) % 16) % 16;
+  variant->interpreter = std::make_unique<tflite::MicroInterpreter>(
+      tflite::GetModel(variant->flatbuffer.data()), variant->resolver, arena,
+      kArenaSize);
+  if (variant->interpreter->AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "%s: AllocateTensors() failed\n", variant->path.c_str());
+    return false;
+  }
+  const TfLiteTensor* input = variant->interpreter->input(0);
+  if (input->type != kTfLiteInt8 || input->bytes != kImageSize ||
+      variant->interpreter->output(0)->bytes != kNumberOfOutputs) {
+    fprintf(stderr, "%s: not a 28x28 int8 classifier\n", variant->path.c_str());
+    return false;
+  }
+  return true;
+}
+
+void SetInput(Variant* variant, const uint8_t* image) {
+  TfLiteTensor* input = variant->interpreter->input(0);
+  const float scale = input->params.scale;
+  const int zero_point = input->params.zero_point;
+  for (int i = 0; i < kImageSize; ++i) {
+    const int q = static_cast<int>(std::lround(image[i] / 255.0f / scale)) +
+                  zero_point;
+    input->data.int8[i] = static_cast<int8_t>(std::min(std::max(q, -128), 127));
+  }
+}
+
+int TopPrediction(const int8_t* outputs) {
+  int top = 0;
+  for (int i = 1; i < kNumberOfOutputs; ++i) {
+    if (outputs[i] > outputs[top]) top = i;
+  }
+  return top;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<std::unique_ptr<Variant>> variants;
+  const char* images_path = nullptr;
+  const char* labels_path = nullptr;
+  int count = 1000;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--images") == 0 && i + 1 < argc) {
+      images_path = argv[++i];
+    } else if (strcmp(argv[i], "--labels") == 0 && i + 1 < argc) {
+      labels_path = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else {
+      variants.push_back(std::make_unique<Variant>());
+      variants.back()->path = argv[i];
+    }
+  }
+  if (variants.empty() || count <= 0 ||
+      (images_path == nullptr) != (labels_path == nullptr)) {
+    fprintf(stderr,
+            "Usage: %s <model.tflite>... [--images <idx3> --labels <idx1>] "
+            "[--count <n>]\n",
+            argv[0]);
+    return 1;
+  }
+
+  Dataset dataset;
+  if (images_path != nullptr) {
+    if (!LoadMnist(images_path, labels_path, count, &dataset)) {
+      fprintf(stderr, "Couldn't read the MNIST idx files\n");
+      return 1;
+    }
+  } else {
+    MakeStrokes(count, &dataset);
+  }
+
+  for (auto& variant : variants) {
+    if (!Setup(variant.get())) return 1;
+  }
+
+  const Variant& reference = *variants[0];
+  for (int n = 0; n < dataset.count; ++n) {
+    const uint8_t* image = &dataset.pixels[static_cast<size_t>(n) * kImageSize];
+    for (auto& variant : variants) {
+      SetInput(variant.get(), image);
+      if (variant->interpreter->Invoke() != kTfLiteOk) {
+        fprintf(stderr, "%s: Invoke() failed\n", variant->path.c_str());
+        return 1;
+      }
+      const int8_t* outputs = variant->interpreter->output(0)->data.int8;
+      variant->outputs.assign(outputs, outputs + kNumberOfOutputs);
+      if (!dataset.labels.empty() &&
+          TopPrediction(outputs) == dataset.labels[n]) {
+        ++variant->correct;
+      }
+    }
+    const int reference_top = TopPrediction(reference.outputs.data());
+    for (auto& variant : variants) {
+      variant->agree += TopPrediction(variant->outputs.data()) == reference_top;
+      for (int i = 0; i < kNumberOfOutputs; ++i) {
+        variant->output_error +=
+            std::abs(variant->outputs[i] - reference.outputs[i]);
+      }
+    }
+  }
+
+  printf("%d %s\n", dataset.count,
+         dataset.labels.empty() ? "random strokes" : "MNIST test images");
+  printf("%-32s %8s %8s %8s %10s %9s %9s %9s\n", "model", "flash", "weights",
+         "arena", "us/invoke", "accuracy", "agree", "mean|d|");
+  for (auto& variant : variants) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kLatencyRuns; ++i) {
+      variant->interpreter->Invoke();
+    }
+    const double latency =
+        std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start)
+            .count() /
+        kLatencyRuns;
+    char accuracy[16] = "-";
+    if (!dataset.labels.empty()) {
+      snprintf(accuracy, sizeof(accuracy), "%.2f%%",
+               100.0 * variant->correct / dataset.count);
+    }
+    printf("%-32s %8zu %8ld %8zu %10.1f %9s %8.2f%% %9.3f\n",
+           variant->path.c_str(), variant->flatbuffer.size(),
+           ConstantBytes(tflite::GetModel(variant->flatbuffer.data())),
+           variant->interpreter->arena_used_bytes(), latency, accuracy,
+           100.0 * variant->agree / dataset.count,
+           variant->output_error / (dataset.count * kNumberOfOutputs));
+  }
+  return 0;
+}
@@ -0,0 +1,440 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: measures how sparse the inputs of the int8 FULLY_CONNECTED ops of
+// the digit classifier are, i.e. the share of them at the zero point, and
+// what the FULLY_CONNECTED kernel of this tree, which switches to its sparse
+// loop on such inputs when built with -DTFLM_CMSIS_NN_SPARSE_FC, gains over
+// the dense arm_fully_connected_s8.
+//
+// The model is run one operator at a time with InvokeStep to capture the
+// input of each FULLY_CONNECTED op. The captured inputs are then run, in
+// the order they came, through a model of that op alone and through
+// arm_fully_connected_s8, timed and checked bit for bit; the kernel's time
+// includes the small cost of Invoke. The kernel decides whether to try its
+// sparse loop from the sparsity of the inputs before, so the whole sequence
+// is run kRepeats times rather than each input. Per sparsity bin, the share
+// of inferences and the time of both are printed, then the totals over the
+// sequence. The firmware's profiler gives the same split on the target.
+//
+// Inputs are the MNIST idx files when given, otherwise random pen strokes.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./fc_sparsity model_int8.tflite
+//       [--images t10k-images-idx3-ubyte --labels t10k-labels-idx1-ubyte]
+//       [--count 1000]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Include/arm_nnfunctions.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kImageSide = 28;
+constexpr int kImageSize = kImageSide * kImageSide;
+constexpr size_t kArenaSize = 256 * 1024;
+constexpr int kBins = 10;
+constexpr int kRepeats = 100;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+uint32_t ReadBigEndian(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) |
+         (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+// The images of the MNIST idx file, 0 = background. The labels are only
+// checked for consistency.
+bool LoadMnist(const char* images_path, const char* labels_path, int limit,
+               std::vector<uint8_t>* pixels) {
+  const std::vector<uint8_t> images = LoadFile(images_path);
+  const std::vector<uint8_t> labels = LoadFile(labels_path);
+  if (images.size() < 16 || labels.size() < 8 ||
+      ReadBigEndian(&images[0]) != 0x803 || ReadBigEndian(&labels[0]) != 0x801 ||
+      ReadBigEndian(&images[8]) != kImageSide ||
+      ReadBigEndian(&images[12]) != kImageSide) {
+    return false;
+  }
+  const int count = std::min<int>(
+      std::min(ReadBigEndian(&images[4]), ReadBigEndian(&labels[4])), limit);
+  if (images.size() < 16 + static_cast<size_t>(count) * kImageSize) {
+    return false;
+  }
+  pixels->assign(images.begin() + 16, images.begin() + 16 + count * kImageSize);
+  return true;
+}
+
+// Random thick pen strokes, roughly what the touch screen produces.
+void MakeStrokes(int count, std::vector<uint8_t>* pixels) {
+  std::mt19937 rng(1);
+  pixels->assign(static_cast<size_t>(count) * kImageSize, 0);
+  for (int n = 0; n < count; ++n) {
+    uint8_t* image = &(*pixels)[static_cast<size_t>(n) * kImageSize];
+    int x = 6 + rng() % 16;
+    int y = 6 + rng() % 16;
+    for (int step = 0; step < 80; ++step) {
+      x = std::min(std::max(x + static_cast<int>(rng() % 3) - 1, 1), 26);
+      y = std::min(std::max(y + static_cast<int>(rng() % 3) - 1, 1), 26);
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+          image[(y + dy) * kImageSide + x + dx] = 255;
+        }
+      }
+    }
+  }
+}
+
+float Scale(const tflite::Tensor& tensor) {
+  return tensor.quantization()->scale()->Get(0);
+}
+
+int ZeroPoint(const tflite::Tensor& tensor) {
+  return static_cast<int>(tensor.quantization()->zero_point()->Get(0));
+}
+
+double Microseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+// One FULLY_CONNECTED op of the model, its inputs over the dataset and the
+// statistics gathered on them.
+struct FullyConnected {
+  int op_index;
+  int input_tensor;
+  int batches;
+  int accum_depth;
+  int output_depth;
+  const int8_t* filter;
+  const int32_t* bias;
+  float input_scale;
+  int input_zero_point;
+  float filter_scale;
+  float output_scale;
+  int output_zero_point;
+  TfLiteFusedActivation activation;
+
+  std::vector<int8_t> inputs;
+  int count[kBins] = {};
+  double kernel_us[kBins] = {};
+  double dense_us[kBins] = {};
+  int mismatches = 0;
+};
+
+const int8_t* BufferData(const tflite::Model& model,
+                         const tflite::Tensor& tensor) {
+  const auto* data = model.buffers()->Get(tensor.buffer())->data();
+  return data != nullptr ? reinterpret_cast<const int8_t*>(data->data())
+                         : nullptr;
+}
+
+bool Describe(const tflite::Model& model, int op_index, FullyConnected* fc) {
+  const tflite::SubGraph& subgraph = *model.subgraphs()->Get(0);
+  const tflite::Operator& op = *subgraph.operators()->Get(op_index);
+  const tflite::Tensor& input = *subgraph.tensors()->Get(op.inputs()->Get(0));
+  const tflite::Tensor& filter = *subgraph.tensors()->Get(op.inputs()->Get(1));
+  const tflite::Tensor& output =
+      *subgraph.tensors()->Get(op.outputs()->Get(0));
+  const auto activation =
+      op.builtin_options_as_FullyConnectedOptions()->fused_activation_function();
+  if (input.type() != tflite::TensorType_INT8 ||
+      filter.type() != tflite::TensorType_INT8 ||
+      filter.shape()->size() != 2 || BufferData(model, filter) == nullptr ||
+      (activation != tflite::ActivationFunctionType_NONE &&
+       activation != tflite::ActivationFunctionType_RELU &&
+       activation != tflite::ActivationFunctionType_RELU6)) {
+    return false;
+  }
+  fc->op_index = op_index;
+  fc->input_tensor = op.inputs()->Get(0);
+  fc->output_depth = filter.shape()->Get(0);
+  fc->accum_depth = filter.shape()->Get(1);
+  fc->batches = 1;
+  for (size_t i = 0; i + 1 < output.shape()->size(); ++i) {
+    fc->batches *= output.shape()->Get(i);
+  }
+  fc->filter = BufferData(model, filter);
+  fc->bias = nullptr;
+  if (op.inputs()->size() > 2 && op.inputs()->Get(2) >= 0) {
+    fc->bias = reinterpret_cast<const int32_t*>(
+        BufferData(model, *subgraph.tensors()->Get(op.inputs()->Get(2))));
+  }
+  fc->input_scale = Scale(input);
+  fc->input_zero_point = ZeroPoint(input);
+  fc->filter_scale = Scale(filter);
+  fc->output_scale = Scale(output);
+  fc->output_zero_point = ZeroPoint(output);
+  // The schema and the C enum agree on NONE, RELU and RELU6.
+  fc->activation = static_cast<TfLiteFusedActivation>(activation);
+  return true;
+}
+
+// A model made of op `op_index` of `flatbuffer` alone, with its input and
+// output as the model's.
+std::vector<uint8_t> ExtractOp(const std::vector<uint8_t>& flatbuffer,
+                               int op_index) {
+  std::unique_ptr<tflite::ModelT> model =
+      tflite::UnPackModel(flatbuffer.data());
+  tflite::SubGraphT& subgraph = *model->subgraphs[0];
+  std::unique_ptr<tflite::OperatorT> op =
+      std::move(subgraph.operators[op_index]);
+  subgraph.inputs = {op->inputs[0]};
+  subgraph.outputs = op->outputs;
+  subgraph.operators.clear();
+  subgraph.operators.push_back(std::move(op));
+
+  // The vendored flatbuffers has no implicit default allocator.
+  flatbuffers::DefaultAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(flatbuffer.size(), &allocator);
+  tflite::FinishModelBuffer(fbb, tflite::Model::Pack(fbb, model.get()));
+  return std::vector<uint8_t>(fbb.GetBufferPointer(),
+                              fbb.GetBufferPointer() + fbb.GetSize());
+}
+
+// Runs the captured inputs of `fc` in sequence through the FULLY_CONNECTED
+// kernel, as a model of that op alone, and through arm_fully_connected_s8,
+// `kRepeats` times over.
+bool Measure(const std::vector<uint8_t>& flatbuffer, FullyConnected* fc) {
+  const std::vector<uint8_t> op_model = ExtractOp(flatbuffer, fc->op_index);
+  tflite::MicroMutableOpResolver<1> resolver;
+  resolver.AddFullyConnected();
+  std::vector<uint8_t> arena(kArenaSize);
+  tflite::MicroInterpreter interpreter(tflite::GetModel(op_model.data()),
+                                       resolver, arena.data(), arena.size());
+  if (interpreter.AllocateTensors() != kTfLiteOk) return false;
+  TfLiteTensor* input = interpreter.input(0);
+  TfLiteTensor* output = interpreter.output(0);
+
+  // The arguments the kernel passes to arm_fully_connected_s8.
+  cmsis_nn_context ctx = {nullptr, 0};
+  cmsis_nn_fc_params fc_params;
+  fc_params.input_offset = -fc->input_zero_point;
+  fc_params.filter_offset = 0;
+  fc_params.output_offset = fc->output_zero_point;
+  tflite::CalculateActivationRangeQuantized(nullptr, fc->activation, output,
+                                            &fc_params.activation.min,
+                                            &fc_params.activation.max);
+  int32_t multiplier;
+  int shift;
+  tflite::QuantizeMultiplier(
+      static_cast<double>(fc->input_scale) * fc->filter_scale /
+          fc->output_scale,
+      &multiplier, &shift);
+  cmsis_nn_per_tensor_quant_params quant_params = {multiplier, shift};
+  cmsis_nn_dims input_dims = {fc->batches, 1, 1, fc->accum_depth};
+  cmsis_nn_dims filter_dims = {fc->accum_depth, 1, 1, fc->output_depth};
+  cmsis_nn_dims bias_dims = {1, 1, 1, fc->output_depth};
+  cmsis_nn_dims output_dims = {fc->batches, 1, 1, fc->output_depth};
+  std::vector<int8_t> expected(output->bytes);
+
+  const int input_size = input->bytes;
+  const int count = fc->inputs.size() / input_size;
+  std::vector<int> bins(count);
+  for (int n = 0; n < count; ++n) {
+    const int8_t* data = &fc->inputs[static_cast<size_t>(n) * input_size];
+    const int zeros = std::count(data, data + input_size,
+                                 static_cast<int8_t>(fc->input_zero_point));
+    bins[n] = std::min(kBins - 1, zeros * kBins / input_size);
+    ++fc->count[bins[n]];
+  }
+
+  for (int repeat = 0; repeat < kRepeats; ++repeat) {
+    for (int n = 0; n < count; ++n) {
+      memcpy(input->data.int8,
+             &fc->inputs[static_cast<size_t>(n) * input_size], input_size);
+
+      auto start = std::chrono::steady_clock::now();
+      if (interpreter.Invoke() != kTfLiteOk) return false;
+      auto middle = std::chrono::steady_clock::now();
+      arm_fully_connected_s8(&ctx, &fc_params, &quant_params, &input_dims,
+                             input->data.int8, &filter_dims, fc->filter,
+                             &bias_dims, fc->bias, &output_dims,
+                             expected.data());
+      auto end = std::chrono::steady_clock::now();
+      fc->kernel_us[bins[n]] += Microseconds(middle - start) / kRepeats;
+      fc->dense_us[bins[n]] += Microseconds(end - middle) / kRepeats;
+
+      if (repeat == 0) {
+        fc->mismatches +=
+            memcmp(output->data.int8, expected.data(), expected.size()) != 0;
+      }
+    }
+  }
+  return true;
+}
+
+void SetInput(tflite::MicroInterpreter* interpreter, const uint8_t* image) {
+  TfLiteTensor* input = interpreter->input(0);
+  const float scale = input->params.scale;
+  const int zero_point = input->params.zero_point;
+  for (int i = 0; i < kImageSize; ++i) {
+    const int q = static_cast<int>(std::lround(image[i] / 255.0f / scale)) +
+                  zero_point;
+    input->data.int8[i] = static_cast<int8_t>(std::min(std::max(q, -128), 127));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* model_path = nullptr;
+  const char* images_path = nullptr;
+  const char* labels_path = nullptr;
+  int count = 1000;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--images") == 0 && i + 1 < argc) {
+      images_path = argv[++i];
+    } else if (strcmp(argv[i], "--labels") == 0 && i + 1 < argc) {
+      labels_path = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else {
+      model_path = argv[i];
+    }
+  }
+  if (model_path == nullptr || count <= 0 ||
+      (images_path == nullptr) != (labels_path == nullptr)) {
+    fprintf(stderr,
+            "Usage: %s <model.tflite> [--images <idx3> --labels <idx1>] "
+            "[--count <n>]\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::vector<uint8_t> pixels;
+  if (images_path != nullptr) {
+    if (!LoadMnist(images_path, labels_path, count, &pixels)) {
+      fprintf(stderr, "Couldn't read the MNIST idx files\n");
+      return 1;
+    }
+  } else {
+    MakeStrokes(count, &pixels);
+  }
+  count = pixels.size() / kImageSize;
+
+  const std::vector<uint8_t> flatbuffer = LoadFile(model_path);
+  flatbuffers::Verifier verifier(flatbuffer.data(), flatbuffer.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", model_path);
+    return 1;
+  }
+  const tflite::Model* model = tflite::GetModel(flatbuffer.data());
+
+  std::vector<FullyConnected> fcs;
+  const auto* operators = model->subgraphs()->Get(0)->operators();
+  for (size_t i = 0; i < operators->size(); ++i) {
+    const auto* code =
+        model->operator_codes()->Get(operators->Get(i)->opcode_index());
+    if (std::max(code->builtin_code(),
+                 static_cast<tflite::BuiltinOperator>(
+                     code->deprecated_builtin_code())) !=
+        tflite::BuiltinOperator_FULLY_CONNECTED) {
+      continue;
+    }
+    FullyConnected fc;
+    if (Describe(*model, i, &fc)) {
+      fcs.push_back(fc);
+    }
+  }
+  if (fcs.empty()) {
+    fprintf(stderr, "%s has no int8 FULLY_CONNECTED op\n", model_path);
+    return 1;
+  }
+
+  // The same registrations as the firmware.
+  tflite::MicroMutableOpResolver<4> resolver;
+  resolver.AddConv2D();
+  resolver.AddMaxPool2D();
+  resolver.AddFullyConnected();
+  resolver.AddReshape();
+  std::vector<uint8_t> arena(kArenaSize);
+  // Every tensor is kept so that the inputs can be read between operators.
+  tflite::MicroInterpreter interpreter(model, resolver, arena.data(),
+                                       arena.size(), nullptr, nullptr,
+                                       /*preserve_all_tensors=*/true);
+  if (interpreter.AllocateTensors() != kTfLiteOk ||
+      interpreter.input(0)->bytes != kImageSize) {
+    fprintf(stderr, "%s: not a 28x28 int8 classifier\n", model_path);
+    return 1;
+  }
+
+  for (int n = 0; n < count; ++n) {
+    SetInput(&interpreter, &pixels[static_cast<size_t>(n) * kImageSize]);
+    bool done = false;
+    for (int op_index = 0; !done; ++op_index) {
+      for (auto& fc : fcs) {
+        if (fc.op_index != op_index) continue;
+        const int8_t* input =
+            interpreter.GetTensor(fc.input_tensor)->data.int8;
+        fc.inputs.insert(fc.inputs.end(), input,
+                         input + fc.batches * fc.accum_depth);
+      }
+      // InvokeStep with no budget runs exactly one operator.
+      if (interpreter.InvokeStep(0, &done) != kTfLiteOk) return 1;
+    }
+  }
+
+  printf("%d %s, times on the host\n", count,
+         images_path != nullptr ? "MNIST test images" : "random strokes");
+  bool exact = true;
+  for (auto& fc : fcs) {
+    if (!Measure(flatbuffer, &fc)) {
+      fprintf(stderr, "FULLY_CONNECTED op %d failed\n", fc.op_index);
+      return 1;
+    }
+    printf("\nFULLY_CONNECTED op %d, %d inputs x %d outputs, %d mismatches\n",
+           fc.op_index, fc.accum_depth, fc.output_depth, fc.mismatches);
+    printf("%-12s %10s %12s %12s %8s\n", "zero inputs", "inferences",
+           "kernel us", "dense us", "speedup");
+    double kernel_total = 0;
+    double dense_total = 0;
+    for (int bin = 0; bin < kBins; ++bin) {
+      if (fc.count[bin] == 0) continue;
+      printf("%3d%% - %3d%% %9.1f%% %12.3f %12.3f %7.2fx\n", bin * 100 / kBins,
+             (bin + 1) * 100 / kBins, 100.0 * fc.count[bin] / count,
+             fc.kernel_us[bin] / fc.count[bin],
+             fc.dense_us[bin] / fc.count[bin],
+             fc.dense_us[bin] / fc.kernel_us[bin]);
+      kernel_total += fc.kernel_us[bin];
+      dense_total += fc.dense_us[bin];
+    }
+    printf("%-12s %10s %12.3f %12.3f %7.2fx\n", "all", "",
+           kernel_total / count, dense_total / count,
+           dense_total / kernel_total);
+    exact &= fc.mismatches == 0;
+  }
+  return exact ? 0 : 1;
+}
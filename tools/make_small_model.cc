@@ -0,0 +1,694 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: trains and writes the small model of the classifier cascade
+// (tensorflow/lite/micro/micro_cascade.h). It takes the 28x28 input of the
+// full model, with the same quantization, and is
+//
+//   AVERAGE_POOL_2D 2x2 (14x14) -> CONV_2D 3x3, --channels filters, ReLU
+//   -> MAX_POOL_2D 2x2 -> RESHAPE -> FULLY_CONNECTED 10
+//
+// about 2% of the MACs of the full model. It is trained in float with SGD on
+// the MNIST idx files when given, otherwise on random pen strokes labelled by
+// the full model. The int8 model has per-channel CONV_2D and per-tensor
+// FULLY_CONNECTED weights and activation ranges calibrated on the training
+// set. Its accuracy, or agreement with the full model, is checked with TFLM
+// before it is written.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./make_small_model model_int8.tflite model_small.tflite
+//       [--images train-images-idx3-ubyte --labels train-labels-idx1-ubyte]
+//       [--count 20000] [--epochs 15] [--channels 8]
+//   xxd -i model_small.tflite > Inc/model_small.h
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kImageSide = 28;
+constexpr int kImageSize = kImageSide * kImageSide;
+constexpr int kPooledSide = kImageSide / 2;
+constexpr int kFilterSide = 3;
+constexpr int kConvSide = kPooledSide - kFilterSide + 1;
+constexpr int kFeatureSide = kConvSide / 2;
+constexpr int kNumberOfOutputs = 10;
+constexpr size_t kArenaSize = 256 * 1024;
+constexpr int kBatchSize = 32;
+constexpr float kLearningRate = 0.02f;
+constexpr float kMomentum = 0.9f;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+uint32_t ReadBigEndian(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) |
+         (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+// A batch of 28x28 grayscale images, 0 = background, with labels.
+struct Dataset {
+  std::vector<uint8_t> pixels;
+  std::vector<int> labels;
+  int count = 0;
+};
+
+bool LoadMnist(const char* images_path, const char* labels_path, int limit,
+               Dataset* dataset) {
+  const std::vector<uint8_t> images = LoadFile(images_path);
+  const std::vector<uint8_t> labels = LoadFile(labels_path);
+  if (images.size() < 16 || labels.size() < 8 ||
+      ReadBigEndian(&images[0]) != 0x803 || ReadBigEndian(&labels[0]) != 0x801 ||
+      ReadBigEndian(&images[8]) != kImageSide ||
+      ReadBigEndian(&images[12]) != kImageSide) {
+    return false;
+  }
+  const int count = std::min<int>(
+      std::min(ReadBigEndian(&images[4]), ReadBigEndian(&labels[4])), limit);
+  if (images.size() < 16 + static_cast<size_t>(count) * kImageSize ||
+      labels.size() < 8 + static_cast<size_t>(count)) {
+    return false;
+  }
+  dataset->count = count;
+  dataset->pixels.assign(images.begin() + 16,
+                         images.begin() + 16 + count * kImageSize);
+  dataset->labels.assign(labels.begin() + 8, labels.begin() + 8 + count);
+  return true;
+}
+
+// Random thick pen strokes, roughly what the touch screen produces.
+void MakeStrokes(int count, Dataset* dataset) {
+  std::mt19937 rng(1);
+  dataset->count = count;
+  dataset->pixels.assign(static_cast<size_t>(count) * kImageSize, 0);
+  for (int n = 0; n < count; ++n) {
+    uint8_t* image = &dataset->pixels[static_cast<size_t>(n) * kImageSize];
+    int x = 6 + rng() % 16;
+    int y = 6 + rng() % 16;
+    for (int step = 0; step < 80; ++step) {
+      x = std::min(std::max(x + static_cast<int>(rng() % 3) - 1, 1), 26);
+      y = std::min(std::max(y + static_cast<int>(rng() % 3) - 1, 1), 26);
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+          image[(y + dy) * kImageSide + x + dx] = 255;
+        }
+      }
+    }
+  }
+}
+
+// Runs an int8 28x28 classifier over the dataset, returns the top-1 classes.
+bool Classify(const uint8_t* flatbuffer, const Dataset& dataset,
+              std::vector<int>* classes) {
+  const tflite::Model* model = tflite::GetModel(flatbuffer);
+  tflite::MicroMutableOpResolver<5> resolver;
+  resolver.AddAveragePool2D();
+  resolver.AddConv2D();
+  resolver.AddMaxPool2D();
+  resolver.AddReshape();
+  resolver.AddFullyConnected();
+  std::vector<uint8_t> arena(kArenaSize);
+  tflite::MicroInterpreter interpreter(model, resolver, arena.data(),
+                                       arena.size());
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    return false;
+  }
+  TfLiteTensor* input = interpreter.input(0);
+  const TfLiteTensor* output = interpreter.output(0);
+  if (input->type != kTfLiteInt8 || input->bytes != kImageSize ||
+      output->type != kTfLiteInt8 || output->bytes != kNumberOfOutputs) {
+    return false;
+  }
+  classes->resize(dataset.count);
+  for (int n = 0; n < dataset.count; ++n) {
+    const uint8_t* image = &dataset.pixels[static_cast<size_t>(n) * kImageSize];
+    for (int i = 0; i < kImageSize; ++i) {
+      const int q = static_cast<int>(std::round(image[i] / 255.0f /
+                                                input->params.scale)) +
+                    input->params.zero_point;
+      input->data.int8[i] = static_cast<int8_t>(std::min(std::max(q, -128), 127));
+    }
+    if (interpreter.Invoke() != kTfLiteOk) {
+      return false;
+    }
+    (*classes)[n] = static_cast<int>(
+        std::max_element(output->data.int8,
+                         output->data.int8 + kNumberOfOutputs) -
+        output->data.int8);
+  }
+  return true;
+}
+
+// The float model and its activations for one image.
+struct Network {
+  int channels = 0;
+  std::vector<float> filter;  // [channels][3][3]
+  std::vector<float> filter_bias;
+  std::vector<float> weights;  // [10][6 * 6 * channels], HWC features
+  std::vector<float> weights_bias;
+
+  int features() const { return kFeatureSide * kFeatureSide * channels; }
+};
+
+struct Activations {
+  float pooled[kPooledSide * kPooledSide];
+  std::vector<float> conv;  // pre-ReLU, [12][12][channels]
+  std::vector<float> features;
+  std::vector<int> argmax;  // index into conv of each feature
+  float logits[kNumberOfOutputs];
+};
+
+void Forward(const Network& net, const uint8_t* image, Activations* act) {
+  for (int y = 0; y < kPooledSide; ++y) {
+    for (int x = 0; x < kPooledSide; ++x) {
+      const uint8_t* p = image + 2 * y * kImageSide + 2 * x;
+      act->pooled[y * kPooledSide + x] =
+          (p[0] + p[1] + p[kImageSide] + p[kImageSide + 1]) / (4 * 255.0f);
+    }
+  }
+  const int c_count = net.channels;
+  act->conv.resize(kConvSide * kConvSide * c_count);
+  for (int y = 0; y < kConvSide; ++y) {
+    for (int x = 0; x < kConvSide; ++x) {
+      for (int c = 0; c < c_count; ++c) {
+        float sum = net.filter_bias[c];
+        for (int fy = 0; fy < kFilterSide; ++fy) {
+          for (int fx = 0; fx < kFilterSide; ++fx) {
+            sum += net.filter[(c * kFilterSide + fy) * kFilterSide + fx] *
+                   act->pooled[(y + fy) * kPooledSide + x + fx];
+          }
+        }
+        act->conv[(y * kConvSide + x) * c_count + c] = sum;
+      }
+    }
+  }
+  act->features.resize(net.features());
+  act->argmax.resize(net.features());
+  for (int y = 0; y < kFeatureSide; ++y) {
+    for (int x = 0; x < kFeatureSide; ++x) {
+      for (int c = 0; c < c_count; ++c) {
+        int best = -1;
+        float value = 0.0f;  // ReLU
+        for (int dy = 0; dy < 2; ++dy) {
+          for (int dx = 0; dx < 2; ++dx) {
+            const int i =
+                ((2 * y + dy) * kConvSide + 2 * x + dx) * c_count + c;
+            if (act->conv[i] > value) {
+              value = act->conv[i];
+              best = i;
+            }
+          }
+        }
+        const int f = (y * kFeatureSide + x) * c_count + c;
+        act->features[f] = value;
+        act->argmax[f] = best;
+      }
+    }
+  }
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    float sum = net.weights_bias[o];
+    const float* row = &net.weights[o * net.features()];
+    for (int f = 0; f < net.features(); ++f) {
+      sum += row[f] * act->features[f];
+    }
+    act->logits[o] = sum;
+  }
+}
+
+// Adds the cross-entropy gradient of one image to `grad`.
+void Backward(const Network& net, const Activations& act, int label,
+              Network* grad) {
+  float max_logit = *std::max_element(act.logits, act.logits + kNumberOfOutputs);
+  float probs[kNumberOfOutputs];
+  float total = 0.0f;
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    probs[o] = std::exp(act.logits[o] - max_logit);
+    total += probs[o];
+  }
+  std::vector<float> feature_grad(net.features(), 0.0f);
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    const float d = probs[o] / total - (o == label ? 1.0f : 0.0f);
+    grad->weights_bias[o] += d;
+    const float* row = &net.weights[o * net.features()];
+    float* grad_row = &grad->weights[o * net.features()];
+    for (int f = 0; f < net.features(); ++f) {
+      grad_row[f] += d * act.features[f];
+      feature_grad[f] += d * row[f];
+    }
+  }
+  const int c_count = net.channels;
+  for (int f = 0; f < net.features(); ++f) {
+    if (act.argmax[f] < 0) {
+      continue;
+    }
+    const int i = act.argmax[f];
+    const int c = i % c_count;
+    const int x = (i / c_count) % kConvSide;
+    const int y = i / c_count / kConvSide;
+    grad->filter_bias[c] += feature_grad[f];
+    for (int fy = 0; fy < kFilterSide; ++fy) {
+      for (int fx = 0; fx < kFilterSide; ++fx) {
+        grad->filter[(c * kFilterSide + fy) * kFilterSide + fx] +=
+            feature_grad[f] * act.pooled[(y + fy) * kPooledSide + x + fx];
+      }
+    }
+  }
+}
+
+void Step(std::vector<float>* values, std::vector<float>* grads,
+          std::vector<float>* velocity, float scale) {
+  for (size_t i = 0; i < values->size(); ++i) {
+    (*velocity)[i] = kMomentum * (*velocity)[i] - scale * (*grads)[i];
+    (*values)[i] += (*velocity)[i];
+    (*grads)[i] = 0.0f;
+  }
+}
+
+void Train(const Dataset& dataset, const std::vector<int>& labels, int epochs,
+           Network* net) {
+  std::mt19937 rng(2);
+  const int c_count = net->channels;
+  std::normal_distribution<float> filter_init(
+      0.0f, std::sqrt(2.0f / (kFilterSide * kFilterSide)));
+  std::normal_distribution<float> weights_init(
+      0.0f, std::sqrt(1.0f / net->features()));
+  net->filter.resize(c_count * kFilterSide * kFilterSide);
+  for (float& w : net->filter) w = filter_init(rng);
+  net->filter_bias.assign(c_count, 0.0f);
+  net->weights.resize(kNumberOfOutputs * net->features());
+  for (float& w : net->weights) w = weights_init(rng);
+  net->weights_bias.assign(kNumberOfOutputs, 0.0f);
+
+  Network grad = *net;
+  Network velocity = *net;
+  for (Network* n : {&grad, &velocity}) {
+    std::fill(n->filter.begin(), n->filter.end(), 0.0f);
+    std::fill(n->filter_bias.begin(), n->filter_bias.end(), 0.0f);
+    std::fill(n->weights.begin(), n->weights.end(), 0.0f);
+    std::fill(n->weights_bias.begin(), n->weights_bias.end(), 0.0f);
+  }
+
+  std::vector<int> order(dataset.count);
+  for (int i = 0; i < dataset.count; ++i) order[i] = i;
+  Activations act;
+  for (int epoch = 0; epoch < epochs; ++epoch) {
+    std::shuffle(order.begin(), order.end(), rng);
+    // Step decay over the last third.
+    const float rate =
+        kLearningRate * (epoch >= epochs * 2 / 3 ? 0.1f : 1.0f) / kBatchSize;
+    int correct = 0;
+    for (int b = 0; b < dataset.count; b += kBatchSize) {
+      const int end = std::min(b + kBatchSize, dataset.count);
+      for (int i = b; i < end; ++i) {
+        const int n = order[i];
+        Forward(*net,
+                &dataset.pixels[static_cast<size_t>(n) * kImageSize], &act);
+        correct += std::max_element(act.logits, act.logits + kNumberOfOutputs) -
+                       act.logits ==
+                   labels[n];
+        Backward(*net, act, labels[n], &grad);
+      }
+      Step(&net->filter, &grad.filter, &velocity.filter, rate);
+      Step(&net->filter_bias, &grad.filter_bias, &velocity.filter_bias, rate);
+      Step(&net->weights, &grad.weights, &velocity.weights, rate);
+      Step(&net->weights_bias, &grad.weights_bias, &velocity.weights_bias,
+           rate);
+    }
+    printf("epoch %2d: %.2f%% of the training set\n", epoch + 1,
+           100.0 * correct / dataset.count);
+  }
+}
+
+// Activation ranges over the dataset: conv ReLU maximum and logit range.
+void Calibrate(const Network& net, const Dataset& dataset, float* conv_max,
+               float* logit_min, float* logit_max) {
+  Activations act;
+  *conv_max = 0.0f;
+  *logit_min = 0.0f;
+  *logit_max = 0.0f;
+  for (int n = 0; n < dataset.count; ++n) {
+    Forward(net, &dataset.pixels[static_cast<size_t>(n) * kImageSize], &act);
+    for (float v : act.features) *conv_max = std::max(*conv_max, v);
+    for (float v : act.logits) {
+      *logit_min = std::min(*logit_min, v);
+      *logit_max = std::max(*logit_max, v);
+    }
+  }
+}
+
+int8_t QuantizeToInt8(float value, float scale) {
+  return static_cast<int8_t>(
+      std::min(std::max(static_cast<int>(std::round(value / scale)), -127),
+               127));
+}
+
+std::unique_ptr<tflite::QuantizationParametersT> Quantization(
+    const std::vector<float>& scales, const std::vector<int64_t>& zero_points,
+    int dimension = 0) {
+  auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+  quantization->scale = scales;
+  quantization->zero_point = zero_points;
+  quantization->quantized_dimension = dimension;
+  return quantization;
+}
+
+class ModelWriter {
+ public:
+  ModelWriter() : model_(std::make_unique<tflite::ModelT>()) {
+    model_->version = 3;
+    model_->description = "tools/make_small_model.cc";
+    model_->buffers.push_back(std::make_unique<tflite::BufferT>());
+    model_->subgraphs.push_back(std::make_unique<tflite::SubGraphT>());
+  }
+
+  int AddTensor(const char* name, tflite::TensorType type,
+                const std::vector<int32_t>& shape,
+                std::unique_ptr<tflite::QuantizationParametersT> quantization,
+                const void* data = nullptr, size_t bytes = 0) {
+    auto tensor = std::make_unique<tflite::TensorT>();
+    tensor->name = name;
+    tensor->type = type;
+    tensor->shape = shape;
+    tensor->quantization = std::move(quantization);
+    if (data != nullptr) {
+      auto buffer = std::make_unique<tflite::BufferT>();
+      const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+      buffer->data.assign(bytes_data, bytes_data + bytes);
+      tensor->buffer = model_->buffers.size();
+      model_->buffers.push_back(std::move(buffer));
+    }
+    subgraph()->tensors.push_back(std::move(tensor));
+    return subgraph()->tensors.size() - 1;
+  }
+
+  tflite::OperatorT* AddOperator(tflite::BuiltinOperator code, int version,
+                                 const std::vector<int32_t>& inputs,
+                                 int output) {
+    uint32_t index = 0;
+    while (index < model_->operator_codes.size() &&
+           model_->operator_codes[index]->builtin_code != code) {
+      ++index;
+    }
+    if (index == model_->operator_codes.size()) {
+      auto opcode = std::make_unique<tflite::OperatorCodeT>();
+      opcode->builtin_code = code;
+      opcode->deprecated_builtin_code = static_cast<int8_t>(code);
+      opcode->version = version;
+      model_->operator_codes.push_back(std::move(opcode));
+    }
+    auto op = std::make_unique<tflite::OperatorT>();
+    op->opcode_index = index;
+    op->inputs = inputs;
+    op->outputs = {output};
+    subgraph()->operators.push_back(std::move(op));
+    return subgraph()->operators.back().get();
+  }
+
+  std::vector<uint8_t> Finish(int input, int output) {
+    subgraph()->inputs = {input};
+    subgraph()->outputs = {output};
+    subgraph()->name = "main";
+    // The vendored flatbuffers has no implicit default allocator.
+    flatbuffers::DefaultAllocator allocator;
+    flatbuffers::FlatBufferBuilder builder(1024, &allocator);
+    tflite::FinishModelBuffer(builder,
+                              tflite::Model::Pack(builder, model_.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(),
+                                builder.GetBufferPointer() + builder.GetSize());
+  }
+
+ private:
+  tflite::SubGraphT* subgraph() { return model_->subgraphs[0].get(); }
+
+  std::unique_ptr<tflite::ModelT> model_;
+};
+
+tflite::Pool2DOptionsT PoolOptions() {
+  tflite::Pool2DOptionsT options;
+  options.padding = tflite::Padding_VALID;
+  options.stride_w = 2;
+  options.stride_h = 2;
+  options.filter_width = 2;
+  options.filter_height = 2;
+  options.fused_activation_function = tflite::ActivationFunctionType_NONE;
+  return options;
+}
+
+std::vector<uint8_t> BuildModel(const Network& net, float input_scale,
+                                int input_zero_point, float conv_max,
+                                float logit_min, float logit_max) {
+  const int c_count = net.channels;
+  const float conv_scale = conv_max / 255.0f;
+  const float logit_scale = (logit_max - logit_min) / 255.0f;
+  const int logit_zero_point = std::min(
+      std::max(static_cast<int>(std::round(-128 - logit_min / logit_scale)),
+               -128),
+      127);
+  ModelWriter writer;
+
+  const int input = writer.AddTensor(
+      "input", tflite::TensorType_INT8, {1, kImageSide, kImageSide, 1},
+      Quantization({input_scale}, {input_zero_point}));
+  // Averaging keeps the input quantization.
+  const int pooled = writer.AddTensor(
+      "average_pool", tflite::TensorType_INT8,
+      {1, kPooledSide, kPooledSide, 1},
+      Quantization({input_scale}, {input_zero_point}));
+  writer.AddOperator(tflite::BuiltinOperator_AVERAGE_POOL_2D, 2, {input},
+                     pooled)
+      ->builtin_options.Set(PoolOptions());
+
+  std::vector<int8_t> filter(net.filter.size());
+  std::vector<int32_t> filter_bias(c_count);
+  std::vector<float> filter_scales(c_count);
+  std::vector<float> filter_bias_scales(c_count);
+  const int taps = kFilterSide * kFilterSide;
+  for (int c = 0; c < c_count; ++c) {
+    float max_abs = 1e-6f;
+    for (int t = 0; t < taps; ++t) {
+      max_abs = std::max(max_abs, std::fabs(net.filter[c * taps + t]));
+    }
+    filter_scales[c] = max_abs / 127.0f;
+    filter_bias_scales[c] = input_scale * filter_scales[c];
+    for (int t = 0; t < taps; ++t) {
+      filter[c * taps + t] =
+          QuantizeToInt8(net.filter[c * taps + t], filter_scales[c]);
+    }
+    filter_bias[c] = static_cast<int32_t>(
+        std::round(net.filter_bias[c] / filter_bias_scales[c]));
+  }
+  const int filter_tensor = writer.AddTensor(
+      "conv/filter", tflite::TensorType_INT8,
+      {c_count, kFilterSide, kFilterSide, 1},
+      Quantization(filter_scales, std::vector<int64_t>(c_count, 0)),
+      filter.data(), filter.size());
+  const int filter_bias_tensor = writer.AddTensor(
+      "conv/bias", tflite::TensorType_INT32, {c_count},
+      Quantization(filter_bias_scales, std::vector<int64_t>(c_count, 0)),
+      filter_bias.data(), filter_bias.size() * sizeof(int32_t));
+  const int conv = writer.AddTensor(
+      "conv", tflite::TensorType_INT8, {1, kConvSide, kConvSide, c_count},
+      Quantization({conv_scale}, {-128}));
+  tflite::Conv2DOptionsT conv_options;
+  conv_options.padding = tflite::Padding_VALID;
+  conv_options.stride_w = 1;
+  conv_options.stride_h = 1;
+  conv_options.fused_activation_function = tflite::ActivationFunctionType_RELU;
+  writer.AddOperator(tflite::BuiltinOperator_CONV_2D, 3,
+                     {pooled, filter_tensor, filter_bias_tensor}, conv)
+      ->builtin_options.Set(conv_options);
+
+  const int max_pool = writer.AddTensor(
+      "max_pool", tflite::TensorType_INT8,
+      {1, kFeatureSide, kFeatureSide, c_count},
+      Quantization({conv_scale}, {-128}));
+  writer.AddOperator(tflite::BuiltinOperator_MAX_POOL_2D, 2, {conv}, max_pool)
+      ->builtin_options.Set(PoolOptions());
+
+  const int32_t new_shape[2] = {1, net.features()};
+  const int shape =
+      writer.AddTensor("flatten/shape", tflite::TensorType_INT32, {2}, nullptr,
+                       new_shape, sizeof(new_shape));
+  const int flatten = writer.AddTensor(
+      "flatten", tflite::TensorType_INT8, {1, net.features()},
+      Quantization({conv_scale}, {-128}));
+  writer.AddOperator(tflite::BuiltinOperator_RESHAPE, 1, {max_pool, shape},
+                     flatten);
+
+  float max_abs = 1e-6f;
+  for (float w : net.weights) max_abs = std::max(max_abs, std::fabs(w));
+  const float weights_scale = max_abs / 127.0f;
+  const float weights_bias_scale = conv_scale * weights_scale;
+  std::vector<int8_t> weights(net.weights.size());
+  for (size_t i = 0; i < weights.size(); ++i) {
+    weights[i] = QuantizeToInt8(net.weights[i], weights_scale);
+  }
+  std::vector<int32_t> weights_bias(kNumberOfOutputs);
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    weights_bias[o] = static_cast<int32_t>(
+        std::round(net.weights_bias[o] / weights_bias_scale));
+  }
+  const int weights_tensor = writer.AddTensor(
+      "dense/weights", tflite::TensorType_INT8,
+      {kNumberOfOutputs, net.features()},
+      Quantization({weights_scale}, {0}), weights.data(), weights.size());
+  const int weights_bias_tensor = writer.AddTensor(
+      "dense/bias", tflite::TensorType_INT32, {kNumberOfOutputs},
+      Quantization({weights_bias_scale}, {0}), weights_bias.data(),
+      weights_bias.size() * sizeof(int32_t));
+  const int output = writer.AddTensor(
+      "logits", tflite::TensorType_INT8, {1, kNumberOfOutputs},
+      Quantization({logit_scale}, {logit_zero_point}));
+  tflite::FullyConnectedOptionsT dense_options;
+  dense_options.fused_activation_function =
+      tflite::ActivationFunctionType_NONE;
+  writer.AddOperator(tflite::BuiltinOperator_FULLY_CONNECTED, 4,
+                     {flatten, weights_tensor, weights_bias_tensor}, output)
+      ->builtin_options.Set(dense_options);
+
+  return writer.Finish(input, output);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* paths[2] = {nullptr, nullptr};
+  int path_count = 0;
+  const char* images_path = nullptr;
+  const char* labels_path = nullptr;
+  int count = 20000;
+  int epochs = 15;
+  int channels = 8;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--images") == 0 && i + 1 < argc) {
+      images_path = argv[++i];
+    } else if (strcmp(argv[i], "--labels") == 0 && i + 1 < argc) {
+      labels_path = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--epochs") == 0 && i + 1 < argc) {
+      epochs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--channels") == 0 && i + 1 < argc) {
+      channels = atoi(argv[++i]);
+    } else if (path_count < 2) {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (path_count != 2 || count < 1 || epochs < 1 || channels < 1) {
+    fprintf(stderr,
+            "Usage: %s model_int8.tflite model_small.tflite\n"
+            "  [--images idx3 --labels idx1] [--count 20000] [--epochs 15]\n"
+            "  [--channels 8]\n",
+            argv[0]);
+    return 1;
+  }
+
+  const std::vector<uint8_t> full = LoadFile(paths[0]);
+  flatbuffers::Verifier verifier(full.data(), full.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", paths[0]);
+    return 1;
+  }
+  // The input quantization of the full model, shared by the small one.
+  const tflite::Model* full_model = tflite::GetModel(full.data());
+  const tflite::SubGraph* full_subgraph = full_model->subgraphs()->Get(0);
+  const tflite::QuantizationParameters* input_quantization =
+      full_subgraph->tensors()
+          ->Get(full_subgraph->inputs()->Get(0))
+          ->quantization();
+  if (input_quantization == nullptr || input_quantization->scale() == nullptr ||
+      input_quantization->scale()->size() != 1) {
+    fprintf(stderr, "%s: input is not int8 quantized\n", paths[0]);
+    return 1;
+  }
+  const float input_scale = input_quantization->scale()->Get(0);
+  const int input_zero_point = input_quantization->zero_point()->Get(0);
+
+  Dataset dataset;
+  if (images_path != nullptr && labels_path != nullptr) {
+    if (!LoadMnist(images_path, labels_path, count, &dataset)) {
+      fprintf(stderr, "Couldn't read the MNIST idx files\n");
+      return 1;
+    }
+  } else {
+    MakeStrokes(count, &dataset);
+  }
+  std::vector<int> full_classes;
+  if (!Classify(full.data(), dataset, &full_classes)) {
+    fprintf(stderr, "%s: not a 28x28 int8 classifier\n", paths[0]);
+    return 1;
+  }
+  const bool labelled = !dataset.labels.empty();
+  const std::vector<int>& labels = labelled ? dataset.labels : full_classes;
+  printf("%d %s images, trained on %s\n", dataset.count,
+         labelled ? "MNIST" : "stroke",
+         labelled ? "the labels" : "the full model classes");
+
+  Network net;
+  net.channels = channels;
+  Train(dataset, labels, epochs, &net);
+
+  float conv_max = 0.0f;
+  float logit_min = 0.0f;
+  float logit_max = 0.0f;
+  Calibrate(net, dataset, &conv_max, &logit_min, &logit_max);
+  const std::vector<uint8_t> small =
+      BuildModel(net, input_scale, input_zero_point, conv_max, logit_min,
+                 logit_max);
+
+  std::vector<int> small_classes;
+  if (!Classify(small.data(), dataset, &small_classes)) {
+    fprintf(stderr, "The small model does not run\n");
+    return 1;
+  }
+  int correct = 0;
+  int agree = 0;
+  for (int n = 0; n < dataset.count; ++n) {
+    correct += small_classes[n] == labels[n];
+    agree += small_classes[n] == full_classes[n];
+  }
+  printf("int8 small model: %.2f%% %s, %.2f%% agreement with the full model\n",
+         100.0 * correct / dataset.count, labelled ? "accuracy" : "of labels",
+         100.0 * agree / dataset.count);
+  printf("%zu bytes, %d MACs\n", small.size(),
+         kConvSide * kConvSide * channels * kFilterSide * kFilterSide +
+             net.features() * kNumberOfOutputs);
+
+  std::ofstream out(paths[1], std::ios::binary);
+  out.write(reinterpret_cast<const char*>(small.data()), small.size());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", paths[1]);
+    return 1;
+  }
+  return 0;
+}
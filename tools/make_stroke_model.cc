@@ -0,0 +1,823 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: trains and writes the stroke model of MODEL_STROKE in main.cc,
+// a recognizer that reads the touch points as they come instead of the
+// finished drawing. Its input is one timestep of Src/stroke_sequence.c, the
+// pen move and pen state, and it is
+//
+//   UNIDIRECTIONAL_SEQUENCE_LSTM --units, batch 1, time 1
+//   -> FULLY_CONNECTED 10
+//
+// with the LSTM hidden and cell state in variable tensors, so that they stay
+// in the arena from one Invoke() to the next and Reset() starts a new
+// drawing. The logits after the end step of a stroke are the prediction.
+//
+// There is no online handwriting data set here, so it is trained on random
+// pen strokes in the firmware's window geometry, labelled by the full model
+// on their Src/stroke.c rasterization: it learns to agree with the full
+// model. Training is in float, with backpropagation through time over whole
+// drawings and Adam. The int8 model has the 8x8->16 LSTM quantization of
+// the CMSIS-NN kernel: per-tensor int8 weights, int16 cell state with a
+// power of two scale, gate inputs in Q3.12. Its agreement with the full
+// model, on the training drawings and on drawings it has not seen, is
+// checked with TFLM before it is written.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and Src/stroke.c and
+// Src/stroke_sequence.c (-IInc), and run:
+//   ./make_stroke_model model_int8.tflite model_stroke.tflite
+//       [--count 20000] [--test 2000] [--epochs 20] [--units 64]
+//   xxd -i model_stroke.tflite > Inc/model_stroke.h
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "stroke.h"
+#include "stroke_sequence.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+// The firmware's working window and pen, as in tools/stroke_equivalence.cc.
+constexpr int kLcdWidth = 240;
+constexpr int kLcdHeight = 320;
+constexpr int kWindowX = 67;
+constexpr int kWindowY = 6;
+constexpr int kWorkingSide = 160;
+constexpr int kPencil = 4;
+constexpr int kMinX = 67 + kPencil + 1;
+constexpr int kMaxX = kLcdWidth - (7 + kPencil) - 1;
+constexpr int kMinY = 7 + kPencil + 1;
+constexpr int kMaxY = kLcdHeight - (155 + kPencil) - 1;
+constexpr uint32_t kPenColor = 0xFFFF0000;
+
+constexpr int kImageSide = 28;
+constexpr int kImageSize = kImageSide * kImageSide;
+constexpr int kFeatures = STROKE_SEQ_FEATURES;
+constexpr int kGates = 4;  // input, forget, cell, output: the TFLM order
+constexpr int kNumberOfOutputs = 10;
+constexpr size_t kArenaSize = 256 * 1024;
+
+// The steps are int8 with this scale and zero point 0.
+constexpr float kInputScale = 1.0f / 128.0f;
+// The hidden state is in (-1, 1).
+constexpr float kHiddenScale = 1.0f / 128.0f;
+// Fixed by the integer LSTM: gate inputs in Q3.12.
+constexpr float kGateScale = 1.0f / 4096.0f;
+
+constexpr int kBatchSize = 32;
+constexpr float kLearningRate = 0.003f;
+constexpr float kBeta1 = 0.9f;
+constexpr float kBeta2 = 0.999f;
+constexpr float kEpsilon = 1e-8f;
+constexpr float kClipNorm = 5.0f;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+struct Point {
+  int x;
+  int y;
+};
+
+// One to three strokes of touch samples a few pixels apart, as in
+// tools/stroke_equivalence.cc.
+std::vector<std::vector<Point>> MakeDrawing(std::mt19937* rng) {
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::vector<std::vector<Point>> drawing(1 + (*rng)() % 3);
+  for (std::vector<Point>& stroke : drawing) {
+    float x = kMinX + 20 + unit(*rng) * (kMaxX - kMinX - 40);
+    float y = kMinY + 20 + unit(*rng) * (kMaxY - kMinY - 40);
+    float angle = unit(*rng) * 6.2832f;
+    const int count = 1 + (*rng)() % 60;
+    for (int i = 0; i < count; ++i) {
+      stroke.push_back({static_cast<int>(x), static_cast<int>(y)});
+      angle += (unit(*rng) - 0.5f) * 1.2f;
+      const float step = 1.0f + unit(*rng) * 7.0f;
+      x = std::min(std::max(x + step * std::cos(angle), float{kMinX}),
+                   float{kMaxX});
+      y = std::min(std::max(y + step * std::sin(angle), float{kMinY}),
+                   float{kMaxY});
+    }
+  }
+  return drawing;
+}
+
+// Drawings as the firmware sees them: the steps check_touch feeds the stroke
+// model and the 28x28 input the full model gets from stroke_rasterize.
+struct Dataset {
+  std::vector<std::vector<int8_t>> steps;  // [drawing][step * kFeatures]
+  std::vector<int8_t> images;
+  int count = 0;
+};
+
+void MakeDataset(int count, uint32_t seed, int32_t zero_point,
+                 Dataset* dataset) {
+  std::mt19937 rng(seed);
+  dataset->count = count;
+  dataset->steps.resize(count);
+  dataset->images.resize(static_cast<size_t>(count) * kImageSize);
+  int8_t steps[STROKE_SEQ_MAX_STEPS * STROKE_SEQ_FEATURES];
+  for (int n = 0; n < count; ++n) {
+    std::vector<int8_t>& sequence = dataset->steps[n];
+    stroke_clear();
+    stroke_seq_clear();
+    for (const std::vector<Point>& stroke : MakeDrawing(&rng)) {
+      uint32_t step_count = stroke_seq_start(stroke[0].x, stroke[0].y, steps);
+      sequence.insert(sequence.end(), steps, steps + step_count * kFeatures);
+      stroke_start(stroke[0].x, stroke[0].y, kPenColor);
+      for (size_t i = 1; i < stroke.size(); ++i) {
+        step_count = stroke_seq_continue(stroke[i].x, stroke[i].y, steps);
+        sequence.insert(sequence.end(), steps, steps + step_count * kFeatures);
+        stroke_continue(stroke[i].x, stroke[i].y);
+      }
+      step_count = stroke_seq_end(steps);
+      sequence.insert(sequence.end(), steps, steps + step_count * kFeatures);
+    }
+    stroke_rasterize(&dataset->images[static_cast<size_t>(n) * kImageSize],
+                     kImageSide, kImageSide, zero_point);
+  }
+}
+
+// The zero point of the full model's input, which stroke_rasterize offsets
+// the gray levels by.
+int32_t InputZeroPoint(const tflite::Model* model) {
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  const tflite::QuantizationParameters* quantization =
+      subgraph->tensors()->Get(subgraph->inputs()->Get(0))->quantization();
+  if (quantization == nullptr || quantization->zero_point() == nullptr ||
+      quantization->zero_point()->size() == 0) {
+    return 0;
+  }
+  return static_cast<int32_t>(quantization->zero_point()->Get(0));
+}
+
+template <typename T>
+int TopClass(const T* logits) {
+  return static_cast<int>(std::max_element(logits, logits + kNumberOfOutputs) -
+                          logits);
+}
+
+// The full model's classes of the rasterized drawings.
+bool ClassifyImages(const uint8_t* flatbuffer, const Dataset& dataset,
+                    std::vector<int>* classes) {
+  tflite::MicroMutableOpResolver<4> resolver;
+  resolver.AddConv2D();
+  resolver.AddMaxPool2D();
+  resolver.AddReshape();
+  resolver.AddFullyConnected();
+  std::vector<uint8_t> arena(kArenaSize);
+  tflite::MicroInterpreter interpreter(tflite::GetModel(flatbuffer), resolver,
+                                       arena.data(), arena.size());
+  if (interpreter.AllocateTensors() != kTfLiteOk ||
+      interpreter.input(0)->bytes != kImageSize ||
+      interpreter.output(0)->bytes != kNumberOfOutputs) {
+    return false;
+  }
+  classes->resize(dataset.count);
+  for (int n = 0; n < dataset.count; ++n) {
+    memcpy(interpreter.input(0)->data.int8,
+           &dataset.images[static_cast<size_t>(n) * kImageSize], kImageSize);
+    if (interpreter.Invoke() != kTfLiteOk) {
+      return false;
+    }
+    (*classes)[n] = TopClass(interpreter.output(0)->data.int8);
+  }
+  return true;
+}
+
+// The stroke model's classes: every drawing from a Reset() interpreter, one
+// Invoke() per step, the logits after the last one.
+bool ClassifySequences(const uint8_t* flatbuffer, const Dataset& dataset,
+                       std::vector<int>* classes, size_t* arena_used) {
+  tflite::MicroMutableOpResolver<2> resolver;
+  resolver.AddUnidirectionalSequenceLSTM();
+  resolver.AddFullyConnected();
+  std::vector<uint8_t> arena(kArenaSize);
+  tflite::MicroInterpreter interpreter(tflite::GetModel(flatbuffer), resolver,
+                                       arena.data(), arena.size());
+  if (interpreter.AllocateTensors() != kTfLiteOk ||
+      interpreter.input(0)->bytes != kFeatures ||
+      interpreter.output(0)->bytes != kNumberOfOutputs) {
+    return false;
+  }
+  *arena_used = interpreter.arena_used_bytes();
+  classes->resize(dataset.count);
+  for (int n = 0; n < dataset.count; ++n) {
+    if (interpreter.Reset() != kTfLiteOk) {
+      return false;
+    }
+    const std::vector<int8_t>& sequence = dataset.steps[n];
+    for (size_t step = 0; step < sequence.size(); step += kFeatures) {
+      memcpy(interpreter.input(0)->data.int8, &sequence[step], kFeatures);
+      if (interpreter.Invoke() != kTfLiteOk) {
+        return false;
+      }
+    }
+    (*classes)[n] = TopClass(interpreter.output(0)->data.int8);
+  }
+  return true;
+}
+
+// The float model, all parameters in one vector for the optimizer.
+struct Network {
+  int units = 0;
+  std::vector<float> values;
+
+  size_t input_weights(int gate) const {  // [units][kFeatures]
+    return static_cast<size_t>(gate) * units * kFeatures;
+  }
+  size_t recurrent_weights(int gate) const {  // [units][units]
+    return input_weights(kGates) + static_cast<size_t>(gate) * units * units;
+  }
+  size_t gate_bias(int gate) const {
+    return recurrent_weights(kGates) + static_cast<size_t>(gate) * units;
+  }
+  size_t dense_weights() const { return gate_bias(kGates); }  // [10][units]
+  size_t dense_bias() const { return dense_weights() + kNumberOfOutputs * units; }
+  size_t size() const { return dense_bias() + kNumberOfOutputs; }
+
+  const float* at(size_t offset) const { return &values[offset]; }
+  float* at(size_t offset) { return &values[offset]; }
+};
+
+// Activations of every step of a drawing, [step][units].
+struct Trace {
+  std::vector<float> gates[kGates];  // after the sigmoid or tanh
+  std::vector<float> cell;
+  std::vector<float> hidden;
+  float logits[kNumberOfOutputs];
+};
+
+float Sigmoid(float x) { return 1.0f / (1.0f + std::exp(-x)); }
+
+void Forward(const Network& net, const std::vector<int8_t>& sequence,
+             Trace* trace) {
+  const int units = net.units;
+  const int steps = sequence.size() / kFeatures;
+  for (int g = 0; g < kGates; ++g) {
+    trace->gates[g].resize(static_cast<size_t>(steps) * units);
+  }
+  trace->cell.resize(static_cast<size_t>(steps) * units);
+  trace->hidden.resize(static_cast<size_t>(steps) * units);
+  std::vector<float> zero(units, 0.0f);
+  for (int t = 0; t < steps; ++t) {
+    float x[kFeatures];
+    for (int f = 0; f < kFeatures; ++f) {
+      x[f] = sequence[t * kFeatures + f] * kInputScale;
+    }
+    const float* h_prev = t > 0 ? &trace->hidden[(t - 1) * units] : zero.data();
+    const float* c_prev = t > 0 ? &trace->cell[(t - 1) * units] : zero.data();
+    for (int g = 0; g < kGates; ++g) {
+      const float* w = net.at(net.input_weights(g));
+      const float* u = net.at(net.recurrent_weights(g));
+      const float* b = net.at(net.gate_bias(g));
+      float* out = &trace->gates[g][t * units];
+      for (int j = 0; j < units; ++j) {
+        float sum = b[j];
+        for (int f = 0; f < kFeatures; ++f) sum += w[j * kFeatures + f] * x[f];
+        for (int k = 0; k < units; ++k) sum += u[j * units + k] * h_prev[k];
+        out[j] = g == 2 ? std::tanh(sum) : Sigmoid(sum);
+      }
+    }
+    for (int j = 0; j < units; ++j) {
+      const int i = t * units + j;
+      trace->cell[i] = trace->gates[1][i] * c_prev[j] +
+                       trace->gates[0][i] * trace->gates[2][i];
+      trace->hidden[i] = trace->gates[3][i] * std::tanh(trace->cell[i]);
+    }
+  }
+  const float* h = &trace->hidden[(steps - 1) * units];
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    float sum = net.at(net.dense_bias())[o];
+    const float* row = net.at(net.dense_weights() + o * units);
+    for (int j = 0; j < units; ++j) sum += row[j] * h[j];
+    trace->logits[o] = sum;
+  }
+}
+
+// Adds the cross-entropy gradient of the last step to `grad`, through time.
+void Backward(const Network& net, const std::vector<int8_t>& sequence,
+              const Trace& trace, int label, Network* grad) {
+  const int units = net.units;
+  const int steps = sequence.size() / kFeatures;
+  const float max_logit =
+      *std::max_element(trace.logits, trace.logits + kNumberOfOutputs);
+  float probs[kNumberOfOutputs];
+  float total = 0.0f;
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    probs[o] = std::exp(trace.logits[o] - max_logit);
+    total += probs[o];
+  }
+  std::vector<float> dh(units, 0.0f);
+  std::vector<float> dc(units, 0.0f);
+  const float* h_last = &trace.hidden[(steps - 1) * units];
+  for (int o = 0; o < kNumberOfOutputs; ++o) {
+    const float d = probs[o] / total - (o == label ? 1.0f : 0.0f);
+    grad->at(grad->dense_bias())[o] += d;
+    const float* row = net.at(net.dense_weights() + o * units);
+    float* grad_row = grad->at(grad->dense_weights() + o * units);
+    for (int j = 0; j < units; ++j) {
+      grad_row[j] += d * h_last[j];
+      dh[j] += d * row[j];
+    }
+  }
+
+  std::vector<float> dz(static_cast<size_t>(kGates) * units);
+  std::vector<float> dh_prev(units);
+  for (int t = steps - 1; t >= 0; --t) {
+    const int base = t * units;
+    for (int j = 0; j < units; ++j) {
+      const float i = trace.gates[0][base + j];
+      const float f = trace.gates[1][base + j];
+      const float g = trace.gates[2][base + j];
+      const float o = trace.gates[3][base + j];
+      const float tanh_c = std::tanh(trace.cell[base + j]);
+      const float c_prev = t > 0 ? trace.cell[base - units + j] : 0.0f;
+      dc[j] += dh[j] * o * (1.0f - tanh_c * tanh_c);
+      dz[0 * units + j] = dc[j] * g * i * (1.0f - i);
+      dz[1 * units + j] = dc[j] * c_prev * f * (1.0f - f);
+      dz[2 * units + j] = dc[j] * i * (1.0f - g * g);
+      dz[3 * units + j] = dh[j] * tanh_c * o * (1.0f - o);
+      dc[j] *= f;
+    }
+    float x[kFeatures];
+    for (int f = 0; f < kFeatures; ++f) {
+      x[f] = sequence[t * kFeatures + f] * kInputScale;
+    }
+    std::fill(dh_prev.begin(), dh_prev.end(), 0.0f);
+    for (int g = 0; g < kGates; ++g) {
+      const float* u = net.at(net.recurrent_weights(g));
+      float* grad_w = grad->at(grad->input_weights(g));
+      float* grad_u = grad->at(grad->recurrent_weights(g));
+      float* grad_b = grad->at(grad->gate_bias(g));
+      for (int j = 0; j < units; ++j) {
+        const float d = dz[g * units + j];
+        grad_b[j] += d;
+        for (int f = 0; f < kFeatures; ++f) grad_w[j * kFeatures + f] += d * x[f];
+        if (t == 0) {
+          continue;  // the initial state is zero
+        }
+        const float* h_prev = &trace.hidden[base - units];
+        for (int k = 0; k < units; ++k) {
+          grad_u[j * units + k] += d * h_prev[k];
+          dh_prev[k] += d * u[j * units + k];
+        }
+      }
+    }
+    dh.swap(dh_prev);
+  }
+}
+
+void Train(const Dataset& dataset, const std::vector<int>& labels, int epochs,
+           Network* net) {
+  std::mt19937 rng(2);
+  const int units = net->units;
+  net->values.assign(net->size(), 0.0f);
+  std::normal_distribution<float> input_init(0.0f, 1.0f);
+  std::normal_distribution<float> recurrent_init(0.0f,
+                                                 std::sqrt(1.0f / units));
+  for (int g = 0; g < kGates; ++g) {
+    float* w = net->at(net->input_weights(g));
+    for (int i = 0; i < units * kFeatures; ++i) w[i] = input_init(rng);
+    float* u = net->at(net->recurrent_weights(g));
+    for (int i = 0; i < units * units; ++i) u[i] = recurrent_init(rng);
+  }
+  // Remember by default.
+  std::fill(net->at(net->gate_bias(1)), net->at(net->gate_bias(2)), 1.0f);
+  float* dense = net->at(net->dense_weights());
+  for (int i = 0; i < kNumberOfOutputs * units; ++i) {
+    dense[i] = recurrent_init(rng);
+  }
+
+  Network grad = *net;
+  std::vector<float> m(net->size(), 0.0f);
+  std::vector<float> v(net->size(), 0.0f);
+  std::fill(grad.values.begin(), grad.values.end(), 0.0f);
+
+  std::vector<int> order(dataset.count);
+  for (int i = 0; i < dataset.count; ++i) order[i] = i;
+  Trace trace;
+  int updates = 0;
+  for (int epoch = 0; epoch < epochs; ++epoch) {
+    std::shuffle(order.begin(), order.end(), rng);
+    // Step decay over the last third.
+    const float rate = kLearningRate * (epoch >= epochs * 2 / 3 ? 0.1f : 1.0f);
+    int correct = 0;
+    for (int b = 0; b < dataset.count; b += kBatchSize) {
+      const int end = std::min(b + kBatchSize, dataset.count);
+      for (int i = b; i < end; ++i) {
+        const int n = order[i];
+        Forward(*net, dataset.steps[n], &trace);
+        correct += TopClass(trace.logits) == labels[n];
+        Backward(*net, dataset.steps[n], trace, labels[n], &grad);
+      }
+      // Long drawings can blow the gradient up, its norm is clipped.
+      double norm = 0.0;
+      for (float& g : grad.values) {
+        g /= end - b;
+        norm += static_cast<double>(g) * g;
+      }
+      const float clip =
+          norm > kClipNorm * kClipNorm ? kClipNorm / std::sqrt(norm) : 1.0f;
+      ++updates;
+      const float correction1 = 1.0f - std::pow(kBeta1, updates);
+      const float correction2 = 1.0f - std::pow(kBeta2, updates);
+      for (size_t i = 0; i < net->values.size(); ++i) {
+        const float g = grad.values[i] * clip;
+        m[i] = kBeta1 * m[i] + (1.0f - kBeta1) * g;
+        v[i] = kBeta2 * v[i] + (1.0f - kBeta2) * g * g;
+        net->values[i] -= rate * (m[i] / correction1) /
+                          (std::sqrt(v[i] / correction2) + kEpsilon);
+        grad.values[i] = 0.0f;
+      }
+    }
+    printf("epoch %2d: %.2f%% of the training set\n", epoch + 1,
+           100.0 * correct / dataset.count);
+  }
+}
+
+// Ranges over the dataset: largest cell state magnitude, logit range.
+void Calibrate(const Network& net, const Dataset& dataset, float* cell_max,
+               float* logit_min, float* logit_max) {
+  Trace trace;
+  *cell_max = 0.0f;
+  *logit_min = 0.0f;
+  *logit_max = 0.0f;
+  for (int n = 0; n < dataset.count; ++n) {
+    Forward(net, dataset.steps[n], &trace);
+    for (float c : trace.cell) *cell_max = std::max(*cell_max, std::fabs(c));
+    for (float l : trace.logits) {
+      *logit_min = std::min(*logit_min, l);
+      *logit_max = std::max(*logit_max, l);
+    }
+  }
+}
+
+int8_t QuantizeToInt8(float value, float scale) {
+  return static_cast<int8_t>(
+      std::min(std::max(static_cast<int>(std::round(value / scale)), -127),
+               127));
+}
+
+std::unique_ptr<tflite::QuantizationParametersT> Quantization(
+    const std::vector<float>& scales, const std::vector<int64_t>& zero_points) {
+  auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+  quantization->scale = scales;
+  quantization->zero_point = zero_points;
+  return quantization;
+}
+
+class ModelWriter {
+ public:
+  ModelWriter() : model_(std::make_unique<tflite::ModelT>()) {
+    model_->version = 3;
+    model_->description = "tools/make_stroke_model.cc";
+    model_->buffers.push_back(std::make_unique<tflite::BufferT>());
+    model_->subgraphs.push_back(std::make_unique<tflite::SubGraphT>());
+  }
+
+  int AddTensor(const char* name, tflite::TensorType type,
+                const std::vector<int32_t>& shape,
+                std::unique_ptr<tflite::QuantizationParametersT> quantization,
+                const void* data = nullptr, size_t bytes = 0) {
+    auto tensor = std::make_unique<tflite::TensorT>();
+    tensor->name = name;
+    tensor->type = type;
+    tensor->shape = shape;
+    tensor->quantization = std::move(quantization);
+    if (data != nullptr) {
+      auto buffer = std::make_unique<tflite::BufferT>();
+      const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+      buffer->data.assign(bytes_data, bytes_data + bytes);
+      tensor->buffer = model_->buffers.size();
+      model_->buffers.push_back(std::move(buffer));
+    }
+    subgraph()->tensors.push_back(std::move(tensor));
+    return subgraph()->tensors.size() - 1;
+  }
+
+  // A tensor the interpreter keeps from one Invoke() to the next.
+  int AddVariable(const char* name, tflite::TensorType type,
+                  const std::vector<int32_t>& shape,
+                  std::unique_ptr<tflite::QuantizationParametersT> quantization) {
+    const int index = AddTensor(name, type, shape, std::move(quantization));
+    subgraph()->tensors[index]->is_variable = true;
+    return index;
+  }
+
+  tflite::OperatorT* AddOperator(tflite::BuiltinOperator code, int version,
+                                 const std::vector<int32_t>& inputs,
+                                 int output) {
+    uint32_t index = 0;
+    while (index < model_->operator_codes.size() &&
+           model_->operator_codes[index]->builtin_code != code) {
+      ++index;
+    }
+    if (index == model_->operator_codes.size()) {
+      auto opcode = std::make_unique<tflite::OperatorCodeT>();
+      opcode->builtin_code = code;
+      opcode->deprecated_builtin_code = static_cast<int8_t>(code);
+      opcode->version = version;
+      model_->operator_codes.push_back(std::move(opcode));
+    }
+    auto op = std::make_unique<tflite::OperatorT>();
+    op->opcode_index = index;
+    op->inputs = inputs;
+    op->outputs = {output};
+    subgraph()->operators.push_back(std::move(op));
+    return subgraph()->operators.back().get();
+  }
+
+  std::vector<uint8_t> Finish(int input, int output) {
+    subgraph()->inputs = {input};
+    subgraph()->outputs = {output};
+    subgraph()->name = "main";
+    // The vendored flatbuffers has no implicit default allocator.
+    flatbuffers::DefaultAllocator allocator;
+    flatbuffers::FlatBufferBuilder builder(1024, &allocator);
+    tflite::FinishModelBuffer(builder,
+                              tflite::Model::Pack(builder, model_.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(),
+                                builder.GetBufferPointer() + builder.GetSize());
+  }
+
+ private:
+  tflite::SubGraphT* subgraph() { return model_->subgraphs[0].get(); }
+
+  std::unique_ptr<tflite::ModelT> model_;
+};
+
+// A per-tensor int8 weight matrix and, for the input weights, the int32 bias
+// of its gate at the accumulator scale.
+int AddWeights(ModelWriter* writer, const char* name, const float* values,
+               int rows, int cols, float* scale) {
+  float max_abs = 1e-6f;
+  for (int i = 0; i < rows * cols; ++i) {
+    max_abs = std::max(max_abs, std::fabs(values[i]));
+  }
+  *scale = max_abs / 127.0f;
+  std::vector<int8_t> weights(rows * cols);
+  for (int i = 0; i < rows * cols; ++i) {
+    weights[i] = QuantizeToInt8(values[i], *scale);
+  }
+  return writer->AddTensor(name, tflite::TensorType_INT8, {rows, cols},
+                           Quantization({*scale}, {0}), weights.data(),
+                           weights.size());
+}
+
+int AddBias(ModelWriter* writer, const char* name, const float* values,
+            int size, float scale) {
+  std::vector<int32_t> bias(size);
+  for (int i = 0; i < size; ++i) {
+    bias[i] = static_cast<int32_t>(std::round(values[i] / scale));
+  }
+  return writer->AddTensor(name, tflite::TensorType_INT32, {size},
+                           Quantization({scale}, {0}), bias.data(),
+                           bias.size() * sizeof(int32_t));
+}
+
+std::vector<uint8_t> BuildModel(const Network& net, int cell_shift,
+                                float logit_min, float logit_max) {
+  static const char* const kGateNames[kGates] = {"input", "forget", "cell",
+                                                 "output"};
+  const int units = net.units;
+  const float logit_scale = (logit_max - logit_min) / 255.0f;
+  const int logit_zero_point = std::min(
+      std::max(static_cast<int>(std::round(-128 - logit_min / logit_scale)),
+               -128),
+      127);
+  ModelWriter writer;
+  char name[64];
+
+  const int input = writer.AddTensor("steps", tflite::TensorType_INT8,
+                                     {1, 1, kFeatures},
+                                     Quantization({kInputScale}, {0}));
+  int input_weights[kGates];
+  int recurrent_weights[kGates];
+  int biases[kGates];
+  for (int g = 0; g < kGates; ++g) {
+    float scale = 0.0f;
+    snprintf(name, sizeof(name), "lstm/input_to_%s", kGateNames[g]);
+    input_weights[g] = AddWeights(&writer, name, net.at(net.input_weights(g)),
+                                  units, kFeatures, &scale);
+    snprintf(name, sizeof(name), "lstm/%s_bias", kGateNames[g]);
+    biases[g] = AddBias(&writer, name, net.at(net.gate_bias(g)), units,
+                        scale * kInputScale);
+    snprintf(name, sizeof(name), "lstm/recurrent_to_%s", kGateNames[g]);
+    recurrent_weights[g] = AddWeights(
+        &writer, name, net.at(net.recurrent_weights(g)), units, units, &scale);
+  }
+  const int output_state = writer.AddVariable(
+      "lstm/output_state", tflite::TensorType_INT8, {1, units},
+      Quantization({kHiddenScale}, {0}));
+  const int cell_state = writer.AddVariable(
+      "lstm/cell_state", tflite::TensorType_INT16, {1, units},
+      Quantization({std::ldexp(1.0f, -cell_shift)}, {0}));
+  // The gate inputs and the hidden state, only their quantization is read.
+  std::vector<int32_t> intermediates;
+  for (int g = 0; g < kGates; ++g) {
+    snprintf(name, sizeof(name), "lstm/%s_gate", kGateNames[g]);
+    intermediates.push_back(writer.AddTensor(name, tflite::TensorType_INT16,
+                                             {0},
+                                             Quantization({kGateScale}, {0})));
+  }
+  intermediates.push_back(writer.AddTensor("lstm/hidden",
+                                           tflite::TensorType_INT8, {0},
+                                           Quantization({kHiddenScale}, {0})));
+  const int hidden = writer.AddTensor("lstm", tflite::TensorType_INT8,
+                                      {1, 1, units},
+                                      Quantization({kHiddenScale}, {0}));
+  tflite::UnidirectionalSequenceLSTMOptionsT lstm_options;
+  lstm_options.fused_activation_function = tflite::ActivationFunctionType_TANH;
+  lstm_options.time_major = false;
+  // No peephole (9-11), projection (16-17) or layer norm (20-23) tensors.
+  tflite::OperatorT* lstm = writer.AddOperator(
+      tflite::BuiltinOperator_UNIDIRECTIONAL_SEQUENCE_LSTM, 1,
+      {input, input_weights[0], input_weights[1], input_weights[2],
+       input_weights[3], recurrent_weights[0], recurrent_weights[1],
+       recurrent_weights[2], recurrent_weights[3], -1, -1, -1, biases[0],
+       biases[1], biases[2], biases[3], -1, -1, output_state, cell_state, -1,
+       -1, -1, -1},
+      hidden);
+  lstm->builtin_options.Set(lstm_options);
+  lstm->intermediates = intermediates;
+
+  float dense_scale = 0.0f;
+  const int dense_weights =
+      AddWeights(&writer, "dense/weights", net.at(net.dense_weights()),
+                 kNumberOfOutputs, units, &dense_scale);
+  const int dense_bias =
+      AddBias(&writer, "dense/bias", net.at(net.dense_bias()),
+              kNumberOfOutputs, dense_scale * kHiddenScale);
+  const int output = writer.AddTensor(
+      "logits", tflite::TensorType_INT8, {1, kNumberOfOutputs},
+      Quantization({logit_scale}, {logit_zero_point}));
+  tflite::FullyConnectedOptionsT dense_options;
+  dense_options.fused_activation_function =
+      tflite::ActivationFunctionType_NONE;
+  writer.AddOperator(tflite::BuiltinOperator_FULLY_CONNECTED, 4,
+                     {hidden, dense_weights, dense_bias}, output)
+      ->builtin_options.Set(dense_options);
+
+  return writer.Finish(input, output);
+}
+
+int Agreement(const std::vector<int>& a, const std::vector<int>& b) {
+  int same = 0;
+  for (size_t i = 0; i < a.size(); ++i) same += a[i] == b[i];
+  return same;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* paths[2] = {nullptr, nullptr};
+  int path_count = 0;
+  int count = 20000;
+  int test_count = 2000;
+  int epochs = 20;
+  int units = 64;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--test") == 0 && i + 1 < argc) {
+      test_count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--epochs") == 0 && i + 1 < argc) {
+      epochs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--units") == 0 && i + 1 < argc) {
+      units = atoi(argv[++i]);
+    } else if (path_count < 2) {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (path_count != 2 || count < 1 || test_count < 1 || epochs < 1 ||
+      units < 1) {
+    fprintf(stderr,
+            "Usage: %s model_int8.tflite model_stroke.tflite\n"
+            "  [--count 20000] [--test 2000] [--epochs 20] [--units 64]\n",
+            argv[0]);
+    return 1;
+  }
+
+  const std::vector<uint8_t> full = LoadFile(paths[0]);
+  flatbuffers::Verifier verifier(full.data(), full.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", paths[0]);
+    return 1;
+  }
+
+  // The firmware's geometry: stroke_init in main.cc, the pen starts at the
+  // window center.
+  stroke_init(kPencil, kWindowX, kWindowY, kWorkingSide, kWorkingSide);
+  stroke_seq_init(kWindowX + kWorkingSide / 2, kWindowY + kWorkingSide / 2);
+  Dataset train;
+  Dataset test;
+  const int32_t zero_point = InputZeroPoint(tflite::GetModel(full.data()));
+  MakeDataset(count, 1, zero_point, &train);
+  MakeDataset(test_count, 3, zero_point, &test);
+  std::vector<int> train_labels;
+  std::vector<int> test_labels;
+  if (!ClassifyImages(full.data(), train, &train_labels) ||
+      !ClassifyImages(full.data(), test, &test_labels)) {
+    fprintf(stderr, "%s: not a 28x28 int8 classifier\n", paths[0]);
+    return 1;
+  }
+  size_t total_steps = 0;
+  size_t max_steps = 0;
+  for (const std::vector<int8_t>& sequence : train.steps) {
+    total_steps += sequence.size() / kFeatures;
+    max_steps = std::max(max_steps, sequence.size() / kFeatures);
+  }
+  printf("%d training and %d test drawings, %.1f steps on average, %zu at "
+         "most, labelled by the full model\n",
+         train.count, test.count, static_cast<double>(total_steps) / count,
+         max_steps);
+
+  Network net;
+  net.units = units;
+  Train(train, train_labels, epochs, &net);
+
+  Trace trace;
+  int float_correct = 0;
+  std::vector<int> float_classes(test.count);
+  for (int n = 0; n < test.count; ++n) {
+    Forward(net, test.steps[n], &trace);
+    float_classes[n] = TopClass(trace.logits);
+    float_correct += float_classes[n] == test_labels[n];
+  }
+  printf("float stroke model: %.2f%% agreement with the full model on the "
+         "test drawings\n",
+         100.0 * float_correct / test.count);
+
+  float cell_max = 0.0f;
+  float logit_min = 0.0f;
+  float logit_max = 0.0f;
+  Calibrate(net, train, &cell_max, &logit_min, &logit_max);
+  // The finest power of two scale that holds the cell state, the kernel
+  // takes 2^-9 at most.
+  int cell_shift = 15;
+  while (cell_shift > 9 && std::ldexp(32767.0f, -cell_shift) < cell_max) {
+    --cell_shift;
+  }
+  printf("cell state up to %.2f, scale 2^-%d\n", cell_max, cell_shift);
+  const std::vector<uint8_t> stroke_model =
+      BuildModel(net, cell_shift, logit_min, logit_max);
+
+  std::vector<int> train_classes;
+  std::vector<int> test_classes;
+  size_t arena_used = 0;
+  if (!ClassifySequences(stroke_model.data(), train, &train_classes,
+                         &arena_used) ||
+      !ClassifySequences(stroke_model.data(), test, &test_classes,
+                         &arena_used)) {
+    fprintf(stderr, "The stroke model does not run\n");
+    return 1;
+  }
+  printf("int8 stroke model: %.2f%% agreement with the full model on the "
+         "training drawings, %.2f%% on the test drawings, %.2f%% with the "
+         "float model\n",
+         100.0 * Agreement(train_classes, train_labels) / train.count,
+         100.0 * Agreement(test_classes, test_labels) / test.count,
+         100.0 * Agreement(test_classes, float_classes) / test.count);
+  printf("%zu bytes, %d MACs per step, %zu arena bytes on this host\n",
+         stroke_model.size(),
+         kGates * units * (kFeatures + units) + units * kNumberOfOutputs,
+         arena_used);
+
+  std::ofstream out(paths[1], std::ios::binary);
+  out.write(reinterpret_cast<const char*>(stroke_model.data()),
+            stroke_model.size());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", paths[1]);
+    return 1;
+  }
+  return 0;
+}
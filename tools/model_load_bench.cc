@@ -0,0 +1,248 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: times the model sources of Src/model_source.c with a model
+// file. For each source it measures:
+//  - load: the source, the flatbuffer check a file needs before it is
+//    trusted, and GetModel;
+//  - first inference: the interpreter, AllocateTensors and the first Invoke;
+//  - the Invoke calls after it.
+// The array source is the file read once beforehand, as the firmware's array
+// sits in flash from reset. The outputs of every source must match the
+// array's. GetModel reads the model in place for all of them, so only the
+// arena is allocated per run.
+//
+// The file is in the page cache after the first run. --cold drops it before
+// each file and mmap load (posix_fadvise), which makes the mmap pages fault
+// in during the first inference instead of during the load.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and Src/model_source.c compiled with
+// -DMODEL_SOURCE_HOST=1 (-IInc), and run:
+//   ./model_load_bench model_int8.tflite [--runs 20] [--cold]
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "model_source.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 256 * 1024;
+constexpr uint32_t kFileCapacity = 16 * 1024 * 1024;
+constexpr int kSteadyInvokes = 10;
+
+using Clock = std::chrono::steady_clock;
+
+double MicrosecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(Clock::now() - start)
+      .count();
+}
+
+struct Timing {
+  double load = 0;
+  double first = 0;
+  double steady = 0;
+};
+
+struct Summary {
+  Timing mean;
+  Timing min;
+  bool outputs_match = true;
+  bool loaded = true;
+};
+
+// The operators of every model variant the firmware can be built with.
+using Resolver = tflite::MicroMutableOpResolver<10>;
+
+void RegisterOps(Resolver* resolver) {
+  resolver->AddConv2D();
+  resolver->AddFullyConnected();
+  resolver->AddMaxPool2D();
+  resolver->AddAveragePool2D();
+  resolver->AddReshape();
+  resolver->AddPatchStage();
+  resolver->AddResizeBilinear();
+  resolver->AddPackedConv2D();
+  resolver->AddPackedFullyConnected();
+}
+
+void DropFromPageCache(const char* path) {
+  const int fd = open(path, O_RDONLY);
+  if (fd >= 0) {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+}
+
+bool Load(uint32_t kind, const char* path, const uint8_t* array,
+          uint32_t array_size, uint8_t* file_buffer, model_source_t* source) {
+  switch (kind) {
+    case MODEL_SOURCE_ARRAY:
+      return model_source_array(source, array, array_size);
+    case MODEL_SOURCE_FILE:
+      return model_source_file(source, path, file_buffer, kFileCapacity);
+    default:
+      return model_source_mmap(source, path);
+  }
+}
+
+// The first inference and the steady state. `output` gets the output of the
+// first inference.
+bool RunInterpreter(const tflite::Model* model, uint8_t* arena,
+                    const Resolver& resolver, Timing* timing,
+                    std::vector<int8_t>* output) {
+  Clock::time_point start = Clock::now();
+  tflite::MicroInterpreter interpreter(model, resolver, arena, kArenaSize);
+  if (interpreter.AllocateTensors() != kTfLiteOk) return false;
+  TfLiteTensor* input = interpreter.input(0);
+  for (size_t i = 0; i < input->bytes; ++i) {
+    input->data.int8[i] = static_cast<int8_t>((i * 37) % 256 - 128);
+  }
+  if (interpreter.Invoke() != kTfLiteOk) return false;
+  timing->first = MicrosecondsSince(start);
+
+  const TfLiteTensor* result = interpreter.output(0);
+  output->assign(result->data.int8, result->data.int8 + result->bytes);
+
+  start = Clock::now();
+  for (int i = 0; i < kSteadyInvokes; ++i) {
+    interpreter.Invoke();
+  }
+  timing->steady = MicrosecondsSince(start) / kSteadyInvokes;
+  return true;
+}
+
+// One load, first inference and steady state.
+bool Run(uint32_t kind, const char* path, const uint8_t* array,
+         uint32_t array_size, uint8_t* file_buffer, uint8_t* arena,
+         const Resolver& resolver, Timing* timing,
+         std::vector<int8_t>* output) {
+  Clock::time_point start = Clock::now();
+  model_source_t source;
+  if (!Load(kind, path, array, array_size, file_buffer, &source)) {
+    return false;
+  }
+  if (kind != MODEL_SOURCE_ARRAY) {
+    flatbuffers::Verifier verifier(source.data, source.size);
+    if (!tflite::VerifyModelBuffer(verifier)) {
+      model_source_close(&source);
+      return false;
+    }
+  }
+  const tflite::Model* model = tflite::GetModel(source.data);
+  timing->load = MicrosecondsSince(start);
+
+  // The interpreter reads the model until it is destroyed, so it goes first.
+  const bool ran = RunInterpreter(model, arena, resolver, timing, output);
+  model_source_close(&source);
+  return ran;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* path = nullptr;
+  int runs = 20;
+  bool cold = false;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+      runs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--cold") == 0) {
+      cold = true;
+    } else {
+      path = argv[i];
+    }
+  }
+  if (path == nullptr || runs <= 0) {
+    fprintf(stderr, "Usage: %s <model.tflite> [--runs <n>] [--cold]\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::ifstream in(path, std::ios::binary);
+  const std::vector<uint8_t> contents((std::istreambuf_iterator<char>(in)),
+                                      std::istreambuf_iterator<char>());
+  if (contents.empty() || contents.size() > kFileCapacity) {
+    fprintf(stderr, "Couldn't read %s\n", path);
+    return 1;
+  }
+  // The flatbuffer needs MODEL_SOURCE_ALIGNMENT, more than std::vector gives.
+  uint8_t* array = static_cast<uint8_t*>(
+      aligned_alloc(MODEL_SOURCE_ALIGNMENT, kFileCapacity));
+  std::copy(contents.begin(), contents.end(), array);
+  uint8_t* file_buffer = static_cast<uint8_t*>(
+      aligned_alloc(MODEL_SOURCE_ALIGNMENT, kFileCapacity));
+  uint8_t* arena =
+      static_cast<uint8_t*>(aligned_alloc(MODEL_SOURCE_ALIGNMENT, kArenaSize));
+  Resolver resolver;
+  RegisterOps(&resolver);
+
+  std::vector<int8_t> reference;
+  printf("%s, %zu bytes, %d runs%s\n", path, contents.size(), runs,
+         cold ? ", cold page cache" : "");
+  int status = 0;
+  for (uint32_t kind = 0; kind < MODEL_SOURCES; ++kind) {
+    Summary summary;
+    summary.min.load = summary.min.first = summary.min.steady = 1e30;
+    for (int run = 0; run < runs && summary.loaded; ++run) {
+      if (cold && kind != MODEL_SOURCE_ARRAY) DropFromPageCache(path);
+      Timing timing;
+      std::vector<int8_t> output;
+      if (!Run(kind, path, array, contents.size(), file_buffer, arena,
+               resolver, &timing, &output)) {
+        summary.loaded = false;
+        break;
+      }
+      if (reference.empty()) reference = output;
+      summary.outputs_match &= output == reference;
+      summary.mean.load += timing.load / runs;
+      summary.mean.first += timing.first / runs;
+      summary.mean.steady += timing.steady / runs;
+      summary.min.load = std::min(summary.min.load, timing.load);
+      summary.min.first = std::min(summary.min.first, timing.first);
+      summary.min.steady = std::min(summary.min.steady, timing.steady);
+    }
+    if (!summary.loaded) {
+      printf("%-5s failed to load or run\n", model_source_name(kind));
+      status = 1;
+      continue;
+    }
+    printf(
+        "%-5s load %8.1f us (min %8.1f), first inference %8.1f us "
+        "(min %8.1f), then %8.1f us (min %8.1f)%s\n",
+        model_source_name(kind), summary.mean.load, summary.min.load,
+        summary.mean.first, summary.min.first, summary.mean.steady,
+        summary.min.steady, summary.outputs_match ? "" : ", OUTPUT DIFFERS");
+    if (!summary.outputs_match) status = 1;
+  }
+  free(arena);
+  free(file_buffer);
+  free(array);
+  return status;
+}
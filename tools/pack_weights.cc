@@ -0,0 +1,287 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: rewrites the int8 CONV_2D and FULLY_CONNECTED ops of a model to
+// the PackedConv2D / PackedFullyConnected custom ops, with the filters stored
+// in the order their inner loops read them, see
+// tensorflow/lite/micro/kernels/packed_weights.h for the format.
+//
+// Conv filters are pre-widened to int16: every weight is read once per two
+// output pixels, so dropping the SXTB16 pays for the doubled size. Fully
+// connected weights are read once per inference and stay int8, where
+// widening would only double the flash reads. --widen all / none overrides
+// this. A size report is printed per tensor.
+//
+// Build and run on the host:
+//   g++ -std=c++17 -O2 -Itensorflow-lite
+//     -Itensorflow-lite/third_party/flatbuffers/include
+//     tools/pack_weights.cc -o pack_weights
+//   ./pack_weights model_int8.tflite model_packed.tflite
+//   xxd -i model_packed.tflite | sed '1s/^unsigned/alignas(16) const unsigned/'
+//     > Inc/model_packed.h
+// The alignas keeps the 16 byte alignment of the buffers in the flatbuffer,
+// so every packed group is a word aligned load.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kGroupSize = 4;
+
+// Order of the weights of a group in a pre-widened filter. It is the order in
+// which SXTB16 and SXTB16 ROR #8 take the bytes of a word.
+constexpr int kWidenedOrder[kGroupSize] = {0, 2, 1, 3};
+
+enum class Widen { kConv, kAll, kNone };
+
+int PackedDepth(int depth) {
+  return (depth + kGroupSize - 1) / kGroupSize * kGroupSize;
+}
+
+// Appends group `group` of `row`, zero padded past `depth`.
+template <typename T>
+void AppendGroup(const int8_t* weights, int row, int depth, int group,
+                 std::vector<T>* packed) {
+  for (int i = 0; i < kGroupSize; ++i) {
+    const int column =
+        group * kGroupSize + (sizeof(T) == 1 ? i : kWidenedOrder[i]);
+    packed->push_back(column < depth ? weights[row * depth + column] : 0);
+  }
+}
+
+// Packs `rows` x `depth` int8 weights: row pairs interleaved group by group,
+// and an odd last row on its own.
+template <typename T>
+std::vector<uint8_t> Pack(const int8_t* weights, int rows, int depth) {
+  const int groups = PackedDepth(depth) / kGroupSize;
+  std::vector<T> packed;
+  int row = 0;
+  for (; row + 1 < rows; row += 2) {
+    for (int group = 0; group < groups; ++group) {
+      AppendGroup(weights, row, depth, group, &packed);
+      AppendGroup(weights, row + 1, depth, group, &packed);
+    }
+  }
+  if (row < rows) {
+    for (int group = 0; group < groups; ++group) {
+      AppendGroup(weights, row, depth, group, &packed);
+    }
+  }
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(packed.data());
+  return std::vector<uint8_t>(bytes, bytes + packed.size() * sizeof(T));
+}
+
+tflite::BuiltinOperator GetBuiltinCode(const tflite::OperatorCodeT& code) {
+  // The deprecated field is saturated at 127 for newer builtins.
+  return std::max(
+      code.builtin_code,
+      static_cast<tflite::BuiltinOperator>(code.deprecated_builtin_code));
+}
+
+uint32_t GetOrAddCustomCode(tflite::ModelT* model, const std::string& name) {
+  for (size_t i = 0; i < model->operator_codes.size(); ++i) {
+    if (model->operator_codes[i]->custom_code == name) {
+      return i;
+    }
+  }
+  auto code = std::make_unique<tflite::OperatorCodeT>();
+  code->builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->deprecated_builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->custom_code = name;
+  model->operator_codes.push_back(std::move(code));
+  return model->operator_codes.size() - 1;
+}
+
+std::vector<uint8_t> BuildOptions(const tflite::OperatorT& op,
+                                  tflite::BuiltinOperator builtin,
+                                  const std::vector<int32_t>& filter_shape) {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    if (builtin == tflite::BuiltinOperator_CONV_2D) {
+      const auto* options = op.builtin_options.AsConv2DOptions();
+      fbb.Int("dilation_h_factor", options->dilation_h_factor);
+      fbb.Int("dilation_w_factor", options->dilation_w_factor);
+      fbb.Int("filter_height", filter_shape[1]);
+      fbb.Int("filter_width", filter_shape[2]);
+      fbb.Int("fused_activation_function", options->fused_activation_function);
+      fbb.Int("padding", options->padding);
+      fbb.Int("stride_h", options->stride_h);
+      fbb.Int("stride_w", options->stride_w);
+    } else {
+      const auto* options = op.builtin_options.AsFullyConnectedOptions();
+      fbb.Int("fused_activation_function", options->fused_activation_function);
+    }
+  });
+  fbb.Finish();
+  return fbb.GetBuffer();
+}
+
+// Number of operators reading `tensor`.
+int ConsumerCount(const tflite::SubGraphT& subgraph, int32_t tensor) {
+  int count = 0;
+  for (const auto& op : subgraph.operators) {
+    count += std::count(op->inputs.begin(), op->inputs.end(), tensor);
+  }
+  return count;
+}
+
+// Rewrites `op` if its filter can be packed. Returns the number of bytes
+// added.
+long PackOp(tflite::ModelT* model, tflite::SubGraphT* subgraph,
+            tflite::OperatorT* op, Widen widen) {
+  const tflite::BuiltinOperator builtin =
+      GetBuiltinCode(*model->operator_codes[op->opcode_index]);
+  if (builtin != tflite::BuiltinOperator_CONV_2D &&
+      builtin != tflite::BuiltinOperator_FULLY_CONNECTED) {
+    return 0;
+  }
+  if (op->inputs.size() < 2) return 0;
+  tflite::TensorT* input = subgraph->tensors[op->inputs[0]].get();
+  tflite::TensorT* filter = subgraph->tensors[op->inputs[1]].get();
+  std::vector<uint8_t>& filter_data = model->buffers[filter->buffer]->data;
+  if (input->type != tflite::TensorType_INT8 ||
+      filter->type != tflite::TensorType_INT8 || filter_data.empty() ||
+      filter->quantization == nullptr) {
+    return 0;
+  }
+  for (int64_t zero_point : filter->quantization->zero_point) {
+    if (zero_point != 0) return 0;
+  }
+  if (builtin == tflite::BuiltinOperator_FULLY_CONNECTED &&
+      (filter->shape.size() != 2 ||
+       op->builtin_options.AsFullyConnectedOptions()->weights_format !=
+           tflite::FullyConnectedOptionsWeightsFormat_DEFAULT)) {
+    return 0;
+  }
+  if (builtin == tflite::BuiltinOperator_CONV_2D && filter->shape.size() != 4) {
+    return 0;
+  }
+  // The filter is packed in place, so it must not be shared.
+  if (ConsumerCount(*subgraph, op->inputs[1]) != 1) {
+    printf("%-60s shared, skipped\n", filter->name.c_str());
+    return 0;
+  }
+
+  const int rows = filter->shape[0];
+  const int total = static_cast<int>(filter_data.size());
+  const int depth = total / rows;
+  const bool widened =
+      widen == Widen::kAll ||
+      (widen == Widen::kConv && builtin == tflite::BuiltinOperator_CONV_2D);
+  const int8_t* weights = reinterpret_cast<const int8_t*>(filter_data.data());
+  std::vector<uint8_t> packed = widened ? Pack<int16_t>(weights, rows, depth)
+                                        : Pack<int8_t>(weights, rows, depth);
+  printf("%-60s %6d -> %6zu bytes, [%d, %d] %s\n", filter->name.c_str(), total,
+         packed.size(), rows, PackedDepth(depth),
+         widened ? "int16" : "int8");
+
+  const std::vector<int32_t> filter_shape = filter->shape;
+  filter->type =
+      widened ? tflite::TensorType_INT16 : tflite::TensorType_INT8;
+  filter->shape = {rows, PackedDepth(depth)};
+  filter->shape_signature.clear();
+  filter->quantization->quantized_dimension = 0;
+  filter_data = packed;
+
+  const int32_t bias_index = op->inputs.size() > 2 ? op->inputs[2] : -1;
+  op->custom_options = BuildOptions(*op, builtin, filter_shape);
+  op->custom_options_format = tflite::CustomOptionsFormat_FLEXBUFFERS;
+  op->builtin_options.Reset();
+  op->opcode_index = GetOrAddCustomCode(
+      model, builtin == tflite::BuiltinOperator_CONV_2D
+                 ? "PackedConv2D"
+                 : "PackedFullyConnected");
+  op->inputs = {op->inputs[0], op->inputs[1], bias_index};
+  return static_cast<long>(packed.size()) - total;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Widen widen = Widen::kConv;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--widen") == 0 && i + 1 < argc) {
+      const char* value = argv[++i];
+      if (strcmp(value, "conv") == 0) {
+        widen = Widen::kConv;
+      } else if (strcmp(value, "all") == 0) {
+        widen = Widen::kAll;
+      } else if (strcmp(value, "none") == 0) {
+        widen = Widen::kNone;
+      } else {
+        paths.clear();
+        break;
+      }
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.size() != 2) {
+    fprintf(stderr,
+            "Usage: %s [--widen conv|all|none] <input.tflite> "
+            "<output.tflite>\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::ifstream in(paths[0], std::ios::binary);
+  if (!in) {
+    fprintf(stderr, "Couldn't open %s\n", paths[0]);
+    return 1;
+  }
+  const std::vector<char> input((std::istreambuf_iterator<char>(in)),
+                                std::istreambuf_iterator<char>());
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(input.data()),
+                                 input.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", paths[0]);
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(input.data());
+
+  long added = 0;
+  for (auto& subgraph : model->subgraphs) {
+    for (auto& op : subgraph->operators) {
+      added += PackOp(model.get(), subgraph.get(), op.get(), widen);
+    }
+  }
+
+  // The vendored flatbuffers has no implicit default allocator.
+  flatbuffers::DefaultAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(input.size(), &allocator);
+  tflite::FinishModelBuffer(fbb, tflite::Model::Pack(fbb, model.get()));
+  std::ofstream out(paths[1], std::ios::binary);
+  out.write(reinterpret_cast<const char*>(fbb.GetBufferPointer()),
+            fbb.GetSize());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", paths[1]);
+    return 1;
+  }
+  printf("weights: %ld bytes added, model: %zu -> %u bytes\n", added,
+         input.size(), fbb.GetSize());
+  return 0;
+}
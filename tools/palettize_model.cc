@@ -0,0 +1,308 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: rewrites the int8 CONV_2D and FULLY_CONNECTED ops of a model to
+// the PalettizedConv2D / PalettizedFullyConnected custom ops, see
+// tensorflow/lite/micro/kernels/palettized.h for the format.
+//
+// Every output channel gets its own 16 entry palette, chosen by an optimal
+// 1-D k-means over the channel's int8 weights, so channels with at most 16
+// distinct values are encoded losslessly. Filters that would not get smaller
+// are left untouched. A size and weight error report is printed per tensor.
+//
+// Build and run on the host:
+//   g++ -std=c++17 -O2 -Itensorflow-lite
+//     -Itensorflow-lite/third_party/flatbuffers/include
+//     tools/palettize_model.cc -o palettize_model
+//   ./palettize_model model_int8.tflite model_palettized.tflite
+//   xxd -i model_palettized.tflite > Inc/model_palettized.h
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kPaletteSize = 16;
+
+struct ChannelPalette {
+  int8_t values[kPaletteSize];
+  uint8_t index_of[256];  // Palette index of every int8 value + 128.
+};
+
+// Squared error of replacing the values of histogram bins [first, last] with
+// their rounded mean, which is also returned in `centroid`.
+double BinsCost(const std::vector<double>& count, const std::vector<double>& sum,
+                const std::vector<double>& sum_sq, int first, int last,
+                int* centroid) {
+  const double n = count[last + 1] - count[first];
+  if (n == 0) {
+    *centroid = first - 128;
+    return 0;
+  }
+  const double s = sum[last + 1] - sum[first];
+  const double s2 = sum_sq[last + 1] - sum_sq[first];
+  const int c = static_cast<int>(std::lround(s / n));
+  *centroid = c;
+  return s2 - 2.0 * c * s + static_cast<double>(c) * c * n;
+}
+
+// Optimal 1-D k-means of the int8 `weights` into at most kPaletteSize
+// clusters, by dynamic programming over the 256 histogram bins.
+ChannelPalette BuildPalette(const int8_t* weights, int count) {
+  std::vector<double> hist(256, 0.0);
+  for (int i = 0; i < count; ++i) {
+    hist[weights[i] + 128] += 1.0;
+  }
+  std::vector<double> prefix_count(257, 0.0), prefix_sum(257, 0.0),
+      prefix_sum_sq(257, 0.0);
+  for (int b = 0; b < 256; ++b) {
+    const double v = b - 128;
+    prefix_count[b + 1] = prefix_count[b] + hist[b];
+    prefix_sum[b + 1] = prefix_sum[b] + hist[b] * v;
+    prefix_sum_sq[b + 1] = prefix_sum_sq[b] + hist[b] * v * v;
+  }
+
+  // cost[k][b]: best cost of covering bins [0, b) with k clusters.
+  const double kInf = std::numeric_limits<double>::infinity();
+  std::vector<std::vector<double>> cost(kPaletteSize + 1,
+                                        std::vector<double>(257, kInf));
+  std::vector<std::vector<int>> split(kPaletteSize + 1,
+                                      std::vector<int>(257, 0));
+  cost[0][0] = 0;
+  for (int k = 1; k <= kPaletteSize; ++k) {
+    for (int b = 1; b <= 256; ++b) {
+      for (int a = k - 1; a < b; ++a) {
+        if (cost[k - 1][a] == kInf) continue;
+        int centroid;
+        const double c = cost[k - 1][a] + BinsCost(prefix_count, prefix_sum,
+                                                   prefix_sum_sq, a, b - 1,
+                                                   &centroid);
+        if (c < cost[k][b]) {
+          cost[k][b] = c;
+          split[k][b] = a;
+        }
+      }
+    }
+  }
+
+  ChannelPalette palette;
+  int b = 256;
+  for (int k = kPaletteSize; k >= 1; --k) {
+    const int a = split[k][b];
+    int centroid;
+    BinsCost(prefix_count, prefix_sum, prefix_sum_sq, a, b - 1, &centroid);
+    palette.values[k - 1] = static_cast<int8_t>(centroid);
+    for (int bin = a; bin < b; ++bin) {
+      palette.index_of[bin] = static_cast<uint8_t>(k - 1);
+    }
+    b = a;
+  }
+  return palette;
+}
+
+tflite::BuiltinOperator GetBuiltinCode(const tflite::OperatorCodeT& code) {
+  // The deprecated field is saturated at 127 for newer builtins.
+  return std::max(
+      code.builtin_code,
+      static_cast<tflite::BuiltinOperator>(code.deprecated_builtin_code));
+}
+
+uint32_t GetOrAddCustomCode(tflite::ModelT* model, const std::string& name) {
+  for (size_t i = 0; i < model->operator_codes.size(); ++i) {
+    if (model->operator_codes[i]->custom_code == name) {
+      return i;
+    }
+  }
+  auto code = std::make_unique<tflite::OperatorCodeT>();
+  code->builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->deprecated_builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->custom_code = name;
+  model->operator_codes.push_back(std::move(code));
+  return model->operator_codes.size() - 1;
+}
+
+std::vector<uint8_t> BuildOptions(const tflite::OperatorT& op,
+                                  tflite::BuiltinOperator builtin) {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    if (builtin == tflite::BuiltinOperator_CONV_2D) {
+      const auto* options = op.builtin_options.AsConv2DOptions();
+      fbb.Int("dilation_h_factor", options->dilation_h_factor);
+      fbb.Int("dilation_w_factor", options->dilation_w_factor);
+      fbb.Int("fused_activation_function", options->fused_activation_function);
+      fbb.Int("padding", options->padding);
+      fbb.Int("stride_h", options->stride_h);
+      fbb.Int("stride_w", options->stride_w);
+    } else {
+      const auto* options = op.builtin_options.AsFullyConnectedOptions();
+      fbb.Int("fused_activation_function", options->fused_activation_function);
+    }
+  });
+  fbb.Finish();
+  return fbb.GetBuffer();
+}
+
+// Rewrites `op` if its filter can be palettized. Returns the number of bytes
+// saved.
+long PalettizeOp(tflite::ModelT* model, tflite::SubGraphT* subgraph,
+                 tflite::OperatorT* op) {
+  const tflite::BuiltinOperator builtin =
+      GetBuiltinCode(*model->operator_codes[op->opcode_index]);
+  if (builtin != tflite::BuiltinOperator_CONV_2D &&
+      builtin != tflite::BuiltinOperator_FULLY_CONNECTED) {
+    return 0;
+  }
+  if (op->inputs.size() < 2) return 0;
+  tflite::TensorT* input = subgraph->tensors[op->inputs[0]].get();
+  tflite::TensorT* filter = subgraph->tensors[op->inputs[1]].get();
+  std::vector<uint8_t>& filter_data = model->buffers[filter->buffer]->data;
+  if (input->type != tflite::TensorType_INT8 ||
+      filter->type != tflite::TensorType_INT8 || filter_data.empty() ||
+      filter->quantization == nullptr) {
+    return 0;
+  }
+  for (int64_t zero_point : filter->quantization->zero_point) {
+    if (zero_point != 0) return 0;
+  }
+  if (builtin == tflite::BuiltinOperator_FULLY_CONNECTED &&
+      (filter->shape.size() != 2 ||
+       op->builtin_options.AsFullyConnectedOptions()->weights_format !=
+           tflite::FullyConnectedOptionsWeightsFormat_DEFAULT)) {
+    return 0;
+  }
+
+  const int channels = filter->shape[0];
+  const int total = static_cast<int>(filter_data.size());
+  const int channel_size = total / channels;
+  const long packed_size = (total + 1) / 2 + channels * kPaletteSize;
+  if (packed_size >= total) {
+    printf("%-60s %6d bytes, skipped\n", filter->name.c_str(), total);
+    return 0;
+  }
+
+  const int8_t* weights = reinterpret_cast<const int8_t*>(filter_data.data());
+  std::vector<int8_t> palette_data(channels * kPaletteSize);
+  std::vector<uint8_t> indices((total + 1) / 2, 0);
+  double error_sq = 0;
+  int error_max = 0;
+  for (int channel = 0; channel < channels; ++channel) {
+    const int8_t* channel_weights = weights + channel * channel_size;
+    const ChannelPalette palette = BuildPalette(channel_weights, channel_size);
+    for (int i = 0; i < kPaletteSize; ++i) {
+      palette_data[channel * kPaletteSize + i] = palette.values[i];
+    }
+    for (int i = 0; i < channel_size; ++i) {
+      const int element = channel * channel_size + i;
+      const uint8_t index = palette.index_of[channel_weights[i] + 128];
+      indices[element >> 1] |= index << ((element & 1) * 4);
+      const int error = palette.values[index] - channel_weights[i];
+      error_sq += static_cast<double>(error) * error;
+      error_max = std::max(error_max, std::abs(error));
+    }
+  }
+  printf("%-60s %6d -> %6ld bytes, rmse %.3f, max error %d\n",
+         filter->name.c_str(), total, packed_size, std::sqrt(error_sq / total),
+         error_max);
+
+  // The palette takes over the filter's quantization parameters.
+  auto palette = std::make_unique<tflite::TensorT>();
+  palette->name = filter->name + "/palette";
+  palette->type = tflite::TensorType_INT8;
+  palette->shape = {channels, kPaletteSize};
+  palette->quantization = std::move(filter->quantization);
+  palette->quantization->quantized_dimension = 0;
+  auto palette_buffer = std::make_unique<tflite::BufferT>();
+  palette_buffer->data.assign(
+      reinterpret_cast<const uint8_t*>(palette_data.data()),
+      reinterpret_cast<const uint8_t*>(palette_data.data()) +
+          palette_data.size());
+  model->buffers.push_back(std::move(palette_buffer));
+  palette->buffer = model->buffers.size() - 1;
+  subgraph->tensors.push_back(std::move(palette));
+  const int32_t palette_index = subgraph->tensors.size() - 1;
+
+  // The filter tensor keeps its shape and becomes the int4 index tensor.
+  filter->type = tflite::TensorType_INT4;
+  filter_data = indices;
+
+  const int32_t bias_index = op->inputs.size() > 2 ? op->inputs[2] : -1;
+  op->custom_options = BuildOptions(*op, builtin);
+  op->custom_options_format = tflite::CustomOptionsFormat_FLEXBUFFERS;
+  op->builtin_options.Reset();
+  op->opcode_index = GetOrAddCustomCode(
+      model, builtin == tflite::BuiltinOperator_CONV_2D
+                 ? "PalettizedConv2D"
+                 : "PalettizedFullyConnected");
+  op->inputs = {op->inputs[0], palette_index, op->inputs[1], bias_index};
+  return total - packed_size;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <input.tflite> <output.tflite>\n", argv[0]);
+    return 1;
+  }
+
+  std::ifstream in(argv[1], std::ios::binary);
+  if (!in) {
+    fprintf(stderr, "Couldn't open %s\n", argv[1]);
+    return 1;
+  }
+  const std::vector<char> input((std::istreambuf_iterator<char>(in)),
+                                std::istreambuf_iterator<char>());
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(input.data()),
+                                 input.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", argv[1]);
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(input.data());
+
+  long saved = 0;
+  for (auto& subgraph : model->subgraphs) {
+    for (auto& op : subgraph->operators) {
+      saved += PalettizeOp(model.get(), subgraph.get(), op.get());
+    }
+  }
+
+  // The vendored flatbuffers has no implicit default allocator.
+  flatbuffers::DefaultAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(input.size(), &allocator);
+  tflite::FinishModelBuffer(fbb, tflite::Model::Pack(fbb, model.get()));
+  std::ofstream out(argv[2], std::ios::binary);
+  out.write(reinterpret_cast<const char*>(fbb.GetBufferPointer()),
+            fbb.GetSize());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", argv[2]);
+    return 1;
+  }
+  printf("weights: %ld bytes saved, model: %zu -> %u bytes\n", saved,
+         input.size(), fbb.GetSize());
+  return 0;
+}
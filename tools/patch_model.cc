@@ -0,0 +1,513 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: plans patch-based execution of the first layers of a model, see
+// tensorflow/lite/micro/kernels/patch_stage.h. The leading chain of int8
+// CONV_2D and MAX_POOL_2D ops is a candidate stage; every prefix of it of two
+// layers or more and every tile grid up to kMaxTiles x kMaxTiles is tried.
+// For each the tool rewrites the model, allocates it for the arena size, runs
+// it against the original on random inputs and counts the MACs including the
+// recomputed halos, then prints the peak memory vs extra MAC trade-off.
+//
+// The chosen plan is the one with the smallest arena within --max-overhead
+// percent extra stage MACs (default 10), or the one given with --layers and
+// --tiles. It is written out only if its outputs are bit-exact.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./patch_model model_int8.tflite model_patched.tflite
+//       [--max-overhead 10] [--layers 2 --tiles 2x2]
+//   xxd -i model_patched.tflite > Inc/model_patched.h
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/micro/kernels/patch_stage.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kMaxTiles = 8;
+constexpr size_t kArenaSize = 1024 * 1024;
+constexpr int kCheckRuns = 20;
+constexpr int kLatencyRuns = 200;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+tflite::BuiltinOperator GetBuiltinCode(const tflite::OperatorCodeT& code) {
+  // The deprecated field is saturated at 127 for newer builtins.
+  return std::max(
+      code.builtin_code,
+      static_cast<tflite::BuiltinOperator>(code.deprecated_builtin_code));
+}
+
+uint32_t GetOrAddCustomCode(tflite::ModelT* model, const std::string& name) {
+  for (size_t i = 0; i < model->operator_codes.size(); ++i) {
+    if (model->operator_codes[i]->custom_code == name) {
+      return i;
+    }
+  }
+  auto code = std::make_unique<tflite::OperatorCodeT>();
+  code->builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->deprecated_builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->custom_code = name;
+  model->operator_codes.push_back(std::move(code));
+  return model->operator_codes.size() - 1;
+}
+
+// One layer of the candidate stage, in the PatchStage "layers" encoding.
+struct Layer {
+  int fields[tflite::kPatchStageLayerFields];
+  int input_channels;
+  int output_channels;
+};
+
+// Number of ops in a row, from the first, that a stage can take: the output
+// of each is read by the next op only.
+int StageableLayers(const tflite::ModelT& model, std::vector<Layer>* layers) {
+  const tflite::SubGraphT& subgraph = *model.subgraphs[0];
+  for (size_t i = 0; i < subgraph.operators.size() &&
+                     layers->size() < tflite::kPatchStageMaxLayers;
+       ++i) {
+    const tflite::OperatorT& op = *subgraph.operators[i];
+    const tflite::BuiltinOperator builtin =
+        GetBuiltinCode(*model.operator_codes[op.opcode_index]);
+    if (op.inputs.empty() || op.outputs.size() != 1) break;
+    const tflite::TensorT& input = *subgraph.tensors[op.inputs[0]];
+    if (input.type != tflite::TensorType_INT8 || input.shape.size() != 4 ||
+        input.shape[0] != 1) {
+      break;
+    }
+    if (i > 0 && op.inputs[0] != subgraph.operators[i - 1]->outputs[0]) break;
+
+    Layer layer;
+    layer.input_channels = input.shape[3];
+    if (builtin == tflite::BuiltinOperator_CONV_2D) {
+      const auto* options = op.builtin_options.AsConv2DOptions();
+      if (op.inputs.size() < 2 || options->dilation_h_factor != 1 ||
+          options->dilation_w_factor != 1) {
+        break;
+      }
+      const tflite::TensorT& filter = *subgraph.tensors[op.inputs[1]];
+      if (filter.type != tflite::TensorType_INT8 || filter.shape.size() != 4) {
+        break;
+      }
+      layer.fields[0] = tflite::kPatchStageConv2D;
+      layer.fields[1] = filter.shape[1];
+      layer.fields[2] = filter.shape[2];
+      layer.fields[3] = options->stride_h;
+      layer.fields[4] = options->stride_w;
+      layer.fields[5] = options->padding;
+      layer.fields[6] = options->fused_activation_function;
+      layer.output_channels = filter.shape[0];
+    } else if (builtin == tflite::BuiltinOperator_MAX_POOL_2D) {
+      const auto* options = op.builtin_options.AsPool2DOptions();
+      layer.fields[0] = tflite::kPatchStageMaxPool2D;
+      layer.fields[1] = options->filter_height;
+      layer.fields[2] = options->filter_width;
+      layer.fields[3] = options->stride_h;
+      layer.fields[4] = options->stride_w;
+      layer.fields[5] = options->padding;
+      layer.fields[6] = options->fused_activation_function;
+      layer.output_channels = layer.input_channels;
+    } else {
+      break;
+    }
+    layers->push_back(layer);
+
+    // The output must not be needed by anything but the next op.
+    const int32_t output = op.outputs[0];
+    int readers = 0;
+    for (const auto& other : subgraph.operators) {
+      readers += std::count(other->inputs.begin(), other->inputs.end(), output);
+    }
+    if (readers != 1 || std::count(subgraph.outputs.begin(),
+                                   subgraph.outputs.end(), output) != 0) {
+      break;
+    }
+  }
+  return layers->size();
+}
+
+// Replaces the first `layer_count` ops with a PatchStage op computing their
+// output in a tiles_h x tiles_w grid, and drops the intermediate tensors.
+std::vector<uint8_t> Rewrite(const std::vector<uint8_t>& flatbuffer,
+                             const std::vector<Layer>& layers, int layer_count,
+                             int tiles_h, int tiles_w) {
+  std::unique_ptr<tflite::ModelT> model =
+      tflite::UnPackModel(flatbuffer.data());
+  tflite::SubGraphT* subgraph = model->subgraphs[0].get();
+  auto& ops = subgraph->operators;
+
+  auto stage = std::make_unique<tflite::OperatorT>();
+  stage->opcode_index = GetOrAddCustomCode(model.get(), "PatchStage");
+  stage->inputs.push_back(ops[0]->inputs[0]);
+  stage->outputs.push_back(ops[layer_count - 1]->outputs[0]);
+
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.TypedVector("layers", [&]() {
+      for (int l = 0; l < layer_count; ++l) {
+        for (int field : layers[l].fields) fbb.Int(field);
+      }
+    });
+    fbb.TypedVector("scales", [&]() {
+      for (int l = 0; l + 1 < layer_count; ++l) {
+        fbb.Float(subgraph->tensors[ops[l]->outputs[0]]->quantization->scale[0]);
+      }
+    });
+    fbb.Int("tiles_h", tiles_h);
+    fbb.Int("tiles_w", tiles_w);
+    fbb.TypedVector("zero_points", [&]() {
+      for (int l = 0; l + 1 < layer_count; ++l) {
+        fbb.Int(subgraph->tensors[ops[l]->outputs[0]]
+                    ->quantization->zero_point[0]);
+      }
+    });
+  });
+  fbb.Finish();
+  stage->custom_options = fbb.GetBuffer();
+  stage->custom_options_format = tflite::CustomOptionsFormat_FLEXBUFFERS;
+
+  for (int l = 0; l < layer_count; ++l) {
+    if (layers[l].fields[0] == tflite::kPatchStageConv2D) {
+      stage->inputs.push_back(ops[l]->inputs[1]);
+      stage->inputs.push_back(ops[l]->inputs.size() > 2 ? ops[l]->inputs[2]
+                                                        : -1);
+    }
+  }
+  ops.erase(ops.begin(), ops.begin() + layer_count);
+  ops.insert(ops.begin(), std::move(stage));
+
+  // Tensors nothing refers to any more would still get arena space.
+  std::vector<int32_t> remap(subgraph->tensors.size(), -1);
+  auto mark = [&](const std::vector<int32_t>& indices) {
+    for (int32_t index : indices) {
+      if (index >= 0) remap[index] = 0;
+    }
+  };
+  mark(subgraph->inputs);
+  mark(subgraph->outputs);
+  for (const auto& op : ops) {
+    mark(op->inputs);
+    mark(op->outputs);
+    mark(op->intermediates);
+  }
+  std::vector<std::unique_ptr<tflite::TensorT>> tensors;
+  for (size_t i = 0; i < subgraph->tensors.size(); ++i) {
+    if (remap[i] == 0) {
+      remap[i] = tensors.size();
+      tensors.push_back(std::move(subgraph->tensors[i]));
+    }
+  }
+  subgraph->tensors = std::move(tensors);
+  auto apply = [&](std::vector<int32_t>* indices) {
+    for (int32_t& index : *indices) {
+      if (index >= 0) index = remap[index];
+    }
+  };
+  apply(&subgraph->inputs);
+  apply(&subgraph->outputs);
+  for (auto& op : ops) {
+    apply(&op->inputs);
+    apply(&op->outputs);
+    apply(&op->intermediates);
+  }
+
+  // The vendored flatbuffers has no implicit default allocator.
+  flatbuffers::DefaultAllocator allocator;
+  flatbuffers::FlatBufferBuilder builder(flatbuffer.size(), &allocator);
+  tflite::FinishModelBuffer(builder, tflite::Model::Pack(builder, model.get()));
+  return std::vector<uint8_t>(builder.GetBufferPointer(),
+                              builder.GetBufferPointer() + builder.GetSize());
+}
+
+// MACs of the convolutions of the first `layer_count` layers, computed over
+// the given grid, halos included.
+long StageMacs(const tflite::ModelT& model, const std::vector<Layer>& layers,
+               int layer_count, int tiles_h, int tiles_w) {
+  const tflite::SubGraphT& subgraph = *model.subgraphs[0];
+  tflite::PatchStageGeometry geometry;
+  geometry.layer_count = layer_count;
+  const auto& input = subgraph.tensors[subgraph.operators[0]->inputs[0]];
+  geometry.input_h = input->shape[1];
+  geometry.input_w = input->shape[2];
+  geometry.tiles_h = tiles_h;
+  geometry.tiles_w = tiles_w;
+  int height = geometry.input_h;
+  int width = geometry.input_w;
+  for (int l = 0; l < layer_count; ++l) {
+    const Layer& layer = layers[l];
+    const auto& output = subgraph.tensors[subgraph.operators[l]->outputs[0]];
+    geometry.filter_h[l] = layer.fields[1];
+    geometry.filter_w[l] = layer.fields[2];
+    geometry.stride_h[l] = layer.fields[3];
+    geometry.stride_w[l] = layer.fields[4];
+    geometry.output_h[l] = output->shape[1];
+    geometry.output_w[l] = output->shape[2];
+    // Top and left padding, as ComputePaddingHeightWidth gives them.
+    geometry.pad_h[l] = std::max(
+        ((geometry.output_h[l] - 1) * layer.fields[3] + layer.fields[1] -
+         height) / 2, 0);
+    geometry.pad_w[l] = std::max(
+        ((geometry.output_w[l] - 1) * layer.fields[4] + layer.fields[2] -
+         width) / 2, 0);
+    height = geometry.output_h[l];
+    width = geometry.output_w[l];
+  }
+
+  long macs = 0;
+  for (int tile_y = 0; tile_y < tiles_h; ++tile_y) {
+    for (int tile_x = 0; tile_x < tiles_w; ++tile_x) {
+      tflite::PatchRegion outputs[tflite::kPatchStageMaxLayers];
+      tflite::PatchRegion windows[tflite::kPatchStageMaxLayers];
+      tflite::PatchStageTile(geometry, tile_y, tile_x, outputs, windows);
+      for (int l = 0; l < layer_count; ++l) {
+        if (layers[l].fields[0] != tflite::kPatchStageConv2D) continue;
+        macs += static_cast<long>(outputs[l].y1 - outputs[l].y0) *
+                (outputs[l].x1 - outputs[l].x0) * layers[l].output_channels *
+                layers[l].fields[1] * layers[l].fields[2] *
+                layers[l].input_channels;
+      }
+    }
+  }
+  return macs;
+}
+
+struct Runner {
+  std::vector<uint8_t> flatbuffer;
+  tflite::MicroMutableOpResolver<7> resolver;
+  std::unique_ptr<uint8_t[]> arena;
+  std::unique_ptr<tflite::MicroInterpreter> interpreter;
+};
+
+bool Setup(const std::vector<uint8_t>& flatbuffer, Runner* runner) {
+  runner->flatbuffer = flatbuffer;
+  runner->resolver.AddConv2D();
+  runner->resolver.AddMaxPool2D();
+  runner->resolver.AddFullyConnected();
+  runner->resolver.AddReshape();
+  runner->resolver.AddPalettizedConv2D();
+  runner->resolver.AddPalettizedFullyConnected();
+  runner->resolver.AddPatchStage();
+  // Aligned the way the firmware's static arena is.
+  runner->arena.reset(new uint8_t[kArenaSize + 16]);
+  uint8_t* arena = runner->arena.get();
+  arena += (16 - reinterpret_cast<uintptr_t>(arena) % 16) % 16;
+  runner->interpreter = std::make_unique<tflite::MicroInterpreter>(
+      tflite::GetModel(runner->flatbuffer.data()), runner->resolver, arena,
+      kArenaSize);
+  return runner->interpreter->AllocateTensors() == kTfLiteOk;
+}
+
+// Runs both models on the same random inputs, returns whether every output
+// byte matched.
+bool Matches(Runner* reference, Runner* candidate) {
+  std::mt19937 rng(1);
+  TfLiteTensor* reference_input = reference->interpreter->input(0);
+  TfLiteTensor* candidate_input = candidate->interpreter->input(0);
+  for (int run = 0; run < kCheckRuns; ++run) {
+    for (size_t i = 0; i < reference_input->bytes; ++i) {
+      reference_input->data.int8[i] = static_cast<int8_t>(rng());
+    }
+    memcpy(candidate_input->data.int8, reference_input->data.int8,
+           reference_input->bytes);
+    if (reference->interpreter->Invoke() != kTfLiteOk ||
+        candidate->interpreter->Invoke() != kTfLiteOk) {
+      return false;
+    }
+    const TfLiteTensor* a = reference->interpreter->output(0);
+    const TfLiteTensor* b = candidate->interpreter->output(0);
+    if (a->bytes != b->bytes || memcmp(a->data.raw, b->data.raw, a->bytes)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double Latency(Runner* runner) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kLatencyRuns; ++i) {
+    runner->interpreter->Invoke();
+  }
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         kLatencyRuns;
+}
+
+struct Plan {
+  int layers;
+  int tiles_h;
+  int tiles_w;
+  size_t arena;
+  long macs;
+  double overhead;
+  double latency;
+  bool exact;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* input_path = nullptr;
+  const char* output_path = nullptr;
+  double max_overhead = 10.0;
+  int forced_layers = 0;
+  int forced_h = 0;
+  int forced_w = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--max-overhead") == 0 && i + 1 < argc) {
+      max_overhead = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--layers") == 0 && i + 1 < argc) {
+      forced_layers = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--tiles") == 0 && i + 1 < argc) {
+      if (sscanf(argv[++i], "%dx%d", &forced_h, &forced_w) != 2) forced_h = 0;
+    } else if (input_path == nullptr) {
+      input_path = argv[i];
+    } else {
+      output_path = argv[i];
+    }
+  }
+  if (output_path == nullptr || (forced_layers != 0) != (forced_h > 0)) {
+    fprintf(stderr,
+            "Usage: %s <input.tflite> <output.tflite> [--max-overhead <%%>] "
+            "[--layers <n> --tiles <h>x<w>]\n",
+            argv[0]);
+    return 1;
+  }
+
+  const std::vector<uint8_t> flatbuffer = LoadFile(input_path);
+  flatbuffers::Verifier verifier(flatbuffer.data(), flatbuffer.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", input_path);
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model =
+      tflite::UnPackModel(flatbuffer.data());
+  std::vector<Layer> layers;
+  const int stageable = StageableLayers(*model, &layers);
+  if (stageable < 2) {
+    fprintf(stderr, "%s: no CONV_2D / MAX_POOL_2D chain to patch\n",
+            input_path);
+    return 1;
+  }
+
+  Runner reference;
+  if (!Setup(flatbuffer, &reference)) {
+    fprintf(stderr, "%s: AllocateTensors() failed\n", input_path);
+    return 1;
+  }
+  printf("%-8s %6s %8s %10s %9s %10s %6s\n", "layers", "tiles", "arena",
+         "stage MACs", "overhead", "us/invoke", "exact");
+  printf("%-8s %6s %8zu %10ld %8.1f%% %10.1f %6s\n", "none", "-",
+         reference.interpreter->arena_used_bytes(),
+         StageMacs(*model, layers, stageable, 1, 1), 0.0,
+         Latency(&reference), "-");
+
+  std::vector<Plan> plans;
+  for (int count = 2; count <= stageable; ++count) {
+    const auto& output =
+        model->subgraphs[0]->tensors[model->subgraphs[0]
+                                         ->operators[count - 1]
+                                         ->outputs[0]];
+    const long base_macs = StageMacs(*model, layers, count, 1, 1);
+    for (int tiles = 1; tiles <= kMaxTiles; ++tiles) {
+      // Square grids, and row bands that need no copies of full width rows.
+      for (int rows_only = 0; rows_only < 2; ++rows_only) {
+        const int tiles_h = tiles;
+        const int tiles_w = rows_only ? 1 : tiles;
+        if ((rows_only && tiles == 1) || tiles_h > output->shape[1] ||
+            tiles_w > output->shape[2]) {
+          continue;
+        }
+        if (forced_layers != 0 &&
+            (count != forced_layers || tiles_h != forced_h ||
+             tiles_w != forced_w)) {
+          continue;
+        }
+        Runner candidate;
+        if (!Setup(Rewrite(flatbuffer, layers, count, tiles_h, tiles_w),
+                   &candidate)) {
+          fprintf(stderr, "%d layers, %dx%d: AllocateTensors() failed\n",
+                  count, tiles_h, tiles_w);
+          continue;
+        }
+        Plan plan;
+        plan.layers = count;
+        plan.tiles_h = tiles_h;
+        plan.tiles_w = tiles_w;
+        plan.arena = candidate.interpreter->arena_used_bytes();
+        plan.macs = StageMacs(*model, layers, count, tiles_h, tiles_w);
+        plan.overhead = 100.0 * (plan.macs - base_macs) / base_macs;
+        plan.exact = Matches(&reference, &candidate);
+        plan.latency = Latency(&candidate);
+        plans.push_back(plan);
+        char grid[16];
+        snprintf(grid, sizeof(grid), "%dx%d", tiles_h, tiles_w);
+        printf("%-8d %6s %8zu %10ld %8.1f%% %10.1f %6s\n", count, grid,
+               plan.arena, plan.macs, plan.overhead, plan.latency,
+               plan.exact ? "yes" : "NO");
+      }
+    }
+  }
+
+  const Plan* best = nullptr;
+  for (const Plan& plan : plans) {
+    if (!plan.exact || (forced_layers == 0 && plan.overhead > max_overhead)) {
+      continue;
+    }
+    if (best == nullptr || plan.arena < best->arena ||
+        (plan.arena == best->arena && plan.macs < best->macs)) {
+      best = &plan;
+    }
+  }
+  if (best == nullptr) {
+    fprintf(stderr, "No bit-exact plan within the MAC overhead\n");
+    return 1;
+  }
+
+  const std::vector<uint8_t> patched =
+      Rewrite(flatbuffer, layers, best->layers, best->tiles_h, best->tiles_w);
+  std::ofstream out(output_path, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(patched.data()), patched.size());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", output_path);
+    return 1;
+  }
+  printf("chosen: %d layers in %dx%d tiles, arena %zu -> %zu bytes, "
+         "%.1f%% extra MACs\n",
+         best->layers, best->tiles_h, best->tiles_w,
+         reference.interpreter->arena_used_bytes(), best->arena,
+         best->overhead);
+  return 0;
+}
@@ -0,0 +1,379 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: moves the framebuffer preprocessing of the firmware into the
+// model. The 28x28x1 int8 input of the classifier is replaced by the 160x160
+// RGB888 working window as it is read back from the LCD, bytes - 128, and two
+// ops in front compute what rgb2gray() and resize_bilnear() in Src/main.cc do:
+//
+//   RESIZE_BILINEAR 160x160x3 -> 29x29x3, align_corners
+//   CONV_2D 2x2 VALID, 3 -> 1: 255 - (0.2126 R + 0.7152 G + 0.0722 B)
+//
+// resize_bilnear() steps 159/28 pixels, which is the align_corners step of a
+// 29 pixel output; the 2x2 VALID filter has only its top-left tap set and
+// drops the 29th row and column. Sampling on another grid (160/28) moves the
+// far samples by up to a pixel and, on sharp pen edges, flips about one class
+// in six. Resizing first keeps the convolution on 28x28 pixels; both are
+// linear, so the order only moves the rounding.
+//
+// The tool checks the result against the firmware pipeline on random pen
+// strokes, drawn in the menu colors, and reports the top-1 agreement and the
+// host latency of both.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and run:
+//   ./prepend_preprocessing model_int8.tflite model_preprocess.tflite
+//       [--count 500]
+//   xxd -i model_preprocess.tflite > Inc/model_preprocess.h
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kWindowSide = 160;
+constexpr int kWindowChannels = 3;
+constexpr int kImageSide = 28;
+constexpr int kResizedSide = kImageSide + 1;
+constexpr int kNumberOfOutputs = 10;
+constexpr size_t kArenaSize = 256 * 1024;
+// CIE luminance of the R, G and B bytes, as rgb2gray() weighs them.
+constexpr float kLuminance[kWindowChannels] = {0.2126f, 0.7152f, 0.0722f};
+// Pen colors of the menu, RGB.
+constexpr uint8_t kPenColors[][kWindowChannels] = {
+    {0x00, 0x00, 0x00}, {0xFF, 0x00, 0x00}, {0x80, 0x00, 0x00},
+    {0x00, 0x80, 0x00}};
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+tflite::BuiltinOperator GetBuiltinCode(const tflite::OperatorCodeT& code) {
+  // The deprecated field is saturated at 127 for newer builtins.
+  return std::max(
+      code.builtin_code,
+      static_cast<tflite::BuiltinOperator>(code.deprecated_builtin_code));
+}
+
+uint32_t GetOrAddBuiltinCode(tflite::ModelT* model,
+                             tflite::BuiltinOperator builtin, int version) {
+  for (size_t i = 0; i < model->operator_codes.size(); ++i) {
+    if (GetBuiltinCode(*model->operator_codes[i]) == builtin) {
+      return i;
+    }
+  }
+  auto code = std::make_unique<tflite::OperatorCodeT>();
+  code->builtin_code = builtin;
+  code->deprecated_builtin_code = static_cast<int8_t>(builtin);
+  code->version = version;
+  model->operator_codes.push_back(std::move(code));
+  return model->operator_codes.size() - 1;
+}
+
+std::unique_ptr<tflite::QuantizationParametersT> Quantization(
+    float scale, int64_t zero_point) {
+  auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+  quantization->scale = {scale};
+  quantization->zero_point = {zero_point};
+  return quantization;
+}
+
+int AddTensor(tflite::ModelT* model, const char* name, tflite::TensorType type,
+              const std::vector<int32_t>& shape,
+              std::unique_ptr<tflite::QuantizationParametersT> quantization,
+              const void* data = nullptr, size_t bytes = 0) {
+  tflite::SubGraphT* subgraph = model->subgraphs[0].get();
+  auto tensor = std::make_unique<tflite::TensorT>();
+  tensor->name = name;
+  tensor->type = type;
+  tensor->shape = shape;
+  tensor->quantization = std::move(quantization);
+  if (data != nullptr) {
+    auto buffer = std::make_unique<tflite::BufferT>();
+    const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+    buffer->data.assign(bytes_data, bytes_data + bytes);
+    tensor->buffer = model->buffers.size();
+    model->buffers.push_back(std::move(buffer));
+  }
+  subgraph->tensors.push_back(std::move(tensor));
+  return subgraph->tensors.size() - 1;
+}
+
+// Returns the rewritten flatbuffer, empty if the model input is not a 28x28x1
+// int8 image.
+std::vector<uint8_t> Prepend(const std::vector<uint8_t>& flatbuffer) {
+  std::unique_ptr<tflite::ModelT> model(
+      tflite::GetModel(flatbuffer.data())->UnPack());
+  tflite::SubGraphT* subgraph = model->subgraphs[0].get();
+  if (subgraph->inputs.size() != 1) {
+    return {};
+  }
+  const int image = subgraph->inputs[0];
+  const tflite::TensorT& image_tensor = *subgraph->tensors[image];
+  if (image_tensor.type != tflite::TensorType_INT8 ||
+      image_tensor.shape != std::vector<int32_t>{1, kImageSide, kImageSide, 1} ||
+      image_tensor.quantization == nullptr ||
+      image_tensor.quantization->scale.size() != 1) {
+    return {};
+  }
+  // The 1x1 convolution writes the old input, in its quantization.
+  if (std::fabs(image_tensor.quantization->scale[0] - 1.0f / 255.0f) > 1e-6f ||
+      image_tensor.quantization->zero_point[0] != -128) {
+    return {};
+  }
+
+  // Window bytes: real = byte / 255.
+  const float window_scale = 1.0f / 255.0f;
+  const int window_zero_point = -128;
+  const int window = AddTensor(
+      model.get(), "window", tflite::TensorType_INT8,
+      {1, kWindowSide, kWindowSide, kWindowChannels},
+      Quantization(window_scale, window_zero_point));
+  const int32_t size[2] = {kResizedSide, kResizedSide};
+  const int size_tensor =
+      AddTensor(model.get(), "resize/size", tflite::TensorType_INT32, {2},
+                nullptr, size, sizeof(size));
+  // Resizing keeps the input quantization.
+  const int resized = AddTensor(
+      model.get(), "resize", tflite::TensorType_INT8,
+      {1, kResizedSide, kResizedSide, kWindowChannels},
+      Quantization(window_scale, window_zero_point));
+
+  // gray = 1 - L of the top-left pixel: filter -luminance, bias 1.
+  const float filter_scale = kLuminance[1] / 127.0f;
+  const float bias_scale = window_scale * filter_scale;
+  int8_t filter[2 * 2 * kWindowChannels] = {};
+  for (int c = 0; c < kWindowChannels; ++c) {
+    filter[c] = static_cast<int8_t>(std::round(-kLuminance[c] / filter_scale));
+  }
+  const int32_t bias = static_cast<int32_t>(std::round(1.0f / bias_scale));
+  const int filter_tensor = AddTensor(
+      model.get(), "gray/filter", tflite::TensorType_INT8,
+      {1, 2, 2, kWindowChannels}, Quantization(filter_scale, 0), filter,
+      sizeof(filter));
+  const int bias_tensor =
+      AddTensor(model.get(), "gray/bias", tflite::TensorType_INT32, {1},
+                Quantization(bias_scale, 0), &bias, sizeof(bias));
+
+  auto resize = std::make_unique<tflite::OperatorT>();
+  resize->opcode_index = GetOrAddBuiltinCode(
+      model.get(), tflite::BuiltinOperator_RESIZE_BILINEAR, 2);
+  resize->inputs = {window, size_tensor};
+  resize->outputs = {resized};
+  tflite::ResizeBilinearOptionsT resize_options;
+  resize_options.align_corners = true;
+  resize_options.half_pixel_centers = false;
+  resize->builtin_options.Set(resize_options);
+
+  auto gray = std::make_unique<tflite::OperatorT>();
+  gray->opcode_index =
+      GetOrAddBuiltinCode(model.get(), tflite::BuiltinOperator_CONV_2D, 3);
+  gray->inputs = {resized, filter_tensor, bias_tensor};
+  gray->outputs = {image};
+  tflite::Conv2DOptionsT gray_options;
+  gray_options.padding = tflite::Padding_VALID;
+  gray_options.stride_w = 1;
+  gray_options.stride_h = 1;
+  gray_options.fused_activation_function = tflite::ActivationFunctionType_NONE;
+  gray->builtin_options.Set(gray_options);
+
+  subgraph->operators.insert(subgraph->operators.begin(), std::move(gray));
+  subgraph->operators.insert(subgraph->operators.begin(), std::move(resize));
+  subgraph->inputs = {window};
+
+  // The vendored flatbuffers has no implicit default allocator.
+  flatbuffers::DefaultAllocator allocator;
+  flatbuffers::FlatBufferBuilder builder(flatbuffer.size(), &allocator);
+  tflite::FinishModelBuffer(builder, tflite::Model::Pack(builder, model.get()));
+  return std::vector<uint8_t>(builder.GetBufferPointer(),
+                              builder.GetBufferPointer() + builder.GetSize());
+}
+
+// A white working window with random thick pen strokes in one menu color.
+void DrawWindow(std::mt19937* rng, uint8_t* window) {
+  memset(window, 0xFF, kWindowSide * kWindowSide * kWindowChannels);
+  const uint8_t* color =
+      kPenColors[(*rng)() % (sizeof(kPenColors) / sizeof(kPenColors[0]))];
+  int x = 30 + (*rng)() % 100;
+  int y = 30 + (*rng)() % 100;
+  for (int step = 0; step < 300; ++step) {
+    x = std::min(std::max(x + static_cast<int>((*rng)() % 5) - 2, 8), 151);
+    y = std::min(std::max(y + static_cast<int>((*rng)() % 5) - 2, 8), 151);
+    for (int dy = -4; dy <= 4; ++dy) {
+      for (int dx = -4; dx <= 4; ++dx) {
+        if (dx * dx + dy * dy > 16) continue;
+        memcpy(&window[((y + dy) * kWindowSide + x + dx) * kWindowChannels],
+               color, kWindowChannels);
+      }
+    }
+  }
+}
+
+// rgb2gray(), resize_bilnear() and update_tensor_input() of Src/main.cc.
+void FirmwarePreprocess(const uint8_t* window, int8_t* input) {
+  static uint8_t gray[kWindowSide * kWindowSide];
+  for (int i = 0; i < kWindowSide * kWindowSide; ++i) {
+    const float l = 0.2126 * window[i * 3] + 0.7152 * window[i * 3 + 1] +
+                    0.0722 * window[i * 3 + 2];
+    gray[i] = static_cast<uint8_t>(255 - l);
+  }
+  const float x_ratio = static_cast<float>(kWindowSide - 1) / kImageSide;
+  const float y_ratio = static_cast<float>(kWindowSide - 1) / kImageSide;
+  for (int i = 0; i < kImageSide; ++i) {
+    for (int j = 0; j < kImageSide; ++j) {
+      const int x = static_cast<int>(x_ratio * j);
+      const int y = static_cast<int>(y_ratio * i);
+      const float x_diff = x_ratio * j - x;
+      const float y_diff = y_ratio * i - y;
+      const int index = y * kWindowSide + x;
+      const uint32_t a = gray[index];
+      const uint32_t b = gray[index + 1];
+      const uint32_t c = gray[index + kWindowSide];
+      const uint32_t d = gray[index + kWindowSide + 1];
+      const uint8_t value = static_cast<uint8_t>(static_cast<int>(
+          a * (1 - x_diff) * (1 - y_diff) + b * x_diff * (1 - y_diff) +
+          c * y_diff * (1 - x_diff) + d * x_diff * y_diff));
+      input[i * kImageSide + j] = static_cast<int8_t>(value - 128);
+    }
+  }
+}
+
+int TopClass(const TfLiteTensor* output) {
+  return static_cast<int>(
+      std::max_element(output->data.int8,
+                       output->data.int8 + kNumberOfOutputs) -
+      output->data.int8);
+}
+
+double Seconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double>(duration).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* paths[2] = {nullptr, nullptr};
+  int path_count = 0;
+  int count = 500;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (path_count < 2) {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (path_count != 2 || count < 1) {
+    fprintf(stderr,
+            "Usage: %s model_int8.tflite model_preprocess.tflite "
+            "[--count 500]\n",
+            argv[0]);
+    return 1;
+  }
+
+  const std::vector<uint8_t> original = LoadFile(paths[0]);
+  flatbuffers::Verifier verifier(original.data(), original.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", paths[0]);
+    return 1;
+  }
+  const std::vector<uint8_t> prepended = Prepend(original);
+  if (prepended.empty()) {
+    fprintf(stderr, "%s: input is not a 28x28x1 int8 image of scale 1/255\n",
+            paths[0]);
+    return 1;
+  }
+
+  tflite::MicroMutableOpResolver<5> resolver;
+  resolver.AddConv2D();
+  resolver.AddMaxPool2D();
+  resolver.AddReshape();
+  resolver.AddFullyConnected();
+  resolver.AddResizeBilinear();
+  std::vector<uint8_t> arenas[2] = {std::vector<uint8_t>(kArenaSize),
+                                    std::vector<uint8_t>(kArenaSize)};
+  tflite::MicroInterpreter reference(tflite::GetModel(original.data()),
+                                     resolver, arenas[0].data(), kArenaSize);
+  tflite::MicroInterpreter candidate(tflite::GetModel(prepended.data()),
+                                     resolver, arenas[1].data(), kArenaSize);
+  if (reference.AllocateTensors() != kTfLiteOk ||
+      candidate.AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "AllocateTensors() failed\n");
+    return 1;
+  }
+
+  std::mt19937 rng(1);
+  std::vector<uint8_t> window(kWindowSide * kWindowSide * kWindowChannels);
+  int agree = 0;
+  double reference_seconds = 0;
+  double candidate_seconds = 0;
+  for (int n = 0; n < count; ++n) {
+    DrawWindow(&rng, window.data());
+
+    auto start = std::chrono::steady_clock::now();
+    FirmwarePreprocess(window.data(), reference.input(0)->data.int8);
+    if (reference.Invoke() != kTfLiteOk) {
+      fprintf(stderr, "%s: Invoke() failed\n", paths[0]);
+      return 1;
+    }
+    reference_seconds += Seconds(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    int8_t* input = candidate.input(0)->data.int8;
+    for (size_t i = 0; i < window.size(); ++i) {
+      input[i] = static_cast<int8_t>(window[i] - 128);
+    }
+    if (candidate.Invoke() != kTfLiteOk) {
+      fprintf(stderr, "The prepended model fails to Invoke()\n");
+      return 1;
+    }
+    candidate_seconds += Seconds(std::chrono::steady_clock::now() - start);
+
+    agree += TopClass(reference.output(0)) == TopClass(candidate.output(0));
+  }
+
+  printf("%d windows: %.2f%% top-1 agreement with the firmware "
+         "preprocessing\n",
+         count, 100.0 * agree / count);
+  printf("%-24s %12s %10s\n", "", "latency us", "arena");
+  printf("%-24s %12.1f %10zu\n", "firmware + model", 1e6 * reference_seconds / count,
+         reference.arena_used_bytes());
+  printf("%-24s %12.1f %10zu\n", "in-graph preprocessing",
+         1e6 * candidate_seconds / count, candidate.arena_used_bytes());
+
+  std::ofstream out(paths[1], std::ios::binary);
+  out.write(reinterpret_cast<const char*>(prepended.data()), prepended.size());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", paths[1]);
+    return 1;
+  }
+  printf("%zu bytes written to %s\n", prepended.size(), paths[1]);
+  return 0;
+}
@@ -0,0 +1,286 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: requantizes the int8 filters of the CONV_2D and FULLY_CONNECTED
+// ops of a model to int4, for the CMSIS-NN s4 kernels behind
+// Register_CONV_2D_INT4 / Register_FULLY_CONNECTED_INT4.
+//
+// The filters are symmetric, packed two per byte over the flattened tensor,
+// low nibble first. CONV_2D filters keep their per-channel quantization; the
+// int4 FULLY_CONNECTED kernel only takes a per-tensor scale. Each scale is
+// the one minimizing the squared error over a range of clipping thresholds,
+// and the int32 bias is rescaled to match. A size and weight error report is
+// printed per tensor.
+//
+// The first and last of those ops stay int8 unless --all is given: they are
+// small, and they see the raw pixels and produce the logits, where int4
+// costs the most accuracy. The last op of the digit classifier is also the
+// FULLY_CONNECTED one, which would be stuck with a per-tensor scale.
+//
+// Build and run on the host:
+//   g++ -std=c++17 -O2 -Itensorflow-lite
+//     -Itensorflow-lite/third_party/flatbuffers/include
+//     tools/quantize_int4_model.cc -o quantize_int4_model
+//   ./quantize_int4_model [--all] model_int8.tflite model_int4.tflite
+//   xxd -i model_int4.tflite > Inc/model_int4.h
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr int kInt4Min = -8;
+constexpr int kInt4Max = 7;
+
+// Clipping thresholds tried, as fractions of the largest weight magnitude.
+constexpr int kClipSteps = 64;
+constexpr float kClipMin = 0.5f;
+
+int QuantizeInt4(float value, float scale) {
+  const int q = static_cast<int>(std::lround(value / scale));
+  return std::min(std::max(q, kInt4Min), kInt4Max);
+}
+
+// Returns the int4 scale of the int8 `weights` dequantized with `scales`
+// (one per `group_size` weights), which minimizes the squared error.
+float ChooseScale(const int8_t* weights, int count, const float* scales,
+                  int group_size) {
+  float max_abs = 0;
+  for (int i = 0; i < count; ++i) {
+    max_abs = std::max(max_abs, std::abs(weights[i] * scales[i / group_size]));
+  }
+  if (max_abs == 0) {
+    return 1.0f;
+  }
+
+  float best_scale = max_abs / kInt4Max;
+  double best_error = -1;
+  for (int step = 0; step <= kClipSteps; ++step) {
+    const float clip = max_abs * (kClipMin + (1.0f - kClipMin) * step /
+                                                 kClipSteps);
+    const float scale = clip / kInt4Max;
+    double error = 0;
+    for (int i = 0; i < count; ++i) {
+      const float value = weights[i] * scales[i / group_size];
+      const float d = QuantizeInt4(value, scale) * scale - value;
+      error += static_cast<double>(d) * d;
+    }
+    if (best_error < 0 || error < best_error) {
+      best_error = error;
+      best_scale = scale;
+    }
+  }
+  return best_scale;
+}
+
+tflite::BuiltinOperator GetBuiltinCode(const tflite::OperatorCodeT& code) {
+  // The deprecated field is saturated at 127 for newer builtins.
+  return std::max(
+      code.builtin_code,
+      static_cast<tflite::BuiltinOperator>(code.deprecated_builtin_code));
+}
+
+bool IsWeightOp(const tflite::ModelT& model, const tflite::OperatorT& op) {
+  const tflite::BuiltinOperator builtin =
+      GetBuiltinCode(*model.operator_codes[op.opcode_index]);
+  return (builtin == tflite::BuiltinOperator_CONV_2D ||
+          builtin == tflite::BuiltinOperator_FULLY_CONNECTED) &&
+         op.inputs.size() >= 2;
+}
+
+// Requantizes the filter of `op` to int4 if it is a symmetric int8 filter.
+// Returns the number of bytes saved.
+long QuantizeOp(tflite::ModelT* model, tflite::SubGraphT* subgraph,
+                tflite::OperatorT* op) {
+  const tflite::BuiltinOperator builtin =
+      GetBuiltinCode(*model->operator_codes[op->opcode_index]);
+  if (!IsWeightOp(*model, *op)) return 0;
+  tflite::TensorT* input = subgraph->tensors[op->inputs[0]].get();
+  tflite::TensorT* filter = subgraph->tensors[op->inputs[1]].get();
+  std::vector<uint8_t>& filter_data = model->buffers[filter->buffer]->data;
+  if (input->type != tflite::TensorType_INT8 ||
+      filter->type != tflite::TensorType_INT8 || filter_data.empty() ||
+      filter->quantization == nullptr ||
+      filter->quantization->scale.empty()) {
+    return 0;
+  }
+  for (int64_t zero_point : filter->quantization->zero_point) {
+    if (zero_point != 0) return 0;
+  }
+  tflite::QuantizationParametersT& quantization = *filter->quantization;
+  const int channels = filter->shape[0];
+  const bool per_channel = quantization.scale.size() > 1;
+  if (per_channel && (quantization.quantized_dimension != 0 ||
+                      static_cast<int>(quantization.scale.size()) != channels)) {
+    return 0;
+  }
+  if (builtin == tflite::BuiltinOperator_FULLY_CONNECTED &&
+      (filter->shape.size() != 2 ||
+       op->builtin_options.AsFullyConnectedOptions()->weights_format !=
+           tflite::FullyConnectedOptionsWeightsFormat_DEFAULT)) {
+    return 0;
+  }
+
+  const int total = static_cast<int>(filter_data.size());
+  const int channel_size = total / channels;
+  const int8_t* weights = reinterpret_cast<const int8_t*>(filter_data.data());
+  const std::vector<float> old_scales(quantization.scale.begin(),
+                                      quantization.scale.end());
+  const int group_size = per_channel ? channel_size : total;
+
+  // CONV_2D keeps one scale per channel, FULLY_CONNECTED gets a single one.
+  std::vector<float> new_scales;
+  if (builtin == tflite::BuiltinOperator_CONV_2D) {
+    for (int channel = 0; channel < channels; ++channel) {
+      const float channel_scale =
+          old_scales[per_channel ? channel : 0];
+      new_scales.push_back(ChooseScale(weights + channel * channel_size,
+                                       channel_size, &channel_scale,
+                                       channel_size));
+    }
+  } else {
+    new_scales.push_back(
+        ChooseScale(weights, total, old_scales.data(), group_size));
+  }
+  const int new_group_size = new_scales.size() > 1 ? channel_size : total;
+
+  std::vector<uint8_t> packed((total + 1) / 2, 0);
+  double error_sq = 0;
+  double max_sq = 0;
+  for (int i = 0; i < total; ++i) {
+    const float value = weights[i] * old_scales[i / group_size];
+    const float scale = new_scales[i / new_group_size];
+    const int q = QuantizeInt4(value, scale);
+    packed[i >> 1] |= static_cast<uint8_t>(q & 0x0f) << ((i & 1) * 4);
+    const double d = q * scale - value;
+    error_sq += d * d;
+    max_sq += static_cast<double>(value) * value;
+  }
+  printf("%-60s %6d -> %6zu bytes, %s, relative rmse %.4f\n",
+         filter->name.c_str(), total, packed.size(),
+         new_scales.size() > 1 ? "per-channel" : "per-tensor",
+         max_sq > 0 ? std::sqrt(error_sq / max_sq) : 0.0);
+
+  // The bias scale is input_scale * filter_scale, so the bias follows.
+  if (op->inputs.size() > 2 && op->inputs[2] >= 0) {
+    tflite::TensorT* bias = subgraph->tensors[op->inputs[2]].get();
+    std::vector<uint8_t>& bias_data = model->buffers[bias->buffer]->data;
+    if (bias->type == tflite::TensorType_INT32 && !bias_data.empty()) {
+      int32_t* values = reinterpret_cast<int32_t*>(bias_data.data());
+      const int count = static_cast<int>(bias_data.size() / sizeof(int32_t));
+      for (int i = 0; i < count; ++i) {
+        const float old_scale = old_scales[per_channel ? i : 0];
+        const float new_scale = new_scales[new_scales.size() > 1 ? i : 0];
+        values[i] = static_cast<int32_t>(
+            std::lround(static_cast<double>(values[i]) * old_scale /
+                        new_scale));
+      }
+      if (bias->quantization != nullptr) {
+        const float input_scale = input->quantization->scale[0];
+        bias->quantization->scale.clear();
+        bias->quantization->zero_point.clear();
+        for (float scale : new_scales) {
+          bias->quantization->scale.push_back(input_scale * scale);
+          bias->quantization->zero_point.push_back(0);
+        }
+      }
+    }
+  }
+
+  quantization.scale = new_scales;
+  quantization.zero_point.assign(new_scales.size(), 0);
+  quantization.quantized_dimension = 0;
+  quantization.min.clear();
+  quantization.max.clear();
+  filter->type = tflite::TensorType_INT4;
+  filter_data = packed;
+  return total - static_cast<long>(packed.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool all = false;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--all") == 0) {
+      all = true;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.size() != 2) {
+    fprintf(stderr, "Usage: %s [--all] <input.tflite> <output.tflite>\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::ifstream in(paths[0], std::ios::binary);
+  if (!in) {
+    fprintf(stderr, "Couldn't open %s\n", paths[0]);
+    return 1;
+  }
+  const std::vector<char> input((std::istreambuf_iterator<char>(in)),
+                                std::istreambuf_iterator<char>());
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(input.data()),
+                                 input.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", paths[0]);
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(input.data());
+
+  long saved = 0;
+  for (auto& subgraph : model->subgraphs) {
+    std::vector<tflite::OperatorT*> ops;
+    for (auto& op : subgraph->operators) {
+      if (IsWeightOp(*model, *op)) ops.push_back(op.get());
+    }
+    for (size_t i = 0; i < ops.size(); ++i) {
+      if (!all && (i == 0 || i + 1 == ops.size())) {
+        const int filter = ops[i]->inputs[1];
+        printf("%-60s kept int8\n",
+               subgraph->tensors[filter]->name.c_str());
+        continue;
+      }
+      saved += QuantizeOp(model.get(), subgraph.get(), ops[i]);
+    }
+  }
+
+  // The vendored flatbuffers has no implicit default allocator.
+  flatbuffers::DefaultAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(input.size(), &allocator);
+  tflite::FinishModelBuffer(fbb, tflite::Model::Pack(fbb, model.get()));
+  std::ofstream out(paths[1], std::ios::binary);
+  out.write(reinterpret_cast<const char*>(fbb.GetBufferPointer()),
+            fbb.GetSize());
+  if (!out) {
+    fprintf(stderr, "Couldn't write %s\n", paths[1]);
+    return 1;
+  }
+  printf("weights: %ld bytes saved, model: %zu -> %u bytes\n", saved,
+         input.size(), fbb.GetSize());
+  return 0;
+}
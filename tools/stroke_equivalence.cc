@@ -0,0 +1,384 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host equivalence check of the two ways the firmware builds the model input
+// from what was drawn on the touch screen:
+//  - the pixel pipeline: brush stamps into the ARGB8888 framebuffer, the
+//    working window read back as RGB888, rgb2gray, resize_bilnear and
+//    update_tensor_input, reproduced here from Src/brush.c and Src/main.cc;
+//  - the vector pipeline: Src/stroke.c itself, compiled for the host.
+// Both are fed the same random pen strokes, in the firmware's window
+// geometry and pen colors. The tool reports the difference between the two
+// int8 inputs and, given a model, how often the top-1 predictions agree. It
+// exits with 1 when the mean difference or the agreement is out of bounds.
+//
+// Point sampling a 160x160 window at 28x28 makes both pipelines sensitive
+// to the position of the stroke edges, so as a yardstick the same figures
+// are given for the pixel pipeline against itself with the drawing moved
+// one LCD pixel to the right.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, and Src/stroke.c (-IInc), and run:
+//   ./stroke_equivalence [--model model_int8.tflite] [--count 1000]
+//       [--max-mean 1.0] [--min-agree 95]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "stroke.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+// The firmware's LCD, working window (prepare_working_window) and pen.
+constexpr int kLcdWidth = 240;
+constexpr int kLcdHeight = 320;
+constexpr int kWindowX = 67;
+constexpr int kWindowY = 6;
+constexpr int kWorkingSide = 160;
+constexpr int kImageSide = 28;
+constexpr int kImageSize = kImageSide * kImageSide;
+constexpr int kPencil = 4;
+constexpr int kSubsamples = 4;
+constexpr uint32_t kPenColors[] = {0xFFFF0000, 0xFF00FF00, 0xFF0000FF};
+// The drawable area, in_working_window() in main.cc.
+constexpr int kMinX = 67 + kPencil + 1;
+constexpr int kMaxX = kLcdWidth - (7 + kPencil) - 1;
+constexpr int kMinY = 7 + kPencil + 1;
+constexpr int kMaxY = kLcdHeight - (155 + kPencil) - 1;
+
+constexpr int kNumberOfOutputs = 10;
+constexpr size_t kArenaSize = 256 * 1024;
+// The input zero point of model_int8.tflite, used when no model is given.
+constexpr int32_t kInputZeroPoint = -128;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+struct Point {
+  int x;
+  int y;
+};
+
+struct Stroke {
+  uint32_t color;
+  std::vector<Point> points;
+};
+
+// A digit-sized scribble: one to three strokes of touch samples, a few
+// pixels apart, with the direction drifting like a hand does.
+std::vector<Stroke> MakeDrawing(std::mt19937* rng) {
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::vector<Stroke> drawing(1 + (*rng)() % 3);
+  const uint32_t color = kPenColors[(*rng)() % 3];
+  for (Stroke& stroke : drawing) {
+    stroke.color = color;
+    float x = kMinX + 20 + unit(*rng) * (kMaxX - kMinX - 40);
+    float y = kMinY + 20 + unit(*rng) * (kMaxY - kMinY - 40);
+    float angle = unit(*rng) * 6.2832f;
+    const int count = 1 + (*rng)() % 60;
+    for (int i = 0; i < count; ++i) {
+      stroke.points.push_back({static_cast<int>(x), static_cast<int>(y)});
+      angle += (unit(*rng) - 0.5f) * 1.2f;
+      const float step = 1.0f + unit(*rng) * 7.0f;
+      x = std::min(std::max(x + step * std::cos(angle), float{kMinX}),
+                   float{kMaxX});
+      y = std::min(std::max(y + step * std::sin(angle), float{kMinY}),
+                   float{kMaxY});
+    }
+  }
+  return drawing;
+}
+
+// Src/brush.c: the anti-aliased A8 pencil sprite and DMA2D_M2M_BLEND.
+class Framebuffer {
+ public:
+  Framebuffer() : pixels_(kLcdWidth * kLcdHeight, 0xFFFFFFFF) {
+    const int size = 2 * kPencil + 1;
+    const int limit = size * kSubsamples;
+    sprite_.resize(size * size);
+    for (int py = 0; py < size; ++py) {
+      for (int px = 0; px < size; ++px) {
+        int covered = 0;
+        for (int sy = 0; sy < kSubsamples; ++sy) {
+          for (int sx = 0; sx < kSubsamples; ++sx) {
+            const int dx = 2 * (px * kSubsamples + sx) + 1 - size * kSubsamples;
+            const int dy = 2 * (py * kSubsamples + sy) + 1 - size * kSubsamples;
+            if (dx * dx + dy * dy <= limit * limit) ++covered;
+          }
+        }
+        sprite_[py * size + px] =
+            covered * 255 / (kSubsamples * kSubsamples);
+      }
+    }
+  }
+
+  void Stamp(int x, int y, uint32_t color) {
+    const int size = 2 * kPencil + 1;
+    for (int py = 0; py < size; ++py) {
+      for (int px = 0; px < size; ++px) {
+        const uint32_t alpha = sprite_[py * size + px];
+        uint32_t& pixel =
+            pixels_[(y - kPencil + py) * kLcdWidth + (x - kPencil + px)];
+        uint32_t blended = 0xFF000000;
+        for (int shift = 0; shift < 24; shift += 8) {
+          const uint32_t fg = (color >> shift) & 0xFF;
+          const uint32_t bg = (pixel >> shift) & 0xFF;
+          blended |= ((fg * alpha + bg * (255 - alpha) + 127) / 255) << shift;
+        }
+        pixel = blended;
+      }
+    }
+  }
+
+  // check_touch() and draw_segment() of main.cc.
+  void Draw(const std::vector<Stroke>& drawing) {
+    for (const Stroke& stroke : drawing) {
+      Stamp(stroke.points[0].x, stroke.points[0].y, stroke.color);
+      for (size_t i = 1; i < stroke.points.size(); ++i) {
+        const Point& p0 = stroke.points[i - 1];
+        const Point& p1 = stroke.points[i];
+        const int dx = p1.x - p0.x;
+        const int dy = p1.y - p0.y;
+        const int length = std::max(std::abs(dx), std::abs(dy));
+        const int steps = (length + (kPencil / 2) - 1) / (kPencil / 2);
+        for (int s = 1; s <= steps; ++s) {
+          Stamp(p0.x + (dx * s) / steps, p0.y + (dy * s) / steps, stroke.color);
+        }
+      }
+    }
+  }
+
+  uint32_t At(int x, int y) const { return pixels_[y * kLcdWidth + x]; }
+
+ private:
+  std::vector<uint32_t> pixels_;
+  std::vector<uint8_t> sprite_;
+};
+
+// prepare_working_window, rgb2gray, resize_bilnear and update_tensor_input.
+void PixelPipeline(const Framebuffer& framebuffer, int32_t zero_point,
+                   int8_t* input) {
+  // The window is copied bottom up from LCD row 166, into working row 160,
+  // so working row r holds LCD row r + 6 and row 0 keeps the 0xFF fill.
+  std::vector<uint8_t> working(kWorkingSide * kWorkingSide * 3, 0xFF);
+  for (int r = 1; r < kWorkingSide; ++r) {
+    for (int c = 0; c < kWorkingSide; ++c) {
+      const uint32_t pixel = framebuffer.At(kWindowX + c, kWindowY + r);
+      // RGB888 in memory is B, G, R; rgb2gray reads it as r, g, b.
+      working[(r * kWorkingSide + c) * 3 + 0] = pixel & 0xFF;
+      working[(r * kWorkingSide + c) * 3 + 1] = (pixel >> 8) & 0xFF;
+      working[(r * kWorkingSide + c) * 3 + 2] = (pixel >> 16) & 0xFF;
+    }
+  }
+
+  std::vector<uint8_t> gray(kWorkingSide * kWorkingSide);
+  for (int offset = 0; offset < kWorkingSide * kWorkingSide; ++offset) {
+    const float r = working[offset * 3];
+    const float g = working[offset * 3 + 1];
+    const float b = working[offset * 3 + 2];
+    const float l = 0.2126 * r + 0.7152 * g + 0.0722 * b;
+    // The firmware's float to uint8_t conversion saturates at 0.
+    gray[offset] = static_cast<uint8_t>(std::max(255 - l, 0.0f));
+  }
+
+  const float x_ratio = static_cast<float>(kWorkingSide - 1) / kImageSide;
+  const float y_ratio = static_cast<float>(kWorkingSide - 1) / kImageSide;
+  for (int i = 0; i < kImageSide; ++i) {
+    for (int j = 0; j < kImageSide; ++j) {
+      const uint32_t x = static_cast<int>(x_ratio * j);
+      const uint32_t y = static_cast<int>(y_ratio * i);
+      const float x_diff = (x_ratio * j) - x;
+      const float y_diff = (y_ratio * i) - y;
+      const uint32_t index = y * kWorkingSide + x;
+      const uint32_t a = gray[index];
+      const uint32_t b = gray[index + 1];
+      const uint32_t c = gray[index + kWorkingSide];
+      const uint32_t d = gray[index + kWorkingSide + 1];
+      const uint8_t value = static_cast<int>(
+          a * (1 - x_diff) * (1 - y_diff) + b * (x_diff) * (1 - y_diff) +
+          c * (y_diff) * (1 - x_diff) + d * (x_diff * y_diff));
+      input[i * kImageSide + j] = static_cast<int8_t>(value + zero_point);
+    }
+  }
+}
+
+void VectorPipeline(const std::vector<Stroke>& drawing, int32_t zero_point,
+                    int8_t* input) {
+  stroke_clear();
+  for (const Stroke& stroke : drawing) {
+    stroke_start(stroke.points[0].x, stroke.points[0].y, stroke.color);
+    for (size_t i = 1; i < stroke.points.size(); ++i) {
+      stroke_continue(stroke.points[i].x, stroke.points[i].y);
+    }
+  }
+  stroke_rasterize(input, kImageSide, kImageSide, zero_point);
+}
+
+int TopPrediction(tflite::MicroInterpreter* interpreter, const int8_t* input) {
+  memcpy(interpreter->input(0)->data.int8, input, kImageSize);
+  if (interpreter->Invoke() != kTfLiteOk) return -1;
+  const int8_t* outputs = interpreter->output(0)->data.int8;
+  int top = 0;
+  for (int i = 1; i < kNumberOfOutputs; ++i) {
+    if (outputs[i] > outputs[top]) top = i;
+  }
+  return top;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* model_path = nullptr;
+  int count = 1000;
+  double max_mean = 1.0;
+  double min_agree = 95.0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+      model_path = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--max-mean") == 0 && i + 1 < argc) {
+      max_mean = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--min-agree") == 0 && i + 1 < argc) {
+      min_agree = atof(argv[++i]);
+    } else {
+      count = 0;
+      break;
+    }
+  }
+  if (count <= 0) {
+    fprintf(stderr,
+            "Usage: %s [--model <model.tflite>] [--count <n>] "
+            "[--max-mean <int8 steps>] [--min-agree <percent>]\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::vector<uint8_t> flatbuffer;
+  tflite::MicroMutableOpResolver<4> resolver;
+  std::vector<uint8_t> arena(kArenaSize);
+  std::unique_ptr<tflite::MicroInterpreter> interpreter;
+  int32_t zero_point = kInputZeroPoint;
+  if (model_path != nullptr) {
+    flatbuffer = LoadFile(model_path);
+    flatbuffers::Verifier verifier(flatbuffer.data(), flatbuffer.size());
+    if (!tflite::VerifyModelBuffer(verifier)) {
+      fprintf(stderr, "%s is not a valid model\n", model_path);
+      return 1;
+    }
+    resolver.AddConv2D();
+    resolver.AddMaxPool2D();
+    resolver.AddFullyConnected();
+    resolver.AddReshape();
+    interpreter = std::make_unique<tflite::MicroInterpreter>(
+        tflite::GetModel(flatbuffer.data()), resolver, arena.data(),
+        kArenaSize);
+    if (interpreter->AllocateTensors() != kTfLiteOk ||
+        interpreter->input(0)->bytes != kImageSize) {
+      fprintf(stderr, "%s: not a 28x28 int8 classifier\n", model_path);
+      return 1;
+    }
+    zero_point = interpreter->input(0)->params.zero_point;
+  }
+
+  stroke_init(kPencil, kWindowX, kWindowY, kWorkingSide, kWorkingSide);
+
+  std::mt19937 rng(1);
+  std::vector<int> histogram(256, 0);
+  double total_difference = 0;
+  int max_difference = 0;
+  int agree = 0;
+  double shifted_difference = 0;
+  int shifted_agree = 0;
+  double pixel_us = 0;
+  double vector_us = 0;
+  for (int n = 0; n < count; ++n) {
+    const std::vector<Stroke> drawing = MakeDrawing(&rng);
+    int8_t pixel_input[kImageSize];
+    int8_t vector_input[kImageSize];
+    int8_t shifted_input[kImageSize];
+
+    Framebuffer framebuffer;
+    framebuffer.Draw(drawing);
+    auto start = std::chrono::steady_clock::now();
+    PixelPipeline(framebuffer, zero_point, pixel_input);
+    auto middle = std::chrono::steady_clock::now();
+    VectorPipeline(drawing, zero_point, vector_input);
+    auto end = std::chrono::steady_clock::now();
+    pixel_us += std::chrono::duration<double, std::micro>(middle - start).count();
+    vector_us += std::chrono::duration<double, std::micro>(end - middle).count();
+
+    std::vector<Stroke> shifted = drawing;
+    for (Stroke& stroke : shifted) {
+      for (Point& point : stroke.points) ++point.x;
+    }
+    Framebuffer shifted_framebuffer;
+    shifted_framebuffer.Draw(shifted);
+    PixelPipeline(shifted_framebuffer, zero_point, shifted_input);
+
+    for (int i = 0; i < kImageSize; ++i) {
+      const int difference = std::abs(pixel_input[i] - vector_input[i]);
+      ++histogram[difference];
+      total_difference += difference;
+      max_difference = std::max(max_difference, difference);
+      shifted_difference += std::abs(pixel_input[i] - shifted_input[i]);
+    }
+    if (interpreter != nullptr) {
+      const int pixel_top = TopPrediction(interpreter.get(), pixel_input);
+      agree += pixel_top == TopPrediction(interpreter.get(), vector_input);
+      shifted_agree +=
+          pixel_top == TopPrediction(interpreter.get(), shifted_input);
+    }
+  }
+
+  const double mean = total_difference / (static_cast<double>(count) * kImageSize);
+  int p99 = 0;
+  for (long seen = 0; p99 < 255; ++p99) {
+    seen += histogram[p99];
+    if (seen >= 0.99 * count * kImageSize) break;
+  }
+  printf("%d random drawings, input difference in int8 steps: mean %.3f, "
+         "p99 %d, max %d\n",
+         count, mean, p99, max_difference);
+  printf("pixel pipeline moved by one pixel: mean %.3f\n",
+         shifted_difference / (static_cast<double>(count) * kImageSize));
+  printf("host time per input: pixel pipeline %.1f us, vector %.1f us\n",
+         pixel_us / count, vector_us / count);
+  bool pass = mean <= max_mean;
+  if (interpreter != nullptr) {
+    const double agreement = 100.0 * agree / count;
+    printf("top-1 agreement %.2f%% (moved by one pixel %.2f%%)\n", agreement,
+           100.0 * shifted_agree / count);
+    pass = pass && agreement >= min_agree;
+  }
+  printf("%s\n", pass ? "PASS" : "FAIL");
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/* Copyright 2023 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool: runs the kernel autotuner (micro_kernel_tuner.h) on a model and
+// prints, for every int8 CONV_2D layer, the time of each implementation legal
+// for it and the one selected. The outputs of the tuned model are compared
+// with those of the untuned one on random inputs, and the table can be
+// written out as a C header.
+//
+// Host timings only say which implementation wins on the host; the firmware
+// (KERNEL_AUTOTUNE in Src/main.cc) tunes on the target itself.
+//
+// Build against the TFLM sources of this tree, compiled for the host with
+// -DTF_LITE_STATIC_MEMORY -DCMSIS_NN, without a micro_time.cc (this file
+// provides the clock), and run:
+//   ./tune_kernels model_int8.tflite [--runs 50] [--header kernel_table.h]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/micro/kernels/kernel_tuning.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_kernel_tuner.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Nanoseconds; the tuner only takes differences, which survive the wrap.
+uint32_t ticks_per_second() { return 1000000000U; }
+
+uint32_t GetCurrentTimeTicks() {
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+}  // namespace tflite
+
+namespace {
+
+constexpr size_t kArenaSize = 256 * 1024;
+constexpr int kCompareRuns = 100;
+
+std::vector<uint8_t> LoadFile(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+}
+
+void AddOps(tflite::MicroMutableOpResolver<7>* resolver) {
+  resolver->AddConv2D();
+  resolver->AddMaxPool2D();
+  resolver->AddFullyConnected();
+  resolver->AddReshape();
+  resolver->AddPalettizedConv2D();
+  resolver->AddPalettizedFullyConnected();
+  resolver->AddPatchStage();
+}
+
+// Counts the random inputs on which the model gives different outputs with
+// and without `table`.
+int CountMismatches(const tflite::Model* model,
+                    const tflite::MicroOpResolver& resolver, uint8_t* arena,
+                    const tflite::KernelTuningTable* table) {
+  tflite::MicroInterpreter plain(model, resolver, arena, kArenaSize / 2);
+  tflite::SetKernelTuningTable(table);
+  tflite::MicroInterpreter tuned(model, resolver, arena + kArenaSize / 2,
+                                 kArenaSize / 2);
+  const bool allocated =
+      plain.AllocateTensors() == kTfLiteOk && tuned.AllocateTensors() == kTfLiteOk;
+  tflite::SetKernelTuningTable(nullptr);
+  if (!allocated) {
+    return -1;
+  }
+  std::mt19937 rng(1);
+  int mismatches = 0;
+  for (int run = 0; run < kCompareRuns; ++run) {
+    TfLiteTensor* input = plain.input(0);
+    for (size_t i = 0; i < input->bytes; ++i) {
+      input->data.uint8[i] = static_cast<uint8_t>(rng());
+    }
+    memcpy(tuned.input(0)->data.raw, input->data.raw, input->bytes);
+    if (plain.Invoke() != kTfLiteOk || tuned.Invoke() != kTfLiteOk) {
+      return -1;
+    }
+    if (memcmp(plain.output(0)->data.raw, tuned.output(0)->data.raw,
+               plain.output(0)->bytes) != 0) {
+      ++mismatches;
+    }
+  }
+  return mismatches;
+}
+
+bool WriteHeader(const char* path, const tflite::KernelTuningTable& table) {
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file,
+          "/* Generated by tools/tune_kernels.cc, for the model with hash "
+          "0x%08X. */\n\n",
+          table.model_hash);
+  fprintf(file, "const tflite::KernelTuningTable kernel_tuning_table = {\n");
+  fprintf(file, "\t0x%08XU, 0x%08XU, %uU,\n\t{\n", table.magic,
+          table.model_hash, table.entry_count);
+  for (uint32_t i = 0; i < table.entry_count; ++i) {
+    fprintf(file, "\t\t{0x%08XU, %uU},\t/* %s */\n",
+            table.entries[i].layer_key, table.entries[i].kernel,
+            tflite::ConvKernelName(
+                static_cast<tflite::ConvKernel>(table.entries[i].kernel)));
+  }
+  fprintf(file, "\t}\n};\n");
+  return fclose(file) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* model_path = nullptr;
+  const char* header_path = nullptr;
+  int runs = 50;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+      runs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--header") == 0 && i + 1 < argc) {
+      header_path = argv[++i];
+    } else {
+      model_path = argv[i];
+    }
+  }
+  if (model_path == nullptr || runs < 1) {
+    fprintf(stderr,
+            "Usage: %s model.tflite [--runs 50] [--header kernel_table.h]\n",
+            argv[0]);
+    return 1;
+  }
+
+  const std::vector<uint8_t> flatbuffer = LoadFile(model_path);
+  flatbuffers::Verifier verifier(flatbuffer.data(), flatbuffer.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", model_path);
+    return 1;
+  }
+  const tflite::Model* model = tflite::GetModel(flatbuffer.data());
+  tflite::MicroMutableOpResolver<7> resolver;
+  AddOps(&resolver);
+  std::vector<uint8_t> arena(kArenaSize);
+
+  tflite::KernelTuningTable table;
+  tflite::KernelTuningReport report;
+  const uint32_t model_hash =
+      tflite::KernelTuningHash(flatbuffer.data(), flatbuffer.size());
+  if (tflite::TuneKernels(model, model_hash, resolver, arena.data(),
+                          arena.size(), runs, &table, &report) != kTfLiteOk) {
+    fprintf(stderr, "%s: tuning failed\n", model_path);
+    return 1;
+  }
+
+  printf("%-6s %-10s", "layer", "key");
+  for (uint32_t k = 0; k < tflite::kConvKernelCount; ++k) {
+    printf(" %21s", tflite::ConvKernelName(static_cast<tflite::ConvKernel>(k)));
+  }
+  printf("  selected\n");
+  for (int i = 0; i < report.layer_count; ++i) {
+    printf("%-6d 0x%08X", i, report.layers[i].layer_key);
+    for (uint32_t k = 0; k < tflite::kConvKernelCount; ++k) {
+      if ((report.layers[i].legal_kernels & (1U << k)) == 0) {
+        printf(" %21s", "-");
+      } else {
+        printf(" %18.1fus", report.ticks[i][k] / 1000.0);
+      }
+    }
+    printf("  %s\n", tflite::ConvKernelName(report.selected[i]));
+  }
+
+  const int mismatches =
+      CountMismatches(model, resolver, arena.data(), &table);
+  if (mismatches < 0) {
+    fprintf(stderr, "%s: comparison run failed\n", model_path);
+    return 1;
+  }
+  printf("%d of %d random inputs differ with the table\n", mismatches,
+         kCompareRuns);
+
+  if (header_path != nullptr && !WriteHeader(header_path, table)) {
+    fprintf(stderr, "Couldn't write %s\n", header_path);
+    return 1;
+  }
+  return mismatches == 0 ? 0 : 1;
+}